@@ -326,6 +326,34 @@ RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictiona
  */
 RSSL_API RsslRet rsslDictionaryEntryGetEnumValueByDisplayString(const RsslDictionaryEntry *pEntry, const RsslBuffer *pEnumDisplay, RsslEnum *pEnumValue, RsslBuffer *errorText);
 
+/**
+ * @brief Writes a loaded data dictionary to a binary dictionary file, which rsslLoadBinaryDataDictionary() can load without parsing.
+ * The dictionary may have been loaded from files (see rsslLoadFieldDictionary(), rsslLoadEnumTypeDictionary()) or decoded from the network
+ * (see rsslDecodeFieldDictionary(), rsslDecodeEnumTypeDictionary()).
+ * The file holds the dictionary's structures as they are laid out in memory, so it can only be loaded by a build with the same structure
+ * layout (the same pointer size and byte order); the loader checks this.
+ * @param filename Name of the file to write.
+ * @param pDictionary The dictionary to write.
+ * @param errorText Buffer to hold error text if writing fails.
+ * @return RSSL_RET_SUCCESS if the file was written, RSSL_RET_FAILURE otherwise.
+ * @see RsslDataDictionary, rsslLoadBinaryDataDictionary
+ */
+RSSL_API RsslRet rsslSaveBinaryDataDictionary(const char *filename, RsslDataDictionary *pDictionary, RsslBuffer *errorText);
+
+/**
+ * @brief Loads a data dictionary from a binary dictionary file written by rsslSaveBinaryDataDictionary().
+ * The file is memory-mapped and the dictionary refers to it in place, so loading does not parse or copy the dictionary, and pages of the
+ * file that are only read (such as the acronyms and enumerated type strings) are shared by all processes that load it.
+ * The loaded dictionary is read-only: it cannot be added to by rsslLoadFieldDictionary(), rsslLoadEnumTypeDictionary(), rsslDecodeFieldDictionary()
+ * or rsslDecodeEnumTypeDictionary(), or linked by rsslLinkDataDictionary().  rsslDeleteDataDictionary() unmaps the file.
+ * @param filename Name of the binary dictionary file.
+ * @param pDictionary The dictionary to load. Must not already be initialized.
+ * @param errorText Buffer to hold error text if loading fails.
+ * @return RSSL_RET_SUCCESS if the dictionary was loaded, RSSL_RET_FAILURE otherwise.
+ * @see RsslDataDictionary, rsslSaveBinaryDataDictionary
+ */
+RSSL_API RsslRet rsslLoadBinaryDataDictionary(const char *filename, RsslDataDictionary *pDictionary, RsslBuffer *errorText);
+
 /*
  * @brief For internal use only. Matches fields of two dictionaries, then reuses the allocated RsslDictionaryEntry objects of the old dictionary.
  * The two dictionaries will share their RsslDictionaryEntry objects and the respective RsslEnumTypeTable objects.
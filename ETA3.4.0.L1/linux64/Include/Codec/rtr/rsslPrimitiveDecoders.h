@@ -213,6 +213,22 @@ RSSL_API RsslRet rsslDecodeReal(
 					RsslDecodeIterator *pIter,
 					RsslReal *value );
 
+/**
+ * @brief Decode an array of encoded RsslReal values (such as the RsslFieldEntry::encData of ::RSSL_DT_REAL entries) and convert them to doubles
+ * Each value is decoded as rsslDecodeReal() would decode it, then converted as rsslRealsToDoubles() converts it.
+ * @param oValues Array of count doubles to populate.
+ * @param oIsBlank Optional array of count RsslBool, each populated with RSSL_TRUE if the value was blank.
+ * @param iEncReals Array of count buffers holding encoded RsslReal content.
+ * @param count Number of values to convert.
+ * @return ::RSSL_RET_SUCCESS if success, ::RSSL_RET_INVALID_DATA if any value could not be decoded or had an invalid hint (its double is NaN).  All values are converted in either case.
+ * @see rsslRealsToDoubles
+ */
+RSSL_API RsslRet rsslDecodeRealsToDoubles(
+					RsslDouble *oValues,
+					RsslBool *oIsBlank,
+					const RsslBuffer *iEncReals,
+					RsslUInt32 count );
+
 /**
  *	@}
  */
@@ -311,6 +327,22 @@ RSSL_API RsslRet rsslDecodeDateTime(
 					RsslDecodeIterator *pIter,
 					RsslDateTime *value);
 
+/**
+ * @brief Decode an array of encoded RsslDateTime values (such as the RsslFieldEntry::encData of ::RSSL_DT_DATETIME entries) and convert them to nanoseconds since the epoch
+ * Each value is decoded as rsslDecodeDateTime() would decode it, then converted as rsslDateTimesToEpochNanos() converts it.
+ * @param oNanos Array of count values to populate.
+ * @param oIsBlank Optional array of count RsslBool, each populated with RSSL_TRUE if the value was blank.
+ * @param iEncDateTimes Array of count buffers holding encoded RsslDateTime content.
+ * @param count Number of values to convert.
+ * @return ::RSSL_RET_SUCCESS if success, ::RSSL_RET_INVALID_DATA if any value could not be decoded or converted (its result is 0).  All values are converted in either case.
+ * @see rsslDateTimesToEpochNanos
+ */
+RSSL_API RsslRet rsslDecodeDateTimesToEpochNanos(
+					RsslInt64 *oNanos,
+					RsslBool *oIsBlank,
+					const RsslBuffer *iEncDateTimes,
+					RsslUInt32 count );
+
 /**
  *	@}
  */
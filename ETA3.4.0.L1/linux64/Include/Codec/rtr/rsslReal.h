@@ -253,6 +253,21 @@ RSSL_API RsslRet rsslFloatToReal(RsslReal * oReal, RsslFloat * iValue, RsslUInt8
  */
 RSSL_API RsslRet rsslRealToDouble(RsslDouble * oValue, RsslReal * iReal);
 
+/**
+ * @brief Convert an array of RsslReal to doubles
+ *
+ * Exponent hints are applied with an exact power of ten (dividing for negative exponents), so each result is the correctly rounded
+ * value (when RsslReal::value is within +/-2<sup>53</sup>); rsslRealToDouble() may differ from it in the last bit.
+ * ::RSSL_RH_INFINITY, ::RSSL_RH_NEG_INFINITY and ::RSSL_RH_NOT_A_NUMBER convert to infinity, negative infinity and NaN. Blank values convert to NaN.
+ * @param oValues Array of count doubles to populate.
+ * @param oIsBlank Optional array of count RsslBool, each populated with RSSL_TRUE if the RsslReal was blank.
+ * @param iReals Array of count RsslReal to convert.
+ * @param count Number of values to convert.
+ * @return Returns ::RSSL_RET_SUCCESS if successful; ::RSSL_RET_INVALID_DATA if any RsslReal had an invalid hint (its double is NaN).  All values are converted in either case.
+ * @see rsslRealToDouble, rsslDecodeRealsToDoubles
+ */
+RSSL_API RsslRet rsslRealsToDoubles(RsslDouble *oValues, RsslBool *oIsBlank, const RsslReal *iReals, RsslUInt32 count);
+
 /**
  * @brief Convert numeric string to double
  * @param oValue double to convert into
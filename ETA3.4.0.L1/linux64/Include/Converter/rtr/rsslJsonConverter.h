@@ -0,0 +1,150 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_JSON_CONVERTER_H
+#define __RSSL_JSON_CONVERTER_H
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslRetCodes.h"
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMessagePackage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RsslJsonConverter
+ * @{
+ */
+
+/**
+ * @brief Converts RWF messages to JSON text and back, without building a document in memory.
+ *
+ * A message is written as a JSON object.  Its header members come first, starting with "Type", then "Key", and
+ * last its payload, named by the payload's container type, e.g.<BR>
+ * {"Type":"Refresh","ID":5,"Domain":"MarketPrice","SeqNumber":12,"State":{"Stream":"Open","Data":"Ok","Code":"None","Text":"All is well"},
+ * "Solicited":true,"Complete":true,"Key":{"Service":1,"Name":"TRI.N"},"FieldList":{"BID":45.55,"ASK":45.57,"DSPLY_NAME":"THOMSON REUTERS"}}<BR>
+ *
+ * RsslFieldList entries are named by the dictionary acronym of their field; entries whose field is not in the dictionary are left out.
+ * RsslElementList entries are written as "Name":{"Type":"UInt","Data":1}.  RsslMap, RsslVector and RsslSeries are objects with
+ * "KeyType" (RsslMap only), "ContainerType", "CountHint", "Summary" and "Entries", in that order, and each entry has "Action", "Key"
+ * or "Index", and "Data".  RsslReal values are exact decimal numbers, dates and times are ISO 8601 strings, RsslBuffer values are base64
+ * and blank values are null.
+ *
+ * The JSON to RWF direction reads the same form, encoding as it goes, so a message's header members must come before its payload and
+ * "Type" must be its first member.  Permission data, group ids, extended headers and set-defined data are not converted;
+ * set-defined entries are written as standard entries.
+ * @see rsslJsonConverterCreate, rsslJsonConverterMsgToJson, rsslJsonConverterJsonToMsg
+ */
+typedef void* RsslJsonConverterHandle;
+
+/**
+ * @brief Defines the size of the string text[] in \ref RsslJsonConverterError
+ */
+#define MAX_JSON_CONVERTER_ERROR_TEXT 255
+
+/**
+ * @brief Error structure passed to the JSON converter functions.
+ * Populated with information if an error occurs during the function call.
+ */
+typedef struct
+{
+	RsslRet			rsslErrorId;	/*!< The RSSL error code */
+	char			text[MAX_JSON_CONVERTER_ERROR_TEXT + 1]; /*!< Additional information about the error */
+} RsslJsonConverterError;
+
+/**
+ * @brief Clears the RsslJsonConverterError structure
+ * @see RsslJsonConverterError
+ */
+RTR_C_INLINE void rsslJsonConverterErrorClear(RsslJsonConverterError *pError)
+{
+	if (pError)
+	{
+		pError->rsslErrorId = RSSL_RET_SUCCESS;
+		pError->text[0] = '\0';
+	}
+}
+
+/**
+ * @brief Options used when creating a JSON converter.
+ * @see rsslJsonConverterCreate
+ */
+typedef struct {
+	RsslDataDictionary	*pDictionary;	/*!< Dictionary used to name RsslFieldList entries and to find the type of each named entry.  Must stay loaded while the converter is in use. */
+	RsslUInt32			bufferSize;		/*!< Initial size of the converter's JSON buffer.  The buffer grows as needed and is reused by each conversion. */
+} RsslJsonConverterOptions;
+
+/**
+ * @brief Static initializer for RsslJsonConverterOptions
+ * @see RsslJsonConverterOptions, rsslClearJsonConverterOptions
+ */
+#define RSSL_INIT_JSON_CONVERTER_OPTIONS { 0, 4096 }
+
+/**
+ * @brief Clears an RsslJsonConverterOptions
+ * @see RsslJsonConverterOptions, RSSL_INIT_JSON_CONVERTER_OPTIONS
+ */
+RTR_C_INLINE void rsslClearJsonConverterOptions(RsslJsonConverterOptions *pOptions)
+{
+	pOptions->pDictionary = 0;
+	pOptions->bufferSize = 4096;
+}
+
+/**
+ * @brief Creates a JSON converter.
+ * A converter may be used by one thread at a time.
+ * @param pOptions Options for the converter.
+ * @param pError Error information populated if this function fails.
+ * @return The handle to the converter, or NULL if it could not be created.
+ * @see RsslJsonConverterOptions, rsslJsonConverterDestroy
+ */
+RSSL_API RsslJsonConverterHandle rsslJsonConverterCreate(const RsslJsonConverterOptions *pOptions, RsslJsonConverterError *pError);
+
+/**
+ * @brief Destroys a JSON converter.
+ * @param handle The converter to destroy.
+ * @see rsslJsonConverterCreate
+ */
+RSSL_API void rsslJsonConverterDestroy(RsslJsonConverterHandle handle);
+
+/**
+ * @brief Writes a decoded message and its payload as JSON.
+ * @param handle The converter.
+ * @param pIter The decode iterator the message was decoded with by rsslDecodeMsg().  It is used to decode the payload.
+ * @param pMsg The decoded message.
+ * @param pJsonBuffer Set to the JSON text, which is held by the converter and is valid until its next call.  The text is null terminated.
+ * @param pError Error information populated if this function fails.
+ * @return RSSL_RET_SUCCESS, or the failing RsslRet from decoding the payload.  RSSL_RET_UNSUPPORTED_DATA_TYPE if the payload contains a type that cannot be converted.
+ * @see rsslJsonConverterJsonToMsg
+ */
+RSSL_API RsslRet rsslJsonConverterMsgToJson(RsslJsonConverterHandle handle, RsslDecodeIterator *pIter, RsslMsg *pMsg,
+							RsslBuffer *pJsonBuffer, RsslJsonConverterError *pError);
+
+/**
+ * @brief Encodes a JSON message, as written by rsslJsonConverterMsgToJson(), with an encode iterator.
+ * @param handle The converter.
+ * @param pJsonBuffer The JSON text of one message.
+ * @param pIter The encode iterator, set to the buffer to encode into and its RWF version.  After success, rsslGetEncodedBufferLength() gives the length of the message.
+ * @param pError Error information populated if this function fails.
+ * @return RSSL_RET_SUCCESS, RSSL_RET_INVALID_DATA if the JSON cannot be parsed or is not a message, or the failing RsslRet from encoding the message, e.g. RSSL_RET_BUFFER_TOO_SMALL.
+ * @see rsslJsonConverterMsgToJson
+ */
+RSSL_API RsslRet rsslJsonConverterJsonToMsg(RsslJsonConverterHandle handle, const RsslBuffer *pJsonBuffer, RsslEncodeIterator *pIter,
+							RsslJsonConverterError *pError);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -12,6 +12,7 @@
   * 
   * Overview of usage:
   * - rsslCreateNotifier creates an RsslNotifier that can wait on file descriptors.
+  *     rsslCreateNotifierEx does the same, but allows the notification mechanism to be selected (see RsslNotifierType).
   * - rsslCreateNotifierEvent creates an RsslNotifierEvent, associated with a file descriptor.
   * - rsslNotifierAddEvent adds the RsslNotifierEvent to the RsslNotifier.
   * - rsslNotifierRegisterRead/rsslNotifierRegisterWrite enable read/write notification for the RsslNotifierEvent.
@@ -67,7 +68,8 @@ RTR_C_INLINE int rsslNotifierEventIsWritable(RsslNotifierEvent *pEvent)
 
 /* Indicates whether the event's file descriptor may be invalid.  The event may need its associated FD to be updated.
  *   Note: When the notifier uses select for notification, this will be set on every descriptor when
- *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events. */
+ *   it sees the EBADF error. When the notifier uses poll, it will be set only on appropriate events.
+ *   When the notifier uses epoll, it is never set, as closed descriptors leave the epoll set. */
 RTR_C_INLINE int rsslNotifierEventIsFdBad(RsslNotifierEvent *pEvent)
 {
 	return pEvent->notifiedFlags & RSSL_NESF_BAD_FD;
@@ -96,17 +98,31 @@ typedef struct
 	int					notifiedEventCount;
 } RsslNotifier;
 
+/* Mechanisms an RsslNotifier may use to wait for notification. */
+typedef enum
+{
+	RSSL_NOTIFIER_TYPE_DEFAULT = 0,	/* Platform default: poll, or select on Windows. The cost of each wait scales with the number of associated events. */
+	RSSL_NOTIFIER_TYPE_EPOLL = 1	/* Level-triggered epoll. The cost of each wait scales with the number of notified events.
+									 * Only available on Linux; other platforms use the default. */
+} RsslNotifierType;
+
 /* Initializes an RsslNotifier. 
  * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance. */
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint);
 
+/* Initializes an RsslNotifier that uses the given notification mechanism.
+ * - maxEventsHint: The likely max number of associated events. Setting appropriately may improve performance.
+ * - notifierType: The notification mechanism to use. See RsslNotifierType. */
+RSSL_API RsslNotifier *rsslCreateNotifierEx(int maxEventsHint, RsslNotifierType notifierType);
+
 /* Cleans up resources associated with an RsslNotifier. */
 RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier);
 
 /* Adds an RsslNotifierEvent to the RsslNotifier. */
 RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent, RsslSocket fd, void *object);
 
-/* Removes an RsslNotifierEvent from the RsslNotifier. */
+/* Removes an RsslNotifierEvent from the RsslNotifier.  The event's descriptor may already be closed, even if its number
+ * has since been reused for a descriptor added with another event; that event's notification is not affected. */
 RSSL_API int rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pEvent);
 
 /* Updates the descriptor associated with an event.  The previous descriptor must already be closed. */
@@ -0,0 +1,375 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+/* Implements an open-addressing hash table with the same interface as RsslHashTable.
+ *
+ * Elements are still found through the RsslHashLink embedded in each object, but the table
+ * itself is a flat array of slots holding each element's hash sum next to its link, so a
+ * lookup compares hash sums in one cache line and only calls the compare function on a match.
+ * Collisions are resolved by Robin Hood linear probing, and removals shift the following
+ * slots back instead of leaving tombstones.
+ *
+ * When the table grows, elements are moved to the larger array a few slots at a time as
+ * elements are added and removed, rather than all at once; until then lookups check both. */
+
+#ifndef RSSL_OPEN_HASH_TABLE_H
+#define RSSL_OPEN_HASH_TABLE_H
+
+#include "rtr/rsslHashTable.h"
+#include <string.h>
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Slots moved to the new array on each insert or removal while the table is growing. */
+#define RSSL_OPEN_HASH_MIGRATE_SLOTS 8
+
+/* Smallest array allocated. */
+#define RSSL_OPEN_HASH_MIN_SLOTS 16
+
+/* A slot in the table. */
+typedef struct
+{
+	RsslHashLink	*pLink;		/* Element in this slot, or NULL if empty. */
+	RsslUInt32		hashSum;	/* Element's hash sum. */
+	RsslUInt32		distance;	/* How far this slot is from the element's preferred slot.
+								 * In an array being migrated, RSSL_OPEN_HASH_REMOVED marks an
+								 * element removed before it was moved. */
+} RsslOpenHashSlot;
+
+#define RSSL_OPEN_HASH_REMOVED 0xffffffff
+
+/* An array of slots. */
+typedef struct
+{
+	RsslOpenHashSlot	*slots;
+	RsslUInt32			mask;		/* Number of slots, minus one. */
+	RsslUInt32			shift;		/* Shift that turns a mixed hash sum into a slot index. */
+} RsslOpenHashArray;
+
+/* Open-addressing hash table structure. */
+typedef struct {
+	RsslOpenHashArray		array;				/* Array that elements are added to. */
+	RsslOpenHashArray		oldArray;			/* Array being emptied into the current one after growing,
+												 * if slots is not NULL. */
+	RsslUInt32				migrateIndex;		/* Slots of oldArray before this have been moved. */
+	RsslUInt32				elementCount;
+	RsslUInt32				thresholdCapacity;	/* Element count at which the table grows. */
+	RsslBool				dynamicSize;
+	RsslHashSumFunction		*keyHashFunction;
+	RsslHashCompareFunction	*keyCompareFunction;
+} RsslOpenHashTable;
+
+/* Initializes a hash table. queueCount is the number of elements expected, and is kept for
+ * compatibility with rsslHashTableInit. */
+RTR_C_INLINE RsslRet rsslOpenHashTableInit(RsslOpenHashTable *pTable, RsslUInt32 queueCount,
+		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
+		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo);
+
+/* Cleans up a hash table. */
+RTR_C_INLINE RsslRet rsslOpenHashTableCleanup(RsslOpenHashTable *pTable);
+
+/* Add an element to the hash table. Returns RSSL_RET_FAILURE if the table is full and could not
+ * be grown, in which case the element is not added. */
+RTR_C_INLINE RsslRet rsslOpenHashTableInsertLink(RsslOpenHashTable *pTable, RsslHashLink *pLink,
+		void *pKey, RsslUInt32 *pSum);
+
+/* Remove an element from a hash table. */
+RTR_C_INLINE void rsslOpenHashTableRemoveLink(RsslOpenHashTable *pTable, RsslHashLink *pLink);
+
+/* Find an element in the hash table that matches the given key. */
+RTR_C_INLINE RsslHashLink *rsslOpenHashTableFind(RsslOpenHashTable *pTable, void *pKey, RsslUInt32 *pSum);
+
+/* Preferred slot of a hash sum.  The sum is mixed first (Fibonacci hashing), since many sum
+ * functions (e.g. rsslHashU32Sum) return the key itself. */
+RTR_C_INLINE RsslUInt32 rsslOpenHashArrayIndex(RsslOpenHashArray *pArray, RsslUInt32 hashSum)
+{
+	return (RsslUInt32)((hashSum * 2654435769U) >> pArray->shift) & pArray->mask;
+}
+
+RTR_C_INLINE RsslRet rsslOpenHashArrayInit(RsslOpenHashArray *pArray, RsslUInt32 slotCount)
+{
+	RsslUInt32 bits = 0;
+
+	while (((RsslUInt32)1 << bits) < slotCount)
+		++bits;
+
+	if (bits >= 31) /* overflow */
+		return RSSL_RET_FAILURE;
+
+	pArray->slots = (RsslOpenHashSlot*)calloc((size_t)1 << bits, sizeof(RsslOpenHashSlot));
+	if (!pArray->slots)
+		return RSSL_RET_FAILURE;
+
+	pArray->mask = ((RsslUInt32)1 << bits) - 1;
+	pArray->shift = 32 - bits;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Adds an element to an array. The array must have an empty slot. */
+RTR_C_INLINE void rsslOpenHashArrayInsert(RsslOpenHashArray *pArray, RsslHashLink *pLink,
+		RsslUInt32 hashSum)
+{
+	RsslOpenHashSlot entry;
+	RsslUInt32 index = rsslOpenHashArrayIndex(pArray, hashSum);
+
+	entry.pLink = pLink;
+	entry.hashSum = hashSum;
+	entry.distance = 0;
+
+	for(;;)
+	{
+		RsslOpenHashSlot *pSlot = &pArray->slots[index];
+
+		if (!pSlot->pLink)
+		{
+			*pSlot = entry;
+			return;
+		}
+
+		/* Take the slot from an element that is closer to its own preferred slot, then
+		 * continue placing that element instead. */
+		if (pSlot->distance < entry.distance)
+		{
+			RsslOpenHashSlot tmp = *pSlot;
+			*pSlot = entry;
+			entry = tmp;
+		}
+
+		index = (index + 1) & pArray->mask;
+		++entry.distance;
+	}
+}
+
+/* Finds the slot of an element in an array, by key or (if pKey is NULL) by link.
+ * migrateIndex is the number of leading slots already moved out of the array (0 unless it is
+ * the old array of a growing table). */
+RTR_C_INLINE RsslOpenHashSlot *rsslOpenHashArrayFindSlot(RsslOpenHashTable *pTable,
+		RsslOpenHashArray *pArray, RsslUInt32 migrateIndex, void *pKey, RsslHashLink *pLink,
+		RsslUInt32 hashSum)
+{
+	RsslUInt32 index = rsslOpenHashArrayIndex(pArray, hashSum);
+	RsslUInt32 distance = 0;
+
+	for(;;)
+	{
+		RsslOpenHashSlot *pSlot;
+
+		/* Moved slots are empty, but elements past them may have probed through them,
+		 * so skip to the first slot that has not been moved. */
+		if (index < migrateIndex)
+		{
+			distance += migrateIndex - index;
+			index = migrateIndex;
+			if (index > pArray->mask)
+				return NULL;
+		}
+
+		pSlot = &pArray->slots[index];
+
+		/* Robin Hood ordering means the element would have been placed before any empty
+		 * slot or any slot closer to its own preferred slot. */
+		if (!pSlot->pLink || (pSlot->distance != RSSL_OPEN_HASH_REMOVED && pSlot->distance < distance))
+			return NULL;
+
+		if (pSlot->distance != RSSL_OPEN_HASH_REMOVED && pSlot->hashSum == hashSum)
+		{
+			if (pKey ? pTable->keyCompareFunction(pKey, pSlot->pLink->pKey) : pSlot->pLink == pLink)
+				return pSlot;
+		}
+
+		index = (index + 1) & pArray->mask;
+		++distance;
+
+		if (distance > pArray->mask)
+			return NULL;
+	}
+}
+
+/* Removes the element in a slot, shifting back following elements that are not in their
+ * preferred slots. */
+RTR_C_INLINE void rsslOpenHashArrayRemoveSlot(RsslOpenHashArray *pArray, RsslOpenHashSlot *pSlot)
+{
+	RsslUInt32 index = (RsslUInt32)(pSlot - pArray->slots);
+
+	for(;;)
+	{
+		RsslUInt32 nextIndex = (index + 1) & pArray->mask;
+		RsslOpenHashSlot *pNextSlot = &pArray->slots[nextIndex];
+
+		if (!pNextSlot->pLink || pNextSlot->distance == 0)
+		{
+			pArray->slots[index].pLink = NULL;
+			return;
+		}
+
+		pArray->slots[index] = *pNextSlot;
+		--pArray->slots[index].distance;
+		index = nextIndex;
+	}
+}
+
+/* Moves some elements from the old array into the current one; frees the old array once
+ * it is empty. */
+RTR_C_INLINE void rsslOpenHashTableMigrate(RsslOpenHashTable *pTable, RsslUInt32 slotCount)
+{
+	RsslOpenHashArray *pOldArray = &pTable->oldArray;
+
+	while (slotCount-- && pTable->migrateIndex <= pOldArray->mask)
+	{
+		RsslOpenHashSlot *pSlot = &pOldArray->slots[pTable->migrateIndex++];
+
+		if (pSlot->pLink && pSlot->distance != RSSL_OPEN_HASH_REMOVED)
+			rsslOpenHashArrayInsert(&pTable->array, pSlot->pLink, pSlot->hashSum);
+	}
+
+	if (pTable->migrateIndex > pOldArray->mask)
+	{
+		free(pOldArray->slots);
+		pOldArray->slots = NULL;
+	}
+}
+
+/* Starts moving the elements to an array twice the size. */
+RTR_C_INLINE RsslRet rsslOpenHashTableGrow(RsslOpenHashTable *pTable)
+{
+	RsslOpenHashArray newArray;
+
+	/* Finish any earlier growth first. */
+	if (pTable->oldArray.slots)
+		rsslOpenHashTableMigrate(pTable, pTable->oldArray.mask + 1);
+
+	if (rsslOpenHashArrayInit(&newArray, (pTable->array.mask + 1) * 2) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	pTable->oldArray = pTable->array;
+	pTable->array = newArray;
+	pTable->migrateIndex = 0;
+	pTable->thresholdCapacity = (newArray.mask + 1) - ((newArray.mask + 1) >> 3);
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE RsslRet rsslOpenHashTableInit(RsslOpenHashTable *pTable, RsslUInt32 queueCount,
+		RsslHashSumFunction *keyHashFunction, RsslHashCompareFunction *keyCompareFunction,
+		RsslBool dynamicSize, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 slotCount = queueCount + (queueCount >> 2);
+
+	memset(pTable, 0, sizeof(RsslOpenHashTable));
+
+	if (slotCount < RSSL_OPEN_HASH_MIN_SLOTS)
+		slotCount = RSSL_OPEN_HASH_MIN_SLOTS;
+
+	if (slotCount < queueCount
+			|| rsslOpenHashArrayInit(&pTable->array, slotCount) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	pTable->thresholdCapacity = (pTable->array.mask + 1) - ((pTable->array.mask + 1) >> 3);
+	pTable->dynamicSize = dynamicSize;
+	pTable->keyHashFunction = keyHashFunction;
+	pTable->keyCompareFunction = keyCompareFunction;
+
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE RsslRet rsslOpenHashTableCleanup(RsslOpenHashTable *pTable)
+{
+	free(pTable->array.slots);
+	free(pTable->oldArray.slots);
+	pTable->array.slots = NULL;
+	pTable->oldArray.slots = NULL;
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE RsslRet rsslOpenHashTableInsertLink(RsslOpenHashTable *pTable, RsslHashLink *pLink,
+		void *pKey, RsslUInt32 *pSum)
+{
+	pLink->hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
+	pLink->pKey = pKey;
+
+	/* Open addressing needs free slots, so the table grows even if it was not created with
+	 * dynamicSize.  If that fails, elements are still added until the array is full and
+	 * growing is tried again on each insert. */
+	if (pTable->elementCount >= pTable->thresholdCapacity
+			&& rsslOpenHashTableGrow(pTable) != RSSL_RET_SUCCESS
+			&& pTable->elementCount > pTable->array.mask)
+		return RSSL_RET_FAILURE;
+
+	rsslOpenHashArrayInsert(&pTable->array, pLink, pLink->hashSum);
+	pTable->elementCount++;
+
+	if (pTable->oldArray.slots)
+		rsslOpenHashTableMigrate(pTable, RSSL_OPEN_HASH_MIGRATE_SLOTS);
+
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE void rsslOpenHashTableRemoveLink(RsslOpenHashTable *pTable, RsslHashLink *pLink)
+{
+	RsslOpenHashSlot *pSlot;
+
+	if ((pSlot = rsslOpenHashArrayFindSlot(pTable, &pTable->array, 0, NULL, pLink, pLink->hashSum)))
+		rsslOpenHashArrayRemoveSlot(&pTable->array, pSlot);
+	else
+	{
+		/* Still in the old array. Mark it removed rather than shifting, since following elements
+		 * may have already been moved. */
+		pSlot = rsslOpenHashArrayFindSlot(pTable, &pTable->oldArray, pTable->migrateIndex, NULL,
+				pLink, pLink->hashSum);
+		assert(pSlot);
+		pSlot->distance = RSSL_OPEN_HASH_REMOVED;
+	}
+
+	pTable->elementCount--;
+
+	if (pTable->oldArray.slots)
+		rsslOpenHashTableMigrate(pTable, RSSL_OPEN_HASH_MIGRATE_SLOTS);
+}
+
+RTR_C_INLINE RsslHashLink *rsslOpenHashTableFind(RsslOpenHashTable *pTable, void *pKey, RsslUInt32 *pSum)
+{
+	RsslUInt32 hashSum = (pSum ? *pSum : pTable->keyHashFunction(pKey));
+	RsslOpenHashSlot *pSlot;
+
+	/* An element whose preferred slot in the old array has not been reached by the migration
+	 * is most likely still there, so look there first. */
+	if (pTable->oldArray.slots
+			&& rsslOpenHashArrayIndex(&pTable->oldArray, hashSum) >= pTable->migrateIndex)
+	{
+		if ((pSlot = rsslOpenHashArrayFindSlot(pTable, &pTable->oldArray, pTable->migrateIndex,
+						pKey, NULL, hashSum)))
+			return pSlot->pLink;
+
+		if ((pSlot = rsslOpenHashArrayFindSlot(pTable, &pTable->array, 0, pKey, NULL, hashSum)))
+			return pSlot->pLink;
+
+		return NULL;
+	}
+
+	if ((pSlot = rsslOpenHashArrayFindSlot(pTable, &pTable->array, 0, pKey, NULL, hashSum)))
+		return pSlot->pLink;
+
+	if (pTable->oldArray.slots
+			&& (pSlot = rsslOpenHashArrayFindSlot(pTable, &pTable->oldArray, pTable->migrateIndex,
+					pKey, NULL, hashSum)))
+		return pSlot->pLink;
+
+	return NULL;
+}
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
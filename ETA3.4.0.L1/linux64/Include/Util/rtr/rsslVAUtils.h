@@ -279,6 +279,19 @@ RTR_C_INLINE RsslRet rsslDeepCopyConnectOpts(RsslConnectOptions *destOpts, RsslC
 		strncpy(destOpts->encryptionOpts.openSSLCAStore, sourceOpts->encryptionOpts.openSSLCAStore, tempLen);
 	}
 
+	if (sourceOpts->compressionDictionary != 0)
+	{
+		tempLen = (strlen(sourceOpts->compressionDictionary) + 1) * sizeof(char);
+		destOpts->compressionDictionary = (char*)malloc(tempLen);
+
+		if (destOpts->compressionDictionary == 0)
+		{
+			return RSSL_RET_FAILURE;
+		}
+
+		strncpy(destOpts->compressionDictionary, sourceOpts->compressionDictionary, tempLen);
+	}
+
 	
 	
 	return RSSL_RET_SUCCESS;
@@ -386,6 +399,11 @@ RTR_C_INLINE void rsslFreeConnectOpts(RsslConnectOptions *connOpts)
 		free(connOpts->encryptionOpts.openSSLCAStore);
 	}
 
+	if(connOpts->compressionDictionary != 0)
+	{
+		free(connOpts->compressionDictionary);
+	}
+
 	memset(connOpts, 0, sizeof(RsslConnectOptions));
 }
 
@@ -0,0 +1,361 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/*
+ * This example checks the batch primitive conversions against their scalar equivalents:
+ * - rsslRealsToDoubles() against rsslRealToDouble() and the correctly rounded value from strtod().
+ * - rsslDateTimesToEpochNanos() against a day-by-day count from the epoch.
+ * - rsslDecodeRealsToDoubles() and rsslDecodeDateTimesToEpochNanos() against rsslDecodeReal() and
+ *   rsslDecodeDateTime() on each value, followed by the conversion of that one value.
+ * It prints each mismatch and exits with a non-zero status if any were found.
+ */
+
+#include "rtr/rsslDataPackage.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define VALUE_COUNT 2000
+#define MAX_PRINTED_MISMATCHES 10
+
+static RsslUInt64 randomState = 88172645463325252ULL;
+static int mismatchCount = 0;
+
+/* xorshift generator, so every run checks the same values */
+static RsslUInt64 nextRandom()
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return randomState;
+}
+
+static void reportMismatch(const char *text)
+{
+	if (mismatchCount++ < MAX_PRINTED_MISMATCHES)
+		printf("Mismatch: %s\n", text);
+}
+
+static int sameDouble(RsslDouble a, RsslDouble b)
+{
+	return a == b || (a != a && b != b);
+}
+
+static int encodePrimitive(RsslBuffer *pBuffer, char *pMem, RsslUInt32 memLength, RsslDataType type, void *pValue)
+{
+	RsslEncodeIterator encIter;
+	RsslRet ret;
+
+	pBuffer->data = pMem;
+	pBuffer->length = memLength;
+	rsslClearEncodeIterator(&encIter);
+	rsslSetEncodeIteratorRWFVersion(&encIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetEncodeIteratorBuffer(&encIter, pBuffer);
+
+	ret = (type == RSSL_DT_REAL) ? rsslEncodeReal(&encIter, (RsslReal*)pValue) : rsslEncodeDateTime(&encIter, (RsslDateTime*)pValue);
+	if (ret < RSSL_RET_SUCCESS)
+		return ret;
+
+	pBuffer->length = rsslGetEncodedBufferLength(&encIter);
+	return RSSL_RET_SUCCESS;
+}
+
+static void setDecodeIterator(RsslDecodeIterator *pDecIter, RsslBuffer *pBuffer)
+{
+	rsslClearDecodeIterator(pDecIter);
+	rsslSetDecodeIteratorRWFVersion(pDecIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetDecodeIteratorBuffer(pDecIter, pBuffer);
+}
+
+/* Checks rsslRealsToDoubles() for every hint.
+ * Exponent hints must give the correctly rounded value, which rsslRealToDouble() may miss by one unit in the last place.
+ * Fraction hints and the special hints must give exactly what rsslRealToDouble() gives. */
+static void checkReals()
+{
+	static RsslReal reals[VALUE_COUNT];
+	static RsslDouble values[VALUE_COUNT];
+	static RsslBool isBlank[VALUE_COUNT];
+	char text[256];
+	int hint, i, lastBitDifferences = 0;
+
+	for (hint = 0; hint <= RSSL_RH_NOT_A_NUMBER; ++hint)
+	{
+		RsslBool isValidHint = (hint <= RSSL_RH_MAX_DIVISOR || hint >= RSSL_RH_INFINITY);
+		RsslRet ret;
+
+		for (i = 0; i < VALUE_COUNT; ++i)
+		{
+			/* Values of every magnitude up to 2^53, where the conversion is exact before the hint is applied. */
+			RsslUInt32 bits = (RsslUInt32)(nextRandom() % 54);
+			RsslInt64 value = (RsslInt64)(nextRandom() & ((1ULL << bits) - 1));
+
+			reals[i].isBlank = RSSL_FALSE;
+			reals[i].hint = (RsslUInt8)hint;
+			reals[i].value = (nextRandom() & 1) ? -value : value;
+		}
+
+		ret = rsslRealsToDoubles(values, isBlank, reals, VALUE_COUNT);
+		if ((ret == RSSL_RET_SUCCESS) != isValidHint)
+		{
+			snprintf(text, sizeof(text), "rsslRealsToDoubles() returned %d for hint %d", ret, hint);
+			reportMismatch(text);
+		}
+
+		for (i = 0; i < VALUE_COUNT; ++i)
+		{
+			RsslDouble scalarValue, expected;
+
+			if (isBlank[i])
+			{
+				snprintf(text, sizeof(text), "hint %d value " RTR_LLD " flagged as blank", hint, reals[i].value);
+				reportMismatch(text);
+			}
+
+			if (!isValidHint)
+			{
+				if (values[i] == values[i])
+				{
+					snprintf(text, sizeof(text), "invalid hint %d converted to %.17g instead of NaN", hint, values[i]);
+					reportMismatch(text);
+				}
+				continue;
+			}
+
+			rsslRealToDouble(&scalarValue, &reals[i]);
+
+			if (hint <= RSSL_RH_EXPONENT7)
+			{
+				char decimal[64];
+
+				snprintf(decimal, sizeof(decimal), RTR_LLD "e%d", reals[i].value, hint - RSSL_RH_EXPONENT0);
+				expected = strtod(decimal, NULL);
+
+				if (scalarValue != expected && (nextafter(expected, scalarValue) == scalarValue))
+					++lastBitDifferences;
+			}
+			else
+				expected = scalarValue;
+
+			if (!sameDouble(values[i], expected))
+			{
+				snprintf(text, sizeof(text), "hint %d value " RTR_LLD ": batch %.17g, expected %.17g (rsslRealToDouble %.17g)",
+						hint, reals[i].value, values[i], expected, scalarValue);
+				reportMismatch(text);
+			}
+		}
+	}
+
+	/* Blank values are NaN and flagged; a zero that is not blank is neither. */
+	reals[0].isBlank = RSSL_TRUE;
+	reals[0].hint = RSSL_RH_EXPONENT0;
+	reals[0].value = 5;
+	reals[1].isBlank = RSSL_FALSE;
+	reals[1].hint = RSSL_RH_EXPONENT0;
+	reals[1].value = 0;
+	if (rsslRealsToDoubles(values, isBlank, reals, 2) != RSSL_RET_SUCCESS
+			|| values[0] == values[0] || !isBlank[0] || values[1] != 0 || isBlank[1])
+		reportMismatch("blank RsslReal not converted to a flagged NaN");
+
+	printf("Reals: checked %d hints; rsslRealToDouble() was off by one unit in the last place for %d values.\n",
+			RSSL_RH_NOT_A_NUMBER + 1, lastBitDifferences);
+}
+
+/* Counts whole days from 1970-01-01, one year and one month at a time. */
+static RsslInt64 daysFromEpoch(RsslUInt32 year, RsslUInt32 month, RsslUInt32 day)
+{
+	static const int daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+	RsslInt64 days = 0;
+	RsslUInt32 y, m;
+
+	for (y = 1970; y < year; ++y)
+		days += ((y % 4 == 0 && y % 100 != 0) || y % 400 == 0) ? 366 : 365;
+	for (y = year; y < 1970; ++y)
+		days -= ((y % 4 == 0 && y % 100 != 0) || y % 400 == 0) ? 366 : 365;
+
+	for (m = 1; m < month; ++m)
+		days += (m == 2 && ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0)) ? 29 : daysInMonth[m - 1];
+
+	return days + day - 1;
+}
+
+static void checkDateTimes()
+{
+	static RsslDateTime dateTimes[VALUE_COUNT];
+	static RsslInt64 nanos[VALUE_COUNT];
+	static RsslBool isBlank[VALUE_COUNT];
+	RsslDateTime special[3];
+	char text[256];
+	int i;
+
+	for (i = 0; i < VALUE_COUNT; ++i)
+	{
+		dateTimes[i].date.year = (RsslUInt16)(1678 + nextRandom() % 584);
+		dateTimes[i].date.month = (RsslUInt8)(1 + nextRandom() % 12);
+		dateTimes[i].date.day = (RsslUInt8)(1 + nextRandom() % 28);
+		dateTimes[i].time.hour = (RsslUInt8)(nextRandom() % 24);
+		dateTimes[i].time.minute = (RsslUInt8)(nextRandom() % 60);
+		dateTimes[i].time.second = (RsslUInt8)(nextRandom() % 60);
+		dateTimes[i].time.millisecond = (RsslUInt16)(nextRandom() % 1000);
+		dateTimes[i].time.microsecond = (RsslUInt16)(nextRandom() % 1000);
+		dateTimes[i].time.nanosecond = (RsslUInt16)(nextRandom() % 1000);
+	}
+
+	if (rsslDateTimesToEpochNanos(nanos, isBlank, dateTimes, VALUE_COUNT) != RSSL_RET_SUCCESS)
+		reportMismatch("rsslDateTimesToEpochNanos() reported invalid data for valid dates");
+
+	for (i = 0; i < VALUE_COUNT; ++i)
+	{
+		RsslDateTime *pDateTime = &dateTimes[i];
+		RsslInt64 seconds = daysFromEpoch(pDateTime->date.year, pDateTime->date.month, pDateTime->date.day) * 86400
+			+ pDateTime->time.hour * 3600 + pDateTime->time.minute * 60 + pDateTime->time.second;
+		RsslInt64 expected = seconds * 1000000000 + pDateTime->time.millisecond * 1000000
+			+ pDateTime->time.microsecond * 1000 + pDateTime->time.nanosecond;
+
+		if (nanos[i] != expected || isBlank[i])
+		{
+			snprintf(text, sizeof(text), "%04u-%02u-%02u: batch " RTR_LLD ", expected " RTR_LLD,
+					pDateTime->date.year, pDateTime->date.month, pDateTime->date.day, nanos[i], expected);
+			reportMismatch(text);
+		}
+	}
+
+	/* A blank date is 0 and flagged; a blank time counts as midnight; a year past 2261 is invalid. */
+	rsslBlankDateTime(&special[0]);
+	rsslClearDateTime(&special[1]);
+	special[1].date.year = 1970;
+	special[1].date.month = 1;
+	special[1].date.day = 2;
+	rsslBlankTime(&special[1].time);
+	rsslClearDateTime(&special[2]);
+	special[2].date.year = 2262;
+	special[2].date.month = 1;
+	special[2].date.day = 1;
+	if (rsslDateTimesToEpochNanos(nanos, isBlank, special, 3) != RSSL_RET_INVALID_DATA
+			|| nanos[0] != 0 || !isBlank[0] || nanos[1] != 86400 * 1000000000LL || isBlank[1] || nanos[2] != 0)
+		reportMismatch("blank or out of range RsslDateTime not converted as documented");
+
+	printf("Date/times: checked %d values.\n", VALUE_COUNT);
+}
+
+/* Checks the decoding batch functions against decoding each value on its own. */
+static void checkEncodedValues()
+{
+	static char realMem[VALUE_COUNT][16], dateTimeMem[VALUE_COUNT][16];
+	static RsslBuffer encReals[VALUE_COUNT], encDateTimes[VALUE_COUNT];
+	static RsslDouble values[VALUE_COUNT];
+	static RsslInt64 nanos[VALUE_COUNT];
+	static RsslBool isBlank[VALUE_COUNT];
+	RsslDecodeIterator decIter;
+	char text[256];
+	int i;
+
+	for (i = 0; i < VALUE_COUNT; ++i)
+	{
+		RsslReal real;
+		RsslDateTime dateTime;
+
+		/* Every tenth value is blank. */
+		rsslClearReal(&real);
+		rsslClearDateTime(&dateTime);
+		if (i % 10 == 9)
+		{
+			rsslBlankReal(&real);
+			rsslBlankDateTime(&dateTime);
+		}
+		else
+		{
+			do
+				real.hint = (RsslUInt8)(nextRandom() % (RSSL_RH_NOT_A_NUMBER + 1));
+			while (real.hint > RSSL_RH_MAX_DIVISOR && real.hint < RSSL_RH_INFINITY);
+			real.value = (RsslInt64)(nextRandom() % 2000000000000ULL) - 1000000000000LL;
+
+			dateTime.date.year = (RsslUInt16)(1678 + nextRandom() % 584);
+			dateTime.date.month = (RsslUInt8)(1 + nextRandom() % 12);
+			dateTime.date.day = (RsslUInt8)(1 + nextRandom() % 28);
+			dateTime.time.hour = (RsslUInt8)(nextRandom() % 24);
+			dateTime.time.minute = (RsslUInt8)(nextRandom() % 60);
+			dateTime.time.second = (RsslUInt8)(nextRandom() % 60);
+			dateTime.time.millisecond = (RsslUInt16)(nextRandom() % 1000);
+		}
+
+		if (encodePrimitive(&encReals[i], realMem[i], sizeof(realMem[i]), RSSL_DT_REAL, &real) != RSSL_RET_SUCCESS
+				|| encodePrimitive(&encDateTimes[i], dateTimeMem[i], sizeof(dateTimeMem[i]), RSSL_DT_DATETIME, &dateTime) != RSSL_RET_SUCCESS)
+		{
+			reportMismatch("could not encode a test value");
+			return;
+		}
+	}
+
+	if (rsslDecodeRealsToDoubles(values, isBlank, encReals, VALUE_COUNT) != RSSL_RET_SUCCESS)
+		reportMismatch("rsslDecodeRealsToDoubles() reported invalid data");
+
+	for (i = 0; i < VALUE_COUNT; ++i)
+	{
+		RsslReal real;
+		RsslDouble expected;
+		RsslBool expectedBlank;
+
+		setDecodeIterator(&decIter, &encReals[i]);
+		if (rsslDecodeReal(&decIter, &real) < RSSL_RET_SUCCESS)
+		{
+			reportMismatch("rsslDecodeReal() failed");
+			continue;
+		}
+		rsslRealsToDoubles(&expected, &expectedBlank, &real, 1);
+
+		if (!sameDouble(values[i], expected) || isBlank[i] != expectedBlank)
+		{
+			snprintf(text, sizeof(text), "encoded real %d: batch %.17g, expected %.17g", i, values[i], expected);
+			reportMismatch(text);
+		}
+	}
+
+	if (rsslDecodeDateTimesToEpochNanos(nanos, isBlank, encDateTimes, VALUE_COUNT) != RSSL_RET_SUCCESS)
+		reportMismatch("rsslDecodeDateTimesToEpochNanos() reported invalid data");
+
+	for (i = 0; i < VALUE_COUNT; ++i)
+	{
+		RsslDateTime dateTime;
+		RsslInt64 expected;
+		RsslBool expectedBlank;
+
+		setDecodeIterator(&decIter, &encDateTimes[i]);
+		if (rsslDecodeDateTime(&decIter, &dateTime) < RSSL_RET_SUCCESS)
+		{
+			reportMismatch("rsslDecodeDateTime() failed");
+			continue;
+		}
+		rsslDateTimesToEpochNanos(&expected, &expectedBlank, &dateTime, 1);
+
+		if (nanos[i] != expected || isBlank[i] != expectedBlank)
+		{
+			snprintf(text, sizeof(text), "encoded date/time %d: batch " RTR_LLD ", expected " RTR_LLD, i, nanos[i], expected);
+			reportMismatch(text);
+		}
+	}
+
+	printf("Encoded values: checked %d reals and %d date/times.\n", VALUE_COUNT, VALUE_COUNT);
+}
+
+int main(int argc, char **argv)
+{
+	checkReals();
+	checkDateTimes();
+	checkEncodedValues();
+
+	if (mismatchCount)
+	{
+		printf("%d mismatches found.\n", mismatchCount);
+		return 1;
+	}
+
+	printf("All batch conversions match.\n");
+	return 0;
+}
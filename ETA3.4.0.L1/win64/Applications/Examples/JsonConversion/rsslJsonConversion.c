@@ -0,0 +1,836 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/*
+ * This example checks the RWF/JSON converter against the RWF decoders.
+ *
+ * Each message is encoded with the RWF encoders, converted to JSON, and converted back to RWF.
+ * The re-encoded message is then walked with the RWF decoders alongside the original, and every
+ * header member, container entry and primitive must match; reals are compared by value, since the
+ * converter may choose a different hint.  Converting the re-encoded message to JSON must give the
+ * same JSON again.
+ *
+ * Field lists are named with the dictionary, loaded from RDMFieldDictionary and enumtype.def in the
+ * current directory unless given with -f and -e.
+ * It prints each mismatch and exits with a non-zero status if any were found.
+ */
+
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rsslMessagePackage.h"
+#include "rtr/rsslJsonConverter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_MSG_SIZE 65536
+#define MAX_PRINTED_MISMATCHES 10
+
+static RsslDataDictionary dictionary;
+static RsslJsonConverterHandle jsonConverter;
+static int mismatchCount = 0;
+static const char *currentMsgName;
+
+static void reportMismatch(const char *text)
+{
+	if (mismatchCount++ < MAX_PRINTED_MISMATCHES)
+		printf("Mismatch in %s: %s\n", currentMsgName, text);
+}
+
+/* Like rsslBufferIsEqual(), but leaves memcmp() out of it for empty buffers, whose data may be NULL. */
+static RsslBool buffersEqual(const RsslBuffer *pBuffer, const RsslBuffer *pRefBuffer)
+{
+	return (pBuffer->length == pRefBuffer->length
+			&& (pBuffer->length == 0 || memcmp(pBuffer->data, pRefBuffer->data, pBuffer->length) == 0)) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static void setDecodeIterator(RsslDecodeIterator *pDecIter, RsslBuffer *pBuffer)
+{
+	rsslClearDecodeIterator(pDecIter);
+	rsslSetDecodeIteratorRWFVersion(pDecIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetDecodeIteratorBuffer(pDecIter, pBuffer);
+}
+
+static void setEncodeIterator(RsslEncodeIterator *pEncIter, RsslBuffer *pBuffer, char *pMem)
+{
+	pBuffer->data = pMem;
+	pBuffer->length = MAX_MSG_SIZE;
+	rsslClearEncodeIterator(pEncIter);
+	rsslSetEncodeIteratorRWFVersion(pEncIter, RSSL_RWF_MAJOR_VERSION, RSSL_RWF_MINOR_VERSION);
+	rsslSetEncodeIteratorBuffer(pEncIter, pBuffer);
+}
+
+static RsslBool compareData(RsslDataType dataType, RsslBuffer *pEncData, RsslBuffer *pRefEncData);
+
+/* Compares two encoded primitives of the same type.  Reals are compared by value, everything else by its string form. */
+static RsslBool comparePrimitive(RsslDataType dataType, RsslBuffer *pEncData, RsslBuffer *pRefEncData)
+{
+	RsslDecodeIterator decIter, refDecIter;
+	char string[1024], refString[1024];
+	RsslBuffer stringBuffer, refStringBuffer;
+	RsslRet ret, refRet;
+
+	setDecodeIterator(&decIter, pEncData);
+	setDecodeIterator(&refDecIter, pRefEncData);
+
+	if (dataType == RSSL_DT_REAL)
+	{
+		RsslReal real, refReal;
+		RsslDouble value, refValue;
+
+		ret = rsslDecodeReal(&decIter, &real);
+		refRet = rsslDecodeReal(&refDecIter, &refReal);
+		if (ret != refRet)
+			return RSSL_FALSE;
+		if (ret == RSSL_RET_BLANK_DATA)
+			return RSSL_TRUE;
+
+		rsslRealsToDoubles(&value, NULL, &real, 1);
+		rsslRealsToDoubles(&refValue, NULL, &refReal, 1);
+		return (value == refValue || (value != value && refValue != refValue)) ? RSSL_TRUE : RSSL_FALSE;
+	}
+
+	if (dataType == RSSL_DT_ARRAY)
+		return compareData(dataType, pEncData, pRefEncData);
+
+	stringBuffer.data = string;
+	stringBuffer.length = sizeof(string);
+	refStringBuffer.data = refString;
+	refStringBuffer.length = sizeof(refString);
+
+	ret = rsslEncodedPrimitiveToString(&decIter, dataType, &stringBuffer);
+	refRet = rsslEncodedPrimitiveToString(&refDecIter, dataType, &refStringBuffer);
+	if (ret != refRet)
+		return RSSL_FALSE;
+
+	return (ret < RSSL_RET_SUCCESS || buffersEqual(&stringBuffer, &refStringBuffer)) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslBool compareArray(RsslDecodeIterator *pDecIter, RsslDecodeIterator *pRefDecIter)
+{
+	RsslArray array, refArray;
+	RsslBuffer entry, refEntry;
+	RsslRet refRet;
+
+	if (rsslDecodeArray(pDecIter, &array) < RSSL_RET_SUCCESS || rsslDecodeArray(pRefDecIter, &refArray) < RSSL_RET_SUCCESS
+			|| array.primitiveType != refArray.primitiveType)
+		return RSSL_FALSE;
+
+	while ((refRet = rsslDecodeArrayEntry(pRefDecIter, &refEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (refRet < RSSL_RET_SUCCESS || rsslDecodeArrayEntry(pDecIter, &entry) != RSSL_RET_SUCCESS
+				|| !comparePrimitive(array.primitiveType, &entry, &refEntry))
+			return RSSL_FALSE;
+	}
+
+	return (rsslDecodeArrayEntry(pDecIter, &entry) == RSSL_RET_END_OF_CONTAINER) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslBool compareFieldList(RsslDecodeIterator *pDecIter, RsslDecodeIterator *pRefDecIter)
+{
+	RsslFieldList fieldList, refFieldList;
+	RsslFieldEntry entry, refEntry;
+	RsslRet refRet;
+
+	if (rsslDecodeFieldList(pDecIter, &fieldList, NULL) < RSSL_RET_SUCCESS || rsslDecodeFieldList(pRefDecIter, &refFieldList, NULL) < RSSL_RET_SUCCESS)
+		return RSSL_FALSE;
+
+	while ((refRet = rsslDecodeFieldEntry(pRefDecIter, &refEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		/* The dictionary gives the type, which both entries share. */
+		RsslDictionaryEntry *pDictionaryEntry;
+
+		if (refRet < RSSL_RET_SUCCESS || rsslDecodeFieldEntry(pDecIter, &entry) != RSSL_RET_SUCCESS || entry.fieldId != refEntry.fieldId
+				|| (pDictionaryEntry = getDictionaryEntry(&dictionary, refEntry.fieldId)) == NULL
+				|| !compareData(pDictionaryEntry->rwfType, &entry.encData, &refEntry.encData))
+			return RSSL_FALSE;
+	}
+
+	return (rsslDecodeFieldEntry(pDecIter, &entry) == RSSL_RET_END_OF_CONTAINER) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslBool compareElementList(RsslDecodeIterator *pDecIter, RsslDecodeIterator *pRefDecIter)
+{
+	RsslElementList elementList, refElementList;
+	RsslElementEntry entry, refEntry;
+	RsslRet refRet;
+
+	if (rsslDecodeElementList(pDecIter, &elementList, NULL) < RSSL_RET_SUCCESS || rsslDecodeElementList(pRefDecIter, &refElementList, NULL) < RSSL_RET_SUCCESS)
+		return RSSL_FALSE;
+
+	while ((refRet = rsslDecodeElementEntry(pRefDecIter, &refEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (refRet < RSSL_RET_SUCCESS || rsslDecodeElementEntry(pDecIter, &entry) != RSSL_RET_SUCCESS
+				|| !buffersEqual(&entry.name, &refEntry.name) || entry.dataType != refEntry.dataType
+				|| !compareData(refEntry.dataType, &entry.encData, &refEntry.encData))
+			return RSSL_FALSE;
+	}
+
+	return (rsslDecodeElementEntry(pDecIter, &entry) == RSSL_RET_END_OF_CONTAINER) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslBool compareMap(RsslDecodeIterator *pDecIter, RsslDecodeIterator *pRefDecIter)
+{
+	RsslMap map, refMap;
+	RsslMapEntry entry, refEntry;
+	RsslRet refRet;
+
+	if (rsslDecodeMap(pDecIter, &map) < RSSL_RET_SUCCESS || rsslDecodeMap(pRefDecIter, &refMap) < RSSL_RET_SUCCESS
+			|| map.flags != refMap.flags || map.keyPrimitiveType != refMap.keyPrimitiveType || map.containerType != refMap.containerType
+			|| ((refMap.flags & RSSL_MPF_HAS_KEY_FIELD_ID) && map.keyFieldId != refMap.keyFieldId)
+			|| ((refMap.flags & RSSL_MPF_HAS_TOTAL_COUNT_HINT) && map.totalCountHint != refMap.totalCountHint))
+		return RSSL_FALSE;
+
+	if ((refMap.flags & RSSL_MPF_HAS_SUMMARY_DATA) && !compareData(refMap.containerType, &map.encSummaryData, &refMap.encSummaryData))
+		return RSSL_FALSE;
+
+	while ((refRet = rsslDecodeMapEntry(pRefDecIter, &refEntry, NULL)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (refRet < RSSL_RET_SUCCESS || rsslDecodeMapEntry(pDecIter, &entry, NULL) != RSSL_RET_SUCCESS || entry.action != refEntry.action
+				|| !comparePrimitive(refMap.keyPrimitiveType, &entry.encKey, &refEntry.encKey)
+				|| (refEntry.action != RSSL_MPEA_DELETE_ENTRY && !compareData(refMap.containerType, &entry.encData, &refEntry.encData)))
+			return RSSL_FALSE;
+	}
+
+	return (rsslDecodeMapEntry(pDecIter, &entry, NULL) == RSSL_RET_END_OF_CONTAINER) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslBool compareVector(RsslDecodeIterator *pDecIter, RsslDecodeIterator *pRefDecIter)
+{
+	RsslVector vector, refVector;
+	RsslVectorEntry entry, refEntry;
+	RsslRet refRet;
+
+	if (rsslDecodeVector(pDecIter, &vector) < RSSL_RET_SUCCESS || rsslDecodeVector(pRefDecIter, &refVector) < RSSL_RET_SUCCESS
+			|| vector.flags != refVector.flags || vector.containerType != refVector.containerType)
+		return RSSL_FALSE;
+
+	while ((refRet = rsslDecodeVectorEntry(pRefDecIter, &refEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (refRet < RSSL_RET_SUCCESS || rsslDecodeVectorEntry(pDecIter, &entry) != RSSL_RET_SUCCESS || entry.index != refEntry.index || entry.action != refEntry.action
+				|| (refEntry.action != RSSL_VTEA_DELETE_ENTRY && !compareData(refVector.containerType, &entry.encData, &refEntry.encData)))
+			return RSSL_FALSE;
+	}
+
+	return (rsslDecodeVectorEntry(pDecIter, &entry) == RSSL_RET_END_OF_CONTAINER) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+static RsslBool compareSeries(RsslDecodeIterator *pDecIter, RsslDecodeIterator *pRefDecIter)
+{
+	RsslSeries series, refSeries;
+	RsslSeriesEntry entry, refEntry;
+	RsslRet refRet;
+
+	if (rsslDecodeSeries(pDecIter, &series) < RSSL_RET_SUCCESS || rsslDecodeSeries(pRefDecIter, &refSeries) < RSSL_RET_SUCCESS
+			|| series.containerType != refSeries.containerType)
+		return RSSL_FALSE;
+
+	while ((refRet = rsslDecodeSeriesEntry(pRefDecIter, &refEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (refRet < RSSL_RET_SUCCESS || rsslDecodeSeriesEntry(pDecIter, &entry) != RSSL_RET_SUCCESS
+				|| !compareData(refSeries.containerType, &entry.encData, &refEntry.encData))
+			return RSSL_FALSE;
+	}
+
+	return (rsslDecodeSeriesEntry(pDecIter, &entry) == RSSL_RET_END_OF_CONTAINER) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Compares two encoded values of the same type with the RWF decoders. */
+static RsslBool compareData(RsslDataType dataType, RsslBuffer *pEncData, RsslBuffer *pRefEncData)
+{
+	RsslDecodeIterator decIter, refDecIter;
+
+	if (pEncData->length == 0 || pRefEncData->length == 0)
+		return (pEncData->length == pRefEncData->length) ? RSSL_TRUE : RSSL_FALSE;
+
+	setDecodeIterator(&decIter, pEncData);
+	setDecodeIterator(&refDecIter, pRefEncData);
+
+	switch (dataType)
+	{
+		case RSSL_DT_ARRAY: return compareArray(&decIter, &refDecIter);
+		case RSSL_DT_FIELD_LIST: return compareFieldList(&decIter, &refDecIter);
+		case RSSL_DT_ELEMENT_LIST: return compareElementList(&decIter, &refDecIter);
+		case RSSL_DT_MAP: return compareMap(&decIter, &refDecIter);
+		case RSSL_DT_VECTOR: return compareVector(&decIter, &refDecIter);
+		case RSSL_DT_SERIES: return compareSeries(&decIter, &refDecIter);
+		case RSSL_DT_OPAQUE:
+		case RSSL_DT_XML:
+		case RSSL_DT_ANSI_PAGE:
+		case RSSL_DT_NO_DATA:
+			return buffersEqual(pEncData, pRefEncData);
+		default:
+			return comparePrimitive(dataType, pEncData, pRefEncData);
+	}
+}
+
+static RsslBool optionalBuffersEqual(const RsslBuffer *pBuffer, const RsslBuffer *pRefBuffer)
+{
+	return (pBuffer == NULL || pRefBuffer == NULL) ? (pBuffer == pRefBuffer) : buffersEqual(pBuffer, pRefBuffer);
+}
+
+static RsslBool postUserInfoEqual(const RsslPostUserInfo *pInfo, const RsslPostUserInfo *pRefInfo)
+{
+	return (pInfo->postUserAddr == pRefInfo->postUserAddr && pInfo->postUserId == pRefInfo->postUserId) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Compares the header members of two decoded messages.  Optional members are compared only when their
+ * flag is set, since the decoders leave them unset otherwise; the keys are compared separately. */
+static RsslBool compareMsgHeaders(RsslMsg *pMsg, RsslMsg *pRefMsg)
+{
+	const RsslUInt32 *pSeqNum = rsslGetSeqNum(pMsg), *pRefSeqNum = rsslGetSeqNum(pRefMsg);
+	const RsslState *pState = rsslGetState(pMsg), *pRefState = rsslGetState(pRefMsg);
+	const RsslMsgKey *pReqKey = rsslGetReqMsgKey(pMsg), *pRefReqKey = rsslGetReqMsgKey(pRefMsg);
+
+	if (pMsg->msgBase.msgClass != pRefMsg->msgBase.msgClass || pMsg->msgBase.streamId != pRefMsg->msgBase.streamId
+			|| pMsg->msgBase.domainType != pRefMsg->msgBase.domainType || pMsg->msgBase.containerType != pRefMsg->msgBase.containerType
+			|| *rsslGetFlags(pMsg) != *rsslGetFlags(pRefMsg))
+		return RSSL_FALSE;
+
+	if ((pSeqNum == NULL) != (pRefSeqNum == NULL) || (pRefSeqNum && *pSeqNum != *pRefSeqNum)
+			|| (pState == NULL) != (pRefState == NULL)
+			|| (pRefState && (pState->streamState != pRefState->streamState || pState->dataState != pRefState->dataState
+				|| pState->code != pRefState->code || !buffersEqual(&pState->text, &pRefState->text)))
+			|| (pReqKey == NULL) != (pRefReqKey == NULL) || (pRefReqKey && rsslCompareMsgKeys(pReqKey, pRefReqKey) != RSSL_RET_SUCCESS)
+			|| !optionalBuffersEqual(rsslGetExtendedHeader(pMsg), rsslGetExtendedHeader(pRefMsg))
+			|| !optionalBuffersEqual(rsslGetPermData(pMsg), rsslGetPermData(pRefMsg))
+			|| !optionalBuffersEqual(rsslGetGroupId(pMsg), rsslGetGroupId(pRefMsg)))
+		return RSSL_FALSE;
+
+	switch (pRefMsg->msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+			return ((!(pRefMsg->refreshMsg.flags & RSSL_RFMF_HAS_PART_NUM) || pMsg->refreshMsg.partNum == pRefMsg->refreshMsg.partNum)
+					&& (!(pRefMsg->refreshMsg.flags & RSSL_RFMF_HAS_QOS) || rsslQosIsEqual(&pMsg->refreshMsg.qos, &pRefMsg->refreshMsg.qos))
+					&& (!(pRefMsg->refreshMsg.flags & RSSL_RFMF_HAS_POST_USER_INFO)
+						|| postUserInfoEqual(&pMsg->refreshMsg.postUserInfo, &pRefMsg->refreshMsg.postUserInfo))) ? RSSL_TRUE : RSSL_FALSE;
+		case RSSL_MC_UPDATE:
+			return (pMsg->updateMsg.updateType == pRefMsg->updateMsg.updateType
+					&& (!(pRefMsg->updateMsg.flags & RSSL_UPMF_HAS_CONF_INFO)
+						|| (pMsg->updateMsg.conflationCount == pRefMsg->updateMsg.conflationCount
+							&& pMsg->updateMsg.conflationTime == pRefMsg->updateMsg.conflationTime))
+					&& (!(pRefMsg->updateMsg.flags & RSSL_UPMF_HAS_POST_USER_INFO)
+						|| postUserInfoEqual(&pMsg->updateMsg.postUserInfo, &pRefMsg->updateMsg.postUserInfo))) ? RSSL_TRUE : RSSL_FALSE;
+		case RSSL_MC_STATUS:
+			return (!(pRefMsg->statusMsg.flags & RSSL_STMF_HAS_POST_USER_INFO)
+					|| postUserInfoEqual(&pMsg->statusMsg.postUserInfo, &pRefMsg->statusMsg.postUserInfo)) ? RSSL_TRUE : RSSL_FALSE;
+		case RSSL_MC_REQUEST:
+			return ((!(pRefMsg->requestMsg.flags & RSSL_RQMF_HAS_PRIORITY)
+						|| (pMsg->requestMsg.priorityClass == pRefMsg->requestMsg.priorityClass
+							&& pMsg->requestMsg.priorityCount == pRefMsg->requestMsg.priorityCount))
+					&& (!(pRefMsg->requestMsg.flags & RSSL_RQMF_HAS_QOS) || rsslQosIsEqual(&pMsg->requestMsg.qos, &pRefMsg->requestMsg.qos))
+					&& (!(pRefMsg->requestMsg.flags & RSSL_RQMF_HAS_WORST_QOS)
+						|| rsslQosIsEqual(&pMsg->requestMsg.worstQos, &pRefMsg->requestMsg.worstQos))) ? RSSL_TRUE : RSSL_FALSE;
+		case RSSL_MC_POST:
+			return (postUserInfoEqual(&pMsg->postMsg.postUserInfo, &pRefMsg->postMsg.postUserInfo)
+					&& (!(pRefMsg->postMsg.flags & RSSL_PSMF_HAS_PART_NUM) || pMsg->postMsg.partNum == pRefMsg->postMsg.partNum)
+					&& (!(pRefMsg->postMsg.flags & RSSL_PSMF_HAS_POST_ID) || pMsg->postMsg.postId == pRefMsg->postMsg.postId)
+					&& (!(pRefMsg->postMsg.flags & RSSL_PSMF_HAS_POST_USER_RIGHTS)
+						|| pMsg->postMsg.postUserRights == pRefMsg->postMsg.postUserRights)) ? RSSL_TRUE : RSSL_FALSE;
+		case RSSL_MC_GENERIC:
+			return ((!(pRefMsg->genericMsg.flags & RSSL_GNMF_HAS_PART_NUM) || pMsg->genericMsg.partNum == pRefMsg->genericMsg.partNum)
+					&& (!(pRefMsg->genericMsg.flags & RSSL_GNMF_HAS_SECONDARY_SEQ_NUM)
+						|| pMsg->genericMsg.secondarySeqNum == pRefMsg->genericMsg.secondarySeqNum)) ? RSSL_TRUE : RSSL_FALSE;
+		case RSSL_MC_ACK:
+			return (pMsg->ackMsg.ackId == pRefMsg->ackMsg.ackId
+					&& (!(pRefMsg->ackMsg.flags & RSSL_AKMF_HAS_NAK_CODE) || pMsg->ackMsg.nakCode == pRefMsg->ackMsg.nakCode)
+					&& (!(pRefMsg->ackMsg.flags & RSSL_AKMF_HAS_TEXT) || buffersEqual(&pMsg->ackMsg.text, &pRefMsg->ackMsg.text))) ? RSSL_TRUE : RSSL_FALSE;
+		default:
+			return RSSL_TRUE;
+	}
+}
+
+/* Compares two encoded messages: their header, key and payload. */
+static void compareMsgs(RsslBuffer *pEncMsg, RsslBuffer *pRefEncMsg)
+{
+	RsslDecodeIterator decIter, refDecIter;
+	RsslMsg msg, refMsg;
+	const RsslMsgKey *pKey, *pRefKey;
+
+	setDecodeIterator(&decIter, pEncMsg);
+	setDecodeIterator(&refDecIter, pRefEncMsg);
+	if (rsslDecodeMsg(&decIter, &msg) < RSSL_RET_SUCCESS || rsslDecodeMsg(&refDecIter, &refMsg) < RSSL_RET_SUCCESS)
+	{
+		reportMismatch("re-encoded message could not be decoded");
+		return;
+	}
+
+	if (!compareMsgHeaders(&msg, &refMsg))
+		reportMismatch("message header differs");
+
+	pKey = rsslGetMsgKey(&msg);
+	pRefKey = rsslGetMsgKey(&refMsg);
+	if ((pKey == NULL) != (pRefKey == NULL) || (pRefKey && rsslCompareMsgKeys(pKey, pRefKey) != RSSL_RET_SUCCESS))
+		reportMismatch("message key differs");
+
+	if (!compareData(refMsg.msgBase.containerType, &msg.msgBase.encDataBody, &refMsg.msgBase.encDataBody))
+		reportMismatch("payload differs");
+}
+
+/* Converts an encoded message to JSON, copying the JSON into pJson. */
+static RsslRet msgToJson(RsslBuffer *pEncMsg, char *pJson, RsslUInt32 *pJsonLength)
+{
+	RsslDecodeIterator decIter;
+	RsslMsg msg;
+	RsslBuffer jsonBuffer;
+	RsslJsonConverterError error;
+	RsslRet ret;
+
+	setDecodeIterator(&decIter, pEncMsg);
+	if ((ret = rsslDecodeMsg(&decIter, &msg)) < RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslJsonConverterMsgToJson(jsonConverter, &decIter, &msg, &jsonBuffer, &error)) < RSSL_RET_SUCCESS)
+	{
+		printf("rsslJsonConverterMsgToJson() failed for %s: %s\n", currentMsgName, error.text);
+		return ret;
+	}
+
+	if (jsonBuffer.length > MAX_MSG_SIZE)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	memcpy(pJson, jsonBuffer.data, jsonBuffer.length);
+	*pJsonLength = jsonBuffer.length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Converts an encoded message to JSON and back, then checks the result against the original. */
+static void checkMsg(const char *name, RsslEncodeIterator *pEncIter, RsslBuffer *pEncMsg)
+{
+	static char json[MAX_MSG_SIZE], json2[MAX_MSG_SIZE], msgMem[MAX_MSG_SIZE];
+	RsslUInt32 jsonLength, json2Length;
+	RsslBuffer jsonBuffer, encMsg;
+	RsslEncodeIterator encIter;
+	RsslJsonConverterError error;
+
+	currentMsgName = name;
+	pEncMsg->length = rsslGetEncodedBufferLength(pEncIter);
+
+	if (msgToJson(pEncMsg, json, &jsonLength) != RSSL_RET_SUCCESS)
+	{
+		reportMismatch("could not convert the message to JSON");
+		return;
+	}
+
+	jsonBuffer.data = json;
+	jsonBuffer.length = jsonLength;
+	setEncodeIterator(&encIter, &encMsg, msgMem);
+	if (rsslJsonConverterJsonToMsg(jsonConverter, &jsonBuffer, &encIter, &error) < RSSL_RET_SUCCESS)
+	{
+		printf("rsslJsonConverterJsonToMsg() failed for %s: %s\n", name, error.text);
+		reportMismatch("could not convert the JSON back to RWF");
+		return;
+	}
+	encMsg.length = rsslGetEncodedBufferLength(&encIter);
+
+	compareMsgs(&encMsg, pEncMsg);
+
+	if (msgToJson(&encMsg, json2, &json2Length) != RSSL_RET_SUCCESS
+			|| json2Length != jsonLength || memcmp(json, json2, jsonLength) != 0)
+		reportMismatch("re-encoded message gives different JSON");
+
+	printf("%s: %.*s\n", name, (int)jsonLength, json);
+}
+
+static void encodeFieldList(RsslEncodeIterator *pEncIter, RsslInt64 priceOffset)
+{
+	RsslFieldList fieldList = RSSL_INIT_FIELD_LIST;
+	RsslFieldEntry entry = RSSL_INIT_FIELD_ENTRY;
+	RsslReal real = RSSL_INIT_REAL;
+	RsslUInt uintValue = 1234;
+	RsslEnum enumValue = 2;
+	RsslDate date;
+	RsslTime time;
+	RsslBuffer displayName = { 9, (char*)"IBM \"CO\"\\" };
+
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+	rsslEncodeFieldListInit(pEncIter, &fieldList, NULL, 0);
+
+	entry.fieldId = 1; entry.dataType = RSSL_DT_UINT;
+	rsslEncodeFieldEntry(pEncIter, &entry, &uintValue);
+
+	entry.fieldId = 3; entry.dataType = RSSL_DT_RMTES_STRING;
+	rsslEncodeFieldEntry(pEncIter, &entry, &displayName);
+
+	entry.fieldId = 4; entry.dataType = RSSL_DT_ENUM;
+	rsslEncodeFieldEntry(pEncIter, &entry, &enumValue);
+
+	entry.fieldId = 6; entry.dataType = RSSL_DT_REAL;
+	real.hint = RSSL_RH_EXPONENT2; real.value = 7;
+	rsslEncodeFieldEntry(pEncIter, &entry, &real);
+
+	/* blank */
+	entry.fieldId = 11;
+	rsslEncodeFieldEntry(pEncIter, &entry, NULL);
+
+	entry.fieldId = 16; entry.dataType = RSSL_DT_DATE;
+	date.year = 2019; date.month = 3; date.day = 7;
+	rsslEncodeFieldEntry(pEncIter, &entry, &date);
+
+	entry.fieldId = 18; entry.dataType = RSSL_DT_TIME;
+	rsslClearTime(&time);
+	time.hour = 13; time.minute = 4; time.second = 5;
+	rsslEncodeFieldEntry(pEncIter, &entry, &time);
+
+	entry.fieldId = 22; entry.dataType = RSSL_DT_REAL;
+	real.hint = RSSL_RH_EXPONENT_2; real.value = 4555 + priceOffset;
+	rsslEncodeFieldEntry(pEncIter, &entry, &real);
+
+	entry.fieldId = 25;
+	real.hint = RSSL_RH_FRACTION_256; real.value = -12345 - priceOffset;
+	rsslEncodeFieldEntry(pEncIter, &entry, &real);
+
+	rsslEncodeFieldListComplete(pEncIter, RSSL_TRUE);
+}
+
+static void encodeElementList(RsslEncodeIterator *pEncIter)
+{
+	RsslElementList elementList = RSSL_INIT_ELEMENT_LIST;
+	RsslElementEntry entry = RSSL_INIT_ELEMENT_ENTRY;
+	RsslArray array = RSSL_INIT_ARRAY;
+	RsslReal real = RSSL_INIT_REAL;
+	RsslUInt uintValue = 18446744073709551615ULL;
+	RsslInt intValue = -9223372036854775807LL - 1;
+	RsslDouble doubleValue = 3.25;
+	RsslDateTime dateTime;
+	RsslQos qos = RSSL_INIT_QOS;
+	RsslState state = RSSL_INIT_STATE;
+	RsslBuffer ascii = { 4, (char*)"a\nb\t" };
+	RsslBuffer buffer = { 5, (char*)"\x00\x01\xff\x10Z" };
+
+	elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+	rsslEncodeElementListInit(pEncIter, &elementList, NULL, 0);
+
+	entry.name.data = (char*)"UInt"; entry.name.length = 4; entry.dataType = RSSL_DT_UINT;
+	rsslEncodeElementEntry(pEncIter, &entry, &uintValue);
+
+	entry.name.data = (char*)"Int"; entry.name.length = 3; entry.dataType = RSSL_DT_INT;
+	rsslEncodeElementEntry(pEncIter, &entry, &intValue);
+
+	entry.name.data = (char*)"BlankInt"; entry.name.length = 8;
+	rsslEncodeElementEntry(pEncIter, &entry, NULL);
+
+	entry.name.data = (char*)"Double"; entry.name.length = 6; entry.dataType = RSSL_DT_DOUBLE;
+	rsslEncodeElementEntry(pEncIter, &entry, &doubleValue);
+
+	entry.name.data = (char*)"DateTime"; entry.name.length = 8; entry.dataType = RSSL_DT_DATETIME;
+	rsslClearDateTime(&dateTime);
+	dateTime.date.year = 2019; dateTime.date.month = 3; dateTime.date.day = 7;
+	dateTime.time.hour = 13; dateTime.time.minute = 4; dateTime.time.second = 5;
+	dateTime.time.millisecond = 123; dateTime.time.microsecond = 456;
+	rsslEncodeElementEntry(pEncIter, &entry, &dateTime);
+
+	entry.name.data = (char*)"Qos"; entry.name.length = 3; entry.dataType = RSSL_DT_QOS;
+	qos.timeliness = RSSL_QOS_TIME_DELAYED; qos.timeInfo = 15; qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+	rsslEncodeElementEntry(pEncIter, &entry, &qos);
+
+	entry.name.data = (char*)"State"; entry.name.length = 5; entry.dataType = RSSL_DT_STATE;
+	state.streamState = RSSL_STREAM_OPEN; state.dataState = RSSL_DATA_SUSPECT; state.code = RSSL_SC_TIMEOUT;
+	state.text.data = (char*)"slow"; state.text.length = 4;
+	rsslEncodeElementEntry(pEncIter, &entry, &state);
+
+	entry.name.data = (char*)"Ascii"; entry.name.length = 5; entry.dataType = RSSL_DT_ASCII_STRING;
+	rsslEncodeElementEntry(pEncIter, &entry, &ascii);
+
+	entry.name.data = (char*)"Buffer"; entry.name.length = 6; entry.dataType = RSSL_DT_BUFFER;
+	rsslEncodeElementEntry(pEncIter, &entry, &buffer);
+
+	entry.name.data = (char*)"Empty"; entry.name.length = 5; entry.dataType = RSSL_DT_NO_DATA;
+	rsslEncodeElementEntry(pEncIter, &entry, NULL);
+
+	entry.name.data = (char*)"Reals"; entry.name.length = 5; entry.dataType = RSSL_DT_ARRAY;
+	rsslEncodeElementEntryInit(pEncIter, &entry, 0);
+	array.primitiveType = RSSL_DT_REAL;
+	rsslEncodeArrayInit(pEncIter, &array);
+	real.hint = RSSL_RH_EXPONENT_1; real.value = 15;
+	rsslEncodeArrayEntry(pEncIter, NULL, &real);
+	rsslEncodeArrayEntry(pEncIter, NULL, NULL);
+	real.hint = RSSL_RH_INFINITY;
+	rsslEncodeArrayEntry(pEncIter, NULL, &real);
+	rsslEncodeArrayComplete(pEncIter, RSSL_TRUE);
+	rsslEncodeElementEntryComplete(pEncIter, RSSL_TRUE);
+
+	entry.name.data = (char*)"Fields"; entry.name.length = 6; entry.dataType = RSSL_DT_FIELD_LIST;
+	rsslEncodeElementEntryInit(pEncIter, &entry, 0);
+	encodeFieldList(pEncIter, 1);
+	rsslEncodeElementEntryComplete(pEncIter, RSSL_TRUE);
+
+	rsslEncodeElementListComplete(pEncIter, RSSL_TRUE);
+}
+
+static void checkMsgs()
+{
+	static char msgMem[MAX_MSG_SIZE];
+	RsslEncodeIterator encIter;
+	RsslBuffer encMsg;
+
+	/* Refresh with a key, key attributes and a field list. */
+	{
+		RsslRefreshMsg refreshMsg;
+		RsslElementList elementList = RSSL_INIT_ELEMENT_LIST;
+		RsslElementEntry element = RSSL_INIT_ELEMENT_ENTRY;
+		RsslUInt role = 1;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearRefreshMsg(&refreshMsg);
+		refreshMsg.msgBase.streamId = 5;
+		refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		refreshMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+		refreshMsg.flags = RSSL_RFMF_HAS_MSG_KEY | RSSL_RFMF_SOLICITED | RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_HAS_QOS | RSSL_RFMF_HAS_SEQ_NUM;
+		refreshMsg.seqNum = 12;
+		refreshMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+		refreshMsg.qos.rate = RSSL_QOS_RATE_TIME_CONFLATED;
+		refreshMsg.qos.rateInfo = 500;
+		refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+		refreshMsg.state.dataState = RSSL_DATA_OK;
+		refreshMsg.state.text.data = (char*)"All is well";
+		refreshMsg.state.text.length = 11;
+		refreshMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_NAME_TYPE | RSSL_MKF_HAS_ATTRIB;
+		refreshMsg.msgBase.msgKey.serviceId = 1;
+		refreshMsg.msgBase.msgKey.name.data = (char*)"TRI.N";
+		refreshMsg.msgBase.msgKey.name.length = 5;
+		refreshMsg.msgBase.msgKey.nameType = RDM_INSTRUMENT_NAME_TYPE_RIC;
+		refreshMsg.msgBase.msgKey.attribContainerType = RSSL_DT_ELEMENT_LIST;
+
+		if (rsslEncodeMsgInit(&encIter, (RsslMsg*)&refreshMsg, 0) == RSSL_RET_ENCODE_MSG_KEY_OPAQUE)
+		{
+			elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+			rsslEncodeElementListInit(&encIter, &elementList, NULL, 0);
+			element.name.data = (char*)"Role";
+			element.name.length = 4;
+			element.dataType = RSSL_DT_UINT;
+			rsslEncodeElementEntry(&encIter, &element, &role);
+			rsslEncodeElementListComplete(&encIter, RSSL_TRUE);
+			rsslEncodeMsgKeyAttribComplete(&encIter, RSSL_TRUE);
+		}
+		encodeFieldList(&encIter, 0);
+		rsslEncodeMsgComplete(&encIter, RSSL_TRUE);
+		checkMsg("Refresh", &encIter, &encMsg);
+	}
+
+	/* Update with an element list of every primitive type. */
+	{
+		RsslUpdateMsg updateMsg;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearUpdateMsg(&updateMsg);
+		updateMsg.msgBase.streamId = -7;
+		updateMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		updateMsg.msgBase.containerType = RSSL_DT_ELEMENT_LIST;
+		updateMsg.flags = RSSL_UPMF_HAS_CONF_INFO | RSSL_UPMF_DO_NOT_RIPPLE;
+		updateMsg.updateType = RDM_UPD_EVENT_TYPE_QUOTE;
+		updateMsg.conflationCount = 3;
+		updateMsg.conflationTime = 100;
+		rsslEncodeMsgInit(&encIter, (RsslMsg*)&updateMsg, 0);
+		encodeElementList(&encIter);
+		rsslEncodeMsgComplete(&encIter, RSSL_TRUE);
+		checkMsg("Update", &encIter, &encMsg);
+	}
+
+	/* Refresh with a map of field lists and summary data. */
+	{
+		RsslRefreshMsg refreshMsg;
+		RsslMap map = RSSL_INIT_MAP;
+		RsslMapEntry mapEntry = RSSL_INIT_MAP_ENTRY;
+		RsslBuffer key = { 4, (char*)"ord1" };
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearRefreshMsg(&refreshMsg);
+		refreshMsg.msgBase.streamId = 8;
+		refreshMsg.msgBase.domainType = RSSL_DMT_MARKET_BY_ORDER;
+		refreshMsg.msgBase.containerType = RSSL_DT_MAP;
+		refreshMsg.flags = RSSL_RFMF_REFRESH_COMPLETE;
+		refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+		refreshMsg.state.dataState = RSSL_DATA_OK;
+		rsslEncodeMsgInit(&encIter, (RsslMsg*)&refreshMsg, 0);
+
+		map.flags = RSSL_MPF_HAS_SUMMARY_DATA | RSSL_MPF_HAS_TOTAL_COUNT_HINT;
+		map.keyPrimitiveType = RSSL_DT_BUFFER;
+		map.containerType = RSSL_DT_FIELD_LIST;
+		map.totalCountHint = 2;
+		rsslEncodeMapInit(&encIter, &map, 0, 0);
+		encodeFieldList(&encIter, 2);
+		rsslEncodeMapSummaryDataComplete(&encIter, RSSL_TRUE);
+
+		mapEntry.action = RSSL_MPEA_ADD_ENTRY;
+		rsslEncodeMapEntryInit(&encIter, &mapEntry, &key, 0);
+		encodeFieldList(&encIter, 3);
+		rsslEncodeMapEntryComplete(&encIter, RSSL_TRUE);
+
+		key.data = (char*)"ord2";
+		mapEntry.action = RSSL_MPEA_DELETE_ENTRY;
+		rsslEncodeMapEntry(&encIter, &mapEntry, &key);
+
+		rsslEncodeMapComplete(&encIter, RSSL_TRUE);
+		rsslEncodeMsgComplete(&encIter, RSSL_TRUE);
+		checkMsg("Map", &encIter, &encMsg);
+	}
+
+	/* Generic message with a vector of series of element lists. */
+	{
+		RsslGenericMsg genericMsg;
+		RsslVector vector = RSSL_INIT_VECTOR;
+		RsslVectorEntry vectorEntry = RSSL_INIT_VECTOR_ENTRY;
+		RsslSeries series = RSSL_INIT_SERIES;
+		RsslSeriesEntry seriesEntry = RSSL_INIT_SERIES_ENTRY;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearGenericMsg(&genericMsg);
+		genericMsg.msgBase.streamId = 9;
+		genericMsg.msgBase.domainType = 200;
+		genericMsg.msgBase.containerType = RSSL_DT_VECTOR;
+		genericMsg.flags = RSSL_GNMF_HAS_SEQ_NUM | RSSL_GNMF_MESSAGE_COMPLETE;
+		genericMsg.seqNum = 4;
+		rsslEncodeMsgInit(&encIter, (RsslMsg*)&genericMsg, 0);
+
+		vector.flags = RSSL_VTF_SUPPORTS_SORTING;
+		vector.containerType = RSSL_DT_SERIES;
+		rsslEncodeVectorInit(&encIter, &vector, 0, 0);
+
+		vectorEntry.index = 1;
+		vectorEntry.action = RSSL_VTEA_SET_ENTRY;
+		rsslEncodeVectorEntryInit(&encIter, &vectorEntry, 0);
+		series.containerType = RSSL_DT_ELEMENT_LIST;
+		rsslEncodeSeriesInit(&encIter, &series, 0, 0);
+		rsslEncodeSeriesEntryInit(&encIter, &seriesEntry, 0);
+		encodeElementList(&encIter);
+		rsslEncodeSeriesEntryComplete(&encIter, RSSL_TRUE);
+		rsslEncodeSeriesComplete(&encIter, RSSL_TRUE);
+		rsslEncodeVectorEntryComplete(&encIter, RSSL_TRUE);
+
+		vectorEntry.index = 2;
+		vectorEntry.action = RSSL_VTEA_DELETE_ENTRY;
+		rsslEncodeVectorEntry(&encIter, &vectorEntry);
+
+		rsslEncodeVectorComplete(&encIter, RSSL_TRUE);
+		rsslEncodeMsgComplete(&encIter, RSSL_TRUE);
+		checkMsg("Vector", &encIter, &encMsg);
+	}
+
+	/* Messages without a payload. */
+	{
+		RsslStatusMsg statusMsg;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearStatusMsg(&statusMsg);
+		statusMsg.msgBase.streamId = 3;
+		statusMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		statusMsg.flags = RSSL_STMF_HAS_STATE | RSSL_STMF_CLEAR_CACHE;
+		statusMsg.state.streamState = RSSL_STREAM_CLOSED_RECOVER;
+		statusMsg.state.dataState = RSSL_DATA_SUSPECT;
+		statusMsg.state.code = RSSL_SC_NO_RESOURCES;
+		rsslEncodeMsg(&encIter, (RsslMsg*)&statusMsg);
+		checkMsg("Status", &encIter, &encMsg);
+	}
+
+	{
+		RsslRequestMsg requestMsg;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearRequestMsg(&requestMsg);
+		requestMsg.msgBase.streamId = 3;
+		requestMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		requestMsg.flags = RSSL_RQMF_STREAMING | RSSL_RQMF_HAS_PRIORITY | RSSL_RQMF_HAS_QOS;
+		requestMsg.priorityClass = 1;
+		requestMsg.priorityCount = 2;
+		requestMsg.qos.timeliness = RSSL_QOS_TIME_REALTIME;
+		requestMsg.qos.rate = RSSL_QOS_RATE_TICK_BY_TICK;
+		requestMsg.msgBase.msgKey.flags = RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
+		requestMsg.msgBase.msgKey.name.data = (char*)"IBM.N";
+		requestMsg.msgBase.msgKey.name.length = 5;
+		requestMsg.msgBase.msgKey.serviceId = 257;
+		rsslEncodeMsg(&encIter, (RsslMsg*)&requestMsg);
+		checkMsg("Request", &encIter, &encMsg);
+	}
+
+	{
+		RsslPostMsg postMsg;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearPostMsg(&postMsg);
+		postMsg.msgBase.streamId = 1;
+		postMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		postMsg.msgBase.containerType = RSSL_DT_OPAQUE;
+		postMsg.flags = RSSL_PSMF_HAS_POST_ID | RSSL_PSMF_POST_COMPLETE | RSSL_PSMF_ACK;
+		postMsg.postId = 5;
+		postMsg.postUserInfo.postUserAddr = 1;
+		postMsg.postUserInfo.postUserId = 2;
+		postMsg.msgBase.encDataBody.data = (char*)"\x01\x02\x03hello";
+		postMsg.msgBase.encDataBody.length = 8;
+		rsslEncodeMsg(&encIter, (RsslMsg*)&postMsg);
+		checkMsg("Post", &encIter, &encMsg);
+	}
+
+	{
+		RsslCloseMsg closeMsg;
+
+		setEncodeIterator(&encIter, &encMsg, msgMem);
+		rsslClearCloseMsg(&closeMsg);
+		closeMsg.msgBase.streamId = 3;
+		closeMsg.msgBase.domainType = RSSL_DMT_MARKET_PRICE;
+		closeMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+		closeMsg.flags = RSSL_CLMF_ACK;
+		rsslEncodeMsg(&encIter, (RsslMsg*)&closeMsg);
+		checkMsg("Close", &encIter, &encMsg);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	const char *fieldDictionaryFile = "RDMFieldDictionary";
+	const char *enumDictionaryFile = "enumtype.def";
+	char errorText[256];
+	RsslBuffer errorBuffer = { sizeof(errorText), errorText };
+	RsslJsonConverterOptions options = RSSL_INIT_JSON_CONVERTER_OPTIONS;
+	RsslJsonConverterError error;
+	int i;
+
+	for (i = 1; i < argc; ++i)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			fieldDictionaryFile = argv[++i];
+		else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+			enumDictionaryFile = argv[++i];
+		else
+		{
+			printf("Usage: %s [-f fieldDictionaryFile] [-e enumDictionaryFile]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	rsslClearDataDictionary(&dictionary);
+	if (rsslLoadFieldDictionary(fieldDictionaryFile, &dictionary, &errorBuffer) < RSSL_RET_SUCCESS
+			|| rsslLoadEnumTypeDictionary(enumDictionaryFile, &dictionary, &errorBuffer) < RSSL_RET_SUCCESS)
+	{
+		printf("Unable to load dictionary: %s\n", errorText);
+		return 1;
+	}
+
+	options.pDictionary = &dictionary;
+	if ((jsonConverter = rsslJsonConverterCreate(&options, &error)) == NULL)
+	{
+		printf("rsslJsonConverterCreate() failed: %s\n", error.text);
+		rsslDeleteDataDictionary(&dictionary);
+		return 1;
+	}
+
+	checkMsgs();
+
+	rsslJsonConverterDestroy(jsonConverter);
+	rsslDeleteDataDictionary(&dictionary);
+
+	if (mismatchCount)
+	{
+		printf("%d mismatches found.\n", mismatchCount);
+		return 1;
+	}
+
+	printf("All messages match.\n");
+	return 0;
+}
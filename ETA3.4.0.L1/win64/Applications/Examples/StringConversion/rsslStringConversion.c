@@ -0,0 +1,280 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/*
+ * This example checks that the word-at-a-time parsers of the string conversions give the same results
+ * as the character loops and sscanf() formats they stand in for.
+ *
+ * Each generated string is converted twice: once as is, which takes the word-at-a-time parser when the
+ * string has one of its forms, and once with a change that every parser but the word-at-a-time one ignores:
+ * - reals (rwf_storeal64(), rwf_storeal64_size()): leading zeros that make the string too long for it;
+ * - rsslDateTimeStringToDateTime(): a leading space, which sscanf() skips;
+ * - rwf_stodatetime(), rwf_stodatetime_size(): a leading zero on the month.
+ * The return codes and converted values must match.  Some strings are altered at random, so that strings
+ * the word-at-a-time parsers must refuse are checked as well.
+ * It prints each mismatch and exits with a non-zero status if any were found.
+ */
+
+#include "rtr/rsslDataPackage.h"
+#include "rtr/rwfConvert.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define STRING_COUNT 200000
+#define MAX_PRINTED_MISMATCHES 10
+
+/* Longest string handled by the word-at-a-time real parser; leading zeros make the strings longer than this. */
+#define PADDING_ZEROS "0000000000000000"
+
+static RsslUInt64 randomState = 88172645463325252ULL;
+static int mismatchCount = 0;
+
+/* xorshift generator, so every run checks the same strings */
+static RsslUInt64 nextRandom()
+{
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 7;
+	randomState ^= randomState << 17;
+	return randomState;
+}
+
+static void reportMismatch(const char *function, const char *string, const char *text)
+{
+	if (mismatchCount++ < MAX_PRINTED_MISMATCHES)
+		printf("Mismatch: %s(\"%s\"): %s\n", function, string, text);
+}
+
+/* Appends up to 'maxDigits' random digits. */
+static char *appendDigits(char *ptr, int maxDigits)
+{
+	int count = 1 + (int)(nextRandom() % maxDigits);
+
+	while (count--)
+		*ptr++ = (char)('0' + nextRandom() % 10);
+	return ptr;
+}
+
+/* Replaces a character (other than the first, whose changes the padding would not carry) with one that can
+ * appear in the strings, sometimes, so the parsers also see strings that are nearly but not quite valid. */
+static void alterString(char *string, const char *characters)
+{
+	size_t length = strlen(string);
+
+	if (length > 1 && nextRandom() % 4 == 0)
+		string[1 + nextRandom() % (length - 1)] = characters[nextRandom() % strlen(characters)];
+}
+
+static void generateReal(char *string)
+{
+	char *ptr = string;
+	int denominator;
+
+	if (nextRandom() & 1)
+		*ptr++ = '-';
+
+	switch (nextRandom() % 4)
+	{
+		case 0: /* "123" */
+			ptr = appendDigits(ptr, 15);
+			break;
+		case 1: /* "123.45" */
+			ptr = appendDigits(ptr, 7);
+			*ptr++ = '.';
+			ptr = appendDigits(ptr, 7);
+			break;
+		case 2: /* "12 3/4" */
+			ptr = appendDigits(ptr, 4);
+			*ptr++ = ' ';
+			ptr = appendDigits(ptr, 3);
+			*ptr++ = '/';
+			denominator = 1 << (nextRandom() % 9);
+			ptr += sprintf(ptr, "%d", denominator);
+			break;
+		default: /* "3/4" */
+			ptr = appendDigits(ptr, 3);
+			*ptr++ = '/';
+			denominator = 1 << (nextRandom() % 9);
+			ptr += sprintf(ptr, "%d", denominator);
+			break;
+	}
+	*ptr = '\0';
+
+	alterString(string, "0123456789 ./-");
+}
+
+static void checkReal(const char *function, const char *string, RsslRet ret, RsslReal *pReal, RsslRet refRet, RsslReal *pRefReal)
+{
+	char text[128];
+
+	if (ret != refRet)
+	{
+		snprintf(text, sizeof(text), "returned %d, expected %d", ret, refRet);
+		reportMismatch(function, string, text);
+	}
+	else if (ret == RSSL_RET_SUCCESS && (pReal->isBlank != pRefReal->isBlank || pReal->hint != pRefReal->hint || pReal->value != pRefReal->value))
+	{
+		snprintf(text, sizeof(text), "value " RTR_LLD " hint %u, expected " RTR_LLD " hint %u",
+				pReal->value, pReal->hint, pRefReal->value, pRefReal->hint);
+		reportMismatch(function, string, text);
+	}
+}
+
+static void checkReals()
+{
+	char string[64], padded[96];
+	int i;
+
+	for (i = 0; i < STRING_COUNT; ++i)
+	{
+		RsslReal real, refReal;
+		RsslRet ret, refRet;
+		size_t signLength;
+
+		generateReal(string);
+		signLength = (string[0] == '-') ? 1 : 0;
+		snprintf(padded, sizeof(padded), "%.*s%s%s", (int)signLength, string, PADDING_ZEROS, string + signLength);
+
+		/* rwf_storeal64() counts each zero of a zero integer into its hint, so the padding changes the result.
+		 * Integers ending in a zero are left to its loop anyway. */
+		if (strspn(string + signLength, "0") != strlen(string + signLength))
+		{
+			rsslClearReal(&real);
+			rsslClearReal(&refReal);
+			ret = rwf_storeal64(&real, string);
+			refRet = rwf_storeal64(&refReal, padded);
+			checkReal("rwf_storeal64", string, ret, &real, refRet, &refReal);
+		}
+
+		rsslClearReal(&real);
+		rsslClearReal(&refReal);
+		ret = rwf_storeal64_size(&real, string, string + strlen(string) - 1);
+		refRet = rwf_storeal64_size(&refReal, padded, padded + strlen(padded) - 1);
+		checkReal("rwf_storeal64_size", string, ret, &real, refRet, &refReal);
+	}
+
+	printf("Reals: checked %d strings.\n", STRING_COUNT);
+}
+
+static void checkDateTime(const char *function, const char *string, RsslRet ret, RsslDateTime *pDateTime, RsslRet refRet, RsslDateTime *pRefDateTime)
+{
+	char text[192];
+
+	if (ret != refRet)
+	{
+		snprintf(text, sizeof(text), "returned %d, expected %d", ret, refRet);
+		reportMismatch(function, string, text);
+	}
+	else if (ret == RSSL_RET_SUCCESS && !rsslDateTimeIsEqual(pDateTime, pRefDateTime))
+	{
+		snprintf(text, sizeof(text), "%u/%u/%u %u:%u:%u.%u.%u.%u, expected %u/%u/%u %u:%u:%u.%u.%u.%u",
+				pDateTime->date.month, pDateTime->date.day, pDateTime->date.year,
+				pDateTime->time.hour, pDateTime->time.minute, pDateTime->time.second,
+				pDateTime->time.millisecond, pDateTime->time.microsecond, pDateTime->time.nanosecond,
+				pRefDateTime->date.month, pRefDateTime->date.day, pRefDateTime->date.year,
+				pRefDateTime->time.hour, pRefDateTime->time.minute, pRefDateTime->time.second,
+				pRefDateTime->time.millisecond, pRefDateTime->time.microsecond, pRefDateTime->time.nanosecond);
+		reportMismatch(function, string, text);
+	}
+}
+
+/* Sets every member to a value no parser produces, so members a parser leaves unset are compared too. */
+static void presetDateTime(RsslDateTime *pDateTime)
+{
+	pDateTime->date.day = pDateTime->date.month = 99;
+	pDateTime->date.year = 9999;
+	pDateTime->time.hour = pDateTime->time.minute = pDateTime->time.second = 99;
+	pDateTime->time.millisecond = pDateTime->time.microsecond = pDateTime->time.nanosecond = 9999;
+}
+
+static void checkDateTimes()
+{
+	char string[64], padded[80];
+	int i;
+
+	for (i = 0; i < STRING_COUNT; ++i)
+	{
+		RsslDateTime dateTime, refDateTime;
+		RsslBuffer buffer;
+		RsslRet ret, refRet;
+
+		/* Random digits rather than valid dates, since none of the parsers check ranges. */
+		if (nextRandom() & 1)
+		{
+			/* "yyyy-mm-ddThh:mm[:ss[.n..n]]" */
+			int fractionDigits = (int)(nextRandom() % 10);
+
+			sprintf(string, "%04u-%02u-%02uT%02u:%02u", (unsigned)(nextRandom() % 10000), (unsigned)(nextRandom() % 100),
+					(unsigned)(nextRandom() % 100), (unsigned)(nextRandom() % 100), (unsigned)(nextRandom() % 100));
+			if (nextRandom() % 4)
+			{
+				sprintf(string + strlen(string), ":%02u", (unsigned)(nextRandom() % 100));
+				if (fractionDigits)
+				{
+					char *ptr = string + strlen(string);
+
+					*ptr++ = (nextRandom() & 1) ? '.' : ',';
+					ptr = appendDigits(ptr, fractionDigits);
+					*ptr = '\0';
+				}
+			}
+			alterString(string, "0123456789-T:.,");
+		}
+		else
+		{
+			/* "mm/dd/yyyy hh:mm:ss[:mmm]" */
+			sprintf(string, "%02u/%02u/%04u %02u:%02u:%02u", (unsigned)(nextRandom() % 100), (unsigned)(nextRandom() % 100),
+					(unsigned)(nextRandom() % 10000), (unsigned)(nextRandom() % 100), (unsigned)(nextRandom() % 100),
+					(unsigned)(nextRandom() % 100));
+			if (nextRandom() & 1)
+				sprintf(string + strlen(string), ":%03u", (unsigned)(nextRandom() % 1000));
+			alterString(string, "0123456789/ :");
+		}
+
+		snprintf(padded, sizeof(padded), " %s", string);
+		presetDateTime(&dateTime);
+		presetDateTime(&refDateTime);
+		buffer.data = string;
+		buffer.length = (RsslUInt32)strlen(string);
+		ret = rsslDateTimeStringToDateTime(&dateTime, &buffer);
+		buffer.data = padded;
+		buffer.length = (RsslUInt32)strlen(padded);
+		refRet = rsslDateTimeStringToDateTime(&refDateTime, &buffer);
+		checkDateTime("rsslDateTimeStringToDateTime", string, ret, &dateTime, refRet, &refDateTime);
+
+		if (string[2] != '/')
+			continue;
+
+		snprintf(padded, sizeof(padded), "0%s", string);
+		ret = rwf_stodatetime(&dateTime, string);
+		refRet = rwf_stodatetime(&refDateTime, padded);
+		checkDateTime("rwf_stodatetime", string, ret, &dateTime, refRet, &refDateTime);
+
+		ret = rwf_stodatetime_size(&dateTime, string, string + strlen(string) - 1);
+		refRet = rwf_stodatetime_size(&refDateTime, padded, padded + strlen(padded) - 1);
+		checkDateTime("rwf_stodatetime_size", string, ret, &dateTime, refRet, &refDateTime);
+	}
+
+	printf("Date/times: checked %d strings.\n", STRING_COUNT);
+}
+
+int main(int argc, char **argv)
+{
+	checkReals();
+	checkDateTimes();
+
+	if (mismatchCount)
+	{
+		printf("%d mismatches found.\n", mismatchCount);
+		return 1;
+	}
+
+	printf("All string conversions match.\n");
+	return 0;
+}
@@ -19,6 +19,16 @@ extern "C" {
 #include <stdarg.h>
 #include <stddef.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
 #include "rtr/rsslDataDictionary.h"
 #include "rtr/rsslDataUtils.h"
 #include "rtr/rsslElementList.h"
@@ -27,7 +37,7 @@ extern "C" {
 #include "rtr/rsslPrimitiveDecoders.h"
 #include "rtr/encoderTools.h"
 #include "rtr/textFileReader.h"
-#include "rtr/rsslHashTable.h"
+#include "rtr/rsslOpenHashTable.h"
 
 #define DICTIONARY_MAX_ENTRIES 65535
 
@@ -37,15 +47,21 @@ typedef struct {
 } FieldsByNameLink;
 
 typedef struct {
-	RsslHashTable	fieldsByName;	/* Table of fields by acronym. */
+	RsslOpenHashTable	fieldsByName;	/* Table of fields by acronym. */
 
 	/* Indicate whether the entries in this dictionary are linked by another one, so we don't delete them on cleanup. */
 	RsslBool isLinked;
 
+	/* If the dictionary was loaded by rsslLoadBinaryDataDictionary, the mapped file that holds it (see rsslSaveBinaryDataDictionary). 
+	 * The whole dictionary is then read-only. */
+	void	*pMappedFile;
+	size_t	mappedFileLength;
+
 	/* Hash table links to use in fieldsByName table. 
 	 * The links are stored on the dictionary itself, not the entry objects. This allows rsslLinkDataDictionary to add fields to the new
 	 * dictionary without editing the links in the old dictionary (so that the table in the old dictionary can still be safely used 
-	 * without locking it). */
+	 * without locking it).
+	 * This must be the last member: a binary dictionary file stores only the members before it, and keeps its links elsewhere. */
 	FieldsByNameLink fieldsByNameLinks[DICTIONARY_MAX_ENTRIES];
 } RsslDictionaryInternal;
 
@@ -58,6 +74,22 @@ typedef enum {
 	RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY	= 0x1 /* This value is one of multiple values that correspond to the same display string. */
 } RsslEnumTypeFlags;
 
+/* Slot in the index of an enum table's values by display string. */
+typedef struct {
+	RsslUInt32	hashSum;	/* Hash sum of the display string. */
+	RsslEnum	value;		/* Lowest value with this display string. */
+	RsslUInt16	isUsed;		/* Whether this slot holds a value. */
+} RsslEnumDisplaySlot;
+
+typedef struct {
+	RsslEnumTypeTable	base;				/* Base table object. */
+
+	/* Open-addressing (linear probing) index of the values by display string, with one slot per distinct string.
+	 * It is kept at most half full, so lookups rarely probe more than one or two slots. */
+	RsslEnumDisplaySlot	*displayIndex;
+	RsslUInt32			displayIndexMask;	/* Number of slots, minus one. */
+} RsslEnumTypeTableImpl;
+
 
 
 /* used for decoding local element list set definitions if user does not pass in memory */
@@ -685,6 +717,12 @@ RsslRet _finishEnumLoadFailure(FILE *fp, RsslDataDictionary *pDict, RsslReferenc
 	return RSSL_RET_FAILURE; /* Return failure code for caller to use */
 }
 
+/* Dictionaries loaded by rsslLoadBinaryDataDictionary are read-only, so nothing can be added to them. */
+static RsslBool _isMappedDictionary(RsslDataDictionary *dictionary)
+{
+	return (dictionary->isInitialized && ((RsslDictionaryInternal*)dictionary->_internal)->pMappedFile != NULL) ? RSSL_TRUE : RSSL_FALSE;
+}
+
 RsslRet _initDictionary(RsslDataDictionary *dictionary, RsslBuffer *errorText)
 {
 	RsslDictionaryEntry ** newDict;
@@ -718,7 +756,7 @@ RsslRet _initDictionary(RsslDataDictionary *dictionary, RsslBuffer *errorText)
 
 	dictionary->_internal = pDictionaryInternal;
 
-	if ( rsslHashTableInit(&pDictionaryInternal->fieldsByName, DICTIONARY_MAX_ENTRIES, rsslHashBufferSum, rsslHashBufferCompare,
+	if ( rsslOpenHashTableInit(&pDictionaryInternal->fieldsByName, DICTIONARY_MAX_ENTRIES, rsslHashBufferSum, rsslHashBufferCompare,
 				RSSL_TRUE, &rsslErrorInfo) != RSSL_RET_SUCCESS )
 	{
 		_setError(errorText, "Failed to initailize fields-by-name table.");
@@ -814,7 +852,7 @@ RsslRet _addFieldToDictionary(RsslDataDictionary *dictionary, RsslDictionaryEntr
 	hashSum = rsslHashBufferSum(&pEntry->acronym);
 
 	/* Check if this acronym is already present. */
-	if ((rsslHashLink = rsslHashTableFind(&pDictionaryInternal->fieldsByName, &pEntry->acronym, &hashSum)) != NULL)
+	if ((rsslHashLink = rsslOpenHashTableFind(&pDictionaryInternal->fieldsByName, &pEntry->acronym, &hashSum)) != NULL)
 	{
 		pFieldsByNameLink = RSSL_HASH_LINK_TO_OBJECT(FieldsByNameLink, nameTableLink, rsslHashLink);
 		RSSL_ASSERT(pFieldsByNameLink->pDictionaryEntry != NULL, Link in fieldsByName table does not have an associated entry);
@@ -849,8 +887,9 @@ RsslRet _addFieldToDictionary(RsslDataDictionary *dictionary, RsslDictionaryEntr
 	}
 
 	pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].pDictionaryEntry = pEntry;
-	rsslHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].nameTableLink, 
-		&pEntry->acronym, &hashSum);
+	if (rsslOpenHashTableInsertLink(&pDictionaryInternal->fieldsByName, &pDictionaryInternal->fieldsByNameLinks[pEntry->fid - (RSSL_MIN_FID)].nameTableLink, 
+		&pEntry->acronym, &hashSum) != RSSL_RET_SUCCESS)
+		return (_setError(errorText, "Failed to add fid %d to fields-by-name table.", pEntry->fid), RSSL_RET_FAILURE);
 
 	dictionary->numberOfEntries++;
 	if (pEntry->fid > dictionary->maxFid) dictionary->maxFid = pEntry->fid;
@@ -978,6 +1017,12 @@ RSSL_API RsslRet rsslLoadFieldDictionary(	const char				*filename,
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was loaded from a binary dictionary file and cannot be changed.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if ((fp = fopen(filename, "r")) == NULL)
 	{
 		_setError(errorText, "Can't open file: '%s'.", filename);
@@ -1707,6 +1752,7 @@ static void _deleteDictionaryEnumTable(RsslEnumTypeTable *pTable)
 
 	free(pTable->enumTypes);
 	free(pTable->fidReferences);
+	free(((RsslEnumTypeTableImpl*)pTable)->displayIndex);
 	free(pTable);
 }
 
@@ -1722,6 +1768,18 @@ RSSL_API RsslRet rsslDeleteDataDictionary( RsslDataDictionary *dictionary )
 	pDictionaryInternal = (RsslDictionaryInternal*)dictionary->_internal;
 	RSSL_ASSERT(pDictionaryInternal != NULL, Dictionary internal pointers is null); /* Dictionary was initialized, so this should exist. */
 
+	/* Everything in a dictionary loaded by rsslLoadBinaryDataDictionary is in the mapped file. */
+	if (pDictionaryInternal->pMappedFile != NULL)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(pDictionaryInternal->pMappedFile);
+#else
+		munmap(pDictionaryInternal->pMappedFile, pDictionaryInternal->mappedFileLength);
+#endif
+		dictionary->isInitialized = RSSL_FALSE;
+		return RSSL_RET_SUCCESS;
+	}
+
 	/* Delete tag info */
 	if (dictionary->infoField_Version.data)
 		free(dictionary->infoField_Version.data);
@@ -1775,7 +1833,7 @@ RSSL_API RsslRet rsslDeleteDataDictionary( RsslDataDictionary *dictionary )
 		free(dictionary->enumTables);
 	}
 
-	rsslHashTableCleanup(&pDictionaryInternal->fieldsByName);
+	rsslOpenHashTableCleanup(&pDictionaryInternal->fieldsByName);
 	free(pDictionaryInternal);
 
 	dictionary->isInitialized = RSSL_FALSE;
@@ -1806,6 +1864,12 @@ RSSL_API RsslRet rsslDecodeFieldDictionary(
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was loaded from a binary dictionary file and cannot be changed.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if (!dictionary->isInitialized && _initDictionary(dictionary, errorText) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
@@ -1986,11 +2050,62 @@ RSSL_API RsslRet rsslDecodeFieldDictionary(
 }
 
 
+/* Builds the display string index of an enum table, and marks values whose display strings are shared with other values. */
+static RsslRet _buildEnumDisplayIndex(RsslEnumTypeTableImpl *pTable)
+{
+	RsslUInt32 slotCount = RSSL_OPEN_HASH_MIN_SLOTS, valueCount = 0, i;
+
+	for (i = 0; i <= pTable->base.maxValue; ++i)
+		if (pTable->base.enumTypes[i] != NULL)
+			++valueCount;
+
+	while (slotCount < valueCount * 2)
+		slotCount *= 2;
+
+	if ((pTable->displayIndex = (RsslEnumDisplaySlot*)calloc(slotCount, sizeof(RsslEnumDisplaySlot))) == NULL)
+		return RSSL_RET_FAILURE;
+	pTable->displayIndexMask = slotCount - 1;
+
+	for (i = 0; i <= pTable->base.maxValue; ++i)
+	{
+		RsslEnumTypeImpl *pEnum = (RsslEnumTypeImpl*)pTable->base.enumTypes[i];
+		RsslUInt32 hashSum, index;
+
+		if (pEnum == NULL)
+			continue;
+
+		hashSum = rsslHashBufferSum(&pEnum->base.display);
+
+		for (index = hashSum & pTable->displayIndexMask; pTable->displayIndex[index].isUsed; index = (index + 1) & pTable->displayIndexMask)
+		{
+			RsslEnumDisplaySlot *pSlot = &pTable->displayIndex[index];
+			RsslEnumTypeImpl *pOtherEnum = (RsslEnumTypeImpl*)pTable->base.enumTypes[pSlot->value];
+
+			if (pSlot->hashSum == hashSum && rsslBufferIsEqual(&pEnum->base.display, &pOtherEnum->base.display))
+			{
+				/* Values have the same display string; mark them as duplicates. */
+				pEnum->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
+				pOtherEnum->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
+				break;
+			}
+		}
+
+		if (!pTable->displayIndex[index].isUsed)
+		{
+			pTable->displayIndex[index].hashSum = hashSum;
+			pTable->displayIndex[index].value = (RsslEnum)i;
+			pTable->displayIndex[index].isUsed = 1;
+		}
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCount, RsslReferenceFidStore *pFids, RsslEnum maxValue, RsslEnumTypeStore *pEnumTypes, RsslBuffer *errorText, int lineNum)
 {
 	RsslEnumTypeTable *pTable;
 	RsslFieldId *fidRefs;
-	int i, j;
+	int i;
 
 	if (dictionary->enumTableCount == ENUM_TABLE_MAX_COUNT) /* Unlikely. */
 		return (_setError(errorText, "Cannot add more tables to this dictionary.", lineNum), RSSL_RET_FAILURE);
@@ -2002,9 +2117,10 @@ RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCo
     		return (_setError(errorText, "No referencing FIDs found before enum table."), RSSL_RET_FAILURE);
 	}
 	
-	pTable = (RsslEnumTypeTable*)malloc(sizeof(RsslEnumTypeTable));
+	pTable = (RsslEnumTypeTable*)malloc(sizeof(RsslEnumTypeTableImpl));
 	if (!pTable)
 		return (_setError(errorText, "Unable to create memory for enumeration table."), RSSL_RET_FAILURE);
+	((RsslEnumTypeTableImpl*)pTable)->displayIndex = NULL;
 	pTable->maxValue = maxValue;
 	pTable->enumTypes = (RsslEnumType**)calloc(maxValue+1, sizeof(RsslEnumType*));
 
@@ -2055,35 +2171,13 @@ RsslRet _addTableToDictionary( RsslDataDictionary *dictionary, RsslUInt32 fidsCo
 		pFids = pFids->next;
 	}
 
-	/* Look for enum values with the same display strings as other values. Mark them as duplicate. */
-	for (i = 1; i < pTable->maxValue; ++i)
-	{
-		RsslEnumTypeImpl *pEnum1 = (RsslEnumTypeImpl*)pTable->enumTypes[i];
-
-		/* If enum not in table, or we already know it's a duplicate, skip. */
-		if (pEnum1 == NULL || pEnum1->flags & RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY) 
-			continue; 
-
-		for (j = 0; j < i; ++j)
-		{
-			RsslEnumTypeImpl *pEnum2 = (RsslEnumTypeImpl*)pTable->enumTypes[j];
-
-			/* If enum not in table, skip. */
-			if (pEnum2 == NULL)
-				continue;
-
-			if (rsslBufferIsEqual(&pEnum1->base.display, &pEnum2->base.display))
-			{
-				/* Values have the same display string; mark them as duplicates. */
-				pEnum1->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
-				pEnum2->flags |= RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY;
-				break;
-			}
-		}
-	}
-
 	RSSL_ASSERT(fidsCount == 0, Invalid content);
 	dictionary->enumTables[dictionary->enumTableCount++] = pTable;
+
+	/* Index the values by display string. This also finds values with the same display strings as other values, and marks them as duplicate. */
+	if (_buildEnumDisplayIndex((RsslEnumTypeTableImpl*)pTable) != RSSL_RET_SUCCESS)
+		return (_setError(errorText, "Unable to create storage for enum display string index."), RSSL_RET_FAILURE);
+
 	return RSSL_RET_SUCCESS;
 }
 
@@ -2114,6 +2208,12 @@ RSSL_API RsslRet rsslLoadEnumTypeDictionary(	const char				*filename,
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was loaded from a binary dictionary file and cannot be changed.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if ((fp = fopen(filename, "r")) == NULL)
 	{
 		_setError(errorText, "Can't open file: '%s'.", filename);
@@ -2305,6 +2405,12 @@ RSSL_API RsslRet rsslDecodeEnumTypeDictionary(
 		return RSSL_RET_FAILURE;
 	}
 
+	if (_isMappedDictionary(dictionary))
+	{
+		_setError(errorText, "Dictionary was loaded from a binary dictionary file and cannot be changed.");
+		return RSSL_RET_FAILURE;
+	}
+
 	if (!dictionary->isInitialized && _initDictionary(dictionary, errorText) != RSSL_RET_SUCCESS)
 		return RSSL_RET_FAILURE;
 
@@ -3116,7 +3222,7 @@ RSSL_API RsslRet rsslExtractDictionaryType(RsslDecodeIterator *dIter,
 RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictionary *pDictionary, const RsslBuffer *pFieldName)
 {
 	FieldsByNameLink *pFieldsByNameLink;
-	RsslHashLink *rsslHashLink = rsslHashTableFind(&((RsslDictionaryInternal*)pDictionary->_internal)->fieldsByName, (RsslBuffer*)pFieldName, NULL);
+	RsslHashLink *rsslHashLink = rsslOpenHashTableFind(&((RsslDictionaryInternal*)pDictionary->_internal)->fieldsByName, (RsslBuffer*)pFieldName, NULL);
 	
 	if (rsslHashLink == NULL)
 		return NULL;
@@ -3129,26 +3235,28 @@ RSSL_API RsslDictionaryEntry *rsslDictionaryGetEntryByFieldName(RsslDataDictiona
  
 RSSL_API RsslRet rsslDictionaryEntryGetEnumValueByDisplayString(const RsslDictionaryEntry *pEntry, const RsslBuffer *pEnumDisplay, RsslEnum *pEnumValue, RsslBuffer *errorText)
 {
-	RsslUInt32 i;
-	RsslEnumTypeTable *pEnumTypeTable = pEntry->pEnumTypeTable;
+	RsslEnumTypeTableImpl *pEnumTypeTable = (RsslEnumTypeTableImpl*)pEntry->pEnumTypeTable;
+	RsslUInt32 hashSum, index;
 
 	if (pEnumTypeTable == NULL)
 		return RSSL_RET_FAILURE;
 
 	/* Find a value matching the given display string. */
-	for (i = 0; i < pEnumTypeTable->maxValue; ++i)
+	hashSum = rsslHashBufferSum((void*)pEnumDisplay);
+
+	for (index = hashSum & pEnumTypeTable->displayIndexMask; pEnumTypeTable->displayIndex[index].isUsed; index = (index + 1) & pEnumTypeTable->displayIndexMask)
 	{
-		if (pEnumTypeTable->enumTypes[i] == NULL)
-			continue;
+		RsslEnumDisplaySlot *pSlot = &pEnumTypeTable->displayIndex[index];
+		RsslEnumTypeImpl *pEnum = (RsslEnumTypeImpl*)pEnumTypeTable->base.enumTypes[pSlot->value];
 
-		if (rsslBufferIsEqual(pEnumDisplay, &pEnumTypeTable->enumTypes[i]->display))
+		if (pSlot->hashSum == hashSum && rsslBufferIsEqual(pEnumDisplay, &pEnum->base.display))
 		{
 			/* If there are multiple values corresponding to the given display string, return an error.
 			 * We cannot provide a correct value. */
-			if (((RsslEnumTypeImpl*)pEnumTypeTable->enumTypes[i])->flags & RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY)
+			if (pEnum->flags & RSSL_ENUMTYPE_FL_DUPLICATE_DISPLAY)
 				return RSSL_RET_DICT_DUPLICATE_ENUM_VALUE;
 
-			*pEnumValue = pEnumTypeTable->enumTypes[i]->value;
+			*pEnumValue = pEnum->base.value;
 			return RSSL_RET_SUCCESS;
 		}
 	}
@@ -3162,6 +3270,10 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 	RsslDictionaryInternal *pNewDictionaryInternal = (RsslDictionaryInternal*)pNewDictionary->_internal;
 	int i;
 
+	/* Linking changes both dictionaries. */
+	if (pNewDictionaryInternal->pMappedFile != NULL || pOldDictionaryInternal->pMappedFile != NULL)
+		return (_setError(errorText, "Dictionaries loaded from binary dictionary files cannot be linked."), RSSL_RET_FAILURE);
+
 	/* Check that the new dictionary is a superset of the old dictionary before linking them. */
 
 	/* Check that major versions match. */
@@ -3330,7 +3442,7 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 		{
 			/* Update the entry key of FieldsByNameLink.nameTableLink as the existing key 
 			   in pNewDictionary will be replaced with the entry from pOldDictionary */
-			if ((rsslHashLink = rsslHashTableFind(&pNewDictionaryInternal->fieldsByName, &pOldEntry->acronym, NULL)) != NULL)
+			if ((rsslHashLink = rsslOpenHashTableFind(&pNewDictionaryInternal->fieldsByName, &pOldEntry->acronym, NULL)) != NULL)
 			{
 				rsslHashLink->pKey = &pOldEntry->acronym;
 			}
@@ -3347,6 +3459,622 @@ RSSL_API RsslRet rsslLinkDataDictionary(RsslDataDictionary *pNewDictionary, Rssl
 	return RSSL_RET_SUCCESS;
 }
 
+/*** Binary dictionary files ***/
+
+/* A binary dictionary file is an image of a loaded dictionary: the RsslDataDictionary, its internal structure, the entries and enum
+ * tables, and the fields-by-name table, laid out as they are in memory.  Each pointer is stored as an offset from the start of the 
+ * file (zero for NULL), and the file ends with a table of the offsets of every stored pointer, so a loader only needs to map the file 
+ * and add its base address to each of them.
+ * Structures that hold pointers come first, followed by strings and other data that do not, so that mapping the file only makes 
+ * private copies of the pages that the relocations change. */
+
+#define RSSL_BINARY_DICTIONARY_VERSION 1
+#define RSSL_BINARY_DICTIONARY_BYTE_ORDER_MARK 0x01020304
+
+static const char RSSL_BINARY_DICTIONARY_MAGIC[8] = { 'R', 'S', 'S', 'L', 'D', 'I', 'C', 'T' };
+
+typedef struct {
+	char		magic[8];			/* RSSL_BINARY_DICTIONARY_MAGIC */
+	RsslUInt32	version;			/* RSSL_BINARY_DICTIONARY_VERSION */
+	RsslUInt32	byteOrderMark;		/* RSSL_BINARY_DICTIONARY_BYTE_ORDER_MARK, in the byte order of the writer. */
+
+	/* The layout of the stored structures depends on the build, so these must match the loader's. */
+	RsslUInt32	pointerSize;
+	RsslUInt32	dictionarySize;
+	RsslUInt32	internalSize;
+	RsslUInt32	entrySize;
+	RsslUInt32	enumTableSize;
+	RsslUInt32	enumTypeSize;
+	RsslUInt32	hashSlotSize;
+	RsslUInt32	reserved;
+
+	RsslUInt64	fileLength;
+	RsslUInt64	dictionaryOffset;	/* Offset of the RsslDataDictionary. */
+	RsslUInt64	relocationOffset;	/* Offset of the relocation table (an array of RsslUInt64 offsets). */
+	RsslUInt64	relocationCount;
+} BinaryDictionaryHeader;
+
+/* Growable buffer used while building a binary dictionary. */
+typedef struct {
+	char		*data;
+	size_t		length;
+	size_t		capacity;
+} BinaryDictionaryBuffer;
+
+/* Offsets of stored pointers. */
+typedef struct {
+	RsslUInt64	*offsets;
+	size_t		count;
+	size_t		capacity;
+} BinaryDictionaryRelocations;
+
+typedef struct {
+	BinaryDictionaryBuffer		image;			/* Header and structures that hold pointers. */
+	BinaryDictionaryBuffer		pool;			/* Strings and other data, appended to the image when it is written. */
+	BinaryDictionaryRelocations	relocations;	/* Pointers to offsets in the image. */
+	BinaryDictionaryRelocations	poolRelocations;/* Pointers to offsets in the pool. */
+} BinaryDictionaryWriter;
+
+/* Only the members of RsslDictionaryInternal before fieldsByNameLinks are stored. */
+#define BINARY_DICTIONARY_INTERNAL_SIZE (offsetof(RsslDictionaryInternal, fieldsByNameLinks))
+
+/* Alignment of the stored structures. */
+#define BINARY_DICTIONARY_ALIGNMENT 8
+
+/* Adds zeroed space for an object to a buffer. alignment must be a power of two. */
+static RsslRet _binDictReserve(BinaryDictionaryBuffer *pBuffer, size_t size, size_t alignment, size_t *pOffset)
+{
+	size_t offset = (pBuffer->length + alignment - 1) & ~(alignment - 1);
+
+	if (offset + size > pBuffer->capacity)
+	{
+		size_t newCapacity = pBuffer->capacity ? pBuffer->capacity : 65536;
+		char *newData;
+
+		while (newCapacity < offset + size)
+			newCapacity *= 2;
+
+		if ((newData = (char*)realloc(pBuffer->data, newCapacity)) == NULL)
+			return RSSL_RET_FAILURE;
+
+		memset(newData + pBuffer->capacity, 0, newCapacity - pBuffer->capacity);
+		pBuffer->data = newData;
+		pBuffer->capacity = newCapacity;
+	}
+
+	pBuffer->length = offset + size;
+	*pOffset = offset;
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet _binDictAddRelocation(BinaryDictionaryRelocations *pRelocations, size_t offset)
+{
+	if (pRelocations->count == pRelocations->capacity)
+	{
+		size_t newCapacity = pRelocations->capacity ? pRelocations->capacity * 2 : 4096;
+		RsslUInt64 *newOffsets;
+
+		if ((newOffsets = (RsslUInt64*)realloc(pRelocations->offsets, newCapacity * sizeof(RsslUInt64))) == NULL)
+			return RSSL_RET_FAILURE;
+
+		pRelocations->offsets = newOffsets;
+		pRelocations->capacity = newCapacity;
+	}
+
+	pRelocations->offsets[pRelocations->count++] = offset;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Stores a pointer, at imageOffset in the image, to targetOffset in the image (or in the pool, if inPool is set). */
+static RsslRet _binDictSetPointer(BinaryDictionaryWriter *pWriter, size_t imageOffset, size_t targetOffset, RsslBool inPool)
+{
+	void *pointer = (void*)targetOffset;
+
+	memcpy(pWriter->image.data + imageOffset, &pointer, sizeof(void*));
+	return _binDictAddRelocation(inPool ? &pWriter->poolRelocations : &pWriter->relocations, imageOffset);
+}
+
+/* Copies data to the pool and stores a pointer to it at imageOffset. A null terminator is added, as with strings in loaded dictionaries. */
+static RsslRet _binDictAddData(BinaryDictionaryWriter *pWriter, size_t imageOffset, const void *pData, size_t length, size_t alignment)
+{
+	size_t offset;
+
+	if (_binDictReserve(&pWriter->pool, length + 1, alignment, &offset) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	memcpy(pWriter->pool.data + offset, pData, length);
+	return _binDictSetPointer(pWriter, imageOffset, offset, RSSL_TRUE);
+}
+
+/* Stores the RsslBuffer at imageOffset, with a copy of its string. */
+static RsslRet _binDictAddBuffer(BinaryDictionaryWriter *pWriter, size_t imageOffset, const RsslBuffer *pBuffer)
+{
+	RsslUInt32 length = pBuffer->data ? pBuffer->length : 0;
+
+	memcpy(pWriter->image.data + imageOffset + offsetof(RsslBuffer, length), &length, sizeof(length));
+
+	if (pBuffer->data == NULL)
+		return RSSL_RET_SUCCESS;
+
+	return _binDictAddData(pWriter, imageOffset + offsetof(RsslBuffer, data), pBuffer->data, pBuffer->length, 1);
+}
+
+static void _binDictCleanupWriter(BinaryDictionaryWriter *pWriter)
+{
+	free(pWriter->image.data);
+	free(pWriter->pool.data);
+	free(pWriter->relocations.offsets);
+	free(pWriter->poolRelocations.offsets);
+}
+
+/* Builds the image of a dictionary, up to the point where the pool is appended. */
+static RsslRet _binDictBuildImage(BinaryDictionaryWriter *pWriter, RsslDataDictionary *pDictionary, size_t *entryTableOffsets, 
+		FieldsByNameLink *pLinks, size_t *linkEntryOffsets, RsslBuffer *errorText)
+{
+	RsslOpenHashTable fieldsByName;
+	RsslErrorInfo rsslErrorInfo;
+	size_t dictionaryOffset, internalOffset, entriesOffset, tablesOffset, linksOffset, slotsOffset, offset;
+	RsslUInt32 linkCount = 0, i;
+	RsslDataDictionary *pImageDictionary;
+	RsslDictionaryInternal *pImageInternal;
+	RsslRet ret = RSSL_RET_FAILURE;
+	int fid;
+
+	/* Header is filled in when the image is written. */
+	if (_binDictReserve(&pWriter->image, sizeof(BinaryDictionaryHeader), BINARY_DICTIONARY_ALIGNMENT, &offset) != RSSL_RET_SUCCESS
+			|| _binDictReserve(&pWriter->image, sizeof(RsslDataDictionary), BINARY_DICTIONARY_ALIGNMENT, &dictionaryOffset) != RSSL_RET_SUCCESS
+			|| _binDictReserve(&pWriter->image, BINARY_DICTIONARY_INTERNAL_SIZE, BINARY_DICTIONARY_ALIGNMENT, &internalOffset) != RSSL_RET_SUCCESS
+			|| _binDictReserve(&pWriter->image, (RSSL_MAX_FID-RSSL_MIN_FID+1) * sizeof(RsslDictionaryEntry*), BINARY_DICTIONARY_ALIGNMENT, &entriesOffset) != RSSL_RET_SUCCESS
+			|| _binDictReserve(&pWriter->image, (pDictionary->enumTableCount ? pDictionary->enumTableCount : 1) * sizeof(RsslEnumTypeTable*), BINARY_DICTIONARY_ALIGNMENT, &tablesOffset) != RSSL_RET_SUCCESS)
+		return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+	/* Dictionary */
+	pImageDictionary = (RsslDataDictionary*)(pWriter->image.data + dictionaryOffset);
+	pImageDictionary->minFid = pDictionary->minFid;
+	pImageDictionary->maxFid = pDictionary->maxFid;
+	pImageDictionary->numberOfEntries = pDictionary->numberOfEntries;
+	pImageDictionary->isInitialized = RSSL_TRUE;
+	pImageDictionary->enumTableCount = pDictionary->enumTableCount;
+	pImageDictionary->info_DictionaryId = pDictionary->info_DictionaryId;
+
+	if (_binDictSetPointer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, entriesArray), 
+				entriesOffset + (RSSL_MIN_FID < 0 ? -(RSSL_MIN_FID) : 0) * sizeof(RsslDictionaryEntry*), RSSL_FALSE) != RSSL_RET_SUCCESS
+			|| _binDictSetPointer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, enumTables), tablesOffset, RSSL_FALSE) != RSSL_RET_SUCCESS
+			|| _binDictSetPointer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, _internal), internalOffset, RSSL_FALSE) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Version), &pDictionary->infoField_Version) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_RT_Version), &pDictionary->infoEnum_RT_Version) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_DT_Version), &pDictionary->infoEnum_DT_Version) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Filename), &pDictionary->infoField_Filename) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Desc), &pDictionary->infoField_Desc) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Build), &pDictionary->infoField_Build) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoField_Date), &pDictionary->infoField_Date) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_Filename), &pDictionary->infoEnum_Filename) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_Desc), &pDictionary->infoEnum_Desc) != RSSL_RET_SUCCESS
+			|| _binDictAddBuffer(pWriter, dictionaryOffset + offsetof(RsslDataDictionary, infoEnum_Date), &pDictionary->infoEnum_Date) != RSSL_RET_SUCCESS)
+		return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+	/* Enum tables. Note where each one is, by the fields that reference it. */
+	for (i = 0; i < pDictionary->enumTableCount; ++i)
+	{
+		RsslEnumTypeTableImpl *pTable = (RsslEnumTypeTableImpl*)pDictionary->enumTables[i];
+		RsslEnumTypeTableImpl *pImageTable;
+		size_t tableOffset, enumTypesOffset;
+		RsslUInt32 j;
+
+		if (_binDictReserve(&pWriter->image, sizeof(RsslEnumTypeTableImpl), BINARY_DICTIONARY_ALIGNMENT, &tableOffset) != RSSL_RET_SUCCESS
+				|| _binDictReserve(&pWriter->image, ((size_t)pTable->base.maxValue + 1) * sizeof(RsslEnumType*), BINARY_DICTIONARY_ALIGNMENT, &enumTypesOffset) != RSSL_RET_SUCCESS)
+			return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+		pImageTable = (RsslEnumTypeTableImpl*)(pWriter->image.data + tableOffset);
+		pImageTable->base.maxValue = pTable->base.maxValue;
+		pImageTable->base.fidReferenceCount = pTable->base.fidReferenceCount;
+		pImageTable->displayIndexMask = pTable->displayIndexMask;
+
+		if (_binDictSetPointer(pWriter, tablesOffset + i * sizeof(RsslEnumTypeTable*), tableOffset, RSSL_FALSE) != RSSL_RET_SUCCESS
+				|| _binDictSetPointer(pWriter, tableOffset + offsetof(RsslEnumTypeTable, enumTypes), enumTypesOffset, RSSL_FALSE) != RSSL_RET_SUCCESS
+				|| _binDictAddData(pWriter, tableOffset + offsetof(RsslEnumTypeTable, fidReferences), pTable->base.fidReferences, 
+					pTable->base.fidReferenceCount * sizeof(RsslFieldId), sizeof(RsslFieldId)) != RSSL_RET_SUCCESS
+				|| _binDictAddData(pWriter, tableOffset + offsetof(RsslEnumTypeTableImpl, displayIndex), pTable->displayIndex, 
+					((size_t)pTable->displayIndexMask + 1) * sizeof(RsslEnumDisplaySlot), sizeof(RsslUInt32)) != RSSL_RET_SUCCESS)
+			return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+		for (j = 0; j <= pTable->base.maxValue; ++j)
+		{
+			RsslEnumTypeImpl *pEnumType = (RsslEnumTypeImpl*)pTable->base.enumTypes[j];
+			RsslEnumTypeImpl *pImageEnumType;
+			size_t enumTypeOffset;
+
+			if (pEnumType == NULL)
+				continue;
+
+			if (_binDictReserve(&pWriter->image, sizeof(RsslEnumTypeImpl), BINARY_DICTIONARY_ALIGNMENT, &enumTypeOffset) != RSSL_RET_SUCCESS)
+				return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+			pImageEnumType = (RsslEnumTypeImpl*)(pWriter->image.data + enumTypeOffset);
+			pImageEnumType->base.value = pEnumType->base.value;
+			pImageEnumType->flags = pEnumType->flags;
+
+			if (_binDictSetPointer(pWriter, enumTypesOffset + j * sizeof(RsslEnumType*), enumTypeOffset, RSSL_FALSE) != RSSL_RET_SUCCESS
+					|| _binDictAddBuffer(pWriter, enumTypeOffset + offsetof(RsslEnumType, display), &pEnumType->base.display) != RSSL_RET_SUCCESS
+					|| _binDictAddBuffer(pWriter, enumTypeOffset + offsetof(RsslEnumType, meaning), &pEnumType->base.meaning) != RSSL_RET_SUCCESS)
+				return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+		}
+
+		for (j = 0; j < pTable->base.fidReferenceCount; ++j)
+			entryTableOffsets[pTable->base.fidReferences[j] - (RSSL_MIN_FID)] = tableOffset;
+	}
+
+	/* Entries */
+	for (fid = RSSL_MIN_FID; fid <= RSSL_MAX_FID; ++fid)
+	{
+		RsslDictionaryEntry *pEntry = pDictionary->entriesArray[fid];
+		RsslDictionaryEntry *pImageEntry;
+		size_t entryOffset;
+
+		if (pEntry == NULL)
+			continue;
+
+		if (_binDictReserve(&pWriter->image, sizeof(RsslDictionaryEntry), BINARY_DICTIONARY_ALIGNMENT, &entryOffset) != RSSL_RET_SUCCESS)
+			return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+		pImageEntry = (RsslDictionaryEntry*)(pWriter->image.data + entryOffset);
+		pImageEntry->fid = pEntry->fid;
+		pImageEntry->rippleToField = pEntry->rippleToField;
+		pImageEntry->fieldType = pEntry->fieldType;
+		pImageEntry->length = pEntry->length;
+		pImageEntry->enumLength = pEntry->enumLength;
+		pImageEntry->rwfType = pEntry->rwfType;
+		pImageEntry->rwfLength = pEntry->rwfLength;
+
+		if (_binDictSetPointer(pWriter, entriesOffset + (fid - (RSSL_MIN_FID)) * sizeof(RsslDictionaryEntry*), entryOffset, RSSL_FALSE) != RSSL_RET_SUCCESS
+				|| _binDictAddBuffer(pWriter, entryOffset + offsetof(RsslDictionaryEntry, acronym), &pEntry->acronym) != RSSL_RET_SUCCESS
+				|| _binDictAddBuffer(pWriter, entryOffset + offsetof(RsslDictionaryEntry, ddeAcronym), &pEntry->ddeAcronym) != RSSL_RET_SUCCESS)
+			return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+
+		if (pEntry->pEnumTypeTable != NULL)
+		{
+			if (entryTableOffsets[fid - (RSSL_MIN_FID)] == 0)
+				return (_setError(errorText, "Field with FID %d references an enum table that does not reference it.", fid), RSSL_RET_FAILURE);
+
+			if (_binDictSetPointer(pWriter, entryOffset + offsetof(RsslDictionaryEntry, pEnumTypeTable), 
+						entryTableOffsets[fid - (RSSL_MIN_FID)], RSSL_FALSE) != RSSL_RET_SUCCESS)
+				return (_setError(errorText, "malloc() of binary dictionary image failed."), RSSL_RET_FAILURE);
+		}
+
+		/* Fields with acronyms get a link in the fields-by-name table (the acronym is also the key of the stored link). */
+		if (pEntry->acronym.data != NULL)
+		{
+			pLinks[linkCount].pDictionaryEntry = pEntry;
+			linkEntryOffsets[linkCount] = entryOffset;
+			++linkCount;
+		}
+	}
+
+	/* Fields-by-name table.  Build it with the links of the dictionary being saved, then store its slots with the offsets of the stored links. */
+	if (rsslOpenHashTableInit(&fieldsByName, linkCount, rsslHashBufferSum, rsslHashBufferCompare, RSSL_TRUE, &rsslErrorInfo) != RSSL_RET_SUCCESS)
+		return (_setError(errorText, "Failed to initialize fields-by-name table."), RSSL_RET_FAILURE);
+
+	for (i = 0; i < linkCount; ++i)
+	{
+		if (rsslOpenHashTableInsertLink(&fieldsByName, &pLinks[i].nameTableLink, &pLinks[i].pDictionaryEntry->acronym, NULL) != RSSL_RET_SUCCESS)
+		{
+			_setError(errorText, "Failed to build fields-by-name table.");
+			goto cleanup;
+		}
+	}
+
+	if (fieldsByName.oldArray.slots)
+		rsslOpenHashTableMigrate(&fieldsByName, fieldsByName.oldArray.mask + 1);
+
+	if (_binDictReserve(&pWriter->image, (linkCount ? linkCount : 1) * sizeof(FieldsByNameLink), BINARY_DICTIONARY_ALIGNMENT, &linksOffset) != RSSL_RET_SUCCESS
+			|| _binDictReserve(&pWriter->image, ((size_t)fieldsByName.array.mask + 1) * sizeof(RsslOpenHashSlot), BINARY_DICTIONARY_ALIGNMENT, &slotsOffset) != RSSL_RET_SUCCESS)
+	{
+		_setError(errorText, "malloc() of binary dictionary image failed.");
+		goto cleanup;
+	}
+
+	for (i = 0; i < linkCount; ++i)
+	{
+		size_t linkOffset = linksOffset + i * sizeof(FieldsByNameLink);
+
+		memcpy(pWriter->image.data + linkOffset + offsetof(FieldsByNameLink, nameTableLink) + offsetof(RsslHashLink, hashSum), 
+				&pLinks[i].nameTableLink.hashSum, sizeof(RsslUInt32));
+
+		if (_binDictSetPointer(pWriter, linkOffset + offsetof(FieldsByNameLink, nameTableLink) + offsetof(RsslHashLink, pKey), 
+					linkEntryOffsets[i] + offsetof(RsslDictionaryEntry, acronym), RSSL_FALSE) != RSSL_RET_SUCCESS
+				|| _binDictSetPointer(pWriter, linkOffset + offsetof(FieldsByNameLink, pDictionaryEntry), linkEntryOffsets[i], RSSL_FALSE) != RSSL_RET_SUCCESS)
+		{
+			_setError(errorText, "malloc() of binary dictionary image failed.");
+			goto cleanup;
+		}
+	}
+
+	for (i = 0; i <= fieldsByName.array.mask; ++i)
+	{
+		RsslOpenHashSlot *pSlot = &fieldsByName.array.slots[i];
+		size_t slotOffset = slotsOffset + i * sizeof(RsslOpenHashSlot);
+		size_t linkIndex;
+
+		if (pSlot->pLink == NULL)
+			continue;
+
+		linkIndex = RSSL_HASH_LINK_TO_OBJECT(FieldsByNameLink, nameTableLink, pSlot->pLink) - pLinks;
+		memcpy(pWriter->image.data + slotOffset + offsetof(RsslOpenHashSlot, hashSum), &pSlot->hashSum, sizeof(RsslUInt32));
+		memcpy(pWriter->image.data + slotOffset + offsetof(RsslOpenHashSlot, distance), &pSlot->distance, sizeof(RsslUInt32));
+
+		if (_binDictSetPointer(pWriter, slotOffset + offsetof(RsslOpenHashSlot, pLink), 
+					linksOffset + linkIndex * sizeof(FieldsByNameLink) + offsetof(FieldsByNameLink, nameTableLink), RSSL_FALSE) != RSSL_RET_SUCCESS)
+		{
+			_setError(errorText, "malloc() of binary dictionary image failed.");
+			goto cleanup;
+		}
+	}
+
+	/* The table is never changed once loaded, so it does not grow. The hash and compare functions are set by the loader. */
+	pImageInternal = (RsslDictionaryInternal*)(pWriter->image.data + internalOffset);
+	pImageInternal->fieldsByName.array.mask = fieldsByName.array.mask;
+	pImageInternal->fieldsByName.array.shift = fieldsByName.array.shift;
+	pImageInternal->fieldsByName.elementCount = fieldsByName.elementCount;
+	pImageInternal->fieldsByName.thresholdCapacity = fieldsByName.thresholdCapacity;
+	pImageInternal->fieldsByName.dynamicSize = RSSL_FALSE;
+
+	if (_binDictSetPointer(pWriter, internalOffset + offsetof(RsslDictionaryInternal, fieldsByName) + offsetof(RsslOpenHashTable, array)
+				+ offsetof(RsslOpenHashArray, slots), slotsOffset, RSSL_FALSE) != RSSL_RET_SUCCESS)
+	{
+		_setError(errorText, "malloc() of binary dictionary image failed.");
+		goto cleanup;
+	}
+
+	ret = RSSL_RET_SUCCESS;
+
+cleanup:
+	rsslOpenHashTableCleanup(&fieldsByName);
+	return ret;
+}
+
+RSSL_API RsslRet rsslSaveBinaryDataDictionary(const char *filename, RsslDataDictionary *pDictionary, RsslBuffer *errorText)
+{
+	BinaryDictionaryWriter writer;
+	BinaryDictionaryHeader *pHeader;
+	size_t *entryTableOffsets = NULL, *linkEntryOffsets = NULL;
+	FieldsByNameLink *pLinks = NULL;
+	size_t poolOffset, relocationOffset, offset, i;
+	RsslRet ret = RSSL_RET_FAILURE;
+	FILE *fp;
+
+	if (filename == 0)
+		return (_setError(errorText, "NULL Filename pointer."), RSSL_RET_FAILURE);
+
+	if (pDictionary == 0 || !pDictionary->isInitialized)
+		return (_setError(errorText, "Dictionary not initialized"), RSSL_RET_FAILURE);
+
+	memset(&writer, 0, sizeof(writer));
+
+	entryTableOffsets = (size_t*)calloc(RSSL_MAX_FID-RSSL_MIN_FID+1, sizeof(size_t));
+	linkEntryOffsets = (size_t*)calloc(RSSL_MAX_FID-RSSL_MIN_FID+1, sizeof(size_t));
+	pLinks = (FieldsByNameLink*)calloc(RSSL_MAX_FID-RSSL_MIN_FID+1, sizeof(FieldsByNameLink));
+	if (entryTableOffsets == NULL || linkEntryOffsets == NULL || pLinks == NULL)
+	{
+		_setError(errorText, "malloc() of binary dictionary temporary memory failed.");
+		goto cleanup;
+	}
+
+	if (_binDictBuildImage(&writer, pDictionary, entryTableOffsets, pLinks, linkEntryOffsets, errorText) != RSSL_RET_SUCCESS)
+		goto cleanup;
+
+	/* Append the pool, and point its relocations at its place in the image. */
+	if (_binDictReserve(&writer.image, writer.pool.length, BINARY_DICTIONARY_ALIGNMENT, &poolOffset) != RSSL_RET_SUCCESS)
+	{
+		_setError(errorText, "malloc() of binary dictionary image failed.");
+		goto cleanup;
+	}
+
+	memcpy(writer.image.data + poolOffset, writer.pool.data, writer.pool.length);
+
+	for (i = 0; i < writer.poolRelocations.count; ++i)
+	{
+		size_t imageOffset = (size_t)writer.poolRelocations.offsets[i];
+		void *pointer;
+
+		memcpy(&pointer, writer.image.data + imageOffset, sizeof(void*));
+		pointer = (void*)((size_t)pointer + poolOffset);
+		memcpy(writer.image.data + imageOffset, &pointer, sizeof(void*));
+
+		if (_binDictAddRelocation(&writer.relocations, imageOffset) != RSSL_RET_SUCCESS)
+		{
+			_setError(errorText, "malloc() of binary dictionary image failed.");
+			goto cleanup;
+		}
+	}
+
+	if (_binDictReserve(&writer.image, writer.relocations.count * sizeof(RsslUInt64), BINARY_DICTIONARY_ALIGNMENT, &relocationOffset) != RSSL_RET_SUCCESS)
+	{
+		_setError(errorText, "malloc() of binary dictionary image failed.");
+		goto cleanup;
+	}
+
+	memcpy(writer.image.data + relocationOffset, writer.relocations.offsets, writer.relocations.count * sizeof(RsslUInt64));
+
+	pHeader = (BinaryDictionaryHeader*)writer.image.data;
+	memcpy(pHeader->magic, RSSL_BINARY_DICTIONARY_MAGIC, sizeof(pHeader->magic));
+	pHeader->version = RSSL_BINARY_DICTIONARY_VERSION;
+	pHeader->byteOrderMark = RSSL_BINARY_DICTIONARY_BYTE_ORDER_MARK;
+	pHeader->pointerSize = (RsslUInt32)sizeof(void*);
+	pHeader->dictionarySize = (RsslUInt32)sizeof(RsslDataDictionary);
+	pHeader->internalSize = (RsslUInt32)BINARY_DICTIONARY_INTERNAL_SIZE;
+	pHeader->entrySize = (RsslUInt32)sizeof(RsslDictionaryEntry);
+	pHeader->enumTableSize = (RsslUInt32)sizeof(RsslEnumTypeTableImpl);
+	pHeader->enumTypeSize = (RsslUInt32)sizeof(RsslEnumTypeImpl);
+	pHeader->hashSlotSize = (RsslUInt32)sizeof(RsslOpenHashSlot);
+	pHeader->fileLength = writer.image.length;
+	pHeader->dictionaryOffset = (sizeof(BinaryDictionaryHeader) + BINARY_DICTIONARY_ALIGNMENT - 1) & ~(size_t)(BINARY_DICTIONARY_ALIGNMENT - 1);
+	pHeader->relocationOffset = relocationOffset;
+	pHeader->relocationCount = writer.relocations.count;
+
+	if ((fp = fopen(filename, "wb")) == NULL)
+	{
+		_setError(errorText, "Can't open file: '%s'.", filename);
+		goto cleanup;
+	}
+
+	offset = fwrite(writer.image.data, 1, writer.image.length, fp);
+	if (fclose(fp) != 0 || offset != writer.image.length)
+	{
+		_setError(errorText, "Failed to write file: '%s'.", filename);
+		goto cleanup;
+	}
+
+	ret = RSSL_RET_SUCCESS;
+
+cleanup:
+	_binDictCleanupWriter(&writer);
+	free(entryTableOffsets);
+	free(linkEntryOffsets);
+	free(pLinks);
+	return ret;
+}
+
+/* Checks the header and relocations of a mapped binary dictionary file, then relocates it. */
+static RsslRet _binDictRelocate(char *pBase, size_t fileLength, RsslBuffer *errorText)
+{
+	BinaryDictionaryHeader *pHeader = (BinaryDictionaryHeader*)pBase;
+	RsslUInt64 *pRelocations;
+	RsslUInt64 i;
+
+	if (fileLength < sizeof(BinaryDictionaryHeader) || memcmp(pHeader->magic, RSSL_BINARY_DICTIONARY_MAGIC, sizeof(pHeader->magic)) != 0)
+		return (_setError(errorText, "File is not a binary dictionary file."), RSSL_RET_FAILURE);
+
+	if (pHeader->version != RSSL_BINARY_DICTIONARY_VERSION)
+		return (_setError(errorText, "Unsupported binary dictionary file version %u.", pHeader->version), RSSL_RET_FAILURE);
+
+	if (pHeader->byteOrderMark != RSSL_BINARY_DICTIONARY_BYTE_ORDER_MARK
+			|| pHeader->pointerSize != sizeof(void*)
+			|| pHeader->dictionarySize != sizeof(RsslDataDictionary)
+			|| pHeader->internalSize != BINARY_DICTIONARY_INTERNAL_SIZE
+			|| pHeader->entrySize != sizeof(RsslDictionaryEntry)
+			|| pHeader->enumTableSize != sizeof(RsslEnumTypeTableImpl)
+			|| pHeader->enumTypeSize != sizeof(RsslEnumTypeImpl)
+			|| pHeader->hashSlotSize != sizeof(RsslOpenHashSlot))
+		return (_setError(errorText, "Binary dictionary file was written by an incompatible build."), RSSL_RET_FAILURE);
+
+	if (pHeader->fileLength != fileLength
+			|| pHeader->dictionaryOffset < sizeof(BinaryDictionaryHeader) 
+			|| pHeader->dictionaryOffset + sizeof(RsslDataDictionary) > pHeader->relocationOffset
+			|| pHeader->relocationOffset % sizeof(RsslUInt64) != 0
+			|| pHeader->relocationOffset > fileLength
+			|| pHeader->relocationCount > (fileLength - pHeader->relocationOffset) / sizeof(RsslUInt64))
+		return (_setError(errorText, "Binary dictionary file is truncated or corrupt."), RSSL_RET_FAILURE);
+
+	pRelocations = (RsslUInt64*)(pBase + pHeader->relocationOffset);
+
+	for (i = 0; i < pHeader->relocationCount; ++i)
+	{
+		RsslUInt64 offset = pRelocations[i];
+		char *pointer;
+
+		if (offset % sizeof(void*) != 0 || offset + sizeof(void*) > pHeader->relocationOffset)
+			return (_setError(errorText, "Binary dictionary file is truncated or corrupt."), RSSL_RET_FAILURE);
+
+		pointer = *(char**)(pBase + offset);
+		if ((size_t)pointer >= pHeader->relocationOffset)
+			return (_setError(errorText, "Binary dictionary file is truncated or corrupt."), RSSL_RET_FAILURE);
+
+		*(char**)(pBase + offset) = pBase + (size_t)pointer;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslLoadBinaryDataDictionary(const char *filename, RsslDataDictionary *pDictionary, RsslBuffer *errorText)
+{
+	RsslDataDictionary *pMappedDictionary;
+	RsslDictionaryInternal *pMappedInternal;
+	size_t fileLength;
+	char *pBase;
+#ifdef _WIN32
+	HANDLE hFile, hMapping;
+	LARGE_INTEGER size;
+	DWORD oldProtect;
+#else
+	struct stat fileStat;
+	int fd;
+#endif
+
+	if (filename == 0)
+		return (_setError(errorText, "NULL Filename pointer."), RSSL_RET_FAILURE);
+
+	if (pDictionary == 0)
+		return (_setError(errorText, "NULL Dictionary pointer."), RSSL_RET_FAILURE);
+
+	if (pDictionary->isInitialized)
+		return (_setError(errorText, "Dictionary already initialized."), RSSL_RET_FAILURE);
+
+	/* Map a private copy of the file. Pages that are not relocated stay shared with other processes using the file. */
+#ifdef _WIN32
+	if ((hFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL)) == INVALID_HANDLE_VALUE)
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+
+	if (!GetFileSizeEx(hFile, &size) || size.QuadPart == 0 || (RsslUInt64)size.QuadPart > (size_t)-1)
+	{
+		CloseHandle(hFile);
+		return (_setError(errorText, "File is not a binary dictionary file."), RSSL_RET_FAILURE);
+	}
+	fileLength = (size_t)size.QuadPart;
+
+	hMapping = CreateFileMapping(hFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+	CloseHandle(hFile);
+	if (hMapping == NULL)
+		return (_setError(errorText, "CreateFileMapping() of '%s' failed (error = %d).", filename, (int)GetLastError()), RSSL_RET_FAILURE);
+
+	pBase = (char*)MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+	CloseHandle(hMapping);
+	if (pBase == NULL)
+		return (_setError(errorText, "MapViewOfFile() of '%s' failed (error = %d).", filename, (int)GetLastError()), RSSL_RET_FAILURE);
+#else
+	if ((fd = open(filename, O_RDONLY)) < 0)
+		return (_setError(errorText, "Can't open file: '%s'.", filename), RSSL_RET_FAILURE);
+
+	if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+	{
+		close(fd);
+		return (_setError(errorText, "File is not a binary dictionary file."), RSSL_RET_FAILURE);
+	}
+	fileLength = (size_t)fileStat.st_size;
+
+	pBase = (char*)mmap(0, fileLength, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (pBase == (char*)MAP_FAILED)
+		return (_setError(errorText, "mmap() of '%s' failed (errno = %d).", filename, errno), RSSL_RET_FAILURE);
+#endif
+
+	if (_binDictRelocate(pBase, fileLength, errorText) != RSSL_RET_SUCCESS)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(pBase);
+#else
+		munmap(pBase, fileLength);
+#endif
+		return RSSL_RET_FAILURE;
+	}
+
+	pMappedDictionary = (RsslDataDictionary*)(pBase + ((BinaryDictionaryHeader*)pBase)->dictionaryOffset);
+	pMappedInternal = (RsslDictionaryInternal*)pMappedDictionary->_internal;
+	pMappedInternal->fieldsByName.keyHashFunction = rsslHashBufferSum;
+	pMappedInternal->fieldsByName.keyCompareFunction = rsslHashBufferCompare;
+	pMappedInternal->pMappedFile = pBase;
+	pMappedInternal->mappedFileLength = fileLength;
+
+	/* Nothing changes the dictionary after this. */
+#ifdef _WIN32
+	VirtualProtect(pBase, fileLength, PAGE_READONLY, &oldProtect);
+#else
+	mprotect(pBase, fileLength, PROT_READ);
+#endif
+
+	*pDictionary = *pMappedDictionary;
+	return RSSL_RET_SUCCESS;
+}
+
 #ifdef __cplusplus
 }
 #endif
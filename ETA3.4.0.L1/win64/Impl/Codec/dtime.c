@@ -615,6 +615,60 @@ RSSL_API RsslBool rsslDateTimeIsValid(const RsslDateTime * iDateTime)
 	return (rsslDateIsValid(&iDateTime->date) && rsslTimeIsValid(&iDateTime->time));
 }
 
+/* Days from March 1 to the first of each month (January = 1). Counting years from March puts leap days at the end of the year. */
+static const RsslUInt16 marchDaysBeforeMonth[13] = { 0, 306, 337, 0, 31, 61, 92, 122, 153, 184, 214, 245, 275 };
+
+/* Whole years that nanoseconds since the epoch can represent in an RsslInt64. */
+#define EPOCH_NANOS_MIN_YEAR 1678
+#define EPOCH_NANOS_MAX_YEAR 2261
+
+RSSL_API RsslRet rsslDateTimesToEpochNanos(RsslInt64 *oNanos, RsslBool *oIsBlank, const RsslDateTime *iDateTimes, RsslUInt32 count)
+{
+	RsslBool hasInvalid = RSSL_FALSE;
+	RsslUInt32 i;
+
+	for (i = 0; i < count; ++i)
+	{
+		const RsslDate *pDate = &iDateTimes[i].date;
+		const RsslTime *pTime = &iDateTimes[i].time;
+		RsslUInt32 month = (pDate->month <= 12) ? pDate->month : 0;
+		RsslBool isBlank = (pDate->day == 0 && pDate->month == 0 && pDate->year == 0);
+		RsslBool isValid;
+		RsslInt64 year, era, yearOfEra, days, seconds;
+
+		/* Blank members of the time count as zero. */
+		RsslInt64 hour = (pTime->hour == 255) ? 0 : pTime->hour;
+		RsslInt64 minute = (pTime->minute == 255) ? 0 : pTime->minute;
+		RsslInt64 second = (pTime->second == 255) ? 0 : pTime->second;
+		RsslInt64 millisecond = (pTime->millisecond == 65535) ? 0 : pTime->millisecond;
+		RsslInt64 microsecond = (pTime->microsecond == 2047) ? 0 : pTime->microsecond;
+		RsslInt64 nanosecond = (pTime->nanosecond == 2047) ? 0 : pTime->nanosecond;
+
+		isValid = (month != 0 && pDate->day >= 1 && pDate->day <= 31 
+				&& pDate->year >= EPOCH_NANOS_MIN_YEAR && pDate->year <= EPOCH_NANOS_MAX_YEAR
+				&& hour <= 23 && minute <= 59 && second <= 60 && millisecond <= 999 && microsecond <= 999 && nanosecond <= 999);
+
+		/* Days since 1970-01-01. */
+		year = (RsslInt64)pDate->year - (month <= 2);
+		era = year / 400;
+		yearOfEra = year - era * 400;
+		days = era * 146097 + yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + marchDaysBeforeMonth[month] + pDate->day - 1 - 719468;
+
+		seconds = isValid ? (days * 86400 + hour * 3600 + minute * 60 + second) : 0;
+		oNanos[i] = isValid ? (seconds * 1000000000 + millisecond * 1000000 + microsecond * 1000 + nanosecond) : 0;
+
+		hasInvalid |= (!isValid && !isBlank);
+	}
+
+	if (oIsBlank)
+	{
+		for (i = 0; i < count; ++i)
+			oIsBlank[i] = (iDateTimes[i].date.day == 0 && iDateTimes[i].date.month == 0 && iDateTimes[i].date.year == 0) ? RSSL_TRUE : RSSL_FALSE;
+	}
+
+	return hasInvalid ? RSSL_RET_INVALID_DATA : RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslDateStringToDate(RsslDate * oDate, const RsslBuffer * iDateString)
 {
 	char * tmp;
@@ -984,6 +1038,82 @@ RSSL_API RsslRet rsslTimeStringToTime(RsslTime * oTime, const RsslBuffer * iTime
 	return RSSL_RET_SUCCESS;
 }
 
+#ifdef RWF_SWAR_PARSE
+/* Converts the ISO 8601 forms "yyyy-mm-ddThh:mm", "yyyy-mm-ddThh:mm:ss" and "yyyy-mm-ddThh:mm:ss.nnnnnnnnn"
+ * (one to nine fractional digits, after '.' or ',') a word at a time, setting the same members as the
+ * matching sscanf() formats in rsslDateTimeStringToDateTime(). Returns RSSL_FALSE, leaving oDateTime
+ * untouched, for any other string. */
+static RsslBool iso8601DateTimeStringToDateTimeSwar(RsslDateTime *oDateTime, const char *data, RsslUInt32 length)
+{
+	static const RsslUInt32 fractionScale[] = { 0, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10, 1 };
+	RsslUInt64 date, dayTime, time = 0;
+	RsslUInt32 fraction = 0;
+
+	if (length != 16 && length != 19 && (length < 21 || length > 29))
+		return RSSL_FALSE;
+
+	date = rwfSwarLoad(data);
+	dayTime = rwfSwarLoad(data + 8);
+
+	if (!rwfSwarMatches(date, RWF_SWAR_WORD('0', '0', '0', '0', '-', '0', '0', '-'))
+			|| !rwfSwarMatches(dayTime, RWF_SWAR_WORD('0', '0', 'T', '0', '0', ':', '0', '0')))
+		return RSSL_FALSE;
+
+	if (length >= 19)
+	{
+		time = rwfSwarLoad(data + 11);
+		if (!rwfSwarMatches(time, RWF_SWAR_WORD('0', '0', ':', '0', '0', ':', '0', '0')))
+			return RSSL_FALSE;
+	}
+
+	if (length >= 21)
+	{
+		RsslUInt32 digits = length - 20;
+		RsslUInt64 word, mask;
+
+		if (data[19] != '.' && data[19] != ',')
+			return RSSL_FALSE;
+
+		if (digits == 9)
+		{
+			if (!isdigit((unsigned char)data[20]))
+				return RSSL_FALSE;
+			fraction = (data[20] - '0') * 100000000;
+			word = rwfSwarLoad(data + 21);
+			digits = 8;
+		}
+		else
+			word = rwfSwarLoad(data + length - 8);
+
+		/* The digits are the last 'digits' characters of the word; clearing the others leaves zero digits in front. */
+		mask = ~RTR_ULL(0) << (8 * (8 - digits));
+		word &= mask;
+		if ((rwfSwarNonDigits(word) & mask) != 0)
+			return RSSL_FALSE;
+
+		fraction += rwfSwarDigitsValue(word - (RWF_SWAR_ZEROS & mask)) * fractionScale[length - 20];
+	}
+
+	oDateTime->date.year = (RsslUInt16)rwfSwarLeadingDigitsValue(date, 4);
+	oDateTime->date.month = (RsslUInt8)RWF_SWAR_2DIGITS(date, 5);
+	oDateTime->date.day = (RsslUInt8)RWF_SWAR_2DIGITS(dayTime, 0);
+	oDateTime->time.hour = (RsslUInt8)RWF_SWAR_2DIGITS(dayTime, 3);
+	oDateTime->time.minute = (RsslUInt8)RWF_SWAR_2DIGITS(dayTime, 6);
+
+	if (length >= 19)
+		oDateTime->time.second = (RsslUInt8)RWF_SWAR_2DIGITS(time, 6);
+
+	if (length >= 21)
+	{
+		oDateTime->time.millisecond = (RsslUInt16)(fraction / 1000000);
+		oDateTime->time.microsecond = (RsslUInt16)(fraction / 1000 % 1000);
+		oDateTime->time.nanosecond = (RsslUInt16)(fraction % 1000);
+	}
+
+	return RSSL_TRUE;
+}
+#endif
+
 RSSL_API RsslRet rsslDateTimeStringToDateTime(RsslDateTime *oDateTime, const RsslBuffer *iDateTimeString)
 {
 	int hour = 0;
@@ -1014,6 +1144,20 @@ RSSL_API RsslRet rsslDateTimeStringToDateTime(RsslDateTime *oDateTime, const Rss
 		return RSSL_RET_BLANK_DATA;
 	}
 
+#ifdef RWF_SWAR_PARSE
+	/* The most common forms, without sscanf(). */
+	if (iso8601DateTimeStringToDateTimeSwar(oDateTime, iDateTimeString->data, iDateTimeString->length))
+		return RSSL_RET_SUCCESS;
+
+	if (rwf_stodatetime_swar(oDateTime, iDateTimeString->data, iDateTimeString->length))
+	{
+		/* As for "%d/%d/%d" below, with a two digit year. */
+		if (oDateTime->date.year < 100)
+			oDateTime->date.year += 1900;
+		return RSSL_RET_SUCCESS;
+	}
+#endif
+
 	if (sscanf(iDateTimeString->data, "%4d-%2d-%2dT%2d:%2d:%2d.%9s", &a, &b, &c, &hour, &minute, &second, isoFractionalTime) == 7)
 	{ /* Read ISO 8601 datetime format yyyy-mm-ddThh:mm:ss.nnnnnnnnn e.g. 2017-08-12T23:20:50.550967845  Or digits < 9 after decimal */
 		oDateTime->date.day = c;
@@ -7,6 +7,7 @@
  */
 
 #include "rtr/rsslFieldList.h"
+#include "rtr/rsslFieldListBulk.h"
 #include "rtr/decoderTools.h"
 #include "rtr/rsslIteratorUtilsInt.h"
 #include "rtr/rsslSetData.h"
@@ -241,6 +242,143 @@ RSSL_API RsslRet rsslDecodeFieldEntry(
 	return RSSL_RET_SUCCESS;
 }
 
+/* Decodes the content of a bulk-decoded entry with the buffer decoder for its type, if it has one. */
+RTR_C_ALWAYS_INLINE RsslRet _rsslDecodeBulkFieldValue(
+				RsslDecodeIterator		*iIter,
+				RsslDecodingLevel		*valueLevelInfo,
+				RsslDecodedFieldEntry	*oEntry )
+{
+	RsslRet (RTR_FASTCALL *decoder)(rsslDecIterPtr, void*) = _rsslDataTypeInfo[oEntry->dataType].bufferDecoders;
+	RsslRet ret;
+
+	if (!decoder)
+		return RSSL_RET_SUCCESS;
+
+	/* Point the iterator at the entry as rsslDecodeFieldEntry would. */
+	iIter->_curBufPtr = oEntry->encData.data;
+	valueLevelInfo->_endBufPtr = oEntry->encData.data + oEntry->encData.length;
+
+	switch (ret = (*decoder)(iIter, &oEntry->value))
+	{
+		case RSSL_RET_SUCCESS:
+			oEntry->flags |= RSSL_DFEF_DECODED;
+			return RSSL_RET_SUCCESS;
+		case RSSL_RET_BLANK_DATA:
+			oEntry->flags |= (RSSL_DFEF_DECODED | RSSL_DFEF_BLANK);
+			return RSSL_RET_SUCCESS;
+		default:
+			return ret;
+	}
+}
+
+RSSL_API RsslRet rsslDecodeFieldListBulk(
+				RsslDecodeIterator			*iIter,
+				RsslFieldList				*oFieldList,
+				RsslLocalFieldSetDefDb		*iLocalSetDb,
+				const RsslDataDictionary	*iDictionary,
+				const RsslFieldIdFilter		*iFilter,
+				RsslDecodedFieldEntry		*oEntries,
+				RsslUInt32					*ioEntryCount )
+{
+	RsslRet				listRet, ret;
+	RsslUInt32			maxEntries, entryCount = 0;
+	RsslDecodingLevel	*_levelInfo, *valueLevelInfo;
+	RsslUInt16			i;
+
+	RSSL_ASSERT(iIter && oFieldList && oEntries && ioEntryCount, Invalid parameters or parameters passed in as NULL);
+
+	maxEntries = *ioEntryCount;
+	*ioEntryCount = 0;
+
+	/* A dictionary that was only cleared has no entries to look up. */
+	if (iDictionary && (!iDictionary->isInitialized || !iDictionary->entriesArray))
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if ((listRet = rsslDecodeFieldList(iIter, oFieldList, iLocalSetDb)) < RSSL_RET_SUCCESS || listRet == RSSL_RET_NO_DATA)
+		return listRet;
+
+	_levelInfo = &iIter->_levelInfo[iIter->_decodingLevel];
+	valueLevelInfo = &iIter->_levelInfo[iIter->_decodingLevel + 1];
+
+	/* Set-defined entries; the set definition gives each type. */
+	for (i = 0; i < _levelInfo->_setCount; ++i)
+	{
+		RsslFieldSetDefEntry	*encoding = &_levelInfo->_fieldListSetDef->pEntries[i];
+		RsslDecodedFieldEntry	*pEntry;
+		RsslBuffer				encData;
+
+		iIter->_curBufPtr = _levelInfo->_nextEntryPtr;
+		if ((ret = _rsslDecodeSet(iIter, encoding->dataType, &encData)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		if (iFilter && !rsslFieldIdFilterCheck(iFilter, encoding->fieldId))
+			continue;
+
+		if (entryCount == maxEntries)
+		{
+			_endOfList(iIter);
+			*ioEntryCount = entryCount;
+			return RSSL_RET_BUFFER_TOO_SMALL;
+		}
+
+		pEntry = &oEntries[entryCount++];
+		pEntry->fieldId = encoding->fieldId;
+		pEntry->dataType = _rsslPrimitiveType(encoding->dataType);
+		pEntry->flags = RSSL_DFEF_SET_DEFINED;
+		pEntry->encData = encData;
+
+		if ((ret = _rsslDecodeBulkFieldValue(iIter, valueLevelInfo, pEntry)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	/* Standard entries; the dictionary gives each type. */
+	if (_levelInfo->_itemCount > _levelInfo->_setCount)
+	{
+		char *position = oFieldList->encEntries.data;
+		char *_endBufPtr = _levelInfo->_endBufPtr;
+
+		for (i = _levelInfo->_setCount; i < _levelInfo->_itemCount; ++i)
+		{
+			RsslDecodedFieldEntry	*pEntry;
+			RsslDictionaryEntry		*pDictionaryEntry;
+			RsslFieldId				fieldId;
+			RsslBuffer				encData;
+
+			if (_endBufPtr - position < 3)
+				return RSSL_RET_INCOMPLETE_DATA;
+
+			position += rwfGet16(fieldId, position);
+			position += rwfGetBuffer16(&encData, position);
+			if (position > _endBufPtr)
+				return RSSL_RET_INCOMPLETE_DATA;
+
+			if (iFilter && !rsslFieldIdFilterCheck(iFilter, fieldId))
+				continue;
+
+			if (entryCount == maxEntries)
+			{
+				_endOfList(iIter);
+				*ioEntryCount = entryCount;
+				return RSSL_RET_BUFFER_TOO_SMALL;
+			}
+
+			pEntry = &oEntries[entryCount++];
+			pEntry->fieldId = fieldId;
+			pEntry->dataType = (iDictionary && (pDictionaryEntry = iDictionary->entriesArray[fieldId])) ?
+				pDictionaryEntry->rwfType : RSSL_DT_UNKNOWN;
+			pEntry->flags = RSSL_DFEF_NONE;
+			pEntry->encData = encData;
+
+			if ((ret = _rsslDecodeBulkFieldValue(iIter, valueLevelInfo, pEntry)) != RSSL_RET_SUCCESS)
+				return ret;
+		}
+	}
+
+	_endOfList(iIter);
+	*ioEntryCount = entryCount;
+	return listRet;
+}
+
 RSSL_API RsslRet rsslDecodeLocalFieldSetDefDb(
 				RsslDecodeIterator				*pIter,
 				RsslLocalFieldSetDefDb			*oLocalSetDb )
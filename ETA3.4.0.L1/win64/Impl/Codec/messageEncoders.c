@@ -2385,14 +2385,13 @@ RSSL_API RsslRet rsslReplaceGroupId(
 	return RSSL_RET_SUCCESS;
 }
 
-RSSL_API RsslRet rsslReplaceSeqNum(
-                     RsslEncodeIterator		*pIter,
-                     RsslUInt32 			seqNum )
+RsslRet _rsslSeqNumPos(
+					char **					pos,
+					const RsslBuffer *		pEncodedMessageBuffer )
 {
 	RsslUInt8 msgClass;
 	RsslUInt16 mFlags;
 	RsslBuffer tempBuf;
-	RsslBuffer *pEncodedMessageBuffer = pIter->_pBuffer;
 
 	char * position;
 
@@ -2475,6 +2474,20 @@ RSSL_API RsslRet rsslReplaceSeqNum(
 			return RSSL_RET_FAILURE;
 	}
 
+	*pos = position;
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslReplaceSeqNum(
+                     RsslEncodeIterator		*pIter,
+                     RsslUInt32 			seqNum )
+{
+	RsslRet ret;
+	char * position;
+
+	if ((ret = _rsslSeqNumPos(&position, pIter->_pBuffer)) < 0)
+		return ret;
+
 	/* at correct position, replace seqNum */
 	rwfPut32(position, seqNum);
 
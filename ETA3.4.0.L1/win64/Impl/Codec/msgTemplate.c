@@ -0,0 +1,250 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include <string.h>
+#include "rtr/rsslMsgTemplate.h"
+#include "rtr/rsslMessageInt.h"
+#include "rtr/encoderTools.h"
+#include "rtr/rsslIteratorUtilsInt.h"
+#include "rtr/intDataTypes.h"
+
+/* Widest slot value, RSSL_DT_DATETIME_12. */
+#define RSSL_MSG_TEMPLATE_MAX_SLOT_LENGTH 12
+
+/* Returns the fixed width type a standard entry of the given primitive type is written as. */
+RTR_C_INLINE RsslUInt8 _rsslStandardSlotType(RsslUInt8 dataType)
+{
+	switch (dataType)
+	{
+		case RSSL_DT_INT:		return RSSL_DT_INT_8;
+		case RSSL_DT_UINT:		return RSSL_DT_UINT_8;
+		case RSSL_DT_REAL:		return RSSL_DT_REAL;
+		case RSSL_DT_FLOAT:		return RSSL_DT_FLOAT_4;
+		case RSSL_DT_DOUBLE:	return RSSL_DT_DOUBLE_8;
+		case RSSL_DT_DATE:		return RSSL_DT_DATE_4;
+		case RSSL_DT_TIME:		return RSSL_DT_TIME_8;
+		case RSSL_DT_DATETIME:	return RSSL_DT_DATETIME_12;
+		default:				return RSSL_DT_UNKNOWN;
+	}
+}
+
+/* Writes a slot value as encType, which always gives the same length for a type. */
+static RsslRet _rsslPutSlotValue(char *position, RsslUInt8 encType, const void *pData, RsslUInt16 *pLength)
+{
+	const RsslReal *pReal = (const RsslReal*)pData;
+	RsslUInt8 format;
+	RsslInt32 value32;
+	RsslEncodeIterator encIter;
+	RsslRet ret;
+
+	switch (encType)
+	{
+		case RSSL_DT_REAL:
+		case RSSL_DT_REAL_8RB:
+			/* The set form also carries its length, in the top bits of the hint. Blank, infinity and NaN
+			 * are a single byte, so cannot be written in place. */
+			if (pReal->isBlank || pReal->hint > RSSL_RH_MAX_DIVISOR)
+				return RSSL_RET_VALUE_OUT_OF_RANGE;
+
+			format = pReal->hint | (encType == RSSL_DT_REAL_8RB ? 0xC0 : 0x00);
+			position += rwfPut8(position, format);
+			rwfPut64(position, pReal->value);
+			*pLength = 9;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_REAL_4RB:
+			if (pReal->isBlank || pReal->hint > RSSL_RH_MAX_DIVISOR
+					|| pReal->value < RTR_LL(-2147483648) || pReal->value > RTR_LL(2147483647))
+				return RSSL_RET_VALUE_OUT_OF_RANGE;
+
+			format = pReal->hint | 0xC0;
+			value32 = (RsslInt32)pReal->value;
+			position += rwfPut8(position, format);
+			rwfPut32(position, value32);
+			*pLength = 5;
+			return RSSL_RET_SUCCESS;
+
+		default:
+			if (encType < RSSL_DT_SET_PRIMITIVE_MIN || encType >= RSSL_DT_CONTAINER_TYPE_MIN
+					|| !(_rsslDataTypeInfo[encType].flags & __RDTFFLEN) || _rsslDataTypeInfo[encType].rawEncoders == 0)
+				return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+
+			/* Use the set encoder for the type, as rsslEncodeFieldEntry() would. */
+			encIter._curBufPtr = position;
+			encIter._endBufPtr = position + RSSL_MSG_TEMPLATE_MAX_SLOT_LENGTH;
+			encIter._encodingLevel = 0;
+			encIter._levelInfo[0]._encodingState = RSSL_EIS_SET_DATA;
+
+			if ((ret = (*(_rsslDataTypeInfo[encType].rawEncoders))(&encIter, pData)) < 0)
+				return ret;
+
+			*pLength = (RsslUInt16)(encIter._curBufPtr - position);
+			return RSSL_RET_SUCCESS;
+	}
+}
+
+RSSL_API RsslRet rsslEncodeFieldEntryTemplateSlot(
+				RsslEncodeIterator	*pIter,
+				RsslMsgTemplate		*pTemplate,
+				RsslFieldEntry		*pField,
+				const void			*pData )
+{
+	RsslEncodingLevel *_levelInfo = &pIter->_levelInfo[pIter->_encodingLevel];
+	RsslMsgTemplateSlot *pSlot;
+	RsslFieldEntry slotEntry;
+	RsslReal widestReal;
+	char slotData[RSSL_MSG_TEMPLATE_MAX_SLOT_LENGTH];
+	RsslUInt16 length;
+	RsslRet ret;
+
+	RSSL_ASSERT(pIter && pTemplate && pField && pData, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(_levelInfo->_containerType == RSSL_DT_FIELD_LIST, Invalid encoding attempted - wrong container);
+	RSSL_ASSERT(pIter->_pBuffer && pIter->_pBuffer->data, Invalid iterator use - check buffer);
+
+	if (pTemplate->slotCount >= pTemplate->maxSlots)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	pSlot = &pTemplate->slots[pTemplate->slotCount];
+	pSlot->fieldId = pField->fieldId;
+	pSlot->dataType = pField->dataType;
+
+	if (_levelInfo->_encodingState == RSSL_EIS_SET_DATA)
+	{
+		const RsslFieldSetDefEntry *pEncoding = &_levelInfo->_fieldListSetDef->pEntries[_levelInfo->_currentCount];
+
+		if (pField->dataType != _rsslPrimitiveType(pEncoding->dataType))
+			return RSSL_RET_INVALID_DATA;
+
+		pSlot->flags = RSSL_MTSF_SET_DEFINED;
+		pSlot->encType = pEncoding->dataType;
+
+		/* Of the set types that are not fixed width, only RSSL_DT_REAL is supported. */
+		if ((ret = _rsslPutSlotValue(slotData, pSlot->encType, pData, &length)) < 0)
+			return ret;
+
+		/* Encode the entry with the set encoder.  It writes a real in its shortest form, so give it one that
+		 * needs the longest form, then write the value over it. */
+		if (pField->dataType == RSSL_DT_REAL)
+		{
+			widestReal = *(const RsslReal*)pData;
+			widestReal.value = (pSlot->encType == RSSL_DT_REAL_4RB) ? RTR_LL(2147483647) : RTR_LL(9223372036854775807);
+			pData = &widestReal;
+		}
+
+		if ((ret = rsslEncodeFieldEntry(pIter, pField, pData)) < 0)
+			return ret;
+
+		/* A set value starts the entry, after its length if the set type is not fixed width. */
+		pSlot->offset = (RsslUInt32)(_levelInfo->_initElemStartPos - pIter->_pBuffer->data);
+		if (pSlot->encType == RSSL_DT_REAL)
+			pSlot->offset += 1;
+		memcpy(pIter->_pBuffer->data + pSlot->offset, slotData, length);
+	}
+	else
+	{
+		pSlot->flags = RSSL_MTSF_NONE;
+		if ((pSlot->encType = _rsslStandardSlotType(pField->dataType)) == RSSL_DT_UNKNOWN)
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+
+		if ((ret = _rsslPutSlotValue(slotData, pSlot->encType, pData, &length)) < 0)
+			return ret;
+
+		slotEntry = *pField;
+		slotEntry.encData.data = slotData;
+		slotEntry.encData.length = length;
+
+		if ((ret = rsslEncodeFieldEntry(pIter, &slotEntry, NULL)) < 0)
+			return ret;
+
+		/* A standard value follows the field id and its one byte length. */
+		pSlot->offset = (RsslUInt32)(_levelInfo->_initElemStartPos - pIter->_pBuffer->data) + 3;
+	}
+
+	pSlot->length = length;
+
+	++pTemplate->slotCount;
+	return ret;
+}
+
+RSSL_API RsslRet rsslEncodeMsgTemplateComplete(
+				RsslEncodeIterator	*pIter,
+				RsslMsgTemplate		*pTemplate )
+{
+	RSSL_ASSERT(pIter && pTemplate, Invalid parameters or parameters passed in as NULL);
+	RSSL_ASSERT(pIter->_pBuffer && pIter->_pBuffer->data, Invalid iterator use - check buffer);
+
+	if (pIter->_encodingLevel != -1)
+		return RSSL_RET_INVALID_DATA;
+
+	pTemplate->encMsgBuf.data = pIter->_pBuffer->data;
+	pTemplate->encMsgBuf.length = (RsslUInt32)(pIter->_curBufPtr - pIter->_pBuffer->data);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslAddMsgTemplateSeqNumSlot(
+				RsslMsgTemplate		*pTemplate )
+{
+	RsslMsgTemplateSlot *pSlot;
+	char *position;
+	RsslRet ret;
+
+	RSSL_ASSERT(pTemplate && pTemplate->encMsgBuf.data, Invalid parameters or parameters passed in as NULL);
+
+	if (pTemplate->slotCount >= pTemplate->maxSlots)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	if ((ret = _rsslSeqNumPos(&position, &pTemplate->encMsgBuf)) < 0)
+		return ret;
+
+	pSlot = &pTemplate->slots[pTemplate->slotCount++];
+	pSlot->fieldId = 0;
+	pSlot->flags = RSSL_MTSF_SEQ_NUM;
+	pSlot->dataType = RSSL_DT_UINT;
+	pSlot->encType = RSSL_DT_UINT_4;
+	pSlot->length = 4;
+	pSlot->offset = (RsslUInt32)(position - pTemplate->encMsgBuf.data);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslEncodeMsgFromTemplate(
+				const RsslMsgTemplate	*pTemplate,
+				const void				**pValues,
+				RsslBuffer				*pBuffer )
+{
+	const RsslMsgTemplateSlot *pSlot = pTemplate->slots;
+	const RsslMsgTemplateSlot *pEndSlot = pTemplate->slots + pTemplate->slotCount;
+	RsslUInt32 seqNum;
+	char *position;
+	RsslUInt16 length;
+	RsslRet ret;
+
+	RSSL_ASSERT(pTemplate && pValues && pBuffer && pBuffer->data, Invalid parameters or parameters passed in as NULL);
+
+	if (pBuffer->length < pTemplate->encMsgBuf.length)
+		return RSSL_RET_BUFFER_TOO_SMALL;
+
+	memcpy(pBuffer->data, pTemplate->encMsgBuf.data, pTemplate->encMsgBuf.length);
+	pBuffer->length = pTemplate->encMsgBuf.length;
+
+	for (; pSlot < pEndSlot; ++pSlot, ++pValues)
+	{
+		if (*pValues == NULL)
+			continue;
+
+		position = pBuffer->data + pSlot->offset;
+		if (pSlot->flags & RSSL_MTSF_SEQ_NUM)
+		{
+			seqNum = *(const RsslUInt32*)*pValues;
+			rwfPut32(position, seqNum);
+		}
+		else if ((ret = _rsslPutSlotValue(position, pSlot->encType, *pValues, &length)) < 0)
+			return ret;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
@@ -49,6 +49,55 @@ static RsslDouble powHintsEx[] = {100000000000000.0, 10000000000000.0, 100000000
 
 static RsslDouble powHints[] = {0.00000000000001, 0.0000000000001, 0.000000000001, 0.00000000001, 0.0000000001, 0.000000001, 0.00000001, 0.0000001, 0.000001, 0.00001, 0.0001, 0.001, 0.01, 0.1, 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 1, 0.5, 0.25, 0.125, 0.0625, 0.03125, 0.015625, 0.0078125, 0.00390625 };
 
+/* Tables for rsslRealsToDoubles, indexed by hint (hints past the table use its last entry, and blank values use REAL_BATCH_BLANK).
+ * A value is converted as (value * multiplier / divisor) + special. Exponents below zero divide by an exact power of ten, rather than
+ * multiplying by an inexact one as powHints does, so that the result is correctly rounded. Hints without a value have a multiplier 
+ * of zero, and get their result from the special value. */
+#define REAL_BATCH_BLANK 64
+
+typedef enum {
+	REAL_BATCH_NORMAL	= 0,	/* Value is scaled. */
+	REAL_BATCH_INF		= 1,	/* Infinity. */
+	REAL_BATCH_NEG_INF	= 2,	/* Negative infinity. */
+	REAL_BATCH_NAN		= 3,	/* Not a number. */
+	REAL_BATCH_INVALID	= 4,	/* Not a number, and the hint is invalid. */
+	REAL_BATCH_NAN_BLANK= 5		/* Not a number, and the value is blank. */
+} RealBatchKind;
+
+static const RsslDouble realBatchMultipliers[REAL_BATCH_BLANK + 1] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,								/* RSSL_RH_EXPONENT_14 - RSSL_RH_EXPONENT_1 */
+	1, 10, 100, 1000, 10000, 100000, 1000000, 10000000,						/* RSSL_RH_EXPONENT0 - RSSL_RH_EXPONENT7 */
+	1, 1, 1, 1, 1, 1, 1, 1, 1,												/* RSSL_RH_FRACTION_1 - RSSL_RH_FRACTION_256 */
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,		/* 31 - 63 */
+	0																		/* REAL_BATCH_BLANK */
+};
+
+static const RsslDouble realBatchDivisors[REAL_BATCH_BLANK + 1] = {
+	100000000000000.0, 10000000000000.0, 1000000000000.0, 100000000000.0, 10000000000.0, 1000000000.0, 100000000.0, 10000000.0, 
+	1000000.0, 100000.0, 10000.0, 1000.0, 100.0, 10.0,						/* RSSL_RH_EXPONENT_14 - RSSL_RH_EXPONENT_1 */
+	1, 1, 1, 1, 1, 1, 1, 1,													/* RSSL_RH_EXPONENT0 - RSSL_RH_EXPONENT7 */
+	1, 2, 4, 8, 16, 32, 64, 128, 256,										/* RSSL_RH_FRACTION_1 - RSSL_RH_FRACTION_256 */
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,		/* 31 - 63 */
+	1																		/* REAL_BATCH_BLANK */
+};
+
+static const RsslUInt8 realBatchKinds[REAL_BATCH_BLANK + 1] = {
+	REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, 
+	REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, 
+	REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, 
+	REAL_BATCH_NORMAL,														/* RSSL_RH_EXPONENT_14 - RSSL_RH_EXPONENT7 */
+	REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, REAL_BATCH_NORMAL, 
+	REAL_BATCH_NORMAL, REAL_BATCH_NORMAL,									/* RSSL_RH_FRACTION_1 - RSSL_RH_FRACTION_256 */
+	REAL_BATCH_INVALID, REAL_BATCH_INVALID,									/* 31, 32 */
+	REAL_BATCH_INF, REAL_BATCH_NEG_INF, REAL_BATCH_NAN,						/* RSSL_RH_INFINITY, RSSL_RH_NEG_INFINITY, RSSL_RH_NOT_A_NUMBER */
+	REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID,
+	REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID,
+	REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID,
+	REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID, REAL_BATCH_INVALID,
+																			/* 36 - 63 */
+	REAL_BATCH_NAN_BLANK													/* REAL_BATCH_BLANK */
+};
+
 
 RSSL_API RsslRet rsslDoubleToReal(RsslReal * oReal, RsslDouble * iValue, RsslUInt8 iHint)
 {
@@ -268,6 +317,41 @@ RSSL_API RsslRet rsslRealToDouble(RsslDouble * oValue, RsslReal * iReal)
 	return RSSL_RET_SUCCESS;
 }
 
+RSSL_API RsslRet rsslRealsToDoubles(RsslDouble *oValues, RsslBool *oIsBlank, const RsslReal *iReals, RsslUInt32 count)
+{
+	/* Added to the scaled value; indexed by RealBatchKind. */
+	RsslDouble specials[6];
+	RsslUInt8 kinds = 0;
+	RsslUInt32 i;
+
+	RSSL_ASSERT(oValues && (iReals || !count), Invalid parameters or parameters passed in as NULL);
+
+	specials[REAL_BATCH_NORMAL] = 0.0;
+	specials[REAL_BATCH_INF] = (RsslDouble)INFINITY;
+	specials[REAL_BATCH_NEG_INF] = (RsslDouble)NEG_INFINITY;
+	specials[REAL_BATCH_NAN] = NAN;
+	specials[REAL_BATCH_INVALID] = NAN;
+	specials[REAL_BATCH_NAN_BLANK] = NAN;
+
+	/* No branches on the hint, so the loop can be vectorized where the instruction set allows. */
+	for (i = 0; i < count; ++i)
+	{
+		RsslUInt32 index = iReals[i].isBlank ? REAL_BATCH_BLANK : (iReals[i].hint < REAL_BATCH_BLANK ? iReals[i].hint : REAL_BATCH_BLANK - 1);
+		RsslUInt8 kind = realBatchKinds[index];
+
+		oValues[i] = (RsslDouble)iReals[i].value * realBatchMultipliers[index] / realBatchDivisors[index] + specials[kind];
+		kinds |= (RsslUInt8)(1 << kind);
+	}
+
+	if (oIsBlank)
+	{
+		for (i = 0; i < count; ++i)
+			oIsBlank[i] = iReals[i].isBlank ? RSSL_TRUE : RSSL_FALSE;
+	}
+
+	return (kinds & (1 << REAL_BATCH_INVALID)) ? RSSL_RET_INVALID_DATA : RSSL_RET_SUCCESS;
+}
+
 RSSL_API RsslRet rsslNumericStringToDouble(RsslDouble * oValue, RsslBuffer * iNumericString)
 {
 	RsslRet		ret;
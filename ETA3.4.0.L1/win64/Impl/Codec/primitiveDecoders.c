@@ -1030,6 +1030,82 @@ RSSL_API RsslRet rsslDecodeReal(RsslDecodeIterator *pIter, RsslReal *value)
 	return RSSL_RET_INVALID_DATA;
 }
 
+/* Number of values the batch decoders decode before converting them. */
+#define RSSL_BATCH_DECODE_CHUNK 64
+
+RSSL_API RsslRet rsslDecodeRealsToDoubles(RsslDouble *oValues, RsslBool *oIsBlank, const RsslBuffer *iEncReals, RsslUInt32 count)
+{
+	RsslDecodeIterator iter;
+	RsslReal reals[RSSL_BATCH_DECODE_CHUNK];
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslUInt32 i, j, chunkCount;
+
+	RSSL_ASSERT(oValues && (iEncReals || !count), Invalid parameters or parameters passed in as NULL);
+
+	/* Each value is decoded as rsslDecodeReal would decode it from a container entry. */
+	rsslClearDecodeIterator(&iter);
+
+	for (i = 0; i < count; i += chunkCount)
+	{
+		chunkCount = (count - i < RSSL_BATCH_DECODE_CHUNK) ? count - i : RSSL_BATCH_DECODE_CHUNK;
+
+		for (j = 0; j < chunkCount; ++j)
+		{
+			iter._curBufPtr = iEncReals[i + j].data;
+			iter._levelInfo[0]._endBufPtr = iEncReals[i + j].data + iEncReals[i + j].length;
+
+			if (rsslDecodeReal(&iter, &reals[j]) < 0)
+			{
+				/* Give it an invalid hint, so it converts to NaN and is reported. */
+				reals[j].isBlank = RSSL_FALSE;
+				reals[j].hint = RSSL_RH_MAX_DIVISOR + 1;
+				reals[j].value = 0;
+			}
+		}
+
+		if (rsslRealsToDoubles(oValues + i, oIsBlank ? oIsBlank + i : NULL, reals, chunkCount) != RSSL_RET_SUCCESS)
+			ret = RSSL_RET_INVALID_DATA;
+	}
+
+	return ret;
+}
+
+RSSL_API RsslRet rsslDecodeDateTimesToEpochNanos(RsslInt64 *oNanos, RsslBool *oIsBlank, const RsslBuffer *iEncDateTimes, RsslUInt32 count)
+{
+	RsslDecodeIterator iter;
+	RsslDateTime dateTimes[RSSL_BATCH_DECODE_CHUNK];
+	RsslRet ret = RSSL_RET_SUCCESS;
+	RsslUInt32 i, j, chunkCount;
+
+	RSSL_ASSERT(oNanos && (iEncDateTimes || !count), Invalid parameters or parameters passed in as NULL);
+
+	/* Each value is decoded as rsslDecodeDateTime would decode it from a container entry. */
+	rsslClearDecodeIterator(&iter);
+
+	for (i = 0; i < count; i += chunkCount)
+	{
+		chunkCount = (count - i < RSSL_BATCH_DECODE_CHUNK) ? count - i : RSSL_BATCH_DECODE_CHUNK;
+
+		for (j = 0; j < chunkCount; ++j)
+		{
+			iter._curBufPtr = iEncDateTimes[i + j].data;
+			iter._levelInfo[0]._endBufPtr = iEncDateTimes[i + j].data + iEncDateTimes[i + j].length;
+
+			if (rsslDecodeDateTime(&iter, &dateTimes[j]) < 0)
+			{
+				/* Give it an invalid month, so it converts to zero and is reported. */
+				rsslClearDateTime(&dateTimes[j]);
+				dateTimes[j].date.month = 13;
+			}
+		}
+
+		if (rsslDateTimesToEpochNanos(oNanos + i, oIsBlank ? oIsBlank + i : NULL, dateTimes, chunkCount) != RSSL_RET_SUCCESS)
+			ret = RSSL_RET_INVALID_DATA;
+	}
+
+	return ret;
+}
+
 RSSL_API RsslRet rsslDecodeDate(RsslDecodeIterator *pIter, RsslDate *value)
 {
 	RSSL_ASSERT(pIter, Invalid parameters or parameters passed in as NULL);
@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 #include "limits.h"
+#include <string.h>
 
 #include "rtr/rsslTypes.h"
 
@@ -563,6 +564,38 @@ int controlParse(unsigned char* curPtr, unsigned char* endPtr, RsslRmtesWorkingS
 	}
 }
 	
+/* Checks that GL maps its characters to themselves, as the default Reuter Basic 1 set does. */
+static int isIdentityGL(RsslRmtesCharSet* set)
+{
+	return (set->_table1 == NULL && set->_table2 == NULL && set->_stride != 2);
+}
+
+/* Returns the number of printable ASCII characters (0x20 to 0x7E) at the start of the input.
+ * Most strings are entirely made of these, so they are checked eight at a time. */
+static size_t asciiSpan(const unsigned char* inIter, const unsigned char* endInput)
+{
+	const RsslUInt64 ones = RTR_ULL(0x0101010101010101);
+	const RsslUInt64 highBits = RTR_ULL(0x8080808080808080);
+	const unsigned char* start = inIter;
+	RsslUInt64 word, del;
+
+	while (endInput - inIter >= 8)
+	{
+		memcpy(&word, inIter, sizeof(word));
+		del = word ^ (ones * 0x7F);
+
+		/* High bit set, below 0x20, or 0x7F in any byte. */
+		if ((word | ((word - ones * 0x20) & ~word) | ((del - ones) & ~del)) & highBits)
+			break;
+		inIter += 8;
+	}
+
+	while (inIter < endInput && *inIter >= 0x20 && *inIter < 0x7F)
+		inIter++;
+
+	return (size_t)(inIter - start);
+}
+
 /* Assumptions: all updates have already been applied to the RMTES buffer... there should be no repeat or cursor move commands */
 RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer *pStringBuffer)
 {
@@ -578,6 +611,7 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 
 	unsigned char* tempChar;
 	unsigned short tempShort;
+	size_t span;
 	
 	RsslRmtesWorkingSet curWorkingSet;
 	RsslRmtesCharSet * shiftGL = NULL;
@@ -605,7 +639,18 @@ RSSL_API RsslRet rsslRMTESToUTF8(RsslRmtesCacheBuffer *pRmtesBuffer, RsslBuffer
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			if(*inIter >= 0x20 && *inIter < 0x7F && shiftGL == NULL && isIdentityGL(*curWorkingSet.GL))
+			/* Run of ASCII characters, which are the same in UTF8 */
+			{
+				span = asciiSpan(inIter, endInput);
+				if(span > (size_t)(endOutput - outIter))
+					return RSSL_RET_BUFFER_TOO_SMALL;
+
+				memcpy(outIter, inIter, span);
+				outIter += span;
+				inIter += span;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
@@ -840,6 +885,8 @@ RSSL_API RsslRet rsslRMTESToUCS2(RsslRmtesCacheBuffer *pRmtesBuffer, RsslU16Buff
 
 	unsigned char* tempChar;
 	unsigned short tempShort;
+	unsigned char* endSpan;
+	size_t span;
 	
 	RsslRmtesWorkingSet curWorkingSet;
 	RsslRmtesCharSet * shiftGL = NULL;
@@ -867,7 +914,17 @@ RSSL_API RsslRet rsslRMTESToUCS2(RsslRmtesCacheBuffer *pRmtesBuffer, RsslU16Buff
 	{
 		if(encType == TYPE_RMTES)
 		{
-			if(*inIter < 0x20)  /* CL character */
+			if(*inIter >= 0x20 && *inIter < 0x7F && shiftGL == NULL && isIdentityGL(*curWorkingSet.GL))
+			/* Run of ASCII characters, widened to UCS2. Output stops when the buffer is full. */
+			{
+				span = asciiSpan(inIter, endInput);
+				if(span > (size_t)(endOutput - outIter))
+					span = (size_t)(endOutput - outIter);
+
+				for(endSpan = inIter + span; inIter < endSpan; inIter++, outIter++)
+					*outIter = *inIter;
+			}
+			else if(*inIter < 0x20)  /* CL character */
 			{
 				if(shiftGL != NULL)
 					return RSSL_RET_FAILURE;
@@ -1090,12 +1147,17 @@ RSSL_API RsslBool rsslHasPartialRMTESUpdate(RsslBuffer *pBuffer)
 		switch(state)
 		{
 			case NORMAL:
-				if(pBuffer->data[i] == ESC_CHAR)
-					state = ESC;
-				/* This appears to break in Korean encodings... not sure if it's still valid for current feeds */
-				//else if(pBuffer->data[i] == CSI_CHAR)
-				//	state = LBRKT;
+			{
+				/* Skip straight to the next escape, if any. CSI_CHAR is not treated as the start of a command;
+				 * this appears to break in Korean encodings... not sure if it's still valid for current feeds */
+				char *escPtr = (char*)memchr(pBuffer->data + i, ESC_CHAR, pBuffer->length - i);
+				if(escPtr == NULL)
+					return RSSL_FALSE;
+
+				i = (rtrUInt32)(escPtr - pBuffer->data);
+				state = ESC;
 				break;
+			}
 			case ESC:
 				if(pBuffer->data[i] == LBRKT_CHAR)
 					state = LBRKT;
@@ -1169,14 +1231,21 @@ RSSL_API RsslRet rsslRMTESApplyToCache(RsslBuffer *inBuffer, RsslRmtesCacheBuffe
 				}*/
 				else
 				{
-					if(cacheBufPos >= cacheBuf->allocatedLength)
+					/* Copy everything up to the next escape at once */
+					char *escPtr = (char*)memchr(inBuffer->data + inBufPos, ESC_CHAR, inBuffer->length - inBufPos);
+					RsslUInt32 runLength = (escPtr ? (RsslUInt32)(escPtr - inBuffer->data) : inBuffer->length) - inBufPos;
+
+					if(cacheBufPos + runLength > cacheBuf->allocatedLength)
 					{
 						/*Out of space */
+						if(cacheBufPos < cacheBuf->allocatedLength)
+							memcpy(cacheBuf->data + cacheBufPos, inBuffer->data + inBufPos, cacheBuf->allocatedLength - cacheBufPos);
 						return RSSL_RET_BUFFER_TOO_SMALL;
 					}
+					memcpy(cacheBuf->data + cacheBufPos, inBuffer->data + inBufPos, runLength);
+					cacheBufPos += runLength;
+					inBufPos += runLength - 1;
 					prevChar = inBuffer->data[inBufPos];
-					cacheBuf->data[cacheBufPos] = inBuffer->data[inBufPos];
-					cacheBufPos++;
 				}
 				break;
 			case ESC:
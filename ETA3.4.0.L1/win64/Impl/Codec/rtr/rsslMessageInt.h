@@ -68,6 +68,14 @@ RSSL_API RsslRet rsslDecodeMsgHeader(const RsslDecodeIterator * dIter, RsslMsg *
  */
 RSSL_API RsslRet rsslDecodeDataSection(RsslMsg * msg, const RsslBuffer * buffer);
 
+/**
+ * @brief Finds the sequence number in an encoded message.
+ * @param pos                set to the position of the encoded sequence number
+ * @param pEncodedMessageBuffer buffer containing the encoded message
+ * @returns RSSL_RET_FAILURE if the message has no sequence number, RSSL_RET_INVALID_ARGUMENT if the buffer is too short
+ */
+RsslRet _rsslSeqNumPos(char ** pos, const RsslBuffer * pEncodedMessageBuffer);
+
 #ifdef __cplusplus
 }
 #endif
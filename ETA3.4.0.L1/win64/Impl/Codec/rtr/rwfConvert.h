@@ -18,6 +18,7 @@
 #include "rtr/rsslReal.h"
 #include "rtr/rsslDateTime.h"
 #include "rtr/rtratoi.h"
+#include <string.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -140,6 +141,84 @@ extern RsslRet rwf_stodatetime_size(
 					const char *strptr,
 					const char *endptr );
 
+#ifdef RTR_LITTLE_ENDIAN
+
+/* Helpers for parsing eight characters at a time in a 64 bit word (SWAR).
+ * A word holds the characters in memory order, so the first character is in its
+ * lowest byte; this needs a little endian machine, and the parsers that use these
+ * fall back to their character loops elsewhere. */
+#define RWF_SWAR_PARSE
+
+#define RWF_SWAR_ZEROS		RTR_ULL(0x3030303030303030)
+#define RWF_SWAR_HIGH_BITS	RTR_ULL(0x8080808080808080)
+
+/* Loads eight characters into a word. */
+RTR_C_INLINE RsslUInt64 rwfSwarLoad(const char *ptr)
+{
+	RsslUInt64 word;
+	memcpy(&word, ptr, sizeof(word));
+	return word;
+}
+
+/* Returns a word with the high bit set in each byte of 'word' that is not an ascii digit. */
+RTR_C_INLINE RsslUInt64 rwfSwarNonDigits(RsslUInt64 word)
+{
+	/* A digit has 3 in its high nibble, both before and after adding 6. A carry out of
+	 * a byte only happens for a non-digit, and can only mark a later byte wrongly. */
+	RsslUInt64 diff = ((word & RTR_ULL(0xF0F0F0F0F0F0F0F0)) ^ RWF_SWAR_ZEROS)
+		| (((word + RTR_ULL(0x0606060606060606)) & RTR_ULL(0xF0F0F0F0F0F0F0F0)) ^ RWF_SWAR_ZEROS);
+
+	return (((diff & ~RWF_SWAR_HIGH_BITS) + ~RWF_SWAR_HIGH_BITS) | diff) & RWF_SWAR_HIGH_BITS;
+}
+
+/* Builds a word from eight characters, e.g. a layout for rwfSwarMatches(). */
+#define RWF_SWAR_WORD(c0, c1, c2, c3, c4, c5, c6, c7) \
+	((RsslUInt64)(RsslUInt8)(c0) | ((RsslUInt64)(RsslUInt8)(c1) << 8) | ((RsslUInt64)(RsslUInt8)(c2) << 16) | ((RsslUInt64)(RsslUInt8)(c3) << 24) \
+	| ((RsslUInt64)(RsslUInt8)(c4) << 32) | ((RsslUInt64)(RsslUInt8)(c5) << 40) | ((RsslUInt64)(RsslUInt8)(c6) << 48) | ((RsslUInt64)(RsslUInt8)(c7) << 56))
+
+/* Checks a word against a fixed layout, which has '0' in each byte that must be a digit and
+ * the expected character in every other byte. */
+RTR_C_INLINE RsslBool rwfSwarMatches(RsslUInt64 word, RsslUInt64 layout)
+{
+	/* High bit set in each byte of the layout that is not a digit. */
+	RsslUInt64 separators = layout ^ RWF_SWAR_ZEROS;
+	RsslUInt64 digitMask;
+
+	separators = (((separators & ~RWF_SWAR_HIGH_BITS) + ~RWF_SWAR_HIGH_BITS) | separators) & RWF_SWAR_HIGH_BITS;
+	digitMask = ~((separators >> 7) * 0xFF);
+
+	return (((word ^ layout) & ~digitMask) == 0 && (rwfSwarNonDigits(word) & digitMask) == 0) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Returns the value of the eight digits in a word, after RWF_SWAR_ZEROS has been subtracted from it. */
+RTR_C_INLINE RsslUInt32 rwfSwarDigitsValue(RsslUInt64 digits)
+{
+	/* Combine neighbouring digits into pairs, then pairs into fours, then fours into the result. */
+	digits = (digits * 10) + (digits >> 8);
+	return (RsslUInt32)((((digits & RTR_ULL(0x000000FF000000FF)) * (100 + (RTR_ULL(1000000) << 32)))
+		+ (((digits >> 16) & RTR_ULL(0x000000FF000000FF)) * (1 + (RTR_ULL(10000) << 32)))) >> 32);
+}
+
+/* Returns the value of the first 'count' (1 to 8) characters of a word, which must be digits. */
+RTR_C_INLINE RsslUInt32 rwfSwarLeadingDigitsValue(RsslUInt64 word, RsslUInt32 count)
+{
+	/* Shifting the digits to the top of the word leaves zero digits in front of them. */
+	return rwfSwarDigitsValue((word - RWF_SWAR_ZEROS) << (8 * (8 - count)));
+}
+
+/* Returns the two digit value of the characters at 'offset' and 'offset' + 1 of a word, which must be digits. */
+#define RWF_SWAR_2DIGITS(word, offset) \
+	((RsslUInt32)(((word) >> (8 * (offset))) & 0x0F) * 10 + (RsslUInt32)(((word) >> (8 * (offset) + 8)) & 0x0F))
+
+/* Converts "mm/dd/yyyy hh:mm:ss" or "mm/dd/yyyy hh:mm:ss:mmm" as rwf_stodatetime() does. Returns RSSL_FALSE,
+ * leaving oDTime untouched, if the string has any other form. */
+extern RsslBool rwf_stodatetime_swar(
+					RsslDateTime *oDTime,
+					const char *strptr,
+					size_t length );
+
+#endif
+
 #if defined(__cplusplus)
 }
 #endif
@@ -925,6 +925,237 @@ RsslUInt8 _rwf_SetFractionHint( RsslInt32 denom )
 	return retval;
 }
 
+#ifdef RWF_SWAR_PARSE
+
+/* Longest string handled by _rwf_storeal64_swar(), which holds it in two words. */
+#define RWF_SWAR_REAL_MAX_LENGTH	16
+
+static const RsslUInt64 _rwf_powersOf10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000 };
+
+/* Position of each bit in a de Bruijn sequence, used to find the lowest set bit of a 32 bit value. */
+static const RsslUInt8 _rwf_deBruijnBitPosition[32] = {
+	0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+	31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9 };
+
+#define _rwf_lowestSetBit(bits) \
+	(_rwf_deBruijnBitPosition[(((bits) & (0 - (bits))) * 0x077CB531U) >> 27])
+
+/* Loads fewer than eight characters into a word, padded with zero bytes, without reading past them. */
+RTR_C_INLINE RsslUInt64 _rwf_swarLoadShort(const char *ptr, size_t length)
+{
+	/* Two overlapping loads cover the characters. */
+	if (length >= 4)
+	{
+		RsslUInt32 first, last;
+		memcpy(&first, ptr, 4);
+		memcpy(&last, ptr + length - 4, 4);
+		return first | ((RsslUInt64)last << (8 * (length - 4)));
+	}
+	else if (length >= 2)
+	{
+		RsslUInt16 first, last;
+		memcpy(&first, ptr, 2);
+		memcpy(&last, ptr + length - 2, 2);
+		return first | ((RsslUInt64)last << (8 * (length - 2)));
+	}
+	else
+		return length ? (RsslUInt8)ptr[0] : 0;
+}
+
+/* Returns a bit for each of the eight characters in a word, set when the character is not a digit. */
+RTR_C_INLINE RsslUInt32 _rwf_nonDigitBits(RsslUInt64 word)
+{
+	/* Gathers the high bit of each byte into the top byte of the product. */
+	return (RsslUInt32)(((rwfSwarNonDigits(word) >> 7) * RTR_ULL(0x0102040810204080)) >> 56);
+}
+
+/* Returns the eight characters starting at 'offset' (0 to 15) of the sixteen held in two words. */
+RTR_C_INLINE RsslUInt64 _rwf_swarWordAt(RsslUInt64 first, RsslUInt64 second, RsslUInt32 offset)
+{
+	if (offset == 0)
+		return first;
+	else if (offset < 8)
+		return (first >> (8 * offset)) | (second << (64 - 8 * offset));
+	else
+		return second >> (8 * (offset - 8));
+}
+
+/* Returns the value of the 'count' (1 to 16) digits starting at 'offset' of the sixteen characters held in two words. */
+RTR_C_INLINE RsslUInt64 _rwf_swarDigits(RsslUInt64 first, RsslUInt64 second, RsslUInt32 offset, RsslUInt32 count)
+{
+	if (count <= 8)
+		return rwfSwarLeadingDigitsValue(_rwf_swarWordAt(first, second, offset), count);
+
+	return (RsslUInt64)rwfSwarDigitsValue(_rwf_swarWordAt(first, second, offset) - RWF_SWAR_ZEROS) * _rwf_powersOf10[count - 8]
+		+ rwfSwarLeadingDigitsValue(_rwf_swarWordAt(first, second, offset + 8), count - 8);
+}
+
+/* Converts the common forms of real ("-123", "-123.45", "-12 3/4" and "-3/4") a word at a time,
+ * giving the same result as the character loops in rwf_storeal64_size(). Returns RSSL_FALSE,
+ * leaving oReal64 untouched, for any other string (leading spaces must already be removed).
+ * When trimTrailingZeros is not set, integers ending in a zero are also refused, as
+ * rwf_storeal64() gives them a different hint. */
+static RsslBool _rwf_storeal64_swar(RsslReal *oReal64, const char *strptr, size_t length, RsslBool trimTrailingZeros)
+{
+	RsslUInt64	first, second;
+	RsslUInt32	nonDigits;
+	RsslUInt32	start, end;
+	RsslUInt32	intDigits;
+	RsslUInt64	value;
+	RsslUInt8	hint;
+	int			isNeg;
+
+	if (length == 0 || length > RWF_SWAR_REAL_MAX_LENGTH)
+		return RSSL_FALSE;
+
+	/* Hold the string in two words, padded with zero bytes. Padding is not a digit, so every run of digits ends inside the words. */
+	if (length >= 8)
+	{
+		first = rwfSwarLoad(strptr);
+		second = (length == 16) ? rwfSwarLoad(strptr + 8) : (length == 8) ? 0 : rwfSwarLoad(strptr + length - 8) >> (8 * (16 - length));
+	}
+	else
+	{
+		first = _rwf_swarLoadShort(strptr, length);
+		second = 0;
+	}
+
+	nonDigits = _rwf_nonDigitBits(first) | (_rwf_nonDigitBits(second) << 8) | 0xFFFF0000;
+
+	isNeg = ((first & 0xFF) == '-');
+	start = isNeg;
+	end = start + _rwf_lowestSetBit(nonDigits >> start);
+	intDigits = end - start;
+
+	if (intDigits == 0)
+		return RSSL_FALSE;
+
+	value = _rwf_swarDigits(first, second, start, intDigits);
+
+	if (end == length)
+	{
+		hint = RSSL_RH_EXPONENT0;
+
+		if (((_rwf_swarWordAt(first, second, end - 1)) & 0xFF) == '0')
+		{
+			if (!trimTrailingZeros)
+				return RSSL_FALSE;
+
+			/* Move up to seven trailing zeros into the exponent. */
+			while (value != 0 && value % 10 == 0 && hint < RSSL_RH_EXPONENT7)
+			{
+				value /= 10;
+				++hint;
+			}
+		}
+	}
+	else
+	{
+		RsslUInt8 separator = (RsslUInt8)(_rwf_swarWordAt(first, second, end) & 0xFF);
+
+		if (separator == '.')
+		{
+			RsslUInt32 fracDigits;
+
+			start = end + 1;
+			end = start + _rwf_lowestSetBit(nonDigits >> start);
+			fracDigits = end - start;
+
+			if (end != length || fracDigits == 0)
+				return RSSL_FALSE;
+
+			/* At most 14 fractional digits fit, so the hint is in range. */
+			if (fracDigits > 8)
+				value = value * _rwf_powersOf10[8] * _rwf_powersOf10[fracDigits - 8];
+			else
+				value = value * _rwf_powersOf10[fracDigits];
+			value += _rwf_swarDigits(first, second, start, fracDigits);
+			hint = RSSL_RH_EXPONENT0 - (RsslUInt8)fracDigits;
+		}
+		else if (separator == ' ' || separator == '/')
+		{
+			RsslUInt64	numerator = 0;
+			RsslInt32	denominator;
+
+			if (separator == ' ')
+			{
+				/* Whole number, then numerator. */
+				start = end + 1;
+				end = start + _rwf_lowestSetBit(nonDigits >> start);
+
+				/* More than nine digits can overflow the numerator in rwf_storeal64_size(). */
+				if (end == start || end - start > 9 || end == length || (_rwf_swarWordAt(first, second, end) & 0xFF) != '/')
+					return RSSL_FALSE;
+
+				numerator = _rwf_swarDigits(first, second, start, end - start);
+			}
+
+			start = end + 1;
+			end = start + _rwf_lowestSetBit(nonDigits >> start);
+
+			if (end != length || end == start || end - start > 3)
+				return RSSL_FALSE;
+
+			denominator = (RsslInt32)_rwf_swarDigits(first, second, start, end - start);
+			if ((hint = _rwf_SetFractionHint(denominator)) == 0)
+				return RSSL_FALSE;
+
+			if (separator == ' ')
+				value = (value * denominator) + numerator;
+		}
+		else
+			return RSSL_FALSE;
+	}
+
+	oReal64->isBlank = RSSL_FALSE;
+	oReal64->hint = hint;
+	oReal64->value = (isNeg ? -1 * value : value);
+	return RSSL_TRUE;
+}
+
+/* Converts "mm/dd/yyyy hh:mm:ss", optionally followed by ":mmm", a word at a time, giving the same
+ * result as the character loop in rwf_stodatetime().  Returns RSSL_FALSE, leaving oDTime untouched,
+ * for any other string. */
+RsslBool rwf_stodatetime_swar(RsslDateTime *oDTime, const char *strptr, size_t length)
+{
+	RsslUInt64 date, yearTime, time, milli = 0;
+
+	if (length != 19 && length != 23)
+		return RSSL_FALSE;
+
+	date = rwfSwarLoad(strptr);
+	yearTime = rwfSwarLoad(strptr + 8);
+	time = rwfSwarLoad(strptr + 11);
+
+	if (!rwfSwarMatches(date, RWF_SWAR_WORD('0', '0', '/', '0', '0', '/', '0', '0'))
+			|| !rwfSwarMatches(yearTime, RWF_SWAR_WORD('0', '0', ' ', '0', '0', ':', '0', '0'))
+			|| !rwfSwarMatches(time, RWF_SWAR_WORD('0', '0', ':', '0', '0', ':', '0', '0')))
+		return RSSL_FALSE;
+
+	if (length == 23)
+	{
+		/* "m:ss:mmm" */
+		milli = rwfSwarLoad(strptr + 15);
+
+		if (!rwfSwarMatches(milli, RWF_SWAR_WORD('0', ':', '0', '0', ':', '0', '0', '0')))
+			return RSSL_FALSE;
+	}
+
+	rsslClearDateTime(oDTime);
+
+	oDTime->date.month = (RsslUInt8)RWF_SWAR_2DIGITS(date, 0);
+	oDTime->date.day = (RsslUInt8)RWF_SWAR_2DIGITS(date, 3);
+	oDTime->date.year = (RsslUInt16)(RWF_SWAR_2DIGITS(date, 6) * 100 + RWF_SWAR_2DIGITS(yearTime, 0));
+	oDTime->time.hour = (RsslUInt8)RWF_SWAR_2DIGITS(yearTime, 3);
+	oDTime->time.minute = (RsslUInt8)RWF_SWAR_2DIGITS(yearTime, 6);
+	oDTime->time.second = (RsslUInt8)RWF_SWAR_2DIGITS(time, 6);
+	if (length == 23)
+		oDTime->time.millisecond = (RsslUInt16)(RWF_SWAR_2DIGITS(milli, 5) * 10 + ((milli >> 56) & 0x0F));
+	return RSSL_TRUE;
+}
+
+#endif
+
 RsslRet rwf_storeal64( RsslReal *oReal64, const char *strptr )
 {
 	RsslUInt64	value = 0,tempValue=0;
@@ -944,6 +1175,11 @@ RsslRet rwf_storeal64( RsslReal *oReal64, const char *strptr )
 
 	__rtr_removewhitespace_null(strptr);
 
+#ifdef RWF_SWAR_PARSE
+	if (_rwf_storeal64_swar(oReal64, strptr, strlen(strptr), RSSL_FALSE))
+		return RSSL_RET_SUCCESS;
+#endif
+
 	if (*strptr == '\0')
 	{
 		oReal64->isBlank = RSSL_TRUE;
@@ -1132,6 +1368,11 @@ RsslRet rwf_storeal64_size( RsslReal *oReal64, const char *strptr, const char *e
 
 	__rtr_removewhitespace_end(strptr,endptr);
 
+#ifdef RWF_SWAR_PARSE
+	if (strptr <= endptr && _rwf_storeal64_swar(oReal64, strptr, endptr - strptr + 1, RSSL_TRUE))
+		return RSSL_RET_SUCCESS;
+#endif
+
 	if (strptr > endptr)
 	{
 		oReal64->isBlank = RSSL_TRUE;
@@ -1338,6 +1579,12 @@ RsslRet rwf_stodatetime( RsslDateTime *oDTime, const char *strptr )
 	rsslClearDateTime(oDTime);
 
 	__rtr_removewhitespace_null(strptr);
+
+#ifdef RWF_SWAR_PARSE
+	if (rwf_stodatetime_swar(oDTime, strptr, strlen(strptr)))
+		return RSSL_RET_SUCCESS;
+#endif
+
 	__rwf_atonumber_null(strptr,value8,foundDigit,MAX_INT8DIV10,nextDigit,tValue8);
 	if (*strptr++ != '/')
 		return RSSL_RET_INVALID_DATA;
@@ -1392,6 +1639,13 @@ RsslRet rwf_stodatetime_size( RsslDateTime *oDTime, const char *strptr, const ch
 	rsslClearDateTime(oDTime);
 
 	__rtr_removewhitespace_end(strptr,endptr);
+
+#ifdef RWF_SWAR_PARSE
+	/* Only without milliseconds, which the loop below reads differently. */
+	if (strptr + 18 == endptr && rwf_stodatetime_swar(oDTime, strptr, 19))
+		return RSSL_RET_SUCCESS;
+#endif
+
 	__rwf_atonumber_end(strptr,endptr,value8,foundDigit,MAX_INT8DIV10,nextDigit,tValue8);
 	if (*strptr++ != '/')
 		return RSSL_RET_INVALID_DATA;
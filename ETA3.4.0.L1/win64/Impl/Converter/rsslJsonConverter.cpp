@@ -0,0 +1,2869 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+/* Converts between RWF and JSON with the rapidjson SAX interfaces.  RWF to JSON decodes a message
+ * and writes each value to a rapidjson Writer as it is decoded.  JSON to RWF parses the text with
+ * the rapidjson Reader and encodes each value as the Reader reaches it, keeping only a stack of the
+ * containers that are open.  Neither direction builds a document. */
+
+#include "rtr/rsslJsonConverter.h"
+
+#include "rapidjson/reader.h"
+#include "rapidjson/writer.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/error/en.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+#define JSON_NAME(str) { sizeof(str) - 1, (char*)str }
+
+/* Member names. */
+static const RsslBuffer JSON_TYPE = JSON_NAME("Type");
+static const RsslBuffer JSON_ID = JSON_NAME("ID");
+static const RsslBuffer JSON_DOMAIN = JSON_NAME("Domain");
+static const RsslBuffer JSON_KEY = JSON_NAME("Key");
+static const RsslBuffer JSON_SERVICE = JSON_NAME("Service");
+static const RsslBuffer JSON_NAME_MEMBER = JSON_NAME("Name");
+static const RsslBuffer JSON_NAME_TYPE = JSON_NAME("NameType");
+static const RsslBuffer JSON_FILTER = JSON_NAME("Filter");
+static const RsslBuffer JSON_IDENTIFIER = JSON_NAME("Identifier");
+static const RsslBuffer JSON_ATTRIB = JSON_NAME("Attrib");
+static const RsslBuffer JSON_DATA = JSON_NAME("Data");
+static const RsslBuffer JSON_STREAM = JSON_NAME("Stream");
+static const RsslBuffer JSON_CODE = JSON_NAME("Code");
+static const RsslBuffer JSON_TEXT = JSON_NAME("Text");
+static const RsslBuffer JSON_TIMELINESS = JSON_NAME("Timeliness");
+static const RsslBuffer JSON_RATE = JSON_NAME("Rate");
+static const RsslBuffer JSON_DYNAMIC = JSON_NAME("Dynamic");
+static const RsslBuffer JSON_TIME_INFO = JSON_NAME("TimeInfo");
+static const RsslBuffer JSON_RATE_INFO = JSON_NAME("RateInfo");
+static const RsslBuffer JSON_CLASS = JSON_NAME("Class");
+static const RsslBuffer JSON_COUNT = JSON_NAME("Count");
+static const RsslBuffer JSON_TIME = JSON_NAME("Time");
+static const RsslBuffer JSON_ADDRESS = JSON_NAME("Address");
+static const RsslBuffer JSON_USER_ID = JSON_NAME("UserID");
+static const RsslBuffer JSON_KEY_TYPE = JSON_NAME("KeyType");
+static const RsslBuffer JSON_CONTAINER_TYPE = JSON_NAME("ContainerType");
+static const RsslBuffer JSON_COUNT_HINT = JSON_NAME("CountHint");
+static const RsslBuffer JSON_KEY_FIELD_ID = JSON_NAME("KeyFieldId");
+static const RsslBuffer JSON_SUPPORTS_SORTING = JSON_NAME("SupportsSorting");
+static const RsslBuffer JSON_SUMMARY = JSON_NAME("Summary");
+static const RsslBuffer JSON_ENTRIES = JSON_NAME("Entries");
+static const RsslBuffer JSON_ACTION = JSON_NAME("Action");
+static const RsslBuffer JSON_INDEX = JSON_NAME("Index");
+static const RsslBuffer JSON_LENGTH = JSON_NAME("Length");
+
+static const RsslBuffer JSON_NAN = JSON_NAME("NaN");
+static const RsslBuffer JSON_INF = JSON_NAME("Inf");
+static const RsslBuffer JSON_NEG_INF = JSON_NAME("-Inf");
+
+/* RMTES designation of UTF-8 text, put in front of a non-ASCII string when it is encoded as RMTES. */
+static const RsslBuffer RMTES_UTF8_DESIGNATION = JSON_NAME("\x1B\x25\x30");
+
+/* Deepest nesting of JSON objects and arrays in a message. */
+#define JSON_MAX_DEPTH 64
+
+/* Kinds of message header members. */
+typedef enum {
+	JSON_HDR_FLAG,				/* true if the flag is set */
+	JSON_HDR_UINT8,
+	JSON_HDR_UINT16,
+	JSON_HDR_UINT32,
+	JSON_HDR_STATE,				/* RsslState */
+	JSON_HDR_QOS,				/* RsslQos */
+	JSON_HDR_PRIORITY,			/* RsslRequestMsg priorityClass and priorityCount */
+	JSON_HDR_CONF_INFO,			/* RsslUpdateMsg conflationCount and conflationTime */
+	JSON_HDR_POST_USER_INFO,	/* RsslPostUserInfo */
+	JSON_HDR_TEXT				/* RsslBuffer */
+} JsonHeaderKind;
+
+/* A message header member.  Present when flag is 0 or set in the message's flags; for JSON_HDR_FLAG, the flag is the value. */
+typedef struct {
+	RsslBuffer	name;
+	RsslUInt8	msgClass;
+	RsslUInt8	kind;
+	RsslUInt16	flag;
+	size_t		offset;
+} JsonHeaderMember;
+
+static const JsonHeaderMember jsonHeaderMembers[] = {
+	{ JSON_NAME("SeqNumber"),			RSSL_MC_REFRESH,	JSON_HDR_UINT32,			RSSL_RFMF_HAS_SEQ_NUM,			offsetof(RsslRefreshMsg, seqNum) },
+	{ JSON_NAME("PartNumber"),			RSSL_MC_REFRESH,	JSON_HDR_UINT16,			RSSL_RFMF_HAS_PART_NUM,			offsetof(RsslRefreshMsg, partNum) },
+	{ JSON_NAME("State"),				RSSL_MC_REFRESH,	JSON_HDR_STATE,				0,								offsetof(RsslRefreshMsg, state) },
+	{ JSON_NAME("Qos"),					RSSL_MC_REFRESH,	JSON_HDR_QOS,				RSSL_RFMF_HAS_QOS,				offsetof(RsslRefreshMsg, qos) },
+	{ JSON_NAME("PostUserInfo"),		RSSL_MC_REFRESH,	JSON_HDR_POST_USER_INFO,	RSSL_RFMF_HAS_POST_USER_INFO,	offsetof(RsslRefreshMsg, postUserInfo) },
+	{ JSON_NAME("Solicited"),			RSSL_MC_REFRESH,	JSON_HDR_FLAG,				RSSL_RFMF_SOLICITED,			0 },
+	{ JSON_NAME("Complete"),			RSSL_MC_REFRESH,	JSON_HDR_FLAG,				RSSL_RFMF_REFRESH_COMPLETE,		0 },
+	{ JSON_NAME("ClearCache"),			RSSL_MC_REFRESH,	JSON_HDR_FLAG,				RSSL_RFMF_CLEAR_CACHE,			0 },
+	{ JSON_NAME("DoNotCache"),			RSSL_MC_REFRESH,	JSON_HDR_FLAG,				RSSL_RFMF_DO_NOT_CACHE,			0 },
+	{ JSON_NAME("PrivateStream"),		RSSL_MC_REFRESH,	JSON_HDR_FLAG,				RSSL_RFMF_PRIVATE_STREAM,		0 },
+	{ JSON_NAME("Qualified"),			RSSL_MC_REFRESH,	JSON_HDR_FLAG,				RSSL_RFMF_QUALIFIED_STREAM,		0 },
+
+	{ JSON_NAME("UpdateType"),			RSSL_MC_UPDATE,		JSON_HDR_UINT8,				0,								offsetof(RsslUpdateMsg, updateType) },
+	{ JSON_NAME("SeqNumber"),			RSSL_MC_UPDATE,		JSON_HDR_UINT32,			RSSL_UPMF_HAS_SEQ_NUM,			offsetof(RsslUpdateMsg, seqNum) },
+	{ JSON_NAME("ConflationInfo"),		RSSL_MC_UPDATE,		JSON_HDR_CONF_INFO,			RSSL_UPMF_HAS_CONF_INFO,		0 },
+	{ JSON_NAME("PostUserInfo"),		RSSL_MC_UPDATE,		JSON_HDR_POST_USER_INFO,	RSSL_UPMF_HAS_POST_USER_INFO,	offsetof(RsslUpdateMsg, postUserInfo) },
+	{ JSON_NAME("DoNotCache"),			RSSL_MC_UPDATE,		JSON_HDR_FLAG,				RSSL_UPMF_DO_NOT_CACHE,			0 },
+	{ JSON_NAME("DoNotConflate"),		RSSL_MC_UPDATE,		JSON_HDR_FLAG,				RSSL_UPMF_DO_NOT_CONFLATE,		0 },
+	{ JSON_NAME("DoNotRipple"),			RSSL_MC_UPDATE,		JSON_HDR_FLAG,				RSSL_UPMF_DO_NOT_RIPPLE,		0 },
+	{ JSON_NAME("Discardable"),			RSSL_MC_UPDATE,		JSON_HDR_FLAG,				RSSL_UPMF_DISCARDABLE,			0 },
+
+	{ JSON_NAME("State"),				RSSL_MC_STATUS,		JSON_HDR_STATE,				RSSL_STMF_HAS_STATE,			offsetof(RsslStatusMsg, state) },
+	{ JSON_NAME("PostUserInfo"),		RSSL_MC_STATUS,		JSON_HDR_POST_USER_INFO,	RSSL_STMF_HAS_POST_USER_INFO,	offsetof(RsslStatusMsg, postUserInfo) },
+	{ JSON_NAME("ClearCache"),			RSSL_MC_STATUS,		JSON_HDR_FLAG,				RSSL_STMF_CLEAR_CACHE,			0 },
+	{ JSON_NAME("PrivateStream"),		RSSL_MC_STATUS,		JSON_HDR_FLAG,				RSSL_STMF_PRIVATE_STREAM,		0 },
+	{ JSON_NAME("Qualified"),			RSSL_MC_STATUS,		JSON_HDR_FLAG,				RSSL_STMF_QUALIFIED_STREAM,		0 },
+
+	{ JSON_NAME("Priority"),			RSSL_MC_REQUEST,	JSON_HDR_PRIORITY,			RSSL_RQMF_HAS_PRIORITY,			0 },
+	{ JSON_NAME("Qos"),					RSSL_MC_REQUEST,	JSON_HDR_QOS,				RSSL_RQMF_HAS_QOS,				offsetof(RsslRequestMsg, qos) },
+	{ JSON_NAME("WorstQos"),			RSSL_MC_REQUEST,	JSON_HDR_QOS,				RSSL_RQMF_HAS_WORST_QOS,		offsetof(RsslRequestMsg, worstQos) },
+	{ JSON_NAME("Streaming"),			RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_STREAMING,			0 },
+	{ JSON_NAME("KeyInUpdates"),		RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_MSG_KEY_IN_UPDATES,	0 },
+	{ JSON_NAME("ConfInfoInUpdates"),	RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_CONF_INFO_IN_UPDATES,	0 },
+	{ JSON_NAME("NoRefresh"),			RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_NO_REFRESH,			0 },
+	{ JSON_NAME("PrivateStream"),		RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_PRIVATE_STREAM,		0 },
+	{ JSON_NAME("Pause"),				RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_PAUSE,				0 },
+	{ JSON_NAME("View"),				RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_HAS_VIEW,				0 },
+	{ JSON_NAME("Batch"),				RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_HAS_BATCH,			0 },
+	{ JSON_NAME("Qualified"),			RSSL_MC_REQUEST,	JSON_HDR_FLAG,				RSSL_RQMF_QUALIFIED_STREAM,		0 },
+
+	{ JSON_NAME("Ack"),					RSSL_MC_CLOSE,		JSON_HDR_FLAG,				RSSL_CLMF_ACK,					0 },
+	{ JSON_NAME("Batch"),				RSSL_MC_CLOSE,		JSON_HDR_FLAG,				RSSL_CLMF_HAS_BATCH,			0 },
+
+	{ JSON_NAME("AckID"),				RSSL_MC_ACK,		JSON_HDR_UINT32,			0,								offsetof(RsslAckMsg, ackId) },
+	{ JSON_NAME("NakCode"),				RSSL_MC_ACK,		JSON_HDR_UINT8,				RSSL_AKMF_HAS_NAK_CODE,			offsetof(RsslAckMsg, nakCode) },
+	{ JSON_NAME("SeqNumber"),			RSSL_MC_ACK,		JSON_HDR_UINT32,			RSSL_AKMF_HAS_SEQ_NUM,			offsetof(RsslAckMsg, seqNum) },
+	{ JSON_NAME("Text"),				RSSL_MC_ACK,		JSON_HDR_TEXT,				RSSL_AKMF_HAS_TEXT,				offsetof(RsslAckMsg, text) },
+	{ JSON_NAME("PrivateStream"),		RSSL_MC_ACK,		JSON_HDR_FLAG,				RSSL_AKMF_PRIVATE_STREAM,		0 },
+	{ JSON_NAME("Qualified"),			RSSL_MC_ACK,		JSON_HDR_FLAG,				RSSL_AKMF_QUALIFIED_STREAM,		0 },
+
+	{ JSON_NAME("SeqNumber"),			RSSL_MC_GENERIC,	JSON_HDR_UINT32,			RSSL_GNMF_HAS_SEQ_NUM,			offsetof(RsslGenericMsg, seqNum) },
+	{ JSON_NAME("SecondarySeqNumber"),	RSSL_MC_GENERIC,	JSON_HDR_UINT32,			RSSL_GNMF_HAS_SECONDARY_SEQ_NUM, offsetof(RsslGenericMsg, secondarySeqNum) },
+	{ JSON_NAME("PartNumber"),			RSSL_MC_GENERIC,	JSON_HDR_UINT16,			RSSL_GNMF_HAS_PART_NUM,			offsetof(RsslGenericMsg, partNum) },
+	{ JSON_NAME("Complete"),			RSSL_MC_GENERIC,	JSON_HDR_FLAG,				RSSL_GNMF_MESSAGE_COMPLETE,		0 },
+
+	{ JSON_NAME("PostID"),				RSSL_MC_POST,		JSON_HDR_UINT32,			RSSL_PSMF_HAS_POST_ID,			offsetof(RsslPostMsg, postId) },
+	{ JSON_NAME("SeqNumber"),			RSSL_MC_POST,		JSON_HDR_UINT32,			RSSL_PSMF_HAS_SEQ_NUM,			offsetof(RsslPostMsg, seqNum) },
+	{ JSON_NAME("PartNumber"),			RSSL_MC_POST,		JSON_HDR_UINT16,			RSSL_PSMF_HAS_PART_NUM,			offsetof(RsslPostMsg, partNum) },
+	{ JSON_NAME("PostUserRights"),		RSSL_MC_POST,		JSON_HDR_UINT16,			RSSL_PSMF_HAS_POST_USER_RIGHTS,	offsetof(RsslPostMsg, postUserRights) },
+	{ JSON_NAME("PostUserInfo"),		RSSL_MC_POST,		JSON_HDR_POST_USER_INFO,	0,								offsetof(RsslPostMsg, postUserInfo) },
+	{ JSON_NAME("Complete"),			RSSL_MC_POST,		JSON_HDR_FLAG,				RSSL_PSMF_POST_COMPLETE,		0 },
+	{ JSON_NAME("Ack"),					RSSL_MC_POST,		JSON_HDR_FLAG,				RSSL_PSMF_ACK,					0 }
+};
+
+#define JSON_HEADER_MEMBER_COUNT (sizeof(jsonHeaderMembers) / sizeof(jsonHeaderMembers[0]))
+
+static RsslBool jsonNameIs(const char *str, rapidjson::SizeType length, const RsslBuffer &name)
+{
+	return (length == name.length && memcmp(str, name.data, length) == 0) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Flags of a message, which follow RsslMsgBase in every message class. */
+static RsslUInt16 *jsonMsgFlags(RsslMsg *pMsg)
+{
+	switch (pMsg->msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:	return &pMsg->refreshMsg.flags;
+		case RSSL_MC_UPDATE:	return &pMsg->updateMsg.flags;
+		case RSSL_MC_STATUS:	return &pMsg->statusMsg.flags;
+		case RSSL_MC_REQUEST:	return &pMsg->requestMsg.flags;
+		case RSSL_MC_CLOSE:		return &pMsg->closeMsg.flags;
+		case RSSL_MC_ACK:		return &pMsg->ackMsg.flags;
+		case RSSL_MC_GENERIC:	return &pMsg->genericMsg.flags;
+		case RSSL_MC_POST:		return &pMsg->postMsg.flags;
+		default:				return NULL;
+	}
+}
+
+/* Flag that indicates a message key, or 0 if the message class always has one. */
+static RsslRet jsonMsgKeyFlag(RsslUInt8 msgClass, RsslUInt16 *pFlag)
+{
+	switch (msgClass)
+	{
+		case RSSL_MC_REFRESH:	*pFlag = RSSL_RFMF_HAS_MSG_KEY; return RSSL_RET_SUCCESS;
+		case RSSL_MC_UPDATE:	*pFlag = RSSL_UPMF_HAS_MSG_KEY; return RSSL_RET_SUCCESS;
+		case RSSL_MC_STATUS:	*pFlag = RSSL_STMF_HAS_MSG_KEY; return RSSL_RET_SUCCESS;
+		case RSSL_MC_REQUEST:	*pFlag = 0; return RSSL_RET_SUCCESS;
+		case RSSL_MC_ACK:		*pFlag = RSSL_AKMF_HAS_MSG_KEY; return RSSL_RET_SUCCESS;
+		case RSSL_MC_GENERIC:	*pFlag = RSSL_GNMF_HAS_MSG_KEY; return RSSL_RET_SUCCESS;
+		case RSSL_MC_POST:		*pFlag = RSSL_PSMF_HAS_MSG_KEY; return RSSL_RET_SUCCESS;
+		default:				return RSSL_RET_INVALID_DATA;
+	}
+}
+
+static RsslBool jsonIsPreEncodedType(RsslDataType dataType)
+{
+	return (dataType == RSSL_DT_OPAQUE || dataType == RSSL_DT_XML || dataType == RSSL_DT_ANSI_PAGE) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Names of an enumeration, from one of the ...ToOmmString() functions, for looking up a value by its name. */
+class JsonNameTable
+{
+public:
+	void init(const char* (*toString)(RsslUInt8))
+	{
+		RsslUInt32 value;
+
+		_count = 0;
+		for (value = 0; value <= 255; ++value)
+		{
+			const char *name = toString((RsslUInt8)value);
+
+			_names[value] = name;
+			if (name)
+			{
+				_entries[_count].name = name;
+				_entries[_count].length = (RsslUInt32)strlen(name);
+				_entries[_count].value = (RsslUInt8)value;
+				++_count;
+			}
+		}
+	}
+
+	const char *name(RsslUInt8 value) const { return _names[value]; }
+
+	RsslBool find(const char *str, rapidjson::SizeType length, RsslUInt8 *pValue) const
+	{
+		RsslUInt32 i;
+
+		for (i = 0; i < _count; ++i)
+		{
+			if (_entries[i].length == length && memcmp(_entries[i].name, str, length) == 0)
+			{
+				*pValue = _entries[i].value;
+				return RSSL_TRUE;
+			}
+		}
+		return RSSL_FALSE;
+	}
+
+private:
+	struct Entry {
+		const char	*name;
+		RsslUInt32	length;
+		RsslUInt8	value;
+	};
+
+	Entry		_entries[256];
+	RsslUInt32	_count;
+	const char	*_names[256];
+};
+
+/* Adapters for the ...ToOmmString() functions whose parameters are not RsslUInt8. */
+static const char *jsonDataTypeName(RsslUInt8 value) { return rsslDataTypeToOmmString(value); }
+static const char *jsonTimelinessName(RsslUInt8 value) { return rsslQosTimelinessToOmmString(value); }
+static const char *jsonRateName(RsslUInt8 value) { return rsslQosRateToOmmString(value); }
+
+/* Storage for any primitive value. */
+typedef union {
+	RsslInt			intValue;
+	RsslUInt		uintValue;
+	RsslFloat		floatValue;
+	RsslDouble		doubleValue;
+	RsslReal		realValue;
+	RsslDate		dateValue;
+	RsslTime		timeValue;
+	RsslDateTime	dateTimeValue;
+	RsslQos			qosValue;
+	RsslState		stateValue;
+	RsslEnum		enumValue;
+	RsslBuffer		bufferValue;
+} JsonPrimitive;
+
+/* Kinds of JSON scalar tokens. */
+typedef enum {
+	JSON_TOKEN_NULL,
+	JSON_TOKEN_BOOL,
+	JSON_TOKEN_NUMBER,
+	JSON_TOKEN_STRING
+} JsonTokenType;
+
+typedef struct {
+	JsonTokenType		type;
+	const char			*str;		/* number or string text */
+	rapidjson::SizeType	length;
+	RsslBool			boolValue;
+} JsonToken;
+
+static const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* Writes the base64 form of 'length' bytes.  'out' has room for ((length + 2) / 3) * 4 characters. */
+static RsslUInt32 jsonBase64Encode(char *out, const unsigned char *in, RsslUInt32 length)
+{
+	char *start = out;
+	RsslUInt32 i;
+
+	for (i = 0; i + 2 < length; i += 3)
+	{
+		*out++ = base64Chars[in[i] >> 2];
+		*out++ = base64Chars[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+		*out++ = base64Chars[((in[i + 1] & 0x0F) << 2) | (in[i + 2] >> 6)];
+		*out++ = base64Chars[in[i + 2] & 0x3F];
+	}
+
+	if (i < length)
+	{
+		*out++ = base64Chars[in[i] >> 2];
+		if (i + 1 < length)
+		{
+			*out++ = base64Chars[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+			*out++ = base64Chars[(in[i + 1] & 0x0F) << 2];
+		}
+		else
+		{
+			*out++ = base64Chars[(in[i] & 0x03) << 4];
+			*out++ = '=';
+		}
+		*out++ = '=';
+	}
+
+	return (RsslUInt32)(out - start);
+}
+
+static int jsonBase64Value(char c)
+{
+	if (c >= 'A' && c <= 'Z') return c - 'A';
+	if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+	if (c >= '0' && c <= '9') return c - '0' + 52;
+	if (c == '+') return 62;
+	if (c == '/') return 63;
+	return -1;
+}
+
+/* Decodes base64 text in place.  Returns RSSL_FALSE if the text is not base64. */
+static RsslBool jsonBase64Decode(char *str, RsslUInt32 length, RsslUInt32 *pDecodedLength)
+{
+	unsigned char *out = (unsigned char*)str;
+	RsslUInt32 bits = 0, bitCount = 0, i;
+
+	while (length > 0 && str[length - 1] == '=')
+		--length;
+
+	for (i = 0; i < length; ++i)
+	{
+		int value = jsonBase64Value(str[i]);
+
+		if (value < 0)
+			return RSSL_FALSE;
+
+		bits = (bits << 6) | (RsslUInt32)value;
+		bitCount += 6;
+		if (bitCount >= 8)
+		{
+			bitCount -= 8;
+			*out++ = (unsigned char)(bits >> bitCount);
+		}
+	}
+
+	*pDecodedLength = (RsslUInt32)(out - (unsigned char*)str);
+	return RSSL_TRUE;
+}
+
+/* Writes an RsslReal as an exact decimal number.  'str' has room for 48 characters. */
+static RsslUInt32 jsonRealToNumber(char *str, const RsslReal *pReal)
+{
+	static const RsslUInt32 powersOf5[] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625 };
+	char digits[24];
+	char *out = str;
+	RsslUInt64 magnitude = pReal->value < 0 ? (RsslUInt64)0 - (RsslUInt64)pReal->value : (RsslUInt64)pReal->value;
+	RsslUInt64 fraction = 0;
+	RsslInt32 decimals, count = 0, i;
+
+	if (pReal->hint >= RSSL_RH_FRACTION_1)
+	{
+		/* n / 2^k has k decimal places: the remainder times 5^k. */
+		decimals = pReal->hint - RSSL_RH_FRACTION_1;
+		fraction = (magnitude & (((RsslUInt64)1 << decimals) - 1)) * powersOf5[decimals];
+		magnitude >>= decimals;
+	}
+	else
+		decimals = RSSL_RH_EXPONENT0 - pReal->hint;
+
+	do
+	{
+		digits[count++] = (char)('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude);
+
+	if (pReal->value < 0)
+		*out++ = '-';
+
+	if (pReal->hint >= RSSL_RH_FRACTION_1)
+	{
+		while (count)
+			*out++ = digits[--count];
+		if (decimals)
+		{
+			*out++ = '.';
+			for (i = decimals - 1; i >= 0; --i)
+			{
+				out[i] = (char)('0' + fraction % 10);
+				fraction /= 10;
+			}
+			out += decimals;
+		}
+	}
+	else if (decimals <= 0)
+	{
+		while (count)
+			*out++ = digits[--count];
+		if (str[str[0] == '-'] != '0')
+			for (i = decimals; i < 0; ++i)
+				*out++ = '0';
+	}
+	else
+	{
+		/* Pad to one digit before the decimal point. */
+		while (count <= decimals)
+			digits[count++] = '0';
+		while (count > decimals)
+			*out++ = digits[--count];
+		*out++ = '.';
+		while (count)
+			*out++ = digits[--count];
+	}
+
+	return (RsslUInt32)(out - str);
+}
+
+static RsslBool jsonParseUInt64(const char *str, rapidjson::SizeType length, RsslUInt64 *pValue)
+{
+	RsslUInt64 value = 0;
+	rapidjson::SizeType i;
+
+	if (length == 0 || length > 20)
+		return RSSL_FALSE;
+
+	for (i = 0; i < length; ++i)
+	{
+		RsslUInt64 next;
+
+		if (str[i] < '0' || str[i] > '9')
+			return RSSL_FALSE;
+
+		next = value * 10 + (RsslUInt64)(str[i] - '0');
+		if (next / 10 != value)
+			return RSSL_FALSE;
+		value = next;
+	}
+
+	*pValue = value;
+	return RSSL_TRUE;
+}
+
+static RsslBool jsonParseInt64(const char *str, rapidjson::SizeType length, RsslInt64 *pValue)
+{
+	RsslUInt64 magnitude;
+
+	if (length > 0 && str[0] == '-')
+	{
+		if (!jsonParseUInt64(str + 1, length - 1, &magnitude) || magnitude > (RsslUInt64)RTR_LL(9223372036854775807) + 1)
+			return RSSL_FALSE;
+		*pValue = (RsslInt64)((RsslUInt64)0 - magnitude);
+		return RSSL_TRUE;
+	}
+
+	if (!jsonParseUInt64(str, length, &magnitude) || magnitude > (RsslUInt64)RTR_LL(9223372036854775807))
+		return RSSL_FALSE;
+	*pValue = (RsslInt64)magnitude;
+	return RSSL_TRUE;
+}
+
+/* State of a JSON object or array that is being read. */
+typedef enum {
+	JSON_FRAME_MSG,
+	JSON_FRAME_MSG_KEY,
+	JSON_FRAME_ATTRIB,
+	JSON_FRAME_STATE,
+	JSON_FRAME_QOS,
+	JSON_FRAME_PRIORITY,
+	JSON_FRAME_CONF_INFO,
+	JSON_FRAME_POST_USER_INFO,
+	JSON_FRAME_FIELD_LIST,
+	JSON_FRAME_ELEMENT_LIST,
+	JSON_FRAME_ELEMENT_ENTRY,
+	JSON_FRAME_ARRAY,
+	JSON_FRAME_ARRAY_ENTRIES,
+	JSON_FRAME_MAP,
+	JSON_FRAME_MAP_ENTRIES,
+	JSON_FRAME_MAP_ENTRY,
+	JSON_FRAME_VECTOR,
+	JSON_FRAME_VECTOR_ENTRIES,
+	JSON_FRAME_VECTOR_ENTRY,
+	JSON_FRAME_SERIES,
+	JSON_FRAME_SERIES_ENTRIES,
+	JSON_FRAME_SERIES_ENTRY
+} JsonFrameType;
+
+typedef struct {
+	JsonFrameType				type;
+	const char					*key;			/* Member being read. */
+	rapidjson::SizeType			keyLength;
+	RsslDataType				dataType;		/* Type of an element entry, attrib, array or map key. */
+	RsslContainerType			containerType;	/* Type of the entries of a map, vector or series. */
+	RsslBool					initialized;	/* Map, vector or series is initialized; entry data is started. */
+	void						*pTarget;		/* Structure being filled by a header object. */
+	const RsslDictionaryEntry	*pDictionaryEntry;
+	union {
+		RsslFieldEntry		fieldEntry;
+		RsslElementEntry	elementEntry;
+		RsslArray			array;
+		RsslMap				map;
+		RsslMapEntry		mapEntry;
+		RsslVector			vector;
+		RsslVectorEntry		vectorEntry;
+		RsslSeries			series;
+		RsslSeriesEntry		seriesEntry;
+	} u;
+	union {
+		RsslFieldList		fieldList;		/* The encoder refers to these until the list is complete. */
+		RsslElementList		elementList;
+	} list;
+	JsonPrimitive				value;			/* Map entry key, or value of a State or Qos object. */
+} JsonFrame;
+
+struct RsslJsonConverterImpl
+{
+	RsslJsonConverterImpl(RsslDataDictionary *pDictionary, RsslUInt32 bufferSize);
+	~RsslJsonConverterImpl();
+
+	RsslRet msgToJson(RsslDecodeIterator *pIter, RsslMsg *pMsg, RsslBuffer *pJsonBuffer);
+	RsslRet jsonToMsg(const RsslBuffer *pJsonBuffer, RsslEncodeIterator *pIter);
+
+	/* rapidjson Reader events. */
+	RsslRet onScalar(const JsonToken &token);
+	RsslRet onKey(const char *str, rapidjson::SizeType length);
+	RsslRet onStartObject();
+	RsslRet onEndObject();
+	RsslRet onStartArray();
+	RsslRet onEndArray();
+
+	RsslRet setError(RsslRet ret, const char *format, ...);
+
+	RsslJsonConverterError	error;
+
+private:
+	/* RWF to JSON */
+	RsslRet writeMsgKey(RsslDecodeIterator *pIter, const RsslMsgKey *pKey);
+	RsslRet writeData(RsslDecodeIterator *pIter, RsslDataType dataType, const RsslBuffer *pEncData);
+	RsslRet writeContainer(RsslDecodeIterator *pIter, RsslDataType dataType,
+			RsslLocalFieldSetDefDb *pFieldSetDb, const RsslLocalElementSetDefDb *pElementSetDb);
+	RsslRet writeFieldList(RsslDecodeIterator *pIter, RsslLocalFieldSetDefDb *pSetDb);
+	RsslRet writeElementList(RsslDecodeIterator *pIter, const RsslLocalElementSetDefDb *pSetDb);
+	RsslRet writeMap(RsslDecodeIterator *pIter);
+	RsslRet writeVector(RsslDecodeIterator *pIter);
+	RsslRet writeSeries(RsslDecodeIterator *pIter);
+	RsslRet writeArray(RsslDecodeIterator *pIter);
+	RsslRet decodeSetDefs(RsslDecodeIterator *pIter, RsslContainerType containerType,
+			RsslLocalFieldSetDefDb *pFieldSetDb, RsslLocalElementSetDefDb *pElementSetDb);
+	RsslRet writePrimitive(RsslDataType dataType, const JsonPrimitive *pValue);
+	void writeName(const JsonNameTable &table, RsslUInt8 value);
+	void writeKey(const RsslBuffer &name) { _writer.Key(name.data, name.length); }
+	void writeState(const RsslState *pState);
+	void writeQos(const RsslQos *pQos);
+	void writeBase64(const RsslBuffer *pBuffer);
+	char *getScratch(size_t size);
+
+	/* JSON to RWF */
+	RsslRet readMsgMember(JsonFrame *pFrame, const JsonToken &token);
+	RsslRet readMsgKeyMember(JsonFrame *pFrame, const JsonToken &token);
+	RsslRet readHeaderObjectMember(JsonFrame *pFrame, const JsonToken &token);
+	RsslRet readContainerMember(JsonFrame *pFrame, const JsonToken &token);
+	RsslRet readEntryMember(JsonFrame *pFrame, const JsonToken &token);
+	RsslRet readValue(JsonFrame *pFrame, RsslDataType dataType, const JsonToken &token);
+	RsslRet parsePrimitive(RsslDataType dataType, const JsonToken &token, JsonPrimitive *pValue, RsslBool *pIsBlank);
+	RsslRet parseName(const JsonNameTable &table, const JsonToken &token, RsslUInt8 *pValue);
+	RsslRet parseUInt(const JsonToken &token, RsslUInt64 max, RsslUInt64 *pValue);
+	RsslRet parseBool(const JsonToken &token, RsslBool *pValue);
+	RsslRet encodeValue(JsonFrame *pFrame, const void *pData);
+	RsslRet startMsgPayload(RsslContainerType containerType);
+	RsslRet startValue(JsonFrame *pFrame, RsslDataType dataType);
+	RsslRet startContainer(RsslContainerType containerType);
+	RsslRet initContainer(JsonFrame *pFrame);
+	RsslRet completeChild(JsonFrame *pParent);
+	JsonFrame *pushFrame(JsonFrameType type);
+	char *arenaAlloc(size_t size);
+
+	RsslDataDictionary							*_pDictionary;
+	rapidjson::StringBuffer						_jsonBuffer;
+	rapidjson::Writer<rapidjson::StringBuffer>	_writer;
+	rapidjson::Reader							_reader;
+	RsslInt32									_majorVersion;
+	RsslInt32									_minorVersion;
+
+	char		*_pScratch;		/* RWF to JSON: text conversions */
+	size_t		_scratchSize;
+	char		*_pArena;		/* JSON to RWF: the text being parsed in place, and anything it refers to */
+	size_t		_arenaSize;
+	size_t		_arenaUsed;
+
+	JsonNameTable	_msgClasses;
+	JsonNameTable	_domains;
+	JsonNameTable	_dataTypes;
+	JsonNameTable	_streamStates;
+	JsonNameTable	_dataStates;
+	JsonNameTable	_stateCodes;
+	JsonNameTable	_timeliness;
+	JsonNameTable	_rates;
+	JsonNameTable	_mapActions;
+	JsonNameTable	_vectorActions;
+
+	/* JSON to RWF state. */
+	RsslEncodeIterator	*_pMsgIter;
+	RsslEncodeIterator	*_pEncIter;		/* _pMsgIter, or _attribIter while encoding key attributes */
+	RsslEncodeIterator	_attribIter;
+	RsslBuffer			_attribBuffer;
+	RsslMsg				_msg;
+	RsslBool			_msgClassSet;
+	RsslBool			_payloadStarted;
+	RsslBool			_msgDone;
+	JsonFrame			_frames[JSON_MAX_DEPTH];
+	RsslInt32			_depth;
+};
+
+RsslJsonConverterImpl::RsslJsonConverterImpl(RsslDataDictionary *pDictionary, RsslUInt32 bufferSize) :
+	_pDictionary(pDictionary),
+	_jsonBuffer(0, bufferSize),
+	_writer(),
+	_reader(),
+	_majorVersion(RSSL_RWF_MAJOR_VERSION),
+	_minorVersion(RSSL_RWF_MINOR_VERSION),
+	_pScratch(NULL),
+	_scratchSize(0),
+	_pArena(NULL),
+	_arenaSize(0),
+	_arenaUsed(0),
+	_pMsgIter(NULL),
+	_pEncIter(NULL),
+	_msgClassSet(RSSL_FALSE),
+	_payloadStarted(RSSL_FALSE),
+	_msgDone(RSSL_FALSE),
+	_depth(0)
+{
+	rsslJsonConverterErrorClear(&error);
+	rsslClearBuffer(&_attribBuffer);
+
+	_msgClasses.init(rsslMsgClassToOmmString);
+	_domains.init(rsslDomainTypeToOmmString);
+	_dataTypes.init(jsonDataTypeName);
+	_streamStates.init(rsslStreamStateToOmmString);
+	_dataStates.init(rsslDataStateToOmmString);
+	_stateCodes.init(rsslStateCodeToOmmString);
+	_timeliness.init(jsonTimelinessName);
+	_rates.init(jsonRateName);
+	_mapActions.init(rsslMapEntryActionToOmmString);
+	_vectorActions.init(rsslVectorEntryActionToOmmString);
+}
+
+RsslJsonConverterImpl::~RsslJsonConverterImpl()
+{
+	free(_pScratch);
+	free(_pArena);
+}
+
+RsslRet RsslJsonConverterImpl::setError(RsslRet ret, const char *format, ...)
+{
+	va_list args;
+
+	/* Keep the first error; failures after it are only a result of it. */
+	if (error.rsslErrorId < 0)
+		return error.rsslErrorId;
+
+	error.rsslErrorId = ret;
+	va_start(args, format);
+	vsnprintf(error.text, sizeof(error.text), format, args);
+	va_end(args);
+	return ret;
+}
+
+char *RsslJsonConverterImpl::getScratch(size_t size)
+{
+	if (size > _scratchSize)
+	{
+		char *pScratch = (char*)realloc(_pScratch, size);
+
+		if (pScratch == NULL)
+			return NULL;
+		_pScratch = pScratch;
+		_scratchSize = size;
+	}
+	return _pScratch;
+}
+
+/*** RWF to JSON ***/
+
+RsslRet RsslJsonConverterImpl::msgToJson(RsslDecodeIterator *pIter, RsslMsg *pMsg, RsslBuffer *pJsonBuffer)
+{
+	RsslUInt16 *pFlags = jsonMsgFlags(pMsg);
+	const RsslMsgKey *pKey;
+	const char *name;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	if (pFlags == NULL)
+		return setError(RSSL_RET_INVALID_DATA, "Unknown message class %u.", pMsg->msgBase.msgClass);
+
+	_majorVersion = pIter->_majorVersion;
+	_minorVersion = pIter->_minorVersion;
+
+	_jsonBuffer.Clear();
+	_writer.Reset(_jsonBuffer);
+
+	_writer.StartObject();
+
+	writeKey(JSON_TYPE);
+	_writer.String(_msgClasses.name(pMsg->msgBase.msgClass));
+	writeKey(JSON_ID);
+	_writer.Int(pMsg->msgBase.streamId);
+	writeKey(JSON_DOMAIN);
+	writeName(_domains, pMsg->msgBase.domainType);
+
+	for (i = 0; i < JSON_HEADER_MEMBER_COUNT; ++i)
+	{
+		const JsonHeaderMember *pMember = &jsonHeaderMembers[i];
+		const char *pField = (const char*)pMsg + pMember->offset;
+
+		if (pMember->msgClass != pMsg->msgBase.msgClass || (pMember->flag && !(*pFlags & pMember->flag)))
+			continue;
+
+		writeKey(pMember->name);
+		switch (pMember->kind)
+		{
+			case JSON_HDR_FLAG:		_writer.Bool(true); break;
+			case JSON_HDR_UINT8:	_writer.Uint(*(const RsslUInt8*)pField); break;
+			case JSON_HDR_UINT16:	_writer.Uint(*(const RsslUInt16*)pField); break;
+			case JSON_HDR_UINT32:	_writer.Uint(*(const RsslUInt32*)pField); break;
+			case JSON_HDR_STATE:	writeState((const RsslState*)pField); break;
+			case JSON_HDR_QOS:		writeQos((const RsslQos*)pField); break;
+			case JSON_HDR_TEXT:		_writer.String(((const RsslBuffer*)pField)->data, ((const RsslBuffer*)pField)->length); break;
+			case JSON_HDR_PRIORITY:
+				_writer.StartObject();
+				writeKey(JSON_CLASS);
+				_writer.Uint(pMsg->requestMsg.priorityClass);
+				writeKey(JSON_COUNT);
+				_writer.Uint(pMsg->requestMsg.priorityCount);
+				_writer.EndObject();
+				break;
+			case JSON_HDR_CONF_INFO:
+				_writer.StartObject();
+				writeKey(JSON_COUNT);
+				_writer.Uint(pMsg->updateMsg.conflationCount);
+				writeKey(JSON_TIME);
+				_writer.Uint(pMsg->updateMsg.conflationTime);
+				_writer.EndObject();
+				break;
+			case JSON_HDR_POST_USER_INFO:
+				_writer.StartObject();
+				writeKey(JSON_ADDRESS);
+				_writer.Uint(((const RsslPostUserInfo*)pField)->postUserAddr);
+				writeKey(JSON_USER_ID);
+				_writer.Uint(((const RsslPostUserInfo*)pField)->postUserId);
+				_writer.EndObject();
+				break;
+		}
+	}
+
+	if ((pKey = rsslGetMsgKey(pMsg)) != NULL)
+	{
+		writeKey(JSON_KEY);
+		if ((ret = writeMsgKey(pIter, pKey)) < 0)
+			return ret;
+	}
+
+	if (pMsg->msgBase.containerType != RSSL_DT_NO_DATA)
+	{
+		if ((name = _dataTypes.name(pMsg->msgBase.containerType)) == NULL)
+			return setError(RSSL_RET_UNSUPPORTED_DATA_TYPE, "Unknown payload type %u.", pMsg->msgBase.containerType);
+
+		_writer.Key(name);
+		if ((ret = writeData(pIter, pMsg->msgBase.containerType, &pMsg->msgBase.encDataBody)) < 0)
+			return ret;
+	}
+
+	_writer.EndObject();
+
+	pJsonBuffer->data = (char*)_jsonBuffer.GetString();
+	pJsonBuffer->length = (RsslUInt32)_jsonBuffer.GetSize();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeMsgKey(RsslDecodeIterator *pIter, const RsslMsgKey *pKey)
+{
+	RsslDecodeIterator attribIter;
+	RsslRet ret;
+
+	_writer.StartObject();
+
+	if (pKey->flags & RSSL_MKF_HAS_SERVICE_ID)
+	{
+		writeKey(JSON_SERVICE);
+		_writer.Uint(pKey->serviceId);
+	}
+	if (pKey->flags & RSSL_MKF_HAS_NAME)
+	{
+		writeKey(JSON_NAME_MEMBER);
+		_writer.String(pKey->name.data, pKey->name.length);
+	}
+	if (pKey->flags & RSSL_MKF_HAS_NAME_TYPE)
+	{
+		writeKey(JSON_NAME_TYPE);
+		_writer.Uint(pKey->nameType);
+	}
+	if (pKey->flags & RSSL_MKF_HAS_FILTER)
+	{
+		writeKey(JSON_FILTER);
+		_writer.Uint(pKey->filter);
+	}
+	if (pKey->flags & RSSL_MKF_HAS_IDENTIFIER)
+	{
+		writeKey(JSON_IDENTIFIER);
+		_writer.Int(pKey->identifier);
+	}
+	if (pKey->flags & RSSL_MKF_HAS_ATTRIB)
+	{
+		/* Attributes are decoded with their own iterator so the message's iterator stays at the payload. */
+		rsslClearDecodeIterator(&attribIter);
+		rsslSetDecodeIteratorRWFVersion(&attribIter, (RsslUInt8)pIter->_majorVersion, (RsslUInt8)pIter->_minorVersion);
+		rsslSetDecodeIteratorBuffer(&attribIter, (RsslBuffer*)&pKey->encAttrib);
+
+		writeKey(JSON_ATTRIB);
+		_writer.StartObject();
+		writeKey(JSON_TYPE);
+		writeName(_dataTypes, pKey->attribContainerType);
+		writeKey(JSON_DATA);
+		if ((ret = writeData(&attribIter, pKey->attribContainerType, &pKey->encAttrib)) < 0)
+			return ret;
+		_writer.EndObject();
+	}
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeData(RsslDecodeIterator *pIter, RsslDataType dataType, const RsslBuffer *pEncData)
+{
+	JsonPrimitive value;
+	RsslRet ret;
+
+	if (jsonIsPreEncodedType(dataType))
+	{
+		/* Opaque payloads are carried as base64; XML is already text. */
+		if (dataType == RSSL_DT_XML)
+			_writer.String(pEncData->data, pEncData->length);
+		else
+			writeBase64(pEncData);
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (dataType == RSSL_DT_ARRAY)
+		return writeArray(pIter);
+
+	if (dataType >= RSSL_DT_CONTAINER_TYPE_MIN)
+		return writeContainer(pIter, dataType, NULL, NULL);
+
+	if ((ret = rsslDecodePrimitiveType(pIter, dataType, &value)) == RSSL_RET_BLANK_DATA)
+	{
+		_writer.Null();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode %s value.", rsslDataTypeToOmmString(dataType));
+
+	return writePrimitive(dataType, &value);
+}
+
+RsslRet RsslJsonConverterImpl::writeContainer(RsslDecodeIterator *pIter, RsslDataType dataType,
+		RsslLocalFieldSetDefDb *pFieldSetDb, const RsslLocalElementSetDefDb *pElementSetDb)
+{
+	switch (dataType)
+	{
+		case RSSL_DT_FIELD_LIST:	return writeFieldList(pIter, pFieldSetDb);
+		case RSSL_DT_ELEMENT_LIST:	return writeElementList(pIter, pElementSetDb);
+		case RSSL_DT_MAP:			return writeMap(pIter);
+		case RSSL_DT_VECTOR:		return writeVector(pIter);
+		case RSSL_DT_SERIES:		return writeSeries(pIter);
+		default:
+			return setError(RSSL_RET_UNSUPPORTED_DATA_TYPE, "Cannot convert container type %u.", dataType);
+	}
+}
+
+RsslRet RsslJsonConverterImpl::writeFieldList(RsslDecodeIterator *pIter, RsslLocalFieldSetDefDb *pSetDb)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	const RsslDictionaryEntry *pDictionaryEntry;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeFieldList(pIter, &fieldList, pSetDb)) == RSSL_RET_NO_DATA)
+	{
+		_writer.StartObject();
+		_writer.EndObject();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode field list.");
+
+	_writer.StartObject();
+
+	while ((ret = rsslDecodeFieldEntry(pIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < 0)
+			return setError(ret, "Failed to decode field list entry.");
+
+		/* Fields not in the dictionary cannot be named or typed. */
+		if (fieldEntry.fieldId < _pDictionary->minFid || fieldEntry.fieldId > _pDictionary->maxFid
+				|| (pDictionaryEntry = _pDictionary->entriesArray[fieldEntry.fieldId]) == NULL)
+			continue;
+
+		writeKey(pDictionaryEntry->acronym);
+		if ((ret = writeData(pIter, pDictionaryEntry->rwfType, &fieldEntry.encData)) < 0)
+			return ret;
+	}
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeElementList(RsslDecodeIterator *pIter, const RsslLocalElementSetDefDb *pSetDb)
+{
+	RsslElementList elementList;
+	RsslElementEntry elementEntry;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeElementList(pIter, &elementList, pSetDb)) == RSSL_RET_NO_DATA)
+	{
+		_writer.StartObject();
+		_writer.EndObject();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode element list.");
+
+	_writer.StartObject();
+
+	while ((ret = rsslDecodeElementEntry(pIter, &elementEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < 0)
+			return setError(ret, "Failed to decode element list entry.");
+
+		writeKey(elementEntry.name);
+		_writer.StartObject();
+		writeKey(JSON_TYPE);
+		writeName(_dataTypes, elementEntry.dataType);
+		if (elementEntry.dataType != RSSL_DT_NO_DATA)
+		{
+			writeKey(JSON_DATA);
+			if ((ret = writeData(pIter, elementEntry.dataType, &elementEntry.encData)) < 0)
+				return ret;
+		}
+		_writer.EndObject();
+	}
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::decodeSetDefs(RsslDecodeIterator *pIter, RsslContainerType containerType,
+		RsslLocalFieldSetDefDb *pFieldSetDb, RsslLocalElementSetDefDb *pElementSetDb)
+{
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	if (containerType == RSSL_DT_FIELD_LIST)
+	{
+		rsslClearLocalFieldSetDefDb(pFieldSetDb);
+		ret = rsslDecodeLocalFieldSetDefDb(pIter, pFieldSetDb);
+	}
+	else if (containerType == RSSL_DT_ELEMENT_LIST)
+	{
+		rsslClearLocalElementSetDefDb(pElementSetDb);
+		ret = rsslDecodeLocalElementSetDefDb(pIter, pElementSetDb);
+	}
+
+	return (ret < 0) ? setError(ret, "Failed to decode set definitions.") : RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeMap(RsslDecodeIterator *pIter)
+{
+	RsslMap map;
+	RsslMapEntry mapEntry;
+	JsonPrimitive key;
+	RsslLocalFieldSetDefDb fieldSetDb;
+	RsslLocalElementSetDefDb elementSetDb;
+	RsslLocalFieldSetDefDb *pFieldSetDb = NULL;
+	const RsslLocalElementSetDefDb *pElementSetDb = NULL;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeMap(pIter, &map)) == RSSL_RET_NO_DATA)
+	{
+		_writer.StartObject();
+		_writer.EndObject();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode map.");
+
+	if (map.flags & RSSL_MPF_HAS_SET_DEFS)
+	{
+		if ((ret = decodeSetDefs(pIter, map.containerType, &fieldSetDb, &elementSetDb)) < 0)
+			return ret;
+		pFieldSetDb = &fieldSetDb;
+		pElementSetDb = &elementSetDb;
+	}
+
+	_writer.StartObject();
+	writeKey(JSON_KEY_TYPE);
+	writeName(_dataTypes, map.keyPrimitiveType);
+	writeKey(JSON_CONTAINER_TYPE);
+	writeName(_dataTypes, map.containerType);
+	if (map.flags & RSSL_MPF_HAS_KEY_FIELD_ID)
+	{
+		writeKey(JSON_KEY_FIELD_ID);
+		_writer.Int(map.keyFieldId);
+	}
+	if (map.flags & RSSL_MPF_HAS_TOTAL_COUNT_HINT)
+	{
+		writeKey(JSON_COUNT_HINT);
+		_writer.Uint(map.totalCountHint);
+	}
+	if (map.flags & RSSL_MPF_HAS_SUMMARY_DATA)
+	{
+		writeKey(JSON_SUMMARY);
+		if ((ret = writeContainer(pIter, map.containerType, pFieldSetDb, pElementSetDb)) < 0)
+			return ret;
+	}
+
+	writeKey(JSON_ENTRIES);
+	_writer.StartArray();
+	while ((ret = rsslDecodeMapEntry(pIter, &mapEntry, &key)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < 0)
+			return setError(ret, "Failed to decode map entry.");
+
+		_writer.StartObject();
+		writeKey(JSON_ACTION);
+		writeName(_mapActions, mapEntry.action);
+		writeKey(JSON_KEY);
+		if ((ret = writePrimitive(map.keyPrimitiveType, &key)) < 0)
+			return ret;
+		if (mapEntry.action != RSSL_MPEA_DELETE_ENTRY && map.containerType != RSSL_DT_NO_DATA)
+		{
+			writeKey(JSON_DATA);
+			if ((ret = writeContainer(pIter, map.containerType, pFieldSetDb, pElementSetDb)) < 0)
+				return ret;
+		}
+		_writer.EndObject();
+	}
+	_writer.EndArray();
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeVector(RsslDecodeIterator *pIter)
+{
+	RsslVector vector;
+	RsslVectorEntry vectorEntry;
+	RsslLocalFieldSetDefDb fieldSetDb;
+	RsslLocalElementSetDefDb elementSetDb;
+	RsslLocalFieldSetDefDb *pFieldSetDb = NULL;
+	const RsslLocalElementSetDefDb *pElementSetDb = NULL;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeVector(pIter, &vector)) == RSSL_RET_NO_DATA)
+	{
+		_writer.StartObject();
+		_writer.EndObject();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode vector.");
+
+	if (vector.flags & RSSL_VTF_HAS_SET_DEFS)
+	{
+		if ((ret = decodeSetDefs(pIter, vector.containerType, &fieldSetDb, &elementSetDb)) < 0)
+			return ret;
+		pFieldSetDb = &fieldSetDb;
+		pElementSetDb = &elementSetDb;
+	}
+
+	_writer.StartObject();
+	writeKey(JSON_CONTAINER_TYPE);
+	writeName(_dataTypes, vector.containerType);
+	if (vector.flags & RSSL_VTF_HAS_TOTAL_COUNT_HINT)
+	{
+		writeKey(JSON_COUNT_HINT);
+		_writer.Uint(vector.totalCountHint);
+	}
+	if (vector.flags & RSSL_VTF_SUPPORTS_SORTING)
+	{
+		writeKey(JSON_SUPPORTS_SORTING);
+		_writer.Bool(true);
+	}
+	if (vector.flags & RSSL_VTF_HAS_SUMMARY_DATA)
+	{
+		writeKey(JSON_SUMMARY);
+		if ((ret = writeContainer(pIter, vector.containerType, pFieldSetDb, pElementSetDb)) < 0)
+			return ret;
+	}
+
+	writeKey(JSON_ENTRIES);
+	_writer.StartArray();
+	while ((ret = rsslDecodeVectorEntry(pIter, &vectorEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < 0)
+			return setError(ret, "Failed to decode vector entry.");
+
+		_writer.StartObject();
+		writeKey(JSON_INDEX);
+		_writer.Uint(vectorEntry.index);
+		writeKey(JSON_ACTION);
+		writeName(_vectorActions, vectorEntry.action);
+		if (vectorEntry.action != RSSL_VTEA_CLEAR_ENTRY && vectorEntry.action != RSSL_VTEA_DELETE_ENTRY
+				&& vector.containerType != RSSL_DT_NO_DATA)
+		{
+			writeKey(JSON_DATA);
+			if ((ret = writeContainer(pIter, vector.containerType, pFieldSetDb, pElementSetDb)) < 0)
+				return ret;
+		}
+		_writer.EndObject();
+	}
+	_writer.EndArray();
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeSeries(RsslDecodeIterator *pIter)
+{
+	RsslSeries series;
+	RsslSeriesEntry seriesEntry;
+	RsslLocalFieldSetDefDb fieldSetDb;
+	RsslLocalElementSetDefDb elementSetDb;
+	RsslLocalFieldSetDefDb *pFieldSetDb = NULL;
+	const RsslLocalElementSetDefDb *pElementSetDb = NULL;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeSeries(pIter, &series)) == RSSL_RET_NO_DATA)
+	{
+		_writer.StartObject();
+		_writer.EndObject();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode series.");
+
+	if (series.flags & RSSL_SRF_HAS_SET_DEFS)
+	{
+		if ((ret = decodeSetDefs(pIter, series.containerType, &fieldSetDb, &elementSetDb)) < 0)
+			return ret;
+		pFieldSetDb = &fieldSetDb;
+		pElementSetDb = &elementSetDb;
+	}
+
+	_writer.StartObject();
+	writeKey(JSON_CONTAINER_TYPE);
+	writeName(_dataTypes, series.containerType);
+	if (series.flags & RSSL_SRF_HAS_TOTAL_COUNT_HINT)
+	{
+		writeKey(JSON_COUNT_HINT);
+		_writer.Uint(series.totalCountHint);
+	}
+	if (series.flags & RSSL_SRF_HAS_SUMMARY_DATA)
+	{
+		writeKey(JSON_SUMMARY);
+		if ((ret = writeContainer(pIter, series.containerType, pFieldSetDb, pElementSetDb)) < 0)
+			return ret;
+	}
+
+	writeKey(JSON_ENTRIES);
+	_writer.StartArray();
+	while ((ret = rsslDecodeSeriesEntry(pIter, &seriesEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < 0)
+			return setError(ret, "Failed to decode series entry.");
+
+		_writer.StartObject();
+		if (series.containerType != RSSL_DT_NO_DATA)
+		{
+			writeKey(JSON_DATA);
+			if ((ret = writeContainer(pIter, series.containerType, pFieldSetDb, pElementSetDb)) < 0)
+				return ret;
+		}
+		_writer.EndObject();
+	}
+	_writer.EndArray();
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::writeArray(RsslDecodeIterator *pIter)
+{
+	RsslArray array;
+	RsslBuffer encEntry;
+	JsonPrimitive value;
+	RsslRet ret;
+
+	if ((ret = rsslDecodeArray(pIter, &array)) == RSSL_RET_BLANK_DATA)
+	{
+		_writer.Null();
+		return RSSL_RET_SUCCESS;
+	}
+	else if (ret < 0)
+		return setError(ret, "Failed to decode array.");
+
+	_writer.StartObject();
+	writeKey(JSON_TYPE);
+	writeName(_dataTypes, array.primitiveType);
+	if (array.itemLength)
+	{
+		writeKey(JSON_LENGTH);
+		_writer.Uint(array.itemLength);
+	}
+
+	writeKey(JSON_DATA);
+	_writer.StartArray();
+	while ((ret = rsslDecodeArrayEntry(pIter, &encEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < 0)
+			return setError(ret, "Failed to decode array entry.");
+
+		if ((ret = rsslDecodePrimitiveType(pIter, array.primitiveType, &value)) == RSSL_RET_BLANK_DATA)
+			_writer.Null();
+		else if (ret < 0)
+			return setError(ret, "Failed to decode %s array entry.", rsslDataTypeToOmmString(array.primitiveType));
+		else if ((ret = writePrimitive(array.primitiveType, &value)) < 0)
+			return ret;
+	}
+	_writer.EndArray();
+
+	_writer.EndObject();
+	return RSSL_RET_SUCCESS;
+}
+
+void RsslJsonConverterImpl::writeName(const JsonNameTable &table, RsslUInt8 value)
+{
+	const char *name = table.name(value);
+
+	if (name)
+		_writer.String(name);
+	else
+		_writer.Uint(value);
+}
+
+void RsslJsonConverterImpl::writeState(const RsslState *pState)
+{
+	_writer.StartObject();
+	writeKey(JSON_STREAM);
+	writeName(_streamStates, pState->streamState);
+	writeKey(JSON_DATA);
+	writeName(_dataStates, pState->dataState);
+	writeKey(JSON_CODE);
+	writeName(_stateCodes, pState->code);
+	if (pState->text.length)
+	{
+		writeKey(JSON_TEXT);
+		_writer.String(pState->text.data, pState->text.length);
+	}
+	_writer.EndObject();
+}
+
+void RsslJsonConverterImpl::writeQos(const RsslQos *pQos)
+{
+	_writer.StartObject();
+	writeKey(JSON_TIMELINESS);
+	writeName(_timeliness, pQos->timeliness);
+	writeKey(JSON_RATE);
+	writeName(_rates, pQos->rate);
+	if (pQos->dynamic)
+	{
+		writeKey(JSON_DYNAMIC);
+		_writer.Bool(true);
+	}
+	if (pQos->timeliness == RSSL_QOS_TIME_DELAYED)
+	{
+		writeKey(JSON_TIME_INFO);
+		_writer.Uint(pQos->timeInfo);
+	}
+	if (pQos->rate == RSSL_QOS_RATE_TIME_CONFLATED)
+	{
+		writeKey(JSON_RATE_INFO);
+		_writer.Uint(pQos->rateInfo);
+	}
+	_writer.EndObject();
+}
+
+void RsslJsonConverterImpl::writeBase64(const RsslBuffer *pBuffer)
+{
+	char *out = getScratch(((size_t)pBuffer->length + 2) / 3 * 4 + 1);
+
+	if (out == NULL)
+		_writer.Null();
+	else
+		_writer.String(out, jsonBase64Encode(out, (const unsigned char*)pBuffer->data, pBuffer->length));
+}
+
+RsslRet RsslJsonConverterImpl::writePrimitive(RsslDataType dataType, const JsonPrimitive *pValue)
+{
+	char text[64];
+	RsslBuffer textBuffer;
+	RsslDateTime dateTime;
+	RsslRet ret;
+
+	switch (dataType)
+	{
+		case RSSL_DT_INT:
+			_writer.Int64(pValue->intValue);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_UINT:
+			_writer.Uint64(pValue->uintValue);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_ENUM:
+			_writer.Uint(pValue->enumValue);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_FLOAT:
+		case RSSL_DT_DOUBLE:
+		{
+			RsslDouble value = (dataType == RSSL_DT_FLOAT) ? (RsslDouble)pValue->floatValue : pValue->doubleValue;
+
+			if (value != value)
+				_writer.String(JSON_NAN.data, JSON_NAN.length);
+			else if (value > 1.7976931348623157e308)
+				_writer.String(JSON_INF.data, JSON_INF.length);
+			else if (value < -1.7976931348623157e308)
+				_writer.String(JSON_NEG_INF.data, JSON_NEG_INF.length);
+			else
+				_writer.Double(value);
+			return RSSL_RET_SUCCESS;
+		}
+
+		case RSSL_DT_REAL:
+			switch (pValue->realValue.hint)
+			{
+				case RSSL_RH_NOT_A_NUMBER:	_writer.String(JSON_NAN.data, JSON_NAN.length); break;
+				case RSSL_RH_INFINITY:		_writer.String(JSON_INF.data, JSON_INF.length); break;
+				case RSSL_RH_NEG_INFINITY:	_writer.String(JSON_NEG_INF.data, JSON_NEG_INF.length); break;
+				default:
+					_writer.RawValue(text, jsonRealToNumber(text, &pValue->realValue), rapidjson::kNumberType);
+					break;
+			}
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_DATE:
+		case RSSL_DT_TIME:
+		case RSSL_DT_DATETIME:
+			rsslClearDateTime(&dateTime);
+			if (dataType == RSSL_DT_DATE)
+				dateTime.date = pValue->dateValue;
+			else if (dataType == RSSL_DT_TIME)
+				dateTime.time = pValue->timeValue;
+			else
+				dateTime = pValue->dateTimeValue;
+
+			textBuffer.data = text;
+			textBuffer.length = sizeof(text);
+			if ((ret = rsslDateTimeToStringFormat(&textBuffer, dataType, &dateTime, RSSL_STR_DATETIME_ISO8601)) < 0)
+				return setError(ret, "Failed to convert %s value.", rsslDataTypeToOmmString(dataType));
+			_writer.String(textBuffer.data, (rapidjson::SizeType)strlen(textBuffer.data));
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_QOS:
+			writeQos(&pValue->qosValue);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_STATE:
+			writeState(&pValue->stateValue);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_BUFFER:
+			writeBase64(&pValue->bufferValue);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+			_writer.String(pValue->bufferValue.data, pValue->bufferValue.length);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_RMTES_STRING:
+		{
+			const RsslBuffer *pRmtes = &pValue->bufferValue;
+			RsslRmtesCacheBuffer cacheBuffer;
+			RsslBuffer utf8Buffer;
+			RsslUInt32 i;
+
+			for (i = 0; i < pRmtes->length; ++i)
+			{
+				if ((unsigned char)pRmtes->data[i] < 0x20 || (unsigned char)pRmtes->data[i] >= 0x7F)
+					break;
+			}
+
+			/* Plain ASCII is the same in UTF-8.  A partial update only means something when applied
+			 * to a cached string, so it is passed on as is. */
+			if (i == pRmtes->length || rsslHasPartialRMTESUpdate((RsslBuffer*)pRmtes))
+			{
+				_writer.String(pRmtes->data, pRmtes->length);
+				return RSSL_RET_SUCCESS;
+			}
+
+			cacheBuffer.data = pRmtes->data;
+			cacheBuffer.length = pRmtes->length;
+			cacheBuffer.allocatedLength = pRmtes->length;
+
+			/* A character takes at most three bytes of UTF-8. */
+			utf8Buffer.length = pRmtes->length * 3 + 16;
+			if ((utf8Buffer.data = getScratch(utf8Buffer.length)) == NULL)
+				return setError(RSSL_RET_FAILURE, "Failed to allocate memory.");
+
+			if ((ret = rsslRMTESToUTF8(&cacheBuffer, &utf8Buffer)) < 0)
+				return setError(ret, "Failed to convert RMTES string.");
+			_writer.String(utf8Buffer.data, utf8Buffer.length);
+			return RSSL_RET_SUCCESS;
+		}
+
+		default:
+			return setError(RSSL_RET_UNSUPPORTED_DATA_TYPE, "Cannot convert primitive type %u.", dataType);
+	}
+}
+
+/*** JSON to RWF ***/
+
+/* Forwards rapidjson Reader events to the converter.  Numbers arrive as text, by kParseNumbersAsStringsFlag. */
+class JsonMsgReader
+{
+public:
+	JsonMsgReader(RsslJsonConverterImpl &converter) : _converter(converter) {}
+
+	bool Null() { JsonToken token = { JSON_TOKEN_NULL, NULL, 0, RSSL_FALSE }; return _converter.onScalar(token) >= 0; }
+	bool Bool(bool b) { JsonToken token = { JSON_TOKEN_BOOL, NULL, 0, (RsslBool)(b ? RSSL_TRUE : RSSL_FALSE) }; return _converter.onScalar(token) >= 0; }
+	bool RawNumber(const char *str, rapidjson::SizeType length, bool) { JsonToken token = { JSON_TOKEN_NUMBER, str, length, RSSL_FALSE }; return _converter.onScalar(token) >= 0; }
+	bool String(const char *str, rapidjson::SizeType length, bool) { JsonToken token = { JSON_TOKEN_STRING, str, length, RSSL_FALSE }; return _converter.onScalar(token) >= 0; }
+	bool Key(const char *str, rapidjson::SizeType length, bool) { return _converter.onKey(str, length) >= 0; }
+	bool StartObject() { return _converter.onStartObject() >= 0; }
+	bool EndObject(rapidjson::SizeType) { return _converter.onEndObject() >= 0; }
+	bool StartArray() { return _converter.onStartArray() >= 0; }
+	bool EndArray(rapidjson::SizeType) { return _converter.onEndArray() >= 0; }
+
+	/* Not called when numbers are parsed as strings. */
+	bool Int(int) { return false; }
+	bool Uint(unsigned) { return false; }
+	bool Int64(int64_t) { return false; }
+	bool Uint64(uint64_t) { return false; }
+	bool Double(double) { return false; }
+
+private:
+	RsslJsonConverterImpl &_converter;
+};
+
+char *RsslJsonConverterImpl::arenaAlloc(size_t size)
+{
+	char *pMem;
+
+	if (_arenaUsed + size > _arenaSize)
+		return NULL;
+
+	pMem = _pArena + _arenaUsed;
+	_arenaUsed += (size + 7) & ~(size_t)7;
+	return pMem;
+}
+
+RsslRet RsslJsonConverterImpl::jsonToMsg(const RsslBuffer *pJsonBuffer, RsslEncodeIterator *pIter)
+{
+	/* The text is parsed in place, and strings are changed in place or in what follows it;
+	 * key attributes are encoded after that. */
+	size_t arenaSize = (size_t)pJsonBuffer->length * 4 + 1024;
+	char *pText;
+	rapidjson::ParseResult result;
+
+	if (arenaSize > _arenaSize)
+	{
+		char *pArena = (char*)realloc(_pArena, arenaSize);
+
+		if (pArena == NULL)
+			return setError(RSSL_RET_FAILURE, "Failed to allocate memory.");
+		_pArena = pArena;
+		_arenaSize = arenaSize;
+	}
+
+	_arenaUsed = 0;
+	pText = arenaAlloc((size_t)pJsonBuffer->length + 1);
+	memcpy(pText, pJsonBuffer->data, pJsonBuffer->length);
+	pText[pJsonBuffer->length] = '\0';
+
+	rsslClearMsg(&_msg);
+	_msgClassSet = RSSL_FALSE;
+	_payloadStarted = RSSL_FALSE;
+	_msgDone = RSSL_FALSE;
+	_depth = 0;
+	_pMsgIter = _pEncIter = pIter;
+
+	{
+		rapidjson::InsituStringStream stream(pText);
+		JsonMsgReader reader(*this);
+
+		result = _reader.Parse<rapidjson::kParseInsituFlag | rapidjson::kParseNumbersAsStringsFlag | rapidjson::kParseStopWhenDoneFlag>(stream, reader);
+	}
+
+	if (error.rsslErrorId < 0)
+		return error.rsslErrorId;
+
+	if (result.IsError())
+		return setError(RSSL_RET_INVALID_DATA, "JSON parse error at offset %u: %s", (unsigned)result.Offset(),
+				rapidjson::GetParseError_En(result.Code()));
+
+	if (!_msgDone)
+		return setError(RSSL_RET_INVALID_DATA, "JSON text is not a message object.");
+
+	return RSSL_RET_SUCCESS;
+}
+
+JsonFrame *RsslJsonConverterImpl::pushFrame(JsonFrameType type)
+{
+	JsonFrame *pFrame;
+
+	if (_depth == JSON_MAX_DEPTH)
+		return NULL;
+
+	pFrame = &_frames[_depth++];
+	pFrame->type = type;
+	pFrame->key = NULL;
+	pFrame->keyLength = 0;
+	pFrame->dataType = RSSL_DT_UNKNOWN;
+	pFrame->containerType = RSSL_DT_NO_DATA;
+	pFrame->initialized = RSSL_FALSE;
+	pFrame->pTarget = NULL;
+	pFrame->pDictionaryEntry = NULL;
+	memset(&pFrame->u, 0, sizeof(pFrame->u));
+	return pFrame;
+}
+
+RsslRet RsslJsonConverterImpl::onKey(const char *str, rapidjson::SizeType length)
+{
+	JsonFrame *pFrame = &_frames[_depth - 1];
+	RsslBuffer name;
+
+	pFrame->key = str;
+	pFrame->keyLength = length;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_MSG:
+			if (_payloadStarted)
+				return setError(RSSL_RET_INVALID_DATA, "Message member \"%s\" follows the payload.", str);
+			if (!_msgClassSet && !jsonNameIs(str, length, JSON_TYPE))
+				return setError(RSSL_RET_INVALID_DATA, "Message member \"%s\" comes before \"Type\".", str);
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_FIELD_LIST:
+			name.data = (char*)str;
+			name.length = length;
+			if ((pFrame->pDictionaryEntry = rsslDictionaryGetEntryByFieldName(_pDictionary, &name)) == NULL)
+				return setError(RSSL_RET_INVALID_DATA, "Field \"%s\" is not in the dictionary.", str);
+
+			rsslClearFieldEntry(&pFrame->u.fieldEntry);
+			pFrame->u.fieldEntry.fieldId = pFrame->pDictionaryEntry->fid;
+			pFrame->u.fieldEntry.dataType = pFrame->pDictionaryEntry->rwfType;
+			return RSSL_RET_SUCCESS;
+
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+}
+
+RsslRet RsslJsonConverterImpl::parseName(const JsonNameTable &table, const JsonToken &token, RsslUInt8 *pValue)
+{
+	RsslUInt64 value;
+
+	if (token.type == JSON_TOKEN_STRING && table.find(token.str, token.length, pValue))
+		return RSSL_RET_SUCCESS;
+
+	if (token.type == JSON_TOKEN_NUMBER && jsonParseUInt64(token.str, token.length, &value) && value <= 255)
+	{
+		*pValue = (RsslUInt8)value;
+		return RSSL_RET_SUCCESS;
+	}
+
+	return RSSL_RET_INVALID_DATA;
+}
+
+RsslRet RsslJsonConverterImpl::parseUInt(const JsonToken &token, RsslUInt64 max, RsslUInt64 *pValue)
+{
+	if (token.type != JSON_TOKEN_NUMBER || !jsonParseUInt64(token.str, token.length, pValue) || *pValue > max)
+		return RSSL_RET_INVALID_DATA;
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::parseBool(const JsonToken &token, RsslBool *pValue)
+{
+	if (token.type != JSON_TOKEN_BOOL)
+		return RSSL_RET_INVALID_DATA;
+	*pValue = token.boolValue;
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::parsePrimitive(RsslDataType dataType, const JsonToken &token, JsonPrimitive *pValue, RsslBool *pIsBlank)
+{
+	RsslBuffer text;
+	char number[64];
+
+	*pIsBlank = RSSL_FALSE;
+	if (token.type == JSON_TOKEN_NULL)
+	{
+		*pIsBlank = RSSL_TRUE;
+		return RSSL_RET_SUCCESS;
+	}
+
+	text.data = (char*)token.str;
+	text.length = token.length;
+
+	switch (dataType)
+	{
+		case RSSL_DT_INT:
+			return (token.type == JSON_TOKEN_NUMBER && jsonParseInt64(token.str, token.length, &pValue->intValue))
+				? RSSL_RET_SUCCESS : RSSL_RET_INVALID_DATA;
+
+		case RSSL_DT_UINT:
+			return parseUInt(token, RTR_ULL(0xFFFFFFFFFFFFFFFF), &pValue->uintValue);
+
+		case RSSL_DT_ENUM:
+		{
+			RsslUInt64 value;
+
+			if (parseUInt(token, 0xFFFF, &value) < 0)
+				return RSSL_RET_INVALID_DATA;
+			pValue->enumValue = (RsslEnum)value;
+			return RSSL_RET_SUCCESS;
+		}
+
+		case RSSL_DT_FLOAT:
+		case RSSL_DT_DOUBLE:
+		{
+			RsslDouble value;
+
+			if (token.type == JSON_TOKEN_STRING)
+			{
+				if (jsonNameIs(token.str, token.length, JSON_NAN))
+					value = strtod("NAN", NULL);
+				else if (jsonNameIs(token.str, token.length, JSON_INF))
+					value = strtod("INF", NULL);
+				else if (jsonNameIs(token.str, token.length, JSON_NEG_INF))
+					value = strtod("-INF", NULL);
+				else
+					return RSSL_RET_INVALID_DATA;
+			}
+			else if (token.type == JSON_TOKEN_NUMBER && token.length < sizeof(number))
+			{
+				memcpy(number, token.str, token.length);
+				number[token.length] = '\0';
+				value = strtod(number, NULL);
+			}
+			else
+				return RSSL_RET_INVALID_DATA;
+
+			if (dataType == RSSL_DT_FLOAT)
+				pValue->floatValue = (RsslFloat)value;
+			else
+				pValue->doubleValue = value;
+			return RSSL_RET_SUCCESS;
+		}
+
+		case RSSL_DT_REAL:
+			if (token.type == JSON_TOKEN_STRING)
+			{
+				rsslClearReal(&pValue->realValue);
+				if (jsonNameIs(token.str, token.length, JSON_NAN))
+					pValue->realValue.hint = RSSL_RH_NOT_A_NUMBER;
+				else if (jsonNameIs(token.str, token.length, JSON_INF))
+					pValue->realValue.hint = RSSL_RH_INFINITY;
+				else if (jsonNameIs(token.str, token.length, JSON_NEG_INF))
+					pValue->realValue.hint = RSSL_RH_NEG_INFINITY;
+				else
+					return RSSL_RET_INVALID_DATA;
+				return RSSL_RET_SUCCESS;
+			}
+			else if (token.type != JSON_TOKEN_NUMBER || rsslNumericStringToReal(&pValue->realValue, &text) < 0)
+				return RSSL_RET_INVALID_DATA;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_DATE:
+			return (token.type == JSON_TOKEN_STRING && rsslDateStringToDate(&pValue->dateValue, &text) >= 0)
+				? RSSL_RET_SUCCESS : RSSL_RET_INVALID_DATA;
+
+		case RSSL_DT_TIME:
+			return (token.type == JSON_TOKEN_STRING && rsslTimeStringToTime(&pValue->timeValue, &text) >= 0)
+				? RSSL_RET_SUCCESS : RSSL_RET_INVALID_DATA;
+
+		case RSSL_DT_DATETIME:
+			return (token.type == JSON_TOKEN_STRING && rsslDateTimeStringToDateTime(&pValue->dateTimeValue, &text) >= 0)
+				? RSSL_RET_SUCCESS : RSSL_RET_INVALID_DATA;
+
+		case RSSL_DT_BUFFER:
+		case RSSL_DT_OPAQUE:
+		case RSSL_DT_ANSI_PAGE:
+			/* Decoded base64 is shorter than its text, so it is decoded in place. */
+			if (token.type != JSON_TOKEN_STRING || !jsonBase64Decode(text.data, text.length, &pValue->bufferValue.length))
+				return RSSL_RET_INVALID_DATA;
+			pValue->bufferValue.data = text.data;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_ASCII_STRING:
+		case RSSL_DT_UTF8_STRING:
+		case RSSL_DT_XML:
+			if (token.type != JSON_TOKEN_STRING)
+				return RSSL_RET_INVALID_DATA;
+			pValue->bufferValue = text;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_RMTES_STRING:
+		{
+			RsslUInt32 i;
+
+			if (token.type != JSON_TOKEN_STRING)
+				return RSSL_RET_INVALID_DATA;
+
+			pValue->bufferValue = text;
+			if (memchr(text.data, 0x1B, text.length) != NULL)
+				return RSSL_RET_SUCCESS;
+
+			for (i = 0; i < text.length; ++i)
+			{
+				if ((unsigned char)text.data[i] >= 0x80)
+					break;
+			}
+
+			/* Text from JSON is UTF-8; anything beyond ASCII is marked as such. */
+			if (i < text.length)
+			{
+				if ((pValue->bufferValue.data = arenaAlloc(text.length + RMTES_UTF8_DESIGNATION.length)) == NULL)
+					return RSSL_RET_BUFFER_TOO_SMALL;
+				memcpy(pValue->bufferValue.data, RMTES_UTF8_DESIGNATION.data, RMTES_UTF8_DESIGNATION.length);
+				memcpy(pValue->bufferValue.data + RMTES_UTF8_DESIGNATION.length, text.data, text.length);
+				pValue->bufferValue.length = text.length + RMTES_UTF8_DESIGNATION.length;
+			}
+			return RSSL_RET_SUCCESS;
+		}
+
+		default:
+			return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+	}
+}
+
+RsslRet RsslJsonConverterImpl::encodeValue(JsonFrame *pFrame, const void *pData)
+{
+	RsslBuffer blank;
+	RsslRet ret;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_FIELD_LIST:
+			ret = rsslEncodeFieldEntry(_pEncIter, &pFrame->u.fieldEntry, pData);
+			break;
+
+		case JSON_FRAME_ELEMENT_ENTRY:
+			pFrame->initialized = RSSL_TRUE;
+			ret = rsslEncodeElementEntry(_pEncIter, &pFrame->u.elementEntry, pData);
+			break;
+
+		case JSON_FRAME_ARRAY_ENTRIES:
+			/* An empty encoded entry is blank. */
+			rsslClearBuffer(&blank);
+			ret = rsslEncodeArrayEntry(_pEncIter, pData ? NULL : &blank, pData);
+			break;
+
+		default:
+			return setError(RSSL_RET_INVALID_DATA, "Unexpected value.");
+	}
+
+	return (ret < 0) ? setError(ret, "Failed to encode value.") : RSSL_RET_SUCCESS;
+}
+
+/* Reads a value of the given type, for a field list entry, element entry or array entry. */
+RsslRet RsslJsonConverterImpl::readValue(JsonFrame *pFrame, RsslDataType dataType, const JsonToken &token)
+{
+	JsonPrimitive value;
+	RsslBool isBlank;
+	RsslRet ret;
+
+	/* Opaque types are set as the entry's pre-encoded data. */
+	if (jsonIsPreEncodedType(dataType) && pFrame->type != JSON_FRAME_ARRAY_ENTRIES)
+	{
+		if ((ret = parsePrimitive(dataType, token, &value, &isBlank)) < 0)
+			return setError(ret, "Invalid %s value.", rsslDataTypeToOmmString(dataType));
+
+		if (isBlank)
+			rsslClearBuffer(&value.bufferValue);
+		if (pFrame->type == JSON_FRAME_FIELD_LIST)
+			pFrame->u.fieldEntry.encData = value.bufferValue;
+		else
+			pFrame->u.elementEntry.encData = value.bufferValue;
+		return encodeValue(pFrame, NULL);
+	}
+
+	if (dataType == RSSL_DT_ENUM && token.type == JSON_TOKEN_STRING && pFrame->type == JSON_FRAME_FIELD_LIST)
+	{
+		/* A field's enumerations may also be given by display string. */
+		RsslBuffer display;
+
+		display.data = (char*)token.str;
+		display.length = token.length;
+		if (rsslDictionaryEntryGetEnumValueByDisplayString(pFrame->pDictionaryEntry, &display, &value.enumValue, NULL) != RSSL_RET_SUCCESS)
+			return setError(RSSL_RET_INVALID_DATA, "Unknown enumeration \"%s\".", token.str);
+		return encodeValue(pFrame, &value);
+	}
+
+	if (dataType >= RSSL_DT_CONTAINER_TYPE_MIN || dataType == RSSL_DT_ARRAY || dataType == RSSL_DT_QOS || dataType == RSSL_DT_STATE)
+	{
+		/* Blank, or an object is expected. */
+		if (token.type == JSON_TOKEN_NULL && dataType < RSSL_DT_CONTAINER_TYPE_MIN)
+			return encodeValue(pFrame, NULL);
+		return setError(RSSL_RET_INVALID_DATA, "Expected an object for %s value.", rsslDataTypeToOmmString(dataType));
+	}
+
+	if ((ret = parsePrimitive(dataType, token, &value, &isBlank)) < 0)
+		return setError(ret, "Invalid %s value.", rsslDataTypeToOmmString(dataType));
+
+	return encodeValue(pFrame, isBlank ? NULL : &value);
+}
+
+RsslRet RsslJsonConverterImpl::readMsgMember(JsonFrame *pFrame, const JsonToken &token)
+{
+	RsslUInt16 *pFlags;
+	RsslUInt64 value;
+	RsslUInt8 name;
+	RsslUInt32 i;
+
+	if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TYPE))
+	{
+		if (_msgClassSet || parseName(_msgClasses, token, &name) < 0)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid message \"Type\".");
+		_msg.msgBase.msgClass = name;
+		_msgClassSet = RSSL_TRUE;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_ID))
+	{
+		RsslInt64 streamId;
+
+		if (token.type != JSON_TOKEN_NUMBER || !jsonParseInt64(token.str, token.length, &streamId)
+				|| streamId < RTR_LL(-2147483648) || streamId > RTR_LL(2147483647))
+			return setError(RSSL_RET_INVALID_DATA, "Invalid \"ID\".");
+		_msg.msgBase.streamId = (RsslInt32)streamId;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DOMAIN))
+	{
+		if (parseName(_domains, token, &name) < 0)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid \"Domain\".");
+		_msg.msgBase.domainType = name;
+		return RSSL_RET_SUCCESS;
+	}
+
+	pFlags = jsonMsgFlags(&_msg);
+	for (i = 0; i < JSON_HEADER_MEMBER_COUNT; ++i)
+	{
+		const JsonHeaderMember *pMember = &jsonHeaderMembers[i];
+		char *pField = (char*)&_msg + pMember->offset;
+		RsslBool flagValue;
+
+		if (pMember->msgClass != _msg.msgBase.msgClass || !jsonNameIs(pFrame->key, pFrame->keyLength, pMember->name))
+			continue;
+
+		switch (pMember->kind)
+		{
+			case JSON_HDR_FLAG:
+				if (parseBool(token, &flagValue) < 0)
+					break;
+				if (flagValue)
+					*pFlags |= pMember->flag;
+				return RSSL_RET_SUCCESS;
+
+			case JSON_HDR_UINT8:
+				if (parseUInt(token, 0xFF, &value) < 0)
+					break;
+				*(RsslUInt8*)pField = (RsslUInt8)value;
+				*pFlags |= pMember->flag;
+				return RSSL_RET_SUCCESS;
+
+			case JSON_HDR_UINT16:
+				if (parseUInt(token, 0xFFFF, &value) < 0)
+					break;
+				*(RsslUInt16*)pField = (RsslUInt16)value;
+				*pFlags |= pMember->flag;
+				return RSSL_RET_SUCCESS;
+
+			case JSON_HDR_UINT32:
+				if (parseUInt(token, 0xFFFFFFFF, &value) < 0)
+					break;
+				*(RsslUInt32*)pField = (RsslUInt32)value;
+				*pFlags |= pMember->flag;
+				return RSSL_RET_SUCCESS;
+
+			case JSON_HDR_TEXT:
+				if (token.type != JSON_TOKEN_STRING)
+					break;
+				((RsslBuffer*)pField)->data = (char*)token.str;
+				((RsslBuffer*)pField)->length = token.length;
+				*pFlags |= pMember->flag;
+				return RSSL_RET_SUCCESS;
+
+			default:
+				break;
+		}
+
+		return setError(RSSL_RET_INVALID_DATA, "Invalid message member \"%s\".", pFrame->key);
+	}
+
+	/* A pre-encoded payload. */
+	if (_dataTypes.find(pFrame->key, pFrame->keyLength, &name) && jsonIsPreEncodedType(name))
+	{
+		JsonPrimitive payload;
+		RsslBool isBlank;
+
+		if (parsePrimitive(name, token, &payload, &isBlank) < 0 || isBlank)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid %s payload.", pFrame->key);
+
+		_msg.msgBase.containerType = name;
+		_msg.msgBase.encDataBody = payload.bufferValue;
+		_payloadStarted = RSSL_TRUE;
+		return RSSL_RET_SUCCESS;
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "Unknown message member \"%s\".", pFrame->key);
+}
+
+RsslRet RsslJsonConverterImpl::readMsgKeyMember(JsonFrame *pFrame, const JsonToken &token)
+{
+	RsslMsgKey *pKey = &_msg.msgBase.msgKey;
+	RsslUInt64 value;
+
+	if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_SERVICE))
+	{
+		if (parseUInt(token, 0xFFFF, &value) < 0)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid key \"Service\".");
+		pKey->serviceId = (RsslUInt16)value;
+		pKey->flags |= RSSL_MKF_HAS_SERVICE_ID;
+	}
+	else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_NAME_MEMBER))
+	{
+		if (token.type != JSON_TOKEN_STRING)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid key \"Name\".");
+		pKey->name.data = (char*)token.str;
+		pKey->name.length = token.length;
+		pKey->flags |= RSSL_MKF_HAS_NAME;
+	}
+	else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_NAME_TYPE))
+	{
+		if (parseUInt(token, 0xFF, &value) < 0)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid key \"NameType\".");
+		pKey->nameType = (RsslUInt8)value;
+		pKey->flags |= RSSL_MKF_HAS_NAME_TYPE;
+	}
+	else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_FILTER))
+	{
+		if (parseUInt(token, 0xFFFFFFFF, &value) < 0)
+			return setError(RSSL_RET_INVALID_DATA, "Invalid key \"Filter\".");
+		pKey->filter = (RsslUInt32)value;
+		pKey->flags |= RSSL_MKF_HAS_FILTER;
+	}
+	else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_IDENTIFIER))
+	{
+		RsslInt64 identifier;
+
+		if (token.type != JSON_TOKEN_NUMBER || !jsonParseInt64(token.str, token.length, &identifier)
+				|| identifier < RTR_LL(-2147483648) || identifier > RTR_LL(2147483647))
+			return setError(RSSL_RET_INVALID_DATA, "Invalid key \"Identifier\".");
+		pKey->identifier = (RsslInt32)identifier;
+		pKey->flags |= RSSL_MKF_HAS_IDENTIFIER;
+	}
+	else
+		return setError(RSSL_RET_INVALID_DATA, "Unknown key member \"%s\".", pFrame->key);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Members of State, Qos, Priority, ConflationInfo and PostUserInfo objects. */
+RsslRet RsslJsonConverterImpl::readHeaderObjectMember(JsonFrame *pFrame, const JsonToken &token)
+{
+	RsslUInt64 value;
+	RsslUInt8 name;
+	RsslBool flag;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_STATE:
+		{
+			RsslState *pState = (RsslState*)pFrame->pTarget;
+
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_STREAM) && parseName(_streamStates, token, &name) >= 0)
+				pState->streamState = name;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) && parseName(_dataStates, token, &name) >= 0)
+				pState->dataState = name;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_CODE) && parseName(_stateCodes, token, &name) >= 0)
+				pState->code = name;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TEXT) && token.type == JSON_TOKEN_STRING)
+			{
+				pState->text.data = (char*)token.str;
+				pState->text.length = token.length;
+			}
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+		}
+
+		case JSON_FRAME_QOS:
+		{
+			RsslQos *pQos = (RsslQos*)pFrame->pTarget;
+
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TIMELINESS) && parseName(_timeliness, token, &name) >= 0)
+				pQos->timeliness = name;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_RATE) && parseName(_rates, token, &name) >= 0)
+				pQos->rate = name;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DYNAMIC) && parseBool(token, &flag) >= 0)
+				pQos->dynamic = flag;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TIME_INFO) && parseUInt(token, 0xFFFF, &value) >= 0)
+				pQos->timeInfo = (RsslUInt16)value;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_RATE_INFO) && parseUInt(token, 0xFFFF, &value) >= 0)
+				pQos->rateInfo = (RsslUInt16)value;
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+		}
+
+		case JSON_FRAME_PRIORITY:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_CLASS) && parseUInt(token, 0xFF, &value) >= 0)
+				_msg.requestMsg.priorityClass = (RsslUInt8)value;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_COUNT) && parseUInt(token, 0xFFFF, &value) >= 0)
+				_msg.requestMsg.priorityCount = (RsslUInt16)value;
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_CONF_INFO:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_COUNT) && parseUInt(token, 0xFFFF, &value) >= 0)
+				_msg.updateMsg.conflationCount = (RsslUInt16)value;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TIME) && parseUInt(token, 0xFFFF, &value) >= 0)
+				_msg.updateMsg.conflationTime = (RsslUInt16)value;
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_POST_USER_INFO:
+		{
+			RsslPostUserInfo *pInfo = (RsslPostUserInfo*)pFrame->pTarget;
+
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_ADDRESS) && parseUInt(token, 0xFFFFFFFF, &value) >= 0)
+				pInfo->postUserAddr = (RsslUInt32)value;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_USER_ID) && parseUInt(token, 0xFFFFFFFF, &value) >= 0)
+				pInfo->postUserId = (RsslUInt32)value;
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+		}
+
+		default:
+			break;
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "Invalid member \"%s\".", pFrame->key ? pFrame->key : "");
+}
+
+/* Members of maps, vectors, series and arrays, before their entries. */
+RsslRet RsslJsonConverterImpl::readContainerMember(JsonFrame *pFrame, const JsonToken &token)
+{
+	RsslUInt64 value;
+	RsslUInt8 dataType;
+	RsslBool flag;
+
+	if (pFrame->initialized)
+		return setError(RSSL_RET_INVALID_DATA, "Member \"%s\" follows the container's summary or entries.", pFrame->key);
+
+	if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_CONTAINER_TYPE) && pFrame->type != JSON_FRAME_ARRAY)
+	{
+		if (parseName(_dataTypes, token, &dataType) < 0
+				|| (dataType < RSSL_DT_CONTAINER_TYPE_MIN && dataType != RSSL_DT_NO_DATA))
+			return setError(RSSL_RET_INVALID_DATA, "Invalid \"ContainerType\".");
+		pFrame->containerType = dataType;
+		return RSSL_RET_SUCCESS;
+	}
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_MAP:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_KEY_TYPE) && parseName(_dataTypes, token, &dataType) >= 0)
+				pFrame->dataType = dataType;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_KEY_FIELD_ID) && token.type == JSON_TOKEN_NUMBER)
+			{
+				RsslInt64 fieldId;
+
+				if (!jsonParseInt64(token.str, token.length, &fieldId) || fieldId < -32768 || fieldId > 32767)
+					break;
+				pFrame->u.map.keyFieldId = (RsslFieldId)fieldId;
+				pFrame->u.map.flags |= RSSL_MPF_HAS_KEY_FIELD_ID;
+			}
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_COUNT_HINT) && parseUInt(token, 0x3FFFFFFF, &value) >= 0)
+			{
+				pFrame->u.map.totalCountHint = (RsslUInt32)value;
+				pFrame->u.map.flags |= RSSL_MPF_HAS_TOTAL_COUNT_HINT;
+			}
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_VECTOR:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_COUNT_HINT) && parseUInt(token, 0x3FFFFFFF, &value) >= 0)
+			{
+				pFrame->u.vector.totalCountHint = (RsslUInt32)value;
+				pFrame->u.vector.flags |= RSSL_VTF_HAS_TOTAL_COUNT_HINT;
+			}
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_SUPPORTS_SORTING) && parseBool(token, &flag) >= 0)
+			{
+				if (flag)
+					pFrame->u.vector.flags |= RSSL_VTF_SUPPORTS_SORTING;
+			}
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_SERIES:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_COUNT_HINT) && parseUInt(token, 0x3FFFFFFF, &value) >= 0)
+			{
+				pFrame->u.series.totalCountHint = (RsslUInt32)value;
+				pFrame->u.series.flags |= RSSL_SRF_HAS_TOTAL_COUNT_HINT;
+			}
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_ARRAY:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TYPE) && parseName(_dataTypes, token, &dataType) >= 0)
+				pFrame->u.array.primitiveType = dataType;
+			else if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_LENGTH) && parseUInt(token, 0xFFFF, &value) >= 0)
+				pFrame->u.array.itemLength = (RsslUInt16)value;
+			else
+				break;
+			return RSSL_RET_SUCCESS;
+
+		default:
+			break;
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "Invalid member \"%s\".", pFrame->key);
+}
+
+/* Members of element, map, vector and series entries, other than their data. */
+RsslRet RsslJsonConverterImpl::readEntryMember(JsonFrame *pFrame, const JsonToken &token)
+{
+	RsslUInt64 value;
+	RsslUInt8 name;
+	RsslBool isBlank;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_ELEMENT_ENTRY:
+		case JSON_FRAME_ATTRIB:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_TYPE) && parseName(_dataTypes, token, &name) >= 0)
+			{
+				pFrame->dataType = name;
+				pFrame->u.elementEntry.dataType = name;
+				return RSSL_RET_SUCCESS;
+			}
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) && pFrame->type == JSON_FRAME_ELEMENT_ENTRY)
+			{
+				if (pFrame->dataType == RSSL_DT_UNKNOWN)
+					return setError(RSSL_RET_INVALID_DATA, "Element entry \"Data\" comes before \"Type\".");
+				return readValue(pFrame, pFrame->dataType, token);
+			}
+			break;
+
+		case JSON_FRAME_MAP_ENTRY:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_ACTION) && parseName(_mapActions, token, &name) >= 0)
+			{
+				pFrame->u.mapEntry.action = name;
+				return RSSL_RET_SUCCESS;
+			}
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_KEY))
+			{
+				/* The map is two frames down, below its entries array. */
+				RsslDataType keyType = pFrame[-2].dataType;
+				RsslRet ret;
+
+				if ((ret = parsePrimitive(keyType, token, &pFrame->value, &isBlank)) < 0 || isBlank)
+					return setError(ret < 0 ? ret : RSSL_RET_INVALID_DATA, "Invalid map entry \"Key\".");
+				return RSSL_RET_SUCCESS;
+			}
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) && token.type == JSON_TOKEN_NULL)
+				return RSSL_RET_SUCCESS;
+			break;
+
+		case JSON_FRAME_VECTOR_ENTRY:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_ACTION) && parseName(_vectorActions, token, &name) >= 0)
+			{
+				pFrame->u.vectorEntry.action = name;
+				return RSSL_RET_SUCCESS;
+			}
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_INDEX) && parseUInt(token, 0x3FFFFFFF, &value) >= 0)
+			{
+				pFrame->u.vectorEntry.index = (RsslUInt32)value;
+				return RSSL_RET_SUCCESS;
+			}
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) && token.type == JSON_TOKEN_NULL)
+				return RSSL_RET_SUCCESS;
+			break;
+
+		case JSON_FRAME_SERIES_ENTRY:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) && token.type == JSON_TOKEN_NULL)
+				return RSSL_RET_SUCCESS;
+			break;
+
+		default:
+			break;
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "Invalid member \"%s\".", pFrame->key);
+}
+
+RsslRet RsslJsonConverterImpl::onScalar(const JsonToken &token)
+{
+	JsonFrame *pFrame;
+
+	if (_depth == 0)
+		return setError(RSSL_RET_INVALID_DATA, "JSON text is not a message object.");
+
+	pFrame = &_frames[_depth - 1];
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_MSG:
+			return readMsgMember(pFrame, token);
+
+		case JSON_FRAME_MSG_KEY:
+			return readMsgKeyMember(pFrame, token);
+
+		case JSON_FRAME_STATE:
+		case JSON_FRAME_QOS:
+		case JSON_FRAME_PRIORITY:
+		case JSON_FRAME_CONF_INFO:
+		case JSON_FRAME_POST_USER_INFO:
+			return readHeaderObjectMember(pFrame, token);
+
+		case JSON_FRAME_FIELD_LIST:
+			return readValue(pFrame, pFrame->u.fieldEntry.dataType, token);
+
+		case JSON_FRAME_ARRAY_ENTRIES:
+			return readValue(pFrame, pFrame[-1].u.array.primitiveType, token);
+
+		case JSON_FRAME_MAP:
+		case JSON_FRAME_VECTOR:
+		case JSON_FRAME_SERIES:
+		case JSON_FRAME_ARRAY:
+			return readContainerMember(pFrame, token);
+
+		case JSON_FRAME_ELEMENT_ENTRY:
+		case JSON_FRAME_ATTRIB:
+		case JSON_FRAME_MAP_ENTRY:
+		case JSON_FRAME_VECTOR_ENTRY:
+		case JSON_FRAME_SERIES_ENTRY:
+			return readEntryMember(pFrame, token);
+
+		default:
+			return setError(RSSL_RET_INVALID_DATA, "Unexpected value.");
+	}
+}
+
+/* Encodes the message header, up to its payload. */
+RsslRet RsslJsonConverterImpl::startMsgPayload(RsslContainerType containerType)
+{
+	RsslRet ret;
+
+	_msg.msgBase.containerType = containerType;
+	_payloadStarted = RSSL_TRUE;
+
+	if ((ret = rsslEncodeMsgInit(_pMsgIter, &_msg, 0)) != RSSL_RET_ENCODE_CONTAINER)
+		return setError(ret < 0 ? ret : RSSL_RET_FAILURE, "Failed to encode message header.");
+
+	return startContainer(containerType);
+}
+
+/* Starts the container that is the value of the current member. */
+RsslRet RsslJsonConverterImpl::startContainer(RsslContainerType containerType)
+{
+	JsonFrame *pFrame;
+	RsslRet ret;
+
+	switch (containerType)
+	{
+		case RSSL_DT_FIELD_LIST:
+			if ((pFrame = pushFrame(JSON_FRAME_FIELD_LIST)) == NULL)
+				break;
+			rsslClearFieldList(&pFrame->list.fieldList);
+			pFrame->list.fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA;
+			if ((ret = rsslEncodeFieldListInit(_pEncIter, &pFrame->list.fieldList, NULL, 0)) < 0)
+				return setError(ret, "Failed to encode field list.");
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_ELEMENT_LIST:
+			if ((pFrame = pushFrame(JSON_FRAME_ELEMENT_LIST)) == NULL)
+				break;
+			rsslClearElementList(&pFrame->list.elementList);
+			pFrame->list.elementList.flags = RSSL_ELF_HAS_STANDARD_DATA;
+			if ((ret = rsslEncodeElementListInit(_pEncIter, &pFrame->list.elementList, NULL, 0)) < 0)
+				return setError(ret, "Failed to encode element list.");
+			return RSSL_RET_SUCCESS;
+
+		/* Maps, vectors and series are initialized when their summary or entries start. */
+		case RSSL_DT_MAP:
+			if (pushFrame(JSON_FRAME_MAP) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_VECTOR:
+			if (pushFrame(JSON_FRAME_VECTOR) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_DT_SERIES:
+			if (pushFrame(JSON_FRAME_SERIES) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		default:
+			return setError(RSSL_RET_UNSUPPORTED_DATA_TYPE, "Cannot convert container type %u.", containerType);
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "JSON is nested too deeply.");
+}
+
+RsslRet RsslJsonConverterImpl::initContainer(JsonFrame *pFrame)
+{
+	RsslRet ret;
+
+	if (pFrame->initialized)
+		return RSSL_RET_SUCCESS;
+	pFrame->initialized = RSSL_TRUE;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_MAP:
+			pFrame->u.map.keyPrimitiveType = pFrame->dataType;
+			pFrame->u.map.containerType = pFrame->containerType;
+			ret = rsslEncodeMapInit(_pEncIter, &pFrame->u.map, 0, 0);
+			break;
+
+		case JSON_FRAME_VECTOR:
+			pFrame->u.vector.containerType = pFrame->containerType;
+			ret = rsslEncodeVectorInit(_pEncIter, &pFrame->u.vector, 0, 0);
+			break;
+
+		case JSON_FRAME_SERIES:
+			pFrame->u.series.containerType = pFrame->containerType;
+			ret = rsslEncodeSeriesInit(_pEncIter, &pFrame->u.series, 0, 0);
+			break;
+
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+
+	return (ret < 0) ? setError(ret, "Failed to encode %s.", rsslDataTypeToOmmString(pFrame->type == JSON_FRAME_MAP ? RSSL_DT_MAP
+				: (pFrame->type == JSON_FRAME_VECTOR ? RSSL_DT_VECTOR : RSSL_DT_SERIES))) : RSSL_RET_SUCCESS;
+}
+
+/* Starts an object that is the value of a field list entry, element entry or array entry. */
+RsslRet RsslJsonConverterImpl::startValue(JsonFrame *pFrame, RsslDataType dataType)
+{
+	JsonFrame *pValueFrame;
+	RsslRet ret;
+
+	if (dataType == RSSL_DT_STATE || dataType == RSSL_DT_QOS)
+	{
+		if ((pValueFrame = pushFrame(dataType == RSSL_DT_STATE ? JSON_FRAME_STATE : JSON_FRAME_QOS)) == NULL)
+			return setError(RSSL_RET_INVALID_DATA, "JSON is nested too deeply.");
+		memset(&pValueFrame->value, 0, sizeof(pValueFrame->value));
+		pValueFrame->pTarget = &pValueFrame->value;
+		return RSSL_RET_SUCCESS;
+	}
+
+	if (pFrame->type == JSON_FRAME_ARRAY_ENTRIES || (dataType != RSSL_DT_ARRAY && dataType < RSSL_DT_CONTAINER_TYPE_MIN))
+		return setError(RSSL_RET_INVALID_DATA, "Unexpected object for %s value.", rsslDataTypeToOmmString(dataType));
+
+	if (pFrame->type == JSON_FRAME_FIELD_LIST)
+		ret = rsslEncodeFieldEntryInit(_pEncIter, &pFrame->u.fieldEntry, 0);
+	else
+	{
+		pFrame->initialized = RSSL_TRUE;
+		ret = rsslEncodeElementEntryInit(_pEncIter, &pFrame->u.elementEntry, 0);
+	}
+	if (ret < 0)
+		return setError(ret, "Failed to encode entry.");
+
+	if (dataType == RSSL_DT_ARRAY)
+	{
+		if ((pValueFrame = pushFrame(JSON_FRAME_ARRAY)) == NULL)
+			return setError(RSSL_RET_INVALID_DATA, "JSON is nested too deeply.");
+		return RSSL_RET_SUCCESS;
+	}
+
+	return startContainer(dataType);
+}
+
+RsslRet RsslJsonConverterImpl::onStartObject()
+{
+	JsonFrame *pFrame, *pNewFrame;
+	const JsonHeaderMember *pMember = NULL;
+	RsslUInt16 keyFlag;
+	RsslUInt8 payloadType;
+	RsslUInt32 i;
+	RsslRet ret;
+
+	if (_depth == 0)
+	{
+		if (_msgDone)
+			return setError(RSSL_RET_INVALID_DATA, "JSON text has more than one message.");
+		pushFrame(JSON_FRAME_MSG);
+		return RSSL_RET_SUCCESS;
+	}
+
+	pFrame = &_frames[_depth - 1];
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_MSG:
+			if (jsonNameIs(pFrame->key, pFrame->keyLength, JSON_KEY))
+			{
+				if (jsonMsgKeyFlag(_msg.msgBase.msgClass, &keyFlag) < 0)
+					return setError(RSSL_RET_INVALID_DATA, "Message has no key.");
+				*jsonMsgFlags(&_msg) |= keyFlag;
+				if ((pNewFrame = pushFrame(JSON_FRAME_MSG_KEY)) == NULL)
+					break;
+				return RSSL_RET_SUCCESS;
+			}
+
+			for (i = 0; i < JSON_HEADER_MEMBER_COUNT; ++i)
+			{
+				if (jsonHeaderMembers[i].msgClass == _msg.msgBase.msgClass && jsonNameIs(pFrame->key, pFrame->keyLength, jsonHeaderMembers[i].name))
+				{
+					pMember = &jsonHeaderMembers[i];
+					break;
+				}
+			}
+
+			if (pMember)
+			{
+				JsonFrameType type;
+
+				switch (pMember->kind)
+				{
+					case JSON_HDR_STATE:			type = JSON_FRAME_STATE; break;
+					case JSON_HDR_QOS:				type = JSON_FRAME_QOS; break;
+					case JSON_HDR_PRIORITY:			type = JSON_FRAME_PRIORITY; break;
+					case JSON_HDR_CONF_INFO:		type = JSON_FRAME_CONF_INFO; break;
+					case JSON_HDR_POST_USER_INFO:	type = JSON_FRAME_POST_USER_INFO; break;
+					default:
+						return setError(RSSL_RET_INVALID_DATA, "Invalid message member \"%s\".", pFrame->key);
+				}
+
+				*jsonMsgFlags(&_msg) |= pMember->flag;
+				if ((pNewFrame = pushFrame(type)) == NULL)
+					break;
+				pNewFrame->pTarget = (char*)&_msg + pMember->offset;
+				return RSSL_RET_SUCCESS;
+			}
+
+			if (!_dataTypes.find(pFrame->key, pFrame->keyLength, &payloadType) || payloadType < RSSL_DT_CONTAINER_TYPE_MIN)
+				return setError(RSSL_RET_INVALID_DATA, "Unknown message member \"%s\".", pFrame->key);
+			return startMsgPayload(payloadType);
+
+		case JSON_FRAME_MSG_KEY:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_ATTRIB))
+				return setError(RSSL_RET_INVALID_DATA, "Invalid key member \"%s\".", pFrame->key);
+			if ((pNewFrame = pushFrame(JSON_FRAME_ATTRIB)) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_ATTRIB:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) || pFrame->dataType < RSSL_DT_CONTAINER_TYPE_MIN
+					|| pFrame->dataType == RSSL_DT_UNKNOWN)
+				return setError(RSSL_RET_INVALID_DATA, "Invalid key attributes.");
+
+			/* Attributes are encoded on their own, then set on the key as pre-encoded data. */
+			_attribBuffer.length = (RsslUInt32)(_arenaSize - _arenaUsed);
+			if (_attribBuffer.length < 16 || (_attribBuffer.data = arenaAlloc(_attribBuffer.length)) == NULL)
+				return setError(RSSL_RET_BUFFER_TOO_SMALL, "No room to encode key attributes.");
+
+			rsslClearEncodeIterator(&_attribIter);
+			rsslSetEncodeIteratorRWFVersion(&_attribIter, (RsslUInt8)_pMsgIter->_majorVersion, (RsslUInt8)_pMsgIter->_minorVersion);
+			if ((ret = rsslSetEncodeIteratorBuffer(&_attribIter, &_attribBuffer)) < 0)
+				return setError(ret, "Failed to encode key attributes.");
+			_pEncIter = &_attribIter;
+			return startContainer(pFrame->dataType);
+
+		case JSON_FRAME_FIELD_LIST:
+			return startValue(pFrame, pFrame->u.fieldEntry.dataType);
+
+		case JSON_FRAME_ELEMENT_LIST:
+			if ((pNewFrame = pushFrame(JSON_FRAME_ELEMENT_ENTRY)) == NULL)
+				break;
+			rsslClearElementEntry(&pNewFrame->u.elementEntry);
+			pNewFrame->u.elementEntry.name.data = (char*)pFrame->key;
+			pNewFrame->u.elementEntry.name.length = pFrame->keyLength;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_ELEMENT_ENTRY:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) || pFrame->dataType == RSSL_DT_UNKNOWN)
+				return setError(RSSL_RET_INVALID_DATA, "Invalid element entry.");
+			return startValue(pFrame, pFrame->dataType);
+
+		case JSON_FRAME_ARRAY_ENTRIES:
+			return startValue(pFrame, pFrame[-1].u.array.primitiveType);
+
+		case JSON_FRAME_MAP:
+		case JSON_FRAME_VECTOR:
+		case JSON_FRAME_SERIES:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_SUMMARY))
+				return setError(RSSL_RET_INVALID_DATA, "Invalid member \"%s\".", pFrame->key);
+			if (pFrame->initialized)
+				return setError(RSSL_RET_INVALID_DATA, "\"Summary\" follows the entries.");
+
+			if (pFrame->type == JSON_FRAME_MAP)
+				pFrame->u.map.flags |= RSSL_MPF_HAS_SUMMARY_DATA;
+			else if (pFrame->type == JSON_FRAME_VECTOR)
+				pFrame->u.vector.flags |= RSSL_VTF_HAS_SUMMARY_DATA;
+			else
+				pFrame->u.series.flags |= RSSL_SRF_HAS_SUMMARY_DATA;
+
+			if ((ret = initContainer(pFrame)) < 0)
+				return ret;
+			return startContainer(pFrame->containerType);
+
+		case JSON_FRAME_MAP_ENTRIES:
+			if ((pNewFrame = pushFrame(JSON_FRAME_MAP_ENTRY)) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_VECTOR_ENTRIES:
+			if ((pNewFrame = pushFrame(JSON_FRAME_VECTOR_ENTRY)) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_SERIES_ENTRIES:
+			if ((pNewFrame = pushFrame(JSON_FRAME_SERIES_ENTRY)) == NULL)
+				break;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_MAP_ENTRY:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA))
+				return setError(RSSL_RET_INVALID_DATA, "Invalid map entry.");
+			pFrame->initialized = RSSL_TRUE;
+			if ((ret = rsslEncodeMapEntryInit(_pEncIter, &pFrame->u.mapEntry, &pFrame->value, 0)) < 0)
+				return setError(ret, "Failed to encode map entry.");
+			return startContainer(pFrame[-2].containerType);
+
+		case JSON_FRAME_VECTOR_ENTRY:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA))
+				return setError(RSSL_RET_INVALID_DATA, "Invalid vector entry.");
+			pFrame->initialized = RSSL_TRUE;
+			if ((ret = rsslEncodeVectorEntryInit(_pEncIter, &pFrame->u.vectorEntry, 0)) < 0)
+				return setError(ret, "Failed to encode vector entry.");
+			return startContainer(pFrame[-2].containerType);
+
+		case JSON_FRAME_SERIES_ENTRY:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA))
+				return setError(RSSL_RET_INVALID_DATA, "Invalid series entry.");
+			pFrame->initialized = RSSL_TRUE;
+			if ((ret = rsslEncodeSeriesEntryInit(_pEncIter, &pFrame->u.seriesEntry, 0)) < 0)
+				return setError(ret, "Failed to encode series entry.");
+			return startContainer(pFrame[-2].containerType);
+
+		default:
+			return setError(RSSL_RET_INVALID_DATA, "Unexpected object.");
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "JSON is nested too deeply.");
+}
+
+RsslRet RsslJsonConverterImpl::onStartArray()
+{
+	JsonFrame *pFrame;
+	RsslRet ret;
+
+	if (_depth == 0)
+		return setError(RSSL_RET_INVALID_DATA, "JSON text is not a message object.");
+
+	pFrame = &_frames[_depth - 1];
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_ARRAY:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_DATA) || pFrame->initialized)
+				break;
+			pFrame->initialized = RSSL_TRUE;
+			if ((ret = rsslEncodeArrayInit(_pEncIter, &pFrame->u.array)) < 0)
+				return setError(ret, "Failed to encode array.");
+			if (pushFrame(JSON_FRAME_ARRAY_ENTRIES) == NULL)
+				return setError(RSSL_RET_INVALID_DATA, "JSON is nested too deeply.");
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_MAP:
+		case JSON_FRAME_VECTOR:
+		case JSON_FRAME_SERIES:
+			if (!jsonNameIs(pFrame->key, pFrame->keyLength, JSON_ENTRIES))
+				break;
+			if ((ret = initContainer(pFrame)) < 0)
+				return ret;
+			if (pushFrame(pFrame->type == JSON_FRAME_MAP ? JSON_FRAME_MAP_ENTRIES
+						: (pFrame->type == JSON_FRAME_VECTOR ? JSON_FRAME_VECTOR_ENTRIES : JSON_FRAME_SERIES_ENTRIES)) == NULL)
+				return setError(RSSL_RET_INVALID_DATA, "JSON is nested too deeply.");
+			return RSSL_RET_SUCCESS;
+
+		default:
+			break;
+	}
+
+	return setError(RSSL_RET_INVALID_DATA, "Unexpected array.");
+}
+
+RsslRet RsslJsonConverterImpl::onEndArray()
+{
+	JsonFrame *pFrame = &_frames[_depth - 1];
+	RsslRet ret;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_ARRAY_ENTRIES:
+			--_depth;
+			if ((ret = rsslEncodeArrayComplete(_pEncIter, RSSL_TRUE)) < 0)
+				return setError(ret, "Failed to complete array.");
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_MAP_ENTRIES:
+		case JSON_FRAME_VECTOR_ENTRIES:
+		case JSON_FRAME_SERIES_ENTRIES:
+			--_depth;
+			return RSSL_RET_SUCCESS;
+
+		default:
+			return setError(RSSL_RET_INVALID_DATA, "Unexpected array.");
+	}
+}
+
+/* Completes whatever the value that just ended belonged to. */
+RsslRet RsslJsonConverterImpl::completeChild(JsonFrame *pParent)
+{
+	RsslRet ret;
+
+	switch (pParent->type)
+	{
+		case JSON_FRAME_MSG:
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_ATTRIB:
+		{
+			RsslMsgKey *pKey = &_msg.msgBase.msgKey;
+
+			pKey->attribContainerType = pParent->dataType;
+			pKey->encAttrib.data = _attribBuffer.data;
+			pKey->encAttrib.length = rsslGetEncodedBufferLength(&_attribIter);
+			pKey->flags |= RSSL_MKF_HAS_ATTRIB;
+			_pEncIter = _pMsgIter;
+			return RSSL_RET_SUCCESS;
+		}
+
+		case JSON_FRAME_FIELD_LIST:			ret = rsslEncodeFieldEntryComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_ELEMENT_ENTRY:		ret = rsslEncodeElementEntryComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_MAP:				ret = rsslEncodeMapSummaryDataComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_VECTOR:				ret = rsslEncodeVectorSummaryDataComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_SERIES:				ret = rsslEncodeSeriesSummaryDataComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_MAP_ENTRY:			ret = rsslEncodeMapEntryComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_VECTOR_ENTRY:		ret = rsslEncodeVectorEntryComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_SERIES_ENTRY:		ret = rsslEncodeSeriesEntryComplete(_pEncIter, RSSL_TRUE); break;
+		case JSON_FRAME_ARRAY_ENTRIES:		return RSSL_RET_SUCCESS;
+		default:
+			return setError(RSSL_RET_INVALID_DATA, "Unexpected end of object.");
+	}
+
+	return (ret < 0) ? setError(ret, "Failed to complete entry.") : RSSL_RET_SUCCESS;
+}
+
+RsslRet RsslJsonConverterImpl::onEndObject()
+{
+	JsonFrame *pFrame = &_frames[_depth - 1];
+	JsonFrame *pParent = (_depth > 1) ? pFrame - 1 : NULL;
+	RsslRet ret;
+
+	switch (pFrame->type)
+	{
+		case JSON_FRAME_MSG:
+			--_depth;
+			if (!_msgClassSet)
+				return setError(RSSL_RET_INVALID_DATA, "Message has no \"Type\".");
+
+			/* Without a container payload, the whole message is encoded here. */
+			if (_msg.msgBase.containerType < RSSL_DT_CONTAINER_TYPE_MIN || jsonIsPreEncodedType(_msg.msgBase.containerType)
+					|| !_payloadStarted)
+			{
+				if (!_payloadStarted)
+					_msg.msgBase.containerType = RSSL_DT_NO_DATA;
+				if ((ret = rsslEncodeMsg(_pMsgIter, &_msg)) < 0)
+					return setError(ret, "Failed to encode message.");
+			}
+			else if ((ret = rsslEncodeMsgComplete(_pMsgIter, RSSL_TRUE)) < 0)
+				return setError(ret, "Failed to complete message.");
+
+			_msgDone = RSSL_TRUE;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_MSG_KEY:
+		case JSON_FRAME_PRIORITY:
+		case JSON_FRAME_CONF_INFO:
+		case JSON_FRAME_POST_USER_INFO:
+			--_depth;
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_ATTRIB:
+			--_depth;
+			if (!(_msg.msgBase.msgKey.flags & RSSL_MKF_HAS_ATTRIB))
+				return setError(RSSL_RET_INVALID_DATA, "Key attributes have no \"Data\".");
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_STATE:
+		case JSON_FRAME_QOS:
+			--_depth;
+			/* A State or Qos value of an entry is encoded once it is complete. */
+			if (pFrame->pTarget == &pFrame->value)
+				return encodeValue(pParent, pFrame->pTarget);
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_FIELD_LIST:
+			--_depth;
+			if ((ret = rsslEncodeFieldListComplete(_pEncIter, RSSL_TRUE)) < 0)
+				return setError(ret, "Failed to complete field list.");
+			return completeChild(pParent);
+
+		case JSON_FRAME_ELEMENT_LIST:
+			--_depth;
+			if ((ret = rsslEncodeElementListComplete(_pEncIter, RSSL_TRUE)) < 0)
+				return setError(ret, "Failed to complete element list.");
+			return completeChild(pParent);
+
+		case JSON_FRAME_ELEMENT_ENTRY:
+			--_depth;
+			/* An entry without data, e.g. of type NoData. */
+			if (!pFrame->initialized)
+			{
+				if (pFrame->dataType == RSSL_DT_UNKNOWN)
+					return setError(RSSL_RET_INVALID_DATA, "Element entry has no \"Type\".");
+				if ((ret = rsslEncodeElementEntry(_pEncIter, &pFrame->u.elementEntry, NULL)) < 0)
+					return setError(ret, "Failed to encode element entry.");
+			}
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_ARRAY:
+			--_depth;
+			if (!pFrame->initialized)
+				return setError(RSSL_RET_INVALID_DATA, "Array has no \"Data\".");
+			return completeChild(pParent);
+
+		case JSON_FRAME_MAP:
+		case JSON_FRAME_VECTOR:
+		case JSON_FRAME_SERIES:
+			--_depth;
+			if ((ret = initContainer(pFrame)) < 0)
+				return ret;
+			if (pFrame->type == JSON_FRAME_MAP)
+				ret = rsslEncodeMapComplete(_pEncIter, RSSL_TRUE);
+			else if (pFrame->type == JSON_FRAME_VECTOR)
+				ret = rsslEncodeVectorComplete(_pEncIter, RSSL_TRUE);
+			else
+				ret = rsslEncodeSeriesComplete(_pEncIter, RSSL_TRUE);
+			if (ret < 0)
+				return setError(ret, "Failed to complete container.");
+			return completeChild(pParent);
+
+		case JSON_FRAME_MAP_ENTRY:
+			--_depth;
+			if (!pFrame->initialized && (ret = rsslEncodeMapEntry(_pEncIter, &pFrame->u.mapEntry, &pFrame->value)) < 0)
+				return setError(ret, "Failed to encode map entry.");
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_VECTOR_ENTRY:
+			--_depth;
+			if (!pFrame->initialized && (ret = rsslEncodeVectorEntry(_pEncIter, &pFrame->u.vectorEntry)) < 0)
+				return setError(ret, "Failed to encode vector entry.");
+			return RSSL_RET_SUCCESS;
+
+		case JSON_FRAME_SERIES_ENTRY:
+			--_depth;
+			if (!pFrame->initialized && (ret = rsslEncodeSeriesEntry(_pEncIter, &pFrame->u.seriesEntry)) < 0)
+				return setError(ret, "Failed to encode series entry.");
+			return RSSL_RET_SUCCESS;
+
+		default:
+			return setError(RSSL_RET_INVALID_DATA, "Unexpected end of object.");
+	}
+}
+
+/*** API ***/
+
+RSSL_API RsslJsonConverterHandle rsslJsonConverterCreate(const RsslJsonConverterOptions *pOptions, RsslJsonConverterError *pError)
+{
+	RsslJsonConverterImpl *pConverter;
+
+	rsslJsonConverterErrorClear(pError);
+
+	if (pOptions == NULL || pOptions->pDictionary == NULL)
+	{
+		if (pError)
+		{
+			pError->rsslErrorId = RSSL_RET_INVALID_ARGUMENT;
+			snprintf(pError->text, sizeof(pError->text), "A dictionary is required.");
+		}
+		return NULL;
+	}
+
+	pConverter = new (std::nothrow) RsslJsonConverterImpl(pOptions->pDictionary, pOptions->bufferSize ? pOptions->bufferSize : 4096);
+	if (pConverter == NULL && pError)
+	{
+		pError->rsslErrorId = RSSL_RET_FAILURE;
+		snprintf(pError->text, sizeof(pError->text), "Failed to allocate JSON converter.");
+	}
+
+	return (RsslJsonConverterHandle)pConverter;
+}
+
+RSSL_API void rsslJsonConverterDestroy(RsslJsonConverterHandle handle)
+{
+	delete (RsslJsonConverterImpl*)handle;
+}
+
+RSSL_API RsslRet rsslJsonConverterMsgToJson(RsslJsonConverterHandle handle, RsslDecodeIterator *pIter, RsslMsg *pMsg,
+		RsslBuffer *pJsonBuffer, RsslJsonConverterError *pError)
+{
+	RsslJsonConverterImpl *pConverter = (RsslJsonConverterImpl*)handle;
+	RsslRet ret;
+
+	rsslJsonConverterErrorClear(&pConverter->error);
+	if ((ret = pConverter->msgToJson(pIter, pMsg, pJsonBuffer)) < 0 && pError)
+		*pError = pConverter->error;
+	return ret;
+}
+
+RSSL_API RsslRet rsslJsonConverterJsonToMsg(RsslJsonConverterHandle handle, const RsslBuffer *pJsonBuffer, RsslEncodeIterator *pIter,
+		RsslJsonConverterError *pError)
+{
+	RsslJsonConverterImpl *pConverter = (RsslJsonConverterImpl*)handle;
+	RsslRet ret;
+
+	rsslJsonConverterErrorClear(&pConverter->error);
+	if ((ret = pConverter->jsonToMsg(pJsonBuffer, pIter)) < 0 && pError)
+		*pError = pConverter->error;
+	return ret;
+}
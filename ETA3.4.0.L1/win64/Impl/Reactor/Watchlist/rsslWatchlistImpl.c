@@ -45,6 +45,11 @@ RsslWatchlist *rsslWatchlistCreate(RsslWatchlistCreateOptions *pCreateOptions,
 	baseInitOpts.ticksPerMsec = pCreateOptions->ticksPerMsec;
 	baseInitOpts.maxOutstandingPosts = pCreateOptions->maxOutstandingPosts;
 	baseInitOpts.postAckTimeout = pCreateOptions->postAckTimeout;
+	baseInitOpts.filterViewsPerRequest = pCreateOptions->filterViewsPerRequest;
+	baseInitOpts.requestPacingRate = pCreateOptions->requestPacingRate;
+	baseInitOpts.requestPacingBurst = pCreateOptions->requestPacingBurst;
+	baseInitOpts.requestPacingLatencyTarget = pCreateOptions->requestPacingLatencyTarget;
+	baseInitOpts.cacheItemImages = pCreateOptions->cacheItemImages;
 
 	if ((ret = wlBaseInit(&pWatchlistImpl->base, &baseInitOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
@@ -121,14 +126,12 @@ RsslInt64 rsslWatchlistProcessFTGroupPing(RsslWatchlist *pWatchlist, RsslUInt8 f
 
 	if (!pGroup) return WL_TIME_UNSET;
 
-	/* Received a ping for an FTGroup we're using. Reset the timer and put it on
-	 * the back of the timeout queue. */
-	rsslQueueRemoveLink(&pWatchlistImpl->items.ftGroupTimerQueue, &pGroup->qlGroups);
-	rsslQueueAddLinkToBack(&pWatchlistImpl->items.ftGroupTimerQueue, &pGroup->qlGroups);
-	pGroup->expireTime = currentTime + pWatchlistImpl->base.pRsslChannel->pingTimeout * 1000;
+	/* Received a ping for an FTGroup we're using. Reset the timer. */
+	wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pGroup->timer, currentTime,
+			pWatchlistImpl->base.pRsslChannel->pingTimeout * 1000);
 	pWatchlist->state |= RSSLWL_STF_NEED_TIMER;
 
-	return pGroup->expireTime;
+	return pGroup->timer.expireTime;
 }
 
 void rsslWatchlistDestroy(RsslWatchlist *pWatchlist)
@@ -204,7 +207,8 @@ void rsslWatchlistDestroy(RsslWatchlist *pWatchlist)
 	for(i = 0; i < WL_FTGROUP_TABLE_SIZE; ++i)
 	{
 		if (pWatchlistImpl->items.ftGroupTable[i])
-			wlFTGroupRemove(&pWatchlistImpl->items, pWatchlistImpl->items.ftGroupTable[i]);
+			wlFTGroupRemove(&pWatchlistImpl->base, &pWatchlistImpl->items, 
+					pWatchlistImpl->items.ftGroupTable[i]);
 	}
 
 	while(pLink = rsslQueueRemoveFirstLink(&pWatchlistImpl->base.openStreams))
@@ -478,6 +482,10 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 		}
 	}
 
+	/* Release any item streams waiting for the request pacer. */
+	if (pWatchlistImpl->base.requestPacer.waitingCount)
+		wlItemStreamProcessPacing(&pWatchlistImpl->base);
+
 	/* Send any item requests. */
 	RSSL_QUEUE_FOR_EACH_LINK(&pWatchlistImpl->base.streamsPendingRequest,
 			pLink)
@@ -506,283 +514,370 @@ RsslRet rsslWatchlistDispatch(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
 RsslInt64 rsslWatchlistGetNextTimeout(RsslWatchlist *pWatchlist)
 {
 	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-	RsslQueueLink *pLink;
-	RsslInt64 time = WL_TIME_UNSET;
-	
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
-	{
-		WlStreamBase *pStream = RSSL_QUEUE_LINK_TO_OBJECT(WlStreamBase, qlStreamsPendingResponse, 
-				pLink);
-		time = pStream->requestExpireTime;
-	}
 
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
-	{
-		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, qlGroups, pLink);
-		if (pGroup->expireTime < time) time = pGroup->expireTime;
-	}
+	return wlTimerWheelGetNextTimeout(&pWatchlistImpl->base.timerWheel);
+}
+
+RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslWatchlistImpl		*pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	WlTimerWheel			*pTimerWheel = &pWatchlistImpl->base.timerWheel;
+	WlTimer					*pTimer;
+	RsslRet					ret;
+
+	if (!wlTimerWheelGetCount(pTimerWheel))
+		return RSSL_RET_SUCCESS;
+
+	pWatchlistImpl->base.watchlist.state &= ~RSSLWL_STF_NEED_TIMER;
+	pWatchlistImpl->base.currentTime = currentTime;
+
+	wlTimerWheelAdvance(pTimerWheel, currentTime);
 
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.postTable.timeoutQueue)))
+	/* Expired timers are retrieved one at a time, so handling one timer may safely cancel
+	 * or re-arm others. */
+	while ((pTimer = wlTimerWheelPopExpired(pTimerWheel)))
 	{
-		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlTimeout, pLink);
-		if (pRecord->expireTime < time) time = pRecord->expireTime;
+		switch(pTimer->timerType)
+		{
+			case WL_TMT_REQUEST:
+				ret = wlProcessRequestTimeout(pWatchlistImpl, 
+						WL_TIMER_TO_OBJECT(WlStream, base.requestTimer, pTimer), pErrorInfo);
+				break;
+
+			case WL_TMT_FTGROUP:
+				ret = wlProcessFTGroupTimeout(pWatchlistImpl, 
+						WL_TIMER_TO_OBJECT(WlFTGroup, timer, pTimer), pErrorInfo);
+				break;
+
+			case WL_TMT_GAP:
+				ret = wlProcessGapTimeout(pWatchlistImpl, pErrorInfo);
+				break;
+
+			case WL_TMT_POST:
+				ret = wlProcessPostTimeout(pWatchlistImpl, 
+						WL_TIMER_TO_OBJECT(WlPostRecord, timer, pTimer), pErrorInfo);
+				break;
+
+			case WL_TMT_CONFLATION:
+				ret = wlItemRequestProcessConflationTimer(&pWatchlistImpl->base,
+						WL_TIMER_TO_OBJECT(WlItemConflation, timer, pTimer), pErrorInfo);
+				break;
+
+			case WL_TMT_PACER:
+				/* Released streams send their requests when the watchlist is next dispatched. */
+				wlItemStreamProcessPacing(&pWatchlistImpl->base);
+				pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_DISPATCH;
+				ret = RSSL_RET_SUCCESS;
+				break;
+
+			default:
+				assert(0);
+				ret = RSSL_RET_SUCCESS;
+				break;
+		}
+
+		if (ret != RSSL_RET_SUCCESS)
+			return ret;
 	}
 
-	if (pWatchlistImpl->items.gapExpireTime < time) time = pWatchlistImpl->items.gapExpireTime;
+	if (wlTimerWheelGetCount(pTimerWheel))
+		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
 
-	return time;
+	return RSSL_RET_SUCCESS;
 }
 
-RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTime,
+void rsslWatchlistResetGapTimer(RsslWatchlist *pWatchlist)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+
+	if (!wlTimerIsArmed(&pWatchlistImpl->items.gapTimer))
+		return;
+
+	wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer,
+			pWatchlistImpl->base.currentTime, pWatchlistImpl->base.gapTimeout);
+	pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
+}
+
+void rsslWatchlistGetPacingStats(RsslWatchlist *pWatchlist, RsslWatchlistPacingStats *pStats)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	WlRequestPacer *pPacer = &pWatchlistImpl->base.requestPacer;
+
+	pStats->requestsWaiting = pPacer->waitingCount;
+	pStats->requestsReleased = pPacer->requestsReleased;
+	pStats->refreshesCompleted = pPacer->refreshesCompleted;
+	pStats->requestRate = pPacer->rate;
+	pStats->averageRefreshLatency = pPacer->averageLatency;
+}
+
+void rsslWatchlistGetMemoryStats(RsslWatchlist *pWatchlist, WlSlabClassStats *pStats)
+{
+	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
+	wlSlabGetStats(&pWatchlistImpl->base.slab, pStats);
+}
+
+/*** Supporting implementation functions. ***/
+
+static RsslRet wlProcessRequestTimeout(RsslWatchlistImpl *pWatchlistImpl, WlStream *pStream,
 		RsslErrorInfo *pErrorInfo)
 {
-	RsslWatchlistImpl		*pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-	RsslQueueLink			*pLink;
 	RsslStatusMsg			statusMsg;
-	RsslAckMsg				ackMsg;
 	RsslWatchlistMsgEvent	msgEvent;
 	RsslRet					ret;
 
-	if (!rsslQueueGetElementCount(&pWatchlistImpl->base.streamsPendingResponse)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.ftGroupTimerQueue)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue)
-			&& !rsslQueueGetElementCount(&pWatchlistImpl->base.postTable.timeoutQueue)
-			)
-		return RSSL_RET_SUCCESS;
-
 	rsslClearStatusMsg(&statusMsg);
 	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.msgBase.domainType = pStream->base.domainType;
 	statusMsg.flags = RSSL_STMF_HAS_STATE;
 	statusMsg.state.streamState = RSSL_STREAM_CLOSED_RECOVER;
 	statusMsg.state.dataState = RSSL_DATA_SUSPECT;
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
+	rssl_set_buffer_to_string(statusMsg.state.text, "Request timed out.");
 
 	wlMsgEventClear(&msgEvent);
 	msgEvent.pRsslMsg = (RsslMsg*)&statusMsg;
 	msgEvent._flags = WL_MEF_SEND_CLOSE;
 
-	pWatchlistImpl->base.watchlist.state &= ~RSSLWL_STF_NEED_TIMER;
+	wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pStream->base);
 
-	/* Check stream timeouts. */
-	rssl_set_buffer_to_string(statusMsg.state.text, "Request timed out.");
-	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.streamsPendingResponse)))
+	switch(pStream->base.domainType)
 	{
-		WlStream *pStream = (WlStream*)RSSL_QUEUE_LINK_TO_OBJECT(WlStream,
-				base.qlStreamsPendingResponse, pLink);
-
-		statusMsg.msgBase.domainType = pStream->base.domainType;
-
-		/* Next timeout in queue has not expired yet. */
-		if (pStream->base.requestExpireTime > currentTime)
+		case RSSL_DMT_LOGIN:
 		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
-		
-		wlUnsetStreamMsgPending(&pWatchlistImpl->base, &pStream->base);
+			RsslDecodeIterator dIter;
+			RsslRDMLoginMsg loginMsg;
+			WlLoginProviderAction loginAction;
 
-		switch(pStream->base.domainType)
-		{
-			case RSSL_DMT_LOGIN:
-			{
-				RsslDecodeIterator dIter;
-				RsslRDMLoginMsg loginMsg;
-				WlLoginProviderAction loginAction;
-				RsslInt32 streamId = pWatchlistImpl->login.pStream->base.streamId;
+			rsslClearDecodeIterator(&dIter);
+			rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
+					RSSL_RWF_MINOR_VERSION);
 
-				rsslClearDecodeIterator(&dIter);
-				rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
-						RSSL_RWF_MINOR_VERSION);
+			msgEvent.pRsslMsg->msgBase.streamId = pWatchlistImpl->login.pStream->base.streamId;
 
-				msgEvent.pRsslMsg->msgBase.streamId = pWatchlistImpl->login.pStream->base.streamId;
+			if ((ret = wlLoginProcessProviderMsg(&pWatchlistImpl->login, &pWatchlistImpl->base, 
+							&dIter, (RsslMsg*)&statusMsg, &loginMsg, &loginAction, pErrorInfo)) 
+					!= RSSL_RET_SUCCESS)
+				return ret;
 
-				if ((ret = wlLoginProcessProviderMsg(&pWatchlistImpl->login, &pWatchlistImpl->base, 
-								&dIter, (RsslMsg*)&statusMsg, &loginMsg, &loginAction, pErrorInfo)) 
-						!= RSSL_RET_SUCCESS)
-					return ret;
+			/* Should be told to recover. */
+			assert(loginAction == WL_LGPA_RECOVER);
 
-				/* Should be told to recover. */
-				assert(loginAction == WL_LGPA_RECOVER);
+			/* Close old login stream */
+			wlLoginStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->login, RSSL_TRUE);
 
-				/* Close old login stream */
-				wlLoginStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->login, RSSL_TRUE);
+			/* Create new login stream. */
+			statusMsg.state.streamState = RSSL_STREAM_OPEN;
+			if (!(pWatchlistImpl->login.pStream = wlLoginStreamCreate(
+							&pWatchlistImpl->base, &pWatchlistImpl->login, pErrorInfo)))
+				return pErrorInfo->rsslError.rsslErrorId;
+			pWatchlistImpl->login.pRequest[pWatchlistImpl->login.index]->base.pStream = &pWatchlistImpl->login.pStream->base;
 
-				/* Create new login stream. */
-				statusMsg.state.streamState = RSSL_STREAM_OPEN;
-				if (!(pWatchlistImpl->login.pStream = wlLoginStreamCreate(
-								&pWatchlistImpl->base, &pWatchlistImpl->login, pErrorInfo)))
-					return pErrorInfo->rsslError.rsslErrorId;
-				pWatchlistImpl->login.pRequest[pWatchlistImpl->login.index]->base.pStream = &pWatchlistImpl->login.pStream->base;
+			msgEvent.pRsslMsg = NULL;
+			msgEvent.pRdmMsg = (RsslRDMMsg*)&loginMsg;
+			loginMsg.rdmMsgBase.streamId = pWatchlistImpl->login.pRequest[pWatchlistImpl->login.index]->base.streamId;
+			if ((ret = (*pWatchlistImpl->base.config.msgCallback)
+						((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
+					!= RSSL_RET_SUCCESS)
+				return ret;
 
-				msgEvent.pRsslMsg = NULL;
-				msgEvent.pRdmMsg = (RsslRDMMsg*)&loginMsg;
-				loginMsg.rdmMsgBase.streamId = pWatchlistImpl->login.pRequest[pWatchlistImpl->login.index]->base.streamId;
-				if ((ret = (*pWatchlistImpl->base.config.msgCallback)
-							((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
-						!= RSSL_RET_SUCCESS)
-					return ret;
+			break;
+		}
 
-				break;
-			}
+		case RSSL_DMT_SOURCE:
+		{
+			RsslDecodeIterator dIter;
 
-			case RSSL_DMT_SOURCE:
-			{
-				RsslDecodeIterator dIter;
-				RsslInt32 streamId = pWatchlistImpl->directory.pStream->base.streamId;
-
-				rsslClearDecodeIterator(&dIter);
-				rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
-						RSSL_RWF_MINOR_VERSION);
-				if ((ret = wlDirectoryProcessProviderMsgEvent(&pWatchlistImpl->base,
-						&pWatchlistImpl->directory, &dIter, &msgEvent, pErrorInfo))
-						!= RSSL_RET_SUCCESS)
-					return ret;
+			rsslClearDecodeIterator(&dIter);
+			rsslSetDecodeIteratorRWFVersion(&dIter, RSSL_RWF_MAJOR_VERSION, 
+					RSSL_RWF_MINOR_VERSION);
+			if ((ret = wlDirectoryProcessProviderMsgEvent(&pWatchlistImpl->base,
+					&pWatchlistImpl->directory, &dIter, &msgEvent, pErrorInfo))
+					!= RSSL_RET_SUCCESS)
+				return ret;
 
-				/* Close old directory stream and create new one. */
-				assert (pWatchlistImpl->base.channelState == WL_CHS_LOGGED_IN);
+			/* Close old directory stream and create new one. */
+			assert (pWatchlistImpl->base.channelState == WL_CHS_LOGGED_IN);
 
-				wlDirectoryStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->directory, 
-						RSSL_TRUE);
+			wlDirectoryStreamClose(&pWatchlistImpl->base, &pWatchlistImpl->directory, 
+					RSSL_TRUE);
 
-				if (!(pWatchlistImpl->directory.pStream = wlDirectoryStreamCreate(
-								&pWatchlistImpl->base, &pWatchlistImpl->directory, 
-								pErrorInfo)))
-					return pErrorInfo->rsslError.rsslErrorId;
+			if (!(pWatchlistImpl->directory.pStream = wlDirectoryStreamCreate(
+							&pWatchlistImpl->base, &pWatchlistImpl->directory, 
+							pErrorInfo)))
+				return pErrorInfo->rsslError.rsslErrorId;
 
-				pWatchlistImpl->base.channelState = WL_CHS_READY;
-				break;
-			}
-			default:
-			{
-				if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, &pStream->item, &msgEvent, 
-								pErrorInfo)) != RSSL_RET_SUCCESS)
-					return ret;
-				pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+			pWatchlistImpl->base.channelState = WL_CHS_READY;
+			break;
+		}
+		default:
+		{
+			if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, &pStream->item, &msgEvent, 
+							pErrorInfo)) != RSSL_RET_SUCCESS)
+				return ret;
+			pWatchlistImpl->items.pCurrentFanoutStream = NULL;
 
-				break;
-			}
+			break;
 		}
 	}
 
-	/* Check FTGroups. */
-	rssl_set_buffer_to_string(statusMsg.state.text, "Fault-tolerant Group timeout.");
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet wlProcessFTGroupTimeout(RsslWatchlistImpl *pWatchlistImpl, WlFTGroup *pGroup,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslStatusMsg			statusMsg;
+	RsslWatchlistMsgEvent	msgEvent;
+	RsslQueueLink			*pStreamLink;
+	RsslRet					ret;
+
+	rsslClearStatusMsg(&statusMsg);
+	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.flags = RSSL_STMF_HAS_STATE;
+	statusMsg.state.streamState = RSSL_STREAM_CLOSED_RECOVER;
+	statusMsg.state.dataState = RSSL_DATA_SUSPECT;
 	statusMsg.state.code = RSSL_SC_TIMEOUT;
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.ftGroupTimerQueue)))
-	{
-		RsslQueueLink *pStreamLink;
-		WlFTGroup *pGroup = RSSL_QUEUE_LINK_TO_OBJECT(WlFTGroup, qlGroups, pLink);
+	rssl_set_buffer_to_string(statusMsg.state.text, "Fault-tolerant Group timeout.");
 
-		/* Next timeout in queue has not expired yet. */
-		if (pGroup->expireTime > currentTime)
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
+	wlMsgEventClear(&msgEvent);
+	msgEvent.pRsslMsg = (RsslMsg*)&statusMsg;
+	msgEvent._flags = WL_MEF_SEND_CLOSE;
 
-		pWatchlistImpl->items.pCurrentFanoutFTGroup = pGroup;
+	pWatchlistImpl->items.pCurrentFanoutFTGroup = pGroup;
 
-		RSSL_QUEUE_FOR_EACH_LINK(&pGroup->openStreamList, pStreamLink)
-		{
-			WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlFTGroup, 
-					pStreamLink);
+	RSSL_QUEUE_FOR_EACH_LINK(&pGroup->openStreamList, pStreamLink)
+	{
+		WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlFTGroup, 
+				pStreamLink);
 
-			statusMsg.msgBase.domainType = pItemStream->base.domainType;
-			if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
-							pErrorInfo)) != RSSL_RET_SUCCESS)
-				return ret;
-			pWatchlistImpl->items.pCurrentFanoutStream = NULL;
-		}
+		statusMsg.msgBase.domainType = pItemStream->base.domainType;
+		if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
+						pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+		pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+	}
 
-		pWatchlistImpl->items.pCurrentFanoutFTGroup = NULL;
+	pWatchlistImpl->items.pCurrentFanoutFTGroup = NULL;
 
-		if (!rsslQueueGetElementCount(&pGroup->openStreamList))
-			wlFTGroupRemove(&pWatchlistImpl->items, pGroup); 
+	if (!rsslQueueGetElementCount(&pGroup->openStreamList))
+		wlFTGroupRemove(&pWatchlistImpl->base, &pWatchlistImpl->items, pGroup); 
 
-	}
+	return RSSL_RET_SUCCESS;
+}
 
-	rssl_set_buffer_to_string(statusMsg.state.text, "Gap in sequence number.");
+static RsslRet wlProcessGapTimeout(RsslWatchlistImpl *pWatchlistImpl, RsslErrorInfo *pErrorInfo)
+{
+	RsslStatusMsg			statusMsg;
+	RsslWatchlistMsgEvent	msgEvent;
+	RsslQueueLink			*pLink;
+	RsslRet					ret;
+
+	rsslClearStatusMsg(&statusMsg);
+	statusMsg.msgBase.containerType = RSSL_DT_NO_DATA;
+	statusMsg.flags = RSSL_STMF_HAS_STATE;
+	statusMsg.state.streamState = RSSL_STREAM_CLOSED_RECOVER;
+	statusMsg.state.dataState = RSSL_DATA_SUSPECT;
 	statusMsg.state.code = RSSL_SC_GAP_DETECTED;
+	rssl_set_buffer_to_string(statusMsg.state.text, "Gap in sequence number.");
 
-	/* Check gap detection timer. */
-	if (pWatchlistImpl->items.gapExpireTime < currentTime)
+	wlMsgEventClear(&msgEvent);
+	msgEvent.pRsslMsg = (RsslMsg*)&statusMsg;
+	msgEvent._flags = WL_MEF_SEND_CLOSE;
+
+	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue)))
 	{
-		while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue)))
-		{
-			WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlGap, pLink);
+		WlItemStream *pItemStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream, qlGap, pLink);
 
 
-			if (pWatchlistImpl->base.gapRecovery)
-			{
-				statusMsg.msgBase.domainType = pItemStream->base.domainType;
-				if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
-								pErrorInfo)) != RSSL_RET_SUCCESS)
-					return ret;
-				pWatchlistImpl->items.pCurrentFanoutStream = NULL;
-			}
-			else
-			{
-				WlBufferedMsg *pBufferedMsg;
-				RsslWatchlistMsgEvent bufferedMsgEvent;
+		if (pWatchlistImpl->base.gapRecovery)
+		{
+			statusMsg.msgBase.domainType = pItemStream->base.domainType;
+			if ((ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, &msgEvent, 
+							pErrorInfo)) != RSSL_RET_SUCCESS)
+				return ret;
+			pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+		}
+		else
+		{
+			WlBufferedMsg *pBufferedMsg;
+			RsslWatchlistMsgEvent bufferedMsgEvent;
 
-				assert(pItemStream->flags & WL_IOSF_BC_BEHIND_UC);
+			assert(pItemStream->flags & WL_IOSF_BC_BEHIND_UC);
 
-				/* If gap recovery is not enabled, this means that the stream was placed
-				 * here due to receiving a unicast message ahead of the broadcast stream
-				 * while reodering. Since the broadcast stream has not caught up yet, 
-				 * assume the expected messages have been lost and forward currently 
-				 * buffered messages. */
+			/* If gap recovery is not enabled, this means that the stream was placed
+			 * here due to receiving a unicast message ahead of the broadcast stream
+			 * while reodering. Since the broadcast stream has not caught up yet, 
+			 * assume the expected messages have been lost and forward currently 
+			 * buffered messages. */
 
-				/* Since multiple messages may be forwarded, set fanout stream
-				 * so we can stop if the stream is closed (either due to a closed streamState
-				 * or because the application closed it from inside the callback. */
-				pWatchlistImpl->items.pCurrentFanoutStream = pItemStream;
+			/* Since multiple messages may be forwarded, set fanout stream
+			 * so we can stop if the stream is closed (either due to a closed streamState
+			 * or because the application closed it from inside the callback. */
+			pWatchlistImpl->items.pCurrentFanoutStream = pItemStream;
 
-				while ( pBufferedMsg = wlMsgReorderQueuePop(
-							&pItemStream->bufferedMsgQueue))
+			while ( pBufferedMsg = wlMsgReorderQueuePop(
+						&pItemStream->bufferedMsgQueue))
+			{
+				wlMsgEventClear(&bufferedMsgEvent);
+				bufferedMsgEvent.pSeqNum = &pBufferedMsg->seqNum;
+				bufferedMsgEvent.pRsslMsg = wlBufferedMsgGetRsslMsg(pBufferedMsg);
+				if (pBufferedMsg->flags & WL_BFMSG_HAS_FT_GROUP_ID)
+					bufferedMsgEvent.pFTGroupId = &pBufferedMsg->ftGroupId;
+
+				/* If a sequence number isn't set for the broadcast stream,
+				 * update the sequence number that we have (this way, if
+				 * any other refreshes come with the same number, we still
+				 * let them through). */
+				if (!(pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM))
 				{
-					wlMsgEventClear(&bufferedMsgEvent);
-					bufferedMsgEvent.pSeqNum = &pBufferedMsg->seqNum;
-					bufferedMsgEvent.pRsslMsg = wlBufferedMsgGetRsslMsg(pBufferedMsg);
-					if (pBufferedMsg->flags & WL_BFMSG_HAS_FT_GROUP_ID)
-						bufferedMsgEvent.pFTGroupId = &pBufferedMsg->ftGroupId;
-
-					/* If a sequence number isn't set for the broadcast stream,
-					 * update the sequence number that we have (this way, if
-					 * any other refreshes come with the same number, we still
-					 * let them through). */
-					if (!(pItemStream->flags & WL_IOSF_HAS_BC_SEQ_NUM))
-					{
-						pItemStream->flags |= WL_IOSF_HAS_UC_SEQ_NUM;
-						pItemStream->seqNum = pBufferedMsg->seqNum;
-					}
-
-					ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, 
-							&bufferedMsgEvent, 
-							pErrorInfo);
+					pItemStream->flags |= WL_IOSF_HAS_UC_SEQ_NUM;
+					pItemStream->seqNum = pBufferedMsg->seqNum;
+				}
 
-					wlBufferedMsgDestroy(pBufferedMsg);
-					if (ret != RSSL_RET_SUCCESS)
-						return ret;
+				ret = wlFanoutItemMsgEvent(pWatchlistImpl, pItemStream, 
+						&bufferedMsgEvent, 
+						pErrorInfo);
 
-					/* If stream was closed, stop. */
-					if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
-						break;
-				}
+				wlBufferedMsgDestroy(&pWatchlistImpl->base, pBufferedMsg);
+				if (ret != RSSL_RET_SUCCESS)
+					return ret;
 
 				/* If stream was closed, stop. */
 				if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
-					continue;
+					break;
+			}
 
-				/* Done forwarding messages. */
-				pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+			/* If stream was closed, stop. */
+			if (pWatchlistImpl->items.pCurrentFanoutStream == NULL)
+				continue;
 
-				wlUnsetGapTimer(pWatchlistImpl, pItemStream, WL_IOSF_BC_BEHIND_UC);
-			}
+			/* Done forwarding messages. */
+			pWatchlistImpl->items.pCurrentFanoutStream = NULL;
+
+			wlUnsetGapTimer(pWatchlistImpl, pItemStream, WL_IOSF_BC_BEHIND_UC);
 		}
 	}
 
-	/* Check timeouts for outstanding post acknowledgements. */
+	/* Restart the gap timer for any streams still waiting. */
+	if (rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue))
+	{
+		wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer,
+				pWatchlistImpl->base.currentTime, pWatchlistImpl->base.gapTimeout);
+		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+static RsslRet wlProcessPostTimeout(RsslWatchlistImpl *pWatchlistImpl, WlPostRecord *pRecord,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslAckMsg				ackMsg;
+	RsslWatchlistMsgEvent	msgEvent;
+	WlRequest				*pRequest = (WlRequest*)pRecord->pUserSpec;
+	RsslRet					ret;
+
 	wlMsgEventClear(&msgEvent);
 	msgEvent.pRsslMsg = (RsslMsg*)&ackMsg;
 
@@ -791,84 +886,44 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
 	ackMsg.nakCode = RSSL_NAKC_NO_RESPONSE;
 	rssl_set_buffer_to_string(ackMsg.text, "Acknowledgement timed out.");
 
-	while ((pLink = rsslQueuePeekFront(&pWatchlistImpl->base.postTable.timeoutQueue)))
-	{
-		WlPostRecord *pRecord = RSSL_QUEUE_LINK_TO_OBJECT(WlPostRecord, qlTimeout, pLink);
-		WlRequest *pRequest;
-
-		if (pRecord->expireTime > currentTime) 
-		{
-			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-			break;
-		}
-
-		pRequest = (WlRequest*)pRecord->pUserSpec;
+	ackMsg.flags = RSSL_AKMF_HAS_TEXT | RSSL_AKMF_HAS_NAK_CODE;
+	ackMsg.ackId = pRecord->postId;
+	ackMsg.msgBase.streamId = pRequest->base.streamId;
+	ackMsg.msgBase.domainType = pRecord->domainType;
 
-		ackMsg.msgBase.domainType = pRequest->base.domainType;
-		ackMsg.flags = RSSL_AKMF_HAS_TEXT | RSSL_AKMF_HAS_NAK_CODE;
-		ackMsg.ackId = pRecord->postId;
-		ackMsg.msgBase.streamId = pRequest->base.streamId;
-		ackMsg.msgBase.domainType = pRecord->domainType;
-
-		if (pRecord->flags & RSSL_PSMF_HAS_SEQ_NUM)
-		{
-			ackMsg.flags |= RSSL_AKMF_HAS_SEQ_NUM;
-			ackMsg.seqNum = pRecord->seqNum;
-		}
-
-		rsslQueueRemoveLink(&pRequest->base.openPosts, &pRecord->qlUser);
-		wlPostTableRemoveRecord(&pWatchlistImpl->base.postTable, pRecord);
+	if (pRecord->flags & RSSL_PSMF_HAS_SEQ_NUM)
+	{
+		ackMsg.flags |= RSSL_AKMF_HAS_SEQ_NUM;
+		ackMsg.seqNum = pRecord->seqNum;
+	}
 
-		if (pRequest->base.domainType == RSSL_DMT_LOGIN)
-		{
-			/* Off-stream post */
-			RsslWatchlistStreamInfo streamInfo;
-			wlStreamInfoClear(&streamInfo);
-			streamInfo.pUserSpec = pRequest->base.pUserSpec;
-			msgEvent.pStreamInfo = &streamInfo;
+	rsslQueueRemoveLink(&pRequest->base.openPosts, &pRecord->qlUser);
+	wlPostTableRemoveRecord(&pWatchlistImpl->base.postTable, pRecord);
 
-			if ((ret = (*pWatchlistImpl->base.config.msgCallback)
-						((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
-					!= RSSL_RET_SUCCESS)
-				return ret;
-		}
-		else
-		{
-			/* Onstream post */
-			if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, &msgEvent, (WlItemRequest*)pRequest, pErrorInfo))
+	if (pRequest->base.domainType == RSSL_DMT_LOGIN)
+	{
+		/* Off-stream post */
+		RsslWatchlistStreamInfo streamInfo;
+		wlStreamInfoClear(&streamInfo);
+		streamInfo.pUserSpec = pRequest->base.pUserSpec;
+		msgEvent.pStreamInfo = &streamInfo;
+
+		if ((ret = (*pWatchlistImpl->base.config.msgCallback)
+					((RsslWatchlist*)&pWatchlistImpl->base.watchlist, &msgEvent, pErrorInfo)) 
 				!= RSSL_RET_SUCCESS)
-				return ret;
-		}
-
+			return ret;
 	}
-
-	/* Update gap timer. */
-	if ((pLink = rsslQueuePeekFront(&pWatchlistImpl->items.gapStreamQueue)))
+	else
 	{
-		pWatchlistImpl->items.gapExpireTime = pWatchlistImpl->base.currentTime + 
-			pWatchlistImpl->base.gapTimeout;
-		pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
+		/* Onstream post */
+		if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, &msgEvent, (WlItemRequest*)pRequest, pErrorInfo))
+			!= RSSL_RET_SUCCESS)
+			return ret;
 	}
-	else
-		pWatchlistImpl->items.gapExpireTime = WL_TIME_UNSET;
 
 	return RSSL_RET_SUCCESS;
 }
 
-void rsslWatchlistResetGapTimer(RsslWatchlist *pWatchlist)
-{
-	RsslWatchlistImpl *pWatchlistImpl = (RsslWatchlistImpl*)pWatchlist;
-
-	if (pWatchlistImpl->items.gapExpireTime == WL_TIME_UNSET)
-		return;
-
-	pWatchlistImpl->items.gapExpireTime = pWatchlistImpl->base.currentTime + 
-		pWatchlistImpl->base.gapTimeout;
-	pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
-}
-
-/*** Supporting implementation functions. ***/
-
 static RsslRet wlServiceUpdateCallback(WlServiceCache *pServiceCache,
 		WlServiceCacheUpdateEvent *pEvent, RsslErrorInfo *pErrorInfo)
 {
@@ -1179,7 +1234,7 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 	{
 		/* Match ID to its stream in our table. */
 
-		pHashLink = rsslHashTableFind(&pWatchlistImpl->base.streamsById, 
+		pHashLink = rsslOpenHashTableFind(&pWatchlistImpl->base.streamsById, 
 				(void*)&pOptions->pRsslMsg->msgBase.streamId, NULL);
 
 		pStream = pHashLink ? RSSL_HASH_LINK_TO_OBJECT(WlStream, base.hlStreamId, pHashLink)
@@ -1208,13 +1263,22 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 				{
 					WlStreamAttributes streamAttributes;
 					streamAttributes.domainType = pOptions->pRsslMsg->msgBase.domainType;
-					streamAttributes.msgKey = *pMsgKey;
 
-					/* Most response messages do not provide a QoS for matching. */
-					streamAttributes.hasQos = RSSL_FALSE;
+					/* Streams' keys are interned, so if the key is not in the table, no stream
+					 * has it. */
+					if ((streamAttributes.itemKey = wlItemKeyTableFind(&pWatchlistImpl->base.itemKeys,
+									pMsgKey)) != WL_ITEM_KEY_NONE)
+					{
+						streamAttributes.keyHashSum = rsslMsgKeyHash(pMsgKey);
 
-					pHashLink = rsslHashTableFind(&pWatchlistImpl->base.openStreamsByAttrib,
-							(void*)&streamAttributes, NULL);
+						/* Most response messages do not provide a QoS for matching. */
+						streamAttributes.hasQos = RSSL_FALSE;
+
+						pHashLink = rsslOpenHashTableFind(&pWatchlistImpl->base.openStreamsByAttrib,
+								(void*)&streamAttributes, NULL);
+					}
+					else
+						pHashLink = NULL;
 
 					pStream = pHashLink ? (WlStream*) RSSL_HASH_LINK_TO_OBJECT(WlItemStream, 
 							hlStreamsByAttrib, pHashLink) : NULL;
@@ -1246,6 +1310,7 @@ RsslRet rsslWatchlistReadMsg(RsslWatchlist *pWatchlist,
 				pStreamBase->isClosing = RSSL_TRUE;
 				pStreamBase->tempStream = RSSL_TRUE;
 				pStreamBase->requestState = WL_STRS_NONE;
+				wlTimerInit(&pStreamBase->requestTimer, WL_TMT_REQUEST);
 
 				wlSetStreamMsgPending(&pWatchlistImpl->base, pStreamBase);
 			}
@@ -1555,8 +1620,8 @@ static void wlSetGapTimer(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItem
 		if (!(pItemStream->flags & (WL_IOSF_HAS_BC_SEQ_GAP | WL_IOSF_HAS_PART_GAP | WL_IOSF_BC_BEHIND_UC)))
 		{
 			/* Move back gap timer. */
-			pWatchlistImpl->items.gapExpireTime = pWatchlistImpl->base.currentTime + 
-				pWatchlistImpl->base.gapTimeout;
+			wlTimerWheelArm(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer,
+					pWatchlistImpl->base.currentTime, pWatchlistImpl->base.gapTimeout);
 			pWatchlistImpl->base.watchlist.state |= RSSLWL_STF_NEED_TIMER;
 
 			rsslQueueAddLinkToBack(&pWatchlistImpl->items.gapStreamQueue,
@@ -1586,7 +1651,7 @@ static void wlUnsetGapTimer(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pIt
 
 			/* If all streams have been removed, reset gap timer. */
 			if (rsslQueueGetElementCount(&pWatchlistImpl->items.gapStreamQueue) == 0)
-				pWatchlistImpl->items.gapExpireTime = WL_TIME_UNSET;
+				wlTimerWheelCancel(&pWatchlistImpl->base.timerWheel, &pWatchlistImpl->items.gapTimer);
 		}
 	}
 }
@@ -1615,7 +1680,7 @@ static RsslRet wlItemStreamForwardUntil(RsslWatchlistImpl *pWatchlistImpl,
 				&bufferedMsgEvent, 
 				pErrorInfo);
 
-		wlBufferedMsgDestroy(pBufferedMsg);
+		wlBufferedMsgDestroy(&pWatchlistImpl->base, pBufferedMsg);
 		if (ret != RSSL_RET_SUCCESS)
 			return ret;
 
@@ -1651,7 +1716,7 @@ static RsslRet wlItemStreamForwardAllQueued(RsslWatchlistImpl *pWatchlistImpl,
 				&bufferedMsgEvent, 
 				pErrorInfo);
 
-		wlBufferedMsgDestroy(pBufferedMsg);
+		wlBufferedMsgDestroy(&pWatchlistImpl->base, pBufferedMsg);
 		if (ret != RSSL_RET_SUCCESS)
 			return ret;
 
@@ -1734,7 +1799,8 @@ static RsslRet wlItemStreamOrderMsg(RsslWatchlistImpl *pWatchlistImpl,
 		if (!(pItemStream->flags & WL_IOSF_HAS_UC_SEQ_NUM))
 		{
 			/* First unicast message. */
-			wlMsgReorderQueueDiscardUntil(&pItemStream->bufferedMsgQueue, seqNum);
+			wlMsgReorderQueueDiscardUntil(&pItemStream->bufferedMsgQueue, seqNum, 
+					&pWatchlistImpl->base);
 
 			pItemStream->flags |= WL_IOSF_HAS_UC_SEQ_NUM;
 			pItemStream->seqNum = seqNum;
@@ -1748,7 +1814,7 @@ static RsslRet wlItemStreamOrderMsg(RsslWatchlistImpl *pWatchlistImpl,
 				 * out-of-order messages from the buffer queue and see if the remaining messages
 				 * leave a gap. */
 				if (wlMsgReorderQueueCheckBroadcastSequence(&pItemStream->bufferedMsgQueue, 
-							&bcSeqNum, &hasGap))
+							&bcSeqNum, &hasGap, &pWatchlistImpl->base))
 				{
 					/* Update sequence number based on what's in the queue. */
 					pItemStream->flags |= WL_IOSF_HAS_BC_SEQ_NUM;
@@ -2030,7 +2096,8 @@ static RsslRet wlItemStreamOrderBroadcastSynchMsg(RsslWatchlistImpl *pWatchlistI
 	if (!(pItemStream->flags & WL_IOSF_HAS_UC_SEQ_NUM))
 	{
 		/* No unicast message received; clear out the queue and forward this message. */
-		wlMsgReorderQueueDiscardAllMessages(&pItemStream->bufferedMsgQueue);
+		wlMsgReorderQueueDiscardAllMessages(&pItemStream->bufferedMsgQueue, 
+				&pWatchlistImpl->base);
 
 		/* Indicate that a broadcast message was used for synchronization.
 		 * Don't set broadcast sequence number since unicast stream hasn't started. */
@@ -2150,6 +2217,52 @@ static RsslRet wlItemStreamOrderBroadcastSynchMsg(RsslWatchlistImpl *pWatchlistI
 	}
 }
 
+/* Sends an update to an item request. When view filtering is enabled and the stream may carry
+ * fields outside the request's view, the update's field list is reduced to the request's own
+ * fields first. Requests with identical views share the filtered payload. */
+static RsslRet wlSendUpdateToItemRequest(RsslWatchlistImpl *pWatchlistImpl, 
+		WlItemStream *pItemStream, RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslMsg *pRsslMsg = pEvent->pRsslMsg;
+	WlView *pView = pItemRequest->pView;
+	WlAggregateView *pAggView = pItemStream->pAggregateView;
+	RsslBuffer *pPayload;
+	RsslMsg filteredMsg;
+	RsslRet ret;
+
+	if (!pWatchlistImpl->base.config.filterViewsPerRequest
+			|| !pView || pView->viewType != RDM_VIEW_TYPE_FIELD_ID_LIST
+			|| pRsslMsg->msgBase.containerType != RSSL_DT_FIELD_LIST
+			|| pRsslMsg->msgBase.encDataBody.length == 0)
+		return wlSendMsgEventToItemRequest(pWatchlistImpl, pEvent, pItemRequest, pErrorInfo);
+
+	/* If this view is part of the stream's view and covers all of it, nothing needs filtering. */
+	if ((pItemStream->flags & WL_IOSF_VIEWED) && pAggView
+			&& pView->pParentQueue != &pAggView->newViews
+			&& pView->elemCount == pAggView->elemCount)
+		return wlSendMsgEventToItemRequest(pWatchlistImpl, pEvent, pItemRequest, pErrorInfo);
+
+	if ((ret = wlViewFilterCacheGet(&pWatchlistImpl->items.viewFilterCache, pView,
+					&pRsslMsg->msgBase.encDataBody, pWatchlistImpl->base.pRsslChannel->majorVersion,
+					pWatchlistImpl->base.pRsslChannel->minorVersion, &pPayload, pErrorInfo))
+			!= RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pPayload == &pRsslMsg->msgBase.encDataBody)
+		return wlSendMsgEventToItemRequest(pWatchlistImpl, pEvent, pItemRequest, pErrorInfo);
+
+	/* The encoded message no longer matches the payload, so don't provide it. */
+	filteredMsg = *pRsslMsg;
+	filteredMsg.msgBase.encDataBody = *pPayload;
+	rsslClearBuffer(&filteredMsg.msgBase.encMsgBuffer);
+
+	pEvent->pRsslMsg = &filteredMsg;
+	ret = wlSendMsgEventToItemRequest(pWatchlistImpl, pEvent, pItemRequest, pErrorInfo);
+	pEvent->pRsslMsg = pRsslMsg;
+	return ret;
+}
+
 static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
 		RsslWatchlistMsgEvent *pEvent, RsslErrorInfo *pErrorInfo)
 {
@@ -2183,12 +2296,17 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 	{
 		case RSSL_MC_UPDATE:
 
+			wlItemStreamCacheMsg(&pWatchlistImpl->base, pItemStream, pRsslMsg);
+
+			if (pItemStream->requestsWithViewCount)
+				wlViewFilterCacheReset(&pWatchlistImpl->items.viewFilterCache);
+
 			RSSL_QUEUE_FOR_EACH_LINK(&pItemStream->requestsOpen, pLink)
 			{
 				WlItemRequest *pItemRequest = 
 					RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest, base.qlStateQueue, pLink);
-				if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, pEvent, pItemRequest, pErrorInfo))
-						!= RSSL_RET_SUCCESS)
+				if ((ret = wlSendUpdateToItemRequest(pWatchlistImpl, pItemStream, pEvent, 
+								pItemRequest, pErrorInfo)) != RSSL_RET_SUCCESS)
 					return ret;
 			}
 
@@ -2197,8 +2315,8 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 				{
 					WlItemRequest *pItemRequest = 
 						RSSL_QUEUE_LINK_TO_OBJECT(WlItemRequest, base.qlStateQueue, pLink);
-					if ((ret = wlSendMsgEventToItemRequest(pWatchlistImpl, pEvent, pItemRequest, pErrorInfo))
-							!= RSSL_RET_SUCCESS)
+					if ((ret = wlSendUpdateToItemRequest(pWatchlistImpl, pItemStream, pEvent, 
+									pItemRequest, pErrorInfo)) != RSSL_RET_SUCCESS)
 						return ret;
 				}
 
@@ -2256,6 +2374,8 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 				}
 			}
 
+			wlItemStreamCacheMsg(&pWatchlistImpl->base, pItemStream, pRsslMsg);
+
 			if (!pWatchlistImpl->base.config.allowSuspectData
 					&& pRefreshMsg->state.dataState == RSSL_DATA_SUSPECT
 					&& pRefreshMsg->state.streamState == RSSL_STREAM_OPEN)
@@ -2423,7 +2543,7 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 								if (pItemStream->requestsRecovering.count)
 								{
 									/* Reset the stream since it is being freshly opened. */
-									wlItemStreamResetState(pItemStream);
+									wlItemStreamResetState(&pWatchlistImpl->base, pItemStream);
 
 									wlItemStreamSetMsgPending(&pWatchlistImpl->base, pItemStream, RSSL_TRUE);
 								}
@@ -2507,6 +2627,8 @@ static RsslRet wlFanoutItemMsgEvent(RsslWatchlistImpl *pWatchlistImpl, WlItemStr
 		{
 			RsslStatusMsg *pStatusMsg = &pRsslMsg->statusMsg;
 
+			wlItemStreamCacheMsg(&pWatchlistImpl->base, pItemStream, pRsslMsg);
+
 			if (pStatusMsg->flags & RSSL_STMF_HAS_GROUP_ID)
 				if ((ret = wlItemGroupAddStream(&pWatchlistImpl->items, &pRsslMsg->refreshMsg.groupId, pItemStream,
 								pErrorInfo))
@@ -2926,7 +3048,7 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 			default:
 			{
 
-				if ((pRequestLink = rsslHashTableFind(&pWatchlistImpl->base.requestsByStreamId, &streamId, NULL)))
+				if ((pRequestLink = rsslOpenHashTableFind(&pWatchlistImpl->base.requestsByStreamId, &streamId, NULL)))
 					pRequest = RSSL_HASH_LINK_TO_OBJECT(WlRequest, base.hlStreamId, pRequestLink);
 
 				switch (pOptions->pRsslMsg->msgBase.msgClass)
@@ -2939,6 +3061,8 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 						opts.pRequestMsg = (RsslRequestMsg*)pOptions->pRsslMsg;
 						opts.pServiceName = pOptions->pServiceName;
 						opts.pUserSpec = pOptions->pUserSpec;
+						opts.conflationInterval = pOptions->conflationInterval;
+						opts.conflationBypassUpdateTypes = pOptions->conflationBypassUpdateTypes;
 						opts.majorVersion = pOptions->majorVersion;
 						opts.minorVersion = pOptions->minorVersion;
 
@@ -3233,7 +3357,9 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 									|| domainType == RSSL_DMT_DICTIONARY)
 								continue;
 
+							/* Updates stop while paused, so the cached image goes stale. */
 							pStream->flags |= WL_IOSF_PAUSED;
+							wlItemStreamInvalidateCache(pStream);
 							if (pStream->requestsPausedCount != pStream->requestsStreamingCount)
 							{
 								/* Pause. */
@@ -3390,7 +3516,7 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 				RsslInt32 streamId = pDirectoryMsg->rdmMsgBase.streamId;
 				WlDirectoryRequest *pDirectoryRequest;
 
-				if ((pRequestLink = rsslHashTableFind(&pWatchlistImpl->base.requestsByStreamId, &streamId, NULL)))
+				if ((pRequestLink = rsslOpenHashTableFind(&pWatchlistImpl->base.requestsByStreamId, &streamId, NULL)))
 					pDirectoryRequest = RSSL_HASH_LINK_TO_OBJECT(WlDirectoryRequest, base.hlStreamId, pRequestLink);
 				else
 					pDirectoryRequest = NULL;
@@ -3515,7 +3641,22 @@ RsslRet rsslWatchlistSubmitMsg(RsslWatchlist *pWatchlist,
 										&pDirectoryRequest->qlRequestedService);
 							}
 
-							wlAddRequest(&pWatchlistImpl->base, &pDirectoryRequest->base);
+							if (wlAddRequest(&pWatchlistImpl->base, &pDirectoryRequest->base, pErrorInfo)
+									!= RSSL_RET_SUCCESS)
+							{
+								if (pDirectoryRequest->pRequestedService)
+								{
+									rsslQueueRemoveLink(&pDirectoryRequest->pRequestedService->directoryRequests,
+											&pDirectoryRequest->qlRequestedService);
+									wlRequestedServiceCheckRefCount(&pWatchlistImpl->base, 
+											pDirectoryRequest->pRequestedService);
+								}
+								else
+									rsslQueueRemoveLink(&pWatchlistImpl->directory.requests,
+											&pDirectoryRequest->qlRequestedService);
+								wlDirectoryRequestDestroy(pDirectoryRequest);
+								return pErrorInfo->rsslError.rsslErrorId;
+							}
 
 							pDirectoryRequest->base.pStateQueue = &pWatchlistImpl->base.newRequests;
 							rsslQueueAddLinkToBack(&pWatchlistImpl->base.newRequests, 
@@ -4025,7 +4166,8 @@ static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 				/* Setup request attributes(stream ID, domain, key). */
 				requestMsg.msgBase.streamId = pItemStream->base.streamId;
 				requestMsg.msgBase.domainType = pAttributes->domainType;
-				requestMsg.msgBase.msgKey = pAttributes->msgKey;
+				requestMsg.msgBase.msgKey = *wlItemKeyTableGetMsgKey(&pWatchlistImpl->base.itemKeys,
+						pAttributes->itemKey);
 				requestMsg.msgBase.containerType = RSSL_DT_NO_DATA;
 
 				if (pAttributes->qos.timeliness != RSSL_QOS_TIME_UNSPECIFIED)
@@ -4077,6 +4219,7 @@ static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 						{
 							sendMsg = RSSL_TRUE;
 							pItemStream->flags |= WL_IOSF_PAUSED;
+							wlItemStreamInvalidateCache(pItemStream);
 						}
 						requestMsg.flags |= RSSL_RQMF_PAUSE;
 					}
@@ -4174,6 +4317,7 @@ static RsslRet wlStreamSubmitMsg(RsslWatchlistImpl *pWatchlistImpl,
 						rsslQueueAppend(&pItemStream->requestsPendingRefresh,
 								&pItemStream->requestsRecovering);
 						pItemStream->refreshState = WL_ISRS_PENDING_REFRESH;
+						pItemStream->refreshRequestTime = pWatchlistImpl->base.currentTime;
 
 						if (!(requestMsg.flags & RSSL_RQMF_STREAMING))
 							pItemStream->flags |= WL_IOSF_PENDING_SNAPSHOT;
@@ -4474,7 +4618,7 @@ static RsslRet wlProcessItemBatchRequest(RsslWatchlistImpl *pWatchlistImpl,
 				}
 				else
 				{
-					if (rsslHashTableFind(&pWatchlistImpl->base.requestsByStreamId,
+					if (rsslOpenHashTableFind(&pWatchlistImpl->base.requestsByStreamId,
 								&requestMsg.msgBase.streamId, NULL))
 					{
 						rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_DATA, __FILE__, __LINE__, 
@@ -4552,7 +4696,7 @@ static RsslRet wlProcessItemBatchRequest(RsslWatchlistImpl *pWatchlistImpl,
 			for(; requestMsg.msgBase.streamId > pOrigRequestMsg->msgBase.streamId;
 				--requestMsg.msgBase.streamId)
 			{
-				if ((pHashLink = rsslHashTableFind(&pWatchlistImpl->base.requestsByStreamId,
+				if ((pHashLink = rsslOpenHashTableFind(&pWatchlistImpl->base.requestsByStreamId,
 								&requestMsg.msgBase.streamId, NULL)))
 				{
 					WlItemRequest *pItemRequest = RSSL_HASH_LINK_TO_OBJECT(WlItemRequest,
@@ -9,6 +9,7 @@
 #define RSSL_WATCHLIST_H
 
 #include "rtr/wlServiceCache.h"
+#include "rtr/wlSlab.h"
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslMessagePackage.h"
 
@@ -65,8 +66,10 @@ typedef enum
 	RSSLWL_STF_NEED_FLUSH		= 0x1,	/* The watchlist has written data to the channel and needs the 
 										 * channel to be flushed. */
 	RSSLWL_STF_NEED_TIMER		= 0x2,	/* The watchlist may have new timeouts. */
-	RSSLWL_STF_RESET_CONN_DELAY	= 0x4	/* The reactor should reset its reconnection time delay
+	RSSLWL_STF_RESET_CONN_DELAY	= 0x4,	/* The reactor should reset its reconnection time delay
 										 * (set when a login stream is established). */
+	RSSLWL_STF_NEED_DISPATCH	= 0x8	/* The watchlist has requests to send (e.g. released by a timer)
+										 * and should be dispatched. */
 } RsslWatchlistStateFlags;
 
 /* The current state of the watchlist.  The reactor may use this to determine when certain
@@ -87,6 +90,23 @@ RsslRet rsslWatchlistProcessTimer(RsslWatchlist *pWatchlist, RsslInt64 currentTi
  * gaps are detected in the transport. */
 void rsslWatchlistResetGapTimer(RsslWatchlist *pWatchlist);
 
+/* Progress of the watchlist's item refresh requests through its request pacer. */
+typedef struct
+{
+	RsslUInt32	requestsWaiting;		/* Requests waiting to be sent. */
+	RsslUInt64	requestsReleased;		/* Requests allowed to be sent. */
+	RsslUInt64	refreshesCompleted;		/* Requested refreshes completed. */
+	RsslUInt32	requestRate;			/* Current rate, in requests per second. */
+	RsslUInt32	averageRefreshLatency;	/* Average time to complete a refresh, in milliseconds. */
+} RsslWatchlistPacingStats;
+
+/* Retrieves the progress of item refresh requests through the request pacer. */
+void rsslWatchlistGetPacingStats(RsslWatchlist *pWatchlist, RsslWatchlistPacingStats *pStats);
+
+/* Retrieves the occupancy of each size class of the watchlist's slab allocator. pStats must have
+ * room for WL_SLAB_CLASS_COUNT + 1 entries. */
+void rsslWatchlistGetMemoryStats(RsslWatchlist *pWatchlist, WlSlabClassStats *pStats);
+
 /* Process FTGroup pings. */
 RsslInt64 rsslWatchlistProcessFTGroupPing(RsslWatchlist *pWatchlist, RsslUInt8 ftGroupId, 
 		RsslInt64 currentTime);
@@ -102,6 +122,11 @@ typedef struct
 	RsslUInt32					postAckTimeout;
 	RsslInt64					ticksPerMsec;
 	RsslInt32					loginRequestCount;
+	RsslBool					filterViewsPerRequest;
+	RsslUInt32					requestPacingRate;
+	RsslUInt32					requestPacingBurst;
+	RsslUInt32					requestPacingLatencyTarget;
+	RsslBool					cacheItemImages;
 } RsslWatchlistCreateOptions;
 
 /* Reactor-facing watchlist structure. */
@@ -146,6 +171,8 @@ typedef struct
 	RsslUInt32			viewElemCount;
 	void				*viewElemList;
 	void				*pUserSpec;
+	RsslUInt32			conflationInterval;
+	RsslUInt32			conflationBypassUpdateTypes;
 	RsslUInt32			majorVersion;
 	RsslUInt32			minorVersion;
 	RsslUInt8			*pFTGroupId;
@@ -110,6 +110,21 @@ static void wlSetGapTimer(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItem
 static void wlUnsetGapTimer(RsslWatchlistImpl *pWatchlistImpl, WlItemStream *pItemStream,
 		RsslUInt32 flag);
 
+/* Handles expiration of a stream's request timer. */
+static RsslRet wlProcessRequestTimeout(RsslWatchlistImpl *pWatchlistImpl, WlStream *pStream,
+		RsslErrorInfo *pErrorInfo);
+
+/* Handles expiration of an FTGroup's ping timer. */
+static RsslRet wlProcessFTGroupTimeout(RsslWatchlistImpl *pWatchlistImpl, WlFTGroup *pGroup,
+		RsslErrorInfo *pErrorInfo);
+
+/* Handles expiration of the gap timer. */
+static RsslRet wlProcessGapTimeout(RsslWatchlistImpl *pWatchlistImpl, RsslErrorInfo *pErrorInfo);
+
+/* Handles expiration of a post's acknowledgement timer. */
+static RsslRet wlProcessPostTimeout(RsslWatchlistImpl *pWatchlistImpl, WlPostRecord *pRecord,
+		RsslErrorInfo *pErrorInfo);
+
 #ifdef __cplusplus
 }
 #endif
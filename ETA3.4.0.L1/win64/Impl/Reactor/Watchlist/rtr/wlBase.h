@@ -13,10 +13,15 @@
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslErrorInfo.h"
 #include "rtr/rsslHashTable.h"
+#include "rtr/rsslOpenHashTable.h"
 #include "rtr/rsslReactorUtils.h"
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslTypes.h"
 #include "rtr/wlPostIdTable.h"
+#include "rtr/wlTimerWheel.h"
+#include "rtr/wlRequestPacer.h"
+#include "rtr/wlItemKey.h"
+#include "rtr/wlSlab.h"
 #include <assert.h>
 
 static const RsslInt64 WL_TIME_UNSET = 0x7fffffffffffffffLL;
@@ -28,9 +33,9 @@ static const RsslInt64 WL_TIME_UNSET = 0x7fffffffffffffffLL;
 extern "C" {
 #endif
 
-/* Creates a copy of an RsslRDMMsg. */
-RsslRDMMsg *wlCreateRdmMsgCopy(RsslRDMMsg *pRdmMsg, RsslBuffer *pMemoryBuffer, 
-		RsslErrorInfo *pErrorInfo);
+/* Creates a copy of an RsslRDMMsg, allocated from a slab allocator. */
+RsslRDMMsg *wlCreateRdmMsgCopy(WlSlabAllocator *pSlab, RsslRDMMsg *pRdmMsg, 
+		RsslBuffer *pMemoryBuffer, RsslErrorInfo *pErrorInfo);
 
 typedef struct WlStreamBase WlStreamBase;
 
@@ -42,10 +47,12 @@ static const RsslInt32 MAX_STREAM_ID = 0x7fffffff;
 /* Attributes that uniquely identify a stream. */
 typedef struct 
 {
-	RsslBool 	hasQos;
-	RsslUInt8	domainType;
-	RsslMsgKey	msgKey;
-	RsslQos		qos;
+	RsslBool 		hasQos;
+	RsslUInt8		domainType;
+	WlItemKeyHandle	itemKey;		/* Interned message key, from WlBase::itemKeys. */
+	RsslUInt32		keyHashSum;		/* rsslMsgKeyHash() of the key.  Streams are hashed by this, since it is
+									 * also the multicast hash ID registered for them. */
+	RsslQos			qos;
 } WlStreamAttributes;
 
 /* Hash sum function for stream attributes. */
@@ -91,10 +98,9 @@ struct WlStreamBase
 	RsslHashLink	hlStreamId;
 	RsslQueueLink	qlStreamsList;
 	RsslQueueLink	qlStreamsPendingRequest;
-	RsslQueueLink	qlStreamsPendingResponse;
+	WlTimer			requestTimer;				/* Times out the request while awaiting a response. */
 	RsslInt32		streamId;
 	RsslUInt8		domainType;
-	RsslInt64		requestExpireTime;			/* Time at which the request is considered timed out. */
 	RsslBool		isClosing;
 	RsslBool		tempStream;
 	RsslUInt8		requestState;
@@ -104,6 +110,7 @@ struct WlStreamBase
 RTR_C_INLINE void wlStreamBaseInit(WlStreamBase *pBase, RsslInt32 streamId, RsslUInt8 domainType)
 {
 	memset(pBase, 0, sizeof(WlStreamBase));
+	wlTimerInit(&pBase->requestTimer, WL_TMT_REQUEST);
 	pBase->streamId = streamId;
 	pBase->domainType = domainType;
 }
@@ -118,6 +125,8 @@ typedef struct
 	RsslWatchlistMsgCallback	*msgCallback;					/* Callback the watchlist should use to forward messages. */
 	RsslBool					obeyOpenWindow;					/* Whether the watchlist obeys a service's OpenWindow. */
 	RsslUInt32					requestTimeout;					/* Request timeout, in milliseconds. */
+	RsslBool					filterViewsPerRequest;			/* Whether updates are filtered to each request's own view. */
+	RsslBool					cacheItemImages;				/* Whether joining requests are refreshed from cached item images. */
 } WlConfig;
 
 /* Represents the state of the current channel session. */
@@ -138,7 +147,7 @@ typedef struct WlBase
 	RsslWatchlist		watchlist;				/* Watchlist reference used by the reactor. */
 	WlConfig			config;					/* Configuration options. */
 	RsslQueue			openStreams;			/* List of currently open streams. */
-	RsslHashTable		openStreamsByAttrib;	/* Table of open streams, by WlStreamAttributes. */
+	RsslOpenHashTable	openStreamsByAttrib;	/* Table of open streams, by WlStreamAttributes. */
 	RsslQueue			newRequests;			/* Recently-submitted requests. */
 	RsslQueue			requestedServices;		/* List of requested services. */
 	RsslHashTable		requestedSvcByName;		/* Table of requested service names. */
@@ -146,15 +155,14 @@ typedef struct WlBase
 	RsslBuffer			tempDecodeBuffer;		/* Reusable decoding buffer. */
 	RsslBuffer			tempEncodeBuffer;		/* Reusable encoding buffer. */
 	RsslBuffer			tempFanoutBuffer;		/* Reusable fanout buffer. */
-	RsslHashTable		streamsById;			/* Table of open streams, by Stream ID. */
-	RsslHashTable		requestsByStreamId;		/* Table of requests, by stream ID. */
+	RsslOpenHashTable	streamsById;			/* Table of open streams, by Stream ID. */
+	RsslOpenHashTable	requestsByStreamId;		/* Table of requests, by stream ID. */
 	RsslUInt32			channelMaxFragmentSize;	/* Channel's maxFragmentSize. */
 	WlChannelState		channelState;			/* Channel state. */
 	RsslChannel			*pRsslChannel;			/* Current channel, if any. */
 	RsslBuffer			*pWriteCallAgainBuffer;	/* Used to handle RSSL_RET_WRITE_CALL_AGAIN codes from rsslWrite. */
 	WlServiceCache		*pServiceCache;			/* Serivce cache. */
 	RsslQueue			streamsPendingRequest;	/* Streams that need to send a request. */
-	RsslQueue			streamsPendingResponse;	/* Streams opened but waiting for a response. */
 	RsslMemoryPool		requestPool;			/* Pool of WlRequest structures. */
 	RsslMemoryPool		streamPool;				/* Pool of WlStream structures. */
 	RsslInt64			currentTime;			/* Latest timestamp set by caller, in milliseconds. */
@@ -167,6 +175,10 @@ typedef struct WlBase
 	WlPostTable			postTable;				/* Table of posts waiting for acknowledgement. */
 	RsslUInt32 			maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32 			postAckTimeout;			/* Timeout for acks of posts. */
+	WlTimerWheel		timerWheel;				/* Timers for request, FTGroup, gap and post timeouts. */
+	WlItemKeyTable		itemKeys;				/* Message keys of item requests and streams. */
+	WlRequestPacer		requestPacer;			/* Limits the rate of item refresh requests. */
+	WlSlabAllocator		slab;					/* Views, buffered messages and message copies. */
 } WlBase;
 
 /* Options for initializing the base structure. */
@@ -183,6 +195,11 @@ typedef struct
 	RsslInt64						ticksPerMsec;			/* Ticks per millisecond. Used when getting current time (windows only) */
 	RsslUInt32						maxOutstandingPosts;	/* Acknowledgement pool limit. */
 	RsslUInt32						postAckTimeout;			/* Timeout for acks of onstream posts. */
+	RsslBool						filterViewsPerRequest;	/* Whether updates are filtered to each request's own view. */
+	RsslUInt32						requestPacingRate;		/* Maximum item refresh requests per second (0 to not limit). */
+	RsslUInt32						requestPacingBurst;		/* Item refresh requests that may be sent at once. */
+	RsslUInt32						requestPacingLatencyTarget;	/* Refresh latency, in milliseconds, above which the rate is reduced. */
+	RsslBool						cacheItemImages;		/* Whether joining requests are refreshed from cached item images. */
 } WlBaseInitOptions;
 
 /* Initializes a WlBase structure. */
@@ -192,7 +209,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 void wlBaseCleanup(WlBase *pBase);
 
 /* Adds a request to the watchlist. */
-void wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase);
+RsslRet wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase, RsslErrorInfo *pErrorInfo);
 
 /* Removes a request from the watchlist. */
 void wlRemoveRequest(WlBase *pBase, WlRequestBase *pRequestBase);
@@ -0,0 +1,96 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#ifndef WL_FIELD_IMAGE_H
+#define WL_FIELD_IMAGE_H
+
+#include "rtr/rsslIterators.h"
+#include "rtr/rsslErrorInfo.h"
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Latest-value image of an RsslFieldList.
+ *
+ * Field lists merged into the image replace the values of fields it already has and add
+ * any new fields after them, so the image holds the most recent value of every field in the
+ * order the fields were first seen.  Values are kept in their encoded form and are never
+ * decoded.  A value that fits in the space of the one it replaces is written over it;
+ * otherwise it is appended, and the space of the old value is reclaimed when the value
+ * buffer next needs to grow.
+ *
+ * Fields are found through an open-addressed index of field positions, keyed by field ID. */
+
+/* Marks a field removed from the image. */
+#define WL_FIELD_IMAGE_REMOVED 0xffffffff
+
+typedef struct
+{
+	RsslFieldId		fieldId;
+	RsslUInt32		offset;		/* Offset of the encoded value in WlFieldImage::values, or
+								 * WL_FIELD_IMAGE_REMOVED. */
+	RsslUInt32		length;		/* Length of the encoded value. */
+} WlImageField;
+
+typedef struct
+{
+	RsslUInt8		fieldListFlags;		/* RSSL_FLF_HAS_FIELD_LIST_INFO, if present on the latest list. */
+	RsslInt16		dictionaryId;		/* Dictionary ID from the latest list. */
+	RsslInt16		fieldListNum;		/* Field list number from the latest list. */
+	WlImageField	*fields;			/* Fields, in the order they were first seen. */
+	RsslUInt32		fieldCount;			/* Fields in use, including removed ones. */
+	RsslUInt32		fieldCapacity;		/* Fields allocated. */
+	RsslUInt32		liveFieldCount;		/* Fields not removed. */
+	RsslUInt32		*index;				/* Position + 1 of each field, by field ID; 0 if unused. */
+	RsslUInt32		indexBits;			/* The index has (1 << indexBits) slots. */
+	char			*values;			/* Encoded values. */
+	RsslUInt32		valuesLength;		/* Bytes used in values, including replaced values. */
+	RsslUInt32		valuesCapacity;		/* Bytes allocated for values. */
+	RsslUInt32		liveLength;			/* Bytes used by the current values. */
+} WlFieldImage;
+
+/* Initializes a field image. */
+void wlFieldImageInit(WlFieldImage *pImage);
+
+/* Frees memory held by a field image. */
+void wlFieldImageCleanup(WlFieldImage *pImage);
+
+/* Removes all fields from the image. Its memory is kept for reuse. */
+void wlFieldImageClear(WlFieldImage *pImage);
+
+/* Whether the image has no fields. */
+RTR_C_INLINE RsslBool wlFieldImageIsEmpty(WlFieldImage *pImage)
+{
+	return pImage->liveFieldCount == 0;
+}
+
+/* Merges an encoded RsslFieldList into the image.
+ * Returns RSSL_RET_UNSUPPORTED_DATA_TYPE, leaving the image unchanged, if the list contains
+ * set-defined data. */
+RsslRet wlFieldImageMerge(WlFieldImage *pImage, RsslBuffer *pEncFieldList, RsslUInt8 majorVersion,
+		RsslUInt8 minorVersion, RsslErrorInfo *pErrorInfo);
+
+/* Removes the fields present in an encoded RsslFieldList from the image, e.g. because
+ * newer values of them were delivered separately.
+ * Returns RSSL_RET_UNSUPPORTED_DATA_TYPE, leaving the image unchanged, if the list contains
+ * set-defined data. */
+RsslRet wlFieldImageRemoveFields(WlFieldImage *pImage, RsslBuffer *pEncFieldList,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion);
+
+/* Returns the maximum length of the image when encoded as an RsslFieldList. */
+RsslUInt32 wlFieldImageEstimateEncodedLength(WlFieldImage *pImage);
+
+/* Encodes the image as an RsslFieldList. */
+RsslRet wlFieldImageEncode(WlFieldImage *pImage, RsslEncodeIterator *pIter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
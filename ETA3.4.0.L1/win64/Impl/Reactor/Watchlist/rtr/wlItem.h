@@ -10,6 +10,7 @@
 
 #include "rtr/wlBase.h"
 #include "rtr/wlView.h" 
+#include "rtr/wlFieldImage.h"
 #include "rtr/rsslRequestMsg.h"
 #include "rtr/wlService.h"
 #include "rtr/wlMsgReorderQueue.h"
@@ -36,7 +37,9 @@ typedef enum
 												 * but currently in excess of service OpenWindow. */
 	WL_ISRS_REQUEST_REFRESH				= 2,	/* Need to request a refresh. */
 	WL_ISRS_PENDING_REFRESH				= 3,	/* Currently waiting for a refresh .*/
-	WL_ISRS_PENDING_REFRESH_COMPLETE	= 4		/* Recevied partial refresh, need the rest. */
+	WL_ISRS_PENDING_REFRESH_COMPLETE	= 4,	/* Recevied partial refresh, need the rest. */
+	WL_ISRS_PENDING_PACING				= 5		/* Need to request a refresh,
+												 * but waiting for the request pacer. */
 } WlItemStreamRefreshState;
 
 /* Indicates current status of the stream. */
@@ -61,6 +64,26 @@ typedef enum
 	WL_IOSF_QUALIFIED					= 0x8000	/* Stream is qualified. */
 } WlItemStreamFlags;
 
+/* Indicates the state of a stream's cached image. */
+typedef enum
+{
+	WL_ICF_NONE			= 0x0,
+	WL_ICF_IN_REFRESH	= 0x1,	/* Image is being built from a multi-part refresh. */
+	WL_ICF_COMPLETE		= 0x2,	/* Image holds a complete, OK refresh and every update since. */
+	WL_ICF_HAS_QOS		= 0x4	/* WlItemCache::qos is present. */
+} WlItemCacheFlags;
+
+/* Latest image of a stream's field list payload, used to refresh requests that join the
+ * stream without requesting a new refresh from the provider. */
+typedef struct
+{
+	RsslUInt8		flags;			/* WlItemCacheFlags. */
+	RsslQos			qos;			/* QoS from the latest refresh. */
+	RsslBuffer		groupId;		/* Group ID from the latest refresh. */
+	RsslBuffer		permData;		/* Latest permission data, if any. */
+	WlFieldImage	image;			/* Latest value of every field. */
+} WlItemCache;
+
 /* Maintains information about a stream open on the network. */
 struct WlItemStream
 {
@@ -76,6 +99,8 @@ struct WlItemStream
 	WlStreamAttributes	streamAttributes;			/* Stream attributes. */
 	RsslUInt8			priorityClass;				/* Stream's current priority class. */
 	RsslUInt16			priorityCount;				/* Stream's current priority count. */
+	RsslUInt8			pacingLevel;				/* Request pacer level the stream waits at, if WL_ISRS_PENDING_PACING. */
+	RsslInt64			refreshRequestTime;			/* Time at which the pending refresh was requested. */
 	RsslQueue			requestsRecovering;			/* Requests waiting to send a request message. */
 	RsslQueue			requestsPendingRefresh;		/* Requests waiting for a refresh. */
 	RsslQueue			requestsOpen;				/* Requests that have received their complete refresh. */
@@ -86,30 +111,38 @@ struct WlItemStream
 	WlFTGroup			*pFTGroup;					/* FTGroup associated with this stream. */
 	WlAggregateView		*pAggregateView;			/* The stream's view, aggregated from requests. */
 	WlService			*pWlService;				/* Service associated with this stream. */
-	char				*msgKeyMemoryBuffer;		/* Memory for the stream's message key. */
 	RsslUInt32			seqNum;						/* Sequence number (meaning is determined by WL_IOSF_HAS_UC_SEQ_NUM and WL_IOSF_HAS_BC_SEQ_NUM) */
 	RsslUInt32			bcSynchSeqNum;				/* Sequence number of the last broadcast message used for synchronization. */
 	RsslUInt16			nextPartNum;				/* Next expected refresh partNum. */
 	WlMsgReorderQueue	bufferedMsgQueue;           /* Multicast message synch queue. */
 	WlItemRequest		*pRequestWithExtraInfo;		/* If present, use the extendedHeader and
 													 * encDataBody, if any, from this request. */
+	WlItemCache			*pCache;					/* Cached image, if item images are cached. */
 };
 
-/* Initializes an item stream. */
+/* Initializes an item stream. The stream takes over the reference to the key
+ * held by pStreamAttributes. */
 RsslRet wlItemStreamInit(WlItemStream *pItemStream, WlStreamAttributes *pStreamAttributes,
 		RsslInt32 streamId, RsslErrorInfo *pErrorInfo);
 
 /* Resets a stream to its initial state (generally used when transitioning a stream
  * from non-streaming to streaming). */
-void wlItemStreamResetState(WlItemStream *pItemStream);
+void wlItemStreamResetState(WlBase *pBase, WlItemStream *pItemStream);
 
 
-/* Creates an item stream. */
+/* Creates an item stream. The stream takes over the reference to the key
+ * held by pStreamAttributes. */
 WlItemStream *wlCreateItemStream(WlBase *pBase, WlStreamAttributes *pStreamAttributes, RsslErrorInfo *pErrorInfo);
 
 /* Destroys an item stream. */
 void wlItemStreamDestroy(WlBase *pBase, WlItemStream *pItemStream);
 
+/* Applies a message received on a stream to its cached image, if any. */
+void wlItemStreamCacheMsg(WlBase *pBase, WlItemStream *pItemStream, RsslMsg *pRsslMsg);
+
+/* Discards a stream's cached image, e.g. because messages will be missed. */
+void wlItemStreamInvalidateCache(WlItemStream *pItemStream);
+
 /* Aggregates priority from stream's requests. */
 RsslBool wlItemStreamMergePriority(WlItemStream *pItemStream, RsslUInt8 *pPriorityClass,
 		RsslUInt16 *pPriorityCount);
@@ -128,6 +161,23 @@ typedef enum
 	WL_IRQF_QUALIFIED		= 0x40	/* Request is for a qualified stream. */
 } WlItemRequestFlags;
 
+/* Conflation state of a request that limits how often it receives updates.
+ * The first update after an interval has passed is delivered immediately. Updates arriving
+ * before the next interval are merged into a latest-value image, which is delivered as one
+ * update when the timer expires. */
+typedef struct
+{
+	WlTimer			timer;					/* Expires when the conflated update is due. */
+	WlItemRequest	*pItemRequest;			/* Request being conflated. */
+	RsslUInt32		interval;				/* Minimum time between updates, in milliseconds. */
+	RsslUInt32		bypassUpdateTypes;		/* Update types not conflated, as (1 << updateType). */
+	RsslInt64		nextUpdateTime;			/* Earliest time the next update may be delivered. */
+	RsslUInt32		updateCount;			/* Updates merged into the image. */
+	RsslUInt8		updateType;				/* Update type of the latest merged update. */
+	WlFieldImage	image;					/* Latest values of the merged updates. */
+	RsslBuffer		encodeBuffer;			/* Memory for encoding the conflated update. */
+} WlItemConflation;
+
 struct WlItemRequest
 {
 	WlRequestBase			base;
@@ -136,7 +186,7 @@ struct WlItemRequest
 	RsslQueueLink			qlRequestedService;
 	RsslUInt16				flags;					/* WlItemRequestFlags */
 	RsslUInt16				requestMsgFlags;		/* RsslRequestFlags */
-	RsslMsgKey				msgKey;					/* Key associated with this request. */
+	WlItemKeyHandle			itemKey;				/* Key associated with this request, from WlBase::itemKeys. */
 	WlRequestedService		*pRequestedService;		/* Service criteria of this request. */
 	RsslUInt8				containerType;			/* Container type of the request. */
 	RsslUInt8				priorityClass;			/* Priority class of this request. */
@@ -144,10 +194,10 @@ struct WlItemRequest
 	RsslQos					qos;					/* Qos of this request, if any. */
 	RsslQos					worstQos;				/* Worst Qos of this request, if any. */
 	RsslQos					staticQos;				/* Static QoS, if established. */
-	char					*msgKeyMemoryBuffer;	/* MsgKey memory. */
 	WlView					*pView;					/* View set by this request. */
 	RsslBuffer				encDataBody;			/* Encoded dataBody. */
 	RsslBuffer				extendedHeader;			/* Extended header, if any. */
+	WlItemConflation		*pConflation;			/* Conflation state, if the request is conflated. */
 };
 
 /* Closes an item request. */
@@ -164,15 +214,11 @@ const RsslQos *wlItemRequestMatchQos(WlItemRequest *pItemRequest, RsslQos *qosLi
  * established(i.e. the item has requested on a given QoS and received a refresh). */
 void wlItemRequestEstablishQos(WlItemRequest *pItemRequest, RsslQos *pQos);
 
-/* Creates a copy of the given MsgKey. */
-RsslRet wlItemCopyKey(RsslMsgKey *pNewMsgKey, RsslMsgKey *pOldMsgKey, char **pMemoryBuffer,
-		RsslErrorInfo *pErrorInfo);
-
 RsslUInt32 wlProviderRequestHashSum(void *pKey);
 
 /* Adds the view of a request to a stream. */
-RsslRet wlItemStreamAddRequestView(WlItemStream *pItemStream, WlItemRequest *pItemRequest, 
-		RsslErrorInfo *pErrorInfo);
+RsslRet wlItemStreamAddRequestView(WlBase *pBase, WlItemStream *pItemStream, 
+		WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
 
 /* Removes the view of a request from a stream. */
 void wlItemStreamRemoveRequestView(WlItemStream *pItemStream, WlItemRequest *pItemRequest);
@@ -213,11 +259,10 @@ void wlItemGroupRemove(WlItemGroup *pItemGroup);
 /* Represents a fault-tolerant multicast group. */
 struct WlFTGroup
 {
-	RsslQueueLink	qlGroups;			/* Group list list. */
+	WlTimer			timer;				/* Expires if no ping is received for this group
+										 * in time. */
 	RsslUInt8		ftGroupId;			/* FTGroup ID. */
 	RsslQueue		openStreamList;		/* List of streams provided by this group. */
-	RsslInt64		expireTime;			/* Next time before which we should receive a ping for
-										 * this group. */
 };
 
 /* Adds an item stream to an FTGroup. Creates the FTGroup if it does not exist. */
@@ -225,10 +270,10 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 		WlItemStream *pItemStream, RsslErrorInfo *pErrorInfo);
 
 /* Removes an item stream from an FTGroup. Destroys the FTGroup if it is emptied. */
-void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream);
+void wlFTGroupRemoveStream(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream);
 
 /* Removes an FTGroup from the table of groups and destroys it (used during general cleanup). */
-void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup);
+void wlFTGroupRemove(WlBase *pBase, WlItems *pItems, WlFTGroup *pGroup);
 
 
 /* Handles item requests. */
@@ -238,15 +283,14 @@ struct WlItems
 	RsslHashTable	providerRequestsByAttrib;	/* Provider-driven streams. */
 	WlFTGroup*		ftGroupTable[WL_FTGROUP_TABLE_SIZE];
 												/* FTGroup table. */
-	RsslQueue		ftGroupTimerQueue;			/* FTGroup list. Should be ordered
-												 * by each group's expireTime. */
 	RsslQueue		gapStreamQueue;				/* Streams that have detected a gap. */
-	RsslInt64		gapExpireTime;				/* Time at which streams begin any recovery from
+	WlTimer			gapTimer;					/* Expires when streams begin any recovery from
 												 * gaps. */
 	WlItemStream	*pCurrentFanoutStream;		/* Used to detect a close of the current stream while
 												 * fanning out. */
 	WlItemGroup		*pCurrentFanoutGroup;
 	WlFTGroup		*pCurrentFanoutFTGroup;
+	WlViewFilterCache	viewFilterCache;		/* Update payloads filtered to request views. */
 };
 
 /* Initializes the WlItems structure. */
@@ -272,6 +316,8 @@ typedef struct
 	void*			viewElemList;
 	RsslUInt32		viewElemCount;
 	void			*pUserSpec;
+	RsslUInt32		conflationInterval;
+	RsslUInt32		conflationBypassUpdateTypes;
 	RsslUInt		slDataStreamFlags;
 	RsslUInt32		majorVersion;
 	RsslUInt32		minorVersion;
@@ -292,7 +338,7 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 		RsslErrorInfo *pErrorInfo);
 
 /* Cleans up an item request. */
-RsslRet wlItemRequestCleanup(WlItemRequest *pItemRequest);
+RsslRet wlItemRequestCleanup(WlBase *pBase, WlItemRequest *pItemRequest);
 
 /* Reissues an item request. */
 RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pItemRequest,
@@ -314,10 +360,15 @@ void wlItemStreamRemoveRequest(WlItemStream *pItemStream, WlItemRequest *pItemRe
 RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream,
 		RsslErrorInfo *pErrorInfo);
 
-/* Sends a message to an item request. */
+/* Sends a message to an item request. If the request is conflated, an update may instead be
+ * held for delivery when its conflation timer expires. */
 RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
 
+/* Delivers the conflated update of a request when its conflation timer expires. */
+RsslRet wlItemRequestProcessConflationTimer(WlBase *pBase, WlItemConflation *pConflation,
+		RsslErrorInfo *pErrorInfo);
+
 /* Creates a message event and sends it to an item request. */
 RsslRet wlItemRequestSendMsg(WlBase *pBase,
 		WlItemRequest *pItemRequest, RsslMsg *pRsslMsg, RsslErrorInfo *pErrorInfo);
@@ -328,6 +379,9 @@ void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBoo
 /* Removes an item stream from the message pending queue. */
 void wlItemStreamUnsetMsgPending(WlBase *pBase, WlItemStream *pItemStream);
 
+/* Requests refreshes for the waiting item streams that the request pacer now allows. */
+void wlItemStreamProcessPacing(WlBase *pBase);
+
 /* Checks if requests can be made due to room in a service's OpenWindow. */
 void wlItemStreamCheckOpenWindow(WlBase *pBase, WlService *pWlService);
 
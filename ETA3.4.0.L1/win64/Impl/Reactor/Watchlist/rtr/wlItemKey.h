@@ -0,0 +1,109 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#ifndef WL_ITEM_KEY_H
+#define WL_ITEM_KEY_H
+
+#include "rtr/rsslMsgKey.h"
+#include "rtr/rsslErrorInfo.h"
+#include "rtr/rsslOpenHashTable.h"
+#include "rtr/rsslTypes.h"
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Table of interned item keys.
+ *
+ * Each distinct message key (service ID, name type, name, filter, identifier and attrib) used by
+ * item requests and streams is stored once, and requests and streams refer to it by a 32-bit
+ * handle.  Keys that rsslCompareMsgKeys() considers equal get the same handle, so two keys can
+ * be matched by comparing handles.  Keys are reference-counted and removed when the last
+ * reference is released; their handles are then reused.
+ *
+ * Keys are allocated from an arena of large chunks, in blocks rounded up to
+ * WL_ITEM_KEY_BLOCK_ALIGN bytes.  Released blocks are kept on a free list for their size and
+ * reused by later keys of the same size.  Keys too large for a size class are allocated
+ * individually. */
+
+#define WL_ITEM_KEY_BLOCK_ALIGN		8
+#define WL_ITEM_KEY_BLOCK_CLASSES	64			/* Largest block from the arena is WL_ITEM_KEY_BLOCK_ALIGN * WL_ITEM_KEY_BLOCK_CLASSES bytes. */
+#define WL_ITEM_KEY_CHUNK_SIZE		(64 * 1024)
+
+/* Handle of an interned key. */
+typedef RsslUInt32 WlItemKeyHandle;
+
+/* Not a key. */
+#define WL_ITEM_KEY_NONE 0
+
+/* An interned key.  Its name and attrib are stored after it, in the same block. */
+typedef struct
+{
+	RsslHashLink	hlTable;		/* Link for WlItemKeyTable::keysByMsgKey. */
+	RsslMsgKey		msgKey;			/* The key. */
+	RsslUInt32		refCount;		/* Number of requests and streams using the key. */
+	WlItemKeyHandle	handle;			/* Handle of the key. */
+} WlItemKey;
+
+typedef struct
+{
+	RsslOpenHashTable	keysByMsgKey;	/* Keys, by message key. */
+	WlItemKey			**keys;			/* Keys, by handle.  NULL if the handle is free.  Entry 0 is not used. */
+	WlItemKeyHandle		*freeHandles;	/* Handles below nextHandle that are free, to be reused. */
+	RsslUInt32			freeHandleCount;
+	RsslUInt32			handleCapacity;	/* Size of the keys and freeHandles arrays. */
+	WlItemKeyHandle		nextHandle;		/* Handles from this one up have not been used. */
+	RsslUInt32			keyCount;		/* Number of keys in the table. */
+	char				*pChunkList;	/* Arena chunks; each starts with a pointer to the previous one. */
+	char				*pChunkPos;		/* Free space in the current chunk. */
+	RsslUInt32			chunkRemaining;	/* Bytes of free space in the current chunk. */
+	void				*freeBlocks[WL_ITEM_KEY_BLOCK_CLASSES]; /* Released blocks, by size class.
+																 * Each starts with a pointer to the next. */
+} WlItemKeyTable;
+
+/* Initializes a key table. */
+RsslRet wlItemKeyTableInit(WlItemKeyTable *pTable, RsslErrorInfo *pErrorInfo);
+
+/* Cleans up a key table, releasing all keys. */
+void wlItemKeyTableCleanup(WlItemKeyTable *pTable);
+
+/* Finds or adds a key, and adds a reference to it.  Returns WL_ITEM_KEY_NONE if memory could
+ * not be allocated. */
+WlItemKeyHandle wlItemKeyTableIntern(WlItemKeyTable *pTable, const RsslMsgKey *pMsgKey,
+		RsslErrorInfo *pErrorInfo);
+
+/* Finds a key without adding a reference.  Returns WL_ITEM_KEY_NONE if the key is not in the table. */
+WlItemKeyHandle wlItemKeyTableFind(WlItemKeyTable *pTable, const RsslMsgKey *pMsgKey);
+
+/* Releases a reference to a key, removing it if it was the last. */
+void wlItemKeyTableRelease(WlItemKeyTable *pTable, WlItemKeyHandle handle);
+
+/* Gets an interned key. */
+RTR_C_INLINE WlItemKey *wlItemKeyTableGet(WlItemKeyTable *pTable, WlItemKeyHandle handle)
+{
+	assert(handle != WL_ITEM_KEY_NONE && handle < pTable->nextHandle && pTable->keys[handle]);
+	return pTable->keys[handle];
+}
+
+/* Gets the message key of an interned key.  The key must not be changed. */
+RTR_C_INLINE RsslMsgKey *wlItemKeyTableGetMsgKey(WlItemKeyTable *pTable, WlItemKeyHandle handle)
+{
+	return &wlItemKeyTableGet(pTable, handle)->msgKey;
+}
+
+/* Adds a reference to a key. */
+RTR_C_INLINE void wlItemKeyTableAddRef(WlItemKeyTable *pTable, WlItemKeyHandle handle)
+{
+	++wlItemKeyTableGet(pTable, handle)->refCount;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
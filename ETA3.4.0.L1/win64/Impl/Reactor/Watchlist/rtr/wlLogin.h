@@ -38,8 +38,8 @@ typedef struct
 } WlLoginRequest;
 
 /* Creates a login request. */
-WlLoginRequest *wlLoginRequestCreate(RsslRDMLoginRequest *pLoginReqMsg, void *pUserSpec,
-		RsslErrorInfo *pErrorInfo);
+WlLoginRequest *wlLoginRequestCreate(WlBase *pBase, RsslRDMLoginRequest *pLoginReqMsg, 
+		void *pUserSpec, RsslErrorInfo *pErrorInfo);
 
 /* Destroys a login request. */
 void wlLoginRequestDestroy(WlBase *pBase, WlLoginRequest *pLoginRequest);
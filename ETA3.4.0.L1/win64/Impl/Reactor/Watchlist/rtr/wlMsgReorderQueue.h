@@ -47,9 +47,10 @@ typedef struct
 void wlMsgReorderQueueInit(WlMsgReorderQueue *pQueue);
 
 /* Cleans up a WlMsgReorderQueue. */
-void wlMsgReorderQueueCleanup(WlMsgReorderQueue *pQueue);
+void wlMsgReorderQueueCleanup(WlMsgReorderQueue *pQueue, WlBase *pBase);
 
-/* Adds a message to the queue. */
+/* Adds a message to the queue. The copy of the message is allocated from the base's slab 
+ * allocator. */
 RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 		RsslUInt32 seqNum, RsslUInt8 *pFTGroupId, WlBase *pBase, RsslErrorInfo *pErrorInfo);
 
@@ -62,12 +63,13 @@ WlBufferedMsg *wlMsgReorderQueuePop(WlMsgReorderQueue *pQueue);
 WlBufferedMsg *wlMsgReorderQueuePopUntil(WlMsgReorderQueue *pQueue, RsslUInt32 seqNum);
 
 /* Discard all messages up to and including the given sequence number. */
-RTR_C_INLINE void wlMsgReorderQueueDiscardUntil(WlMsgReorderQueue *pQueue, RsslUInt32 seqNum);
+RTR_C_INLINE void wlMsgReorderQueueDiscardUntil(WlMsgReorderQueue *pQueue, RsslUInt32 seqNum,
+		WlBase *pBase);
 
 /* Checks for gaps in broadcast queue. pSeqNum should be set to the currently needed sequence number.
  * Returns nonzero value if pSeqNum and pHasGap have been set. */
 RsslUInt32 wlMsgReorderQueueCheckBroadcastSequence(WlMsgReorderQueue *pQueue, RsslUInt32 *pSeqNum,
-		RsslBool *pHasGap);
+		RsslBool *pHasGap, WlBase *pBase);
 
 /* Retrieves the sequence number of the last message in the broadcast queue. */
 RsslBool wlMsgReorderQueueGetLastBcSeqNum(WlMsgReorderQueue *pQueue, RsslUInt32 *pSeqNum);
@@ -79,10 +81,10 @@ RTR_C_INLINE RsslBool wlMsgReorderQueueHasUnicastMsgs(WlMsgReorderQueue *pQueue)
 RTR_C_INLINE RsslMsg *wlBufferedMsgGetRsslMsg(WlBufferedMsg *pBufferedMsg);
 
 /* Cleans up a message that was popped from the queue. */
-void wlBufferedMsgDestroy(WlBufferedMsg *pBufferedMsg);
+void wlBufferedMsgDestroy(WlBase *pBase, WlBufferedMsg *pBufferedMsg);
 
 /* Deletes all messages from the queue. */
-void wlMsgReorderQueueDiscardAllMessages(WlMsgReorderQueue *pQueue);
+void wlMsgReorderQueueDiscardAllMessages(WlMsgReorderQueue *pQueue, WlBase *pBase);
 
 /* Gets the RsslMsg stored in the WlBufferedMsg. */
 RTR_C_INLINE RsslMsg *wlBufferedMsgGetRsslMsg(WlBufferedMsg *pBufferedMsg)
@@ -90,11 +92,12 @@ RTR_C_INLINE RsslMsg *wlBufferedMsgGetRsslMsg(WlBufferedMsg *pBufferedMsg)
 	return (RsslMsg*)((char*)pBufferedMsg + sizeof(WlBufferedMsg));
 }
 
-RTR_C_INLINE void wlMsgReorderQueueDiscardUntil(WlMsgReorderQueue *pQueue, RsslUInt32 seqNum)
+RTR_C_INLINE void wlMsgReorderQueueDiscardUntil(WlMsgReorderQueue *pQueue, RsslUInt32 seqNum,
+		WlBase *pBase)
 {
 	WlBufferedMsg *pMsg;
 	while (pMsg = wlMsgReorderQueuePopUntil(pQueue, seqNum))
-		wlBufferedMsgDestroy(pMsg);
+		wlBufferedMsgDestroy(pBase, pMsg);
 }
 
 RTR_C_INLINE RsslBool wlMsgReorderQueueHasUnicastMsgs(WlMsgReorderQueue *pQueue)
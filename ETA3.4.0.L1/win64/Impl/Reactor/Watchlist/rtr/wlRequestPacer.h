@@ -0,0 +1,96 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#ifndef WL_REQUEST_PACER_H
+#define WL_REQUEST_PACER_H
+
+#include "rtr/wlTimerWheel.h"
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Token bucket that limits the rate at which the watchlist requests refreshes, so that
+ * re-requesting every item after a reconnection does not flood the provider.
+ *
+ * Each refresh request takes one token.  Tokens are added at the current rate, in requests per
+ * second, up to the burst size.  Requests that find no token wait in a queue for their priority
+ * level and are released highest priority first, oldest first within a level, as tokens are
+ * added.
+ *
+ * If a latency target is set, the rate adapts to the time providers take to complete the
+ * refreshes: while the average latency is above the target the rate is halved (to no less than
+ * 1/64 of the maximum) once per adjustment interval, and while it is below, the rate is raised
+ * by 1/16 of the maximum, up to the maximum. */
+
+/* Number of priority levels. Requests of priority class WL_REQUEST_PACER_LEVELS - 1 and above
+ * share the highest level. */
+#define WL_REQUEST_PACER_LEVELS 8
+
+typedef struct
+{
+	WlTimer			timer;				/* Expires when the next waiting request may be released. */
+	RsslUInt32		maxRate;			/* Maximum rate, in requests per second. 0 if pacing is disabled. */
+	RsslUInt32		minRate;			/* Rate below which adaptation will not go. */
+	RsslUInt32		rate;				/* Current rate, in requests per second. */
+	RsslInt64		burst;				/* Maximum tokens, in thousandths of a request. */
+	RsslInt64		tokens;				/* Available tokens, in thousandths of a request. */
+	RsslInt64		refillTime;			/* Time at which tokens were last added. */
+	RsslUInt32		latencyTarget;		/* Target refresh latency, in milliseconds. 0 if the rate is fixed. */
+	RsslInt64		adjustTime;			/* Time at which the rate was last adjusted. */
+	RsslUInt32		averageLatency;		/* Moving average of refresh latency, in milliseconds. */
+	RsslQueue		waiting[WL_REQUEST_PACER_LEVELS];	/* Waiting requests, by priority level. */
+	RsslUInt32		waitingCount;		/* Total waiting requests. */
+	RsslUInt64		requestsReleased;	/* Requests that have taken a token. */
+	RsslUInt64		refreshesCompleted;	/* Refreshes whose latency was measured. */
+} WlRequestPacer;
+
+/* Initializes a request pacer. A maxRate of 0 disables pacing; a burst of 0 allows a tenth of a
+ * second's worth of requests at once. */
+void wlRequestPacerInit(WlRequestPacer *pPacer, RsslUInt32 maxRate, RsslUInt32 burst,
+		RsslUInt32 latencyTarget, RsslInt64 currentTime);
+
+/* Whether pacing is enabled. */
+RTR_C_INLINE RsslBool wlRequestPacerIsEnabled(WlRequestPacer *pPacer)
+{
+	return pPacer->maxRate ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Returns the priority level used for a priority class. */
+RTR_C_INLINE RsslUInt8 wlRequestPacerGetLevel(RsslUInt8 priorityClass)
+{
+	return priorityClass < WL_REQUEST_PACER_LEVELS ? priorityClass : WL_REQUEST_PACER_LEVELS - 1;
+}
+
+/* Takes a token for a request, if none are waiting and a token is available. Returns RSSL_FALSE
+ * if the request needs to wait. */
+RsslBool wlRequestPacerTryAcquire(WlRequestPacer *pPacer, RsslInt64 currentTime);
+
+/* Adds a request to wait at a priority level (from wlRequestPacerGetLevel). */
+void wlRequestPacerAdd(WlRequestPacer *pPacer, RsslQueueLink *pLink, RsslUInt8 level);
+
+/* Removes a waiting request from its priority level. */
+void wlRequestPacerRemove(WlRequestPacer *pPacer, RsslQueueLink *pLink, RsslUInt8 level);
+
+/* Takes a token for the highest priority waiting request and returns it, or returns NULL if
+ * no requests are waiting or no token is available. */
+RsslQueueLink *wlRequestPacerTake(WlRequestPacer *pPacer, RsslInt64 currentTime);
+
+/* Returns the time, in milliseconds from currentTime, until a token is available. */
+RsslInt64 wlRequestPacerGetWaitTime(WlRequestPacer *pPacer, RsslInt64 currentTime);
+
+/* Records the latency of a completed refresh, in milliseconds, adjusting the rate if a latency
+ * target is set. */
+void wlRequestPacerProcessLatency(WlRequestPacer *pPacer, RsslInt64 latency, RsslInt64 currentTime);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#ifndef WL_SLAB_H
+#define WL_SLAB_H
+
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslTypes.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Size-class allocator for the watchlist's small, variably-sized allocations (views, aggregate
+ * view element lists, buffered messages and message copies).
+ *
+ * Each size class carves slabs of WL_SLAB_SIZE bytes into equal blocks.  Freed blocks go on
+ * their class's free list and are reused by later allocations of that class; slabs are only
+ * returned to the system when the allocator is cleaned up, which frees them all at once.
+ * Allocations larger than the largest class are made individually, but are tracked so that
+ * cleanup frees them as well.
+ *
+ * Every block is preceded by a small header recording its class, so blocks are freed and
+ * reallocated without their size. */
+
+#define WL_SLAB_SIZE			65536
+#define WL_SLAB_CLASS_COUNT		9		/* Classes of 32 to 8192 bytes. */
+#define WL_SLAB_LARGE_CLASS		WL_SLAB_CLASS_COUNT
+
+typedef struct
+{
+	RsslUInt32		blockSize;			/* Usable bytes in each block. */
+	RsslUInt32		blocksPerSlab;		/* Blocks carved from each slab. */
+	RsslUInt32		slabCount;			/* Slabs allocated for this class. */
+	RsslUInt32		blocksInUse;		/* Blocks currently allocated. */
+	RsslUInt32		blocksHighWater;	/* Most blocks allocated at once. */
+	void			*pFreeList;			/* Free blocks, linked through their first bytes. */
+} WlSlabClass;
+
+typedef struct
+{
+	WlSlabClass		classes[WL_SLAB_CLASS_COUNT];
+	void			*pSlabs;				/* All slabs, linked through their first bytes. */
+	RsslQueue		largeBlocks;			/* Allocations larger than the largest class. */
+	RsslUInt32		largeBlocksHighWater;	/* Most large allocations at once. */
+} WlSlabAllocator;
+
+/* Occupancy of a size class, from wlSlabGetStats. */
+typedef struct
+{
+	RsslUInt32		blockSize;			/* Usable bytes in each block (0 for large allocations). */
+	RsslUInt32		blocksAllocated;	/* Blocks carved from slabs so far. */
+	RsslUInt32		blocksInUse;		/* Blocks currently allocated. */
+	RsslUInt32		blocksHighWater;	/* Most blocks allocated at once. */
+} WlSlabClassStats;
+
+/* Initializes a slab allocator. */
+void wlSlabInit(WlSlabAllocator *pSlab);
+
+/* Frees all memory held by a slab allocator, including blocks that were not freed. */
+void wlSlabCleanup(WlSlabAllocator *pSlab);
+
+/* Allocates a block of at least the given size. Returns NULL if memory could not be allocated. */
+void *wlSlabAlloc(WlSlabAllocator *pSlab, size_t size);
+
+/* Frees a block, if not NULL. */
+void wlSlabFree(WlSlabAllocator *pSlab, void *pBlock);
+
+/* Resizes a block, preserving its contents up to the smaller of the old and new sizes. The block
+ * is returned as is if it already fits. Returns NULL, leaving the block allocated, if memory
+ * could not be allocated. */
+void *wlSlabRealloc(WlSlabAllocator *pSlab, void *pBlock, size_t size);
+
+/* Gets the occupancy of each size class. pStats must have room for WL_SLAB_CLASS_COUNT + 1
+ * entries; the last is for allocations larger than the largest class. */
+void wlSlabGetStats(WlSlabAllocator *pSlab, WlSlabClassStats *pStats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
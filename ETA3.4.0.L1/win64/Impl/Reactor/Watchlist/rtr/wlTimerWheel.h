@@ -0,0 +1,115 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#ifndef WL_TIMER_WHEEL_H
+#define WL_TIMER_WHEEL_H
+
+#include "rtr/rsslQueue.h"
+#include "rtr/rsslTypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Hierarchical timing wheel shared by the watchlist's timers (request timeouts, FTGroup
+ * pings, gap recovery and post acknowledgements).
+ *
+ * Times are in milliseconds.  Level 0 has one slot per millisecond, and each level above it
+ * has slots WL_TIMER_WHEEL_SLOTS times as wide; timers too far out for the top level wait in
+ * an overflow list.  Arming, canceling and re-arming a timer are constant-time.  As the wheel
+ * advances, timers in a higher level slot are moved down when that slot comes due, and timers
+ * in the current level 0 slot are moved to the expired list. */
+
+#define WL_TIMER_WHEEL_BITS		6
+#define WL_TIMER_WHEEL_SLOTS	(1 << WL_TIMER_WHEEL_BITS)
+#define WL_TIMER_WHEEL_LEVELS	4
+
+typedef enum
+{
+	WL_TMT_REQUEST		= 1,	/* WlStreamBase request timeout. */
+	WL_TMT_FTGROUP		= 2,	/* WlFTGroup ping timeout. */
+	WL_TMT_GAP			= 3,	/* Multicast gap recovery timer. */
+	WL_TMT_POST			= 4,	/* WlPostRecord acknowledgement timeout. */
+	WL_TMT_CONFLATION	= 5,	/* WlItemConflation update timer. */
+	WL_TMT_PACER		= 6		/* WlRequestPacer release timer. */
+} WlTimerType;
+
+/* A timer.  Embedded in the structure that owns it. */
+typedef struct
+{
+	RsslQueueLink	qlTimer;		/* Link for the slot, overflow or expired list. */
+	RsslQueue		*pQueue;		/* List holding the timer, or NULL if it is not armed. */
+	RsslInt64		expireTime;		/* Time at which the timer expires. */
+	RsslUInt8		level;			/* Level holding the timer (WL_TIMER_WHEEL_LEVELS for overflow,
+									 * WL_TIMER_WHEEL_LEVELS + 1 for expired). */
+	RsslUInt8		timerType;		/* WlTimerType. */
+} WlTimer;
+
+/* Gets the structure containing a timer. */
+#define WL_TIMER_TO_OBJECT(__objectType, __timer, __pTimer) \
+	((__objectType*)((char*)(__pTimer) - offsetof(__objectType, __timer)))
+
+typedef struct
+{
+	RsslQueue		slots[WL_TIMER_WHEEL_LEVELS][WL_TIMER_WHEEL_SLOTS];
+	RsslUInt32		levelCounts[WL_TIMER_WHEEL_LEVELS + 2];	/* Timers in each level, the overflow list
+															 * and the expired list. */
+	RsslQueue		overflow;		/* Timers beyond the top level. */
+	RsslQueue		expired;		/* Timers that have expired but not been retrieved. */
+	RsslInt64		time;			/* Time of the next level 0 slot to expire. */
+	RsslUInt32		count;			/* Total number of armed timers. */
+} WlTimerWheel;
+
+/* Initializes a timer. */
+RTR_C_INLINE void wlTimerInit(WlTimer *pTimer, WlTimerType timerType)
+{
+	rsslInitQueueLink(&pTimer->qlTimer);
+	pTimer->pQueue = NULL;
+	pTimer->expireTime = 0;
+	pTimer->level = 0;
+	pTimer->timerType = (RsslUInt8)timerType;
+}
+
+/* Whether a timer is armed (including expired timers that have not been retrieved). */
+RTR_C_INLINE RsslBool wlTimerIsArmed(WlTimer *pTimer)
+{
+	return pTimer->pQueue ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* Initializes a timer wheel. currentTime is the time from which it starts advancing. */
+void wlTimerWheelInit(WlTimerWheel *pWheel, RsslInt64 currentTime);
+
+/* Arms a timer to expire timeout milliseconds after currentTime. Re-arms it if already armed. */
+void wlTimerWheelArm(WlTimerWheel *pWheel, WlTimer *pTimer, RsslInt64 currentTime,
+		RsslInt64 timeout);
+
+/* Cancels a timer, if armed. */
+void wlTimerWheelCancel(WlTimerWheel *pWheel, WlTimer *pTimer);
+
+/* Advances the wheel to currentTime, moving any timers that expire by then to the expired list. */
+void wlTimerWheelAdvance(WlTimerWheel *pWheel, RsslInt64 currentTime);
+
+/* Removes and returns the next expired timer, or NULL if there are none.
+ * Timers may be armed or canceled between calls. */
+WlTimer *wlTimerWheelPopExpired(WlTimerWheel *pWheel);
+
+/* Returns the time at which the wheel should next be advanced, or WL_TIME_UNSET if no timers are armed.
+ * This is exact for timers due within WL_TIMER_WHEEL_SLOTS milliseconds. For later timers it is when the
+ * slot holding them comes due, after which this should be checked again. */
+RsslInt64 wlTimerWheelGetNextTimeout(WlTimerWheel *pWheel);
+
+/* Returns the number of armed timers. */
+RTR_C_INLINE RsslUInt32 wlTimerWheelGetCount(WlTimerWheel *pWheel)
+{
+	return pWheel->count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
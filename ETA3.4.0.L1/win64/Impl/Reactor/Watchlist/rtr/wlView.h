@@ -12,6 +12,7 @@
 #include "rtr/rsslIterators.h"
 #include "rtr/rsslQueue.h"
 #include "rtr/rsslErrorInfo.h"
+#include "rtr/wlSlab.h"
 
 /* Implements aggregation of multiple lists of field IDs into a single list, to
  * aid in aggregation of requested views on a stream. */
@@ -61,15 +62,67 @@ typedef struct
 	RsslUInt		viewType;
 	RsslUInt32		elemCount;
 	void			*elemList;
-	char			*nameBuf;			/* Memory that stores names for element list views. */
+	char			*nameBuf;			/* Names for element list views. Stored in the same block, 
+										 * after elemList. */
 } WlView;
 
 /* Initializes a view structure. Sorts the fields and removes any duplicates or instances
- * of field ID 0(which should not appear in a view). */
-WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
-		RsslErrorInfo *pErrorInfo);
+ * of field ID 0(which should not appear in a view). The view, including its elements, is
+ * allocated as a single block from the slab allocator. */
+WlView *wlViewCreate(WlSlabAllocator *pSlab, void *elemList, RsslUInt32 elemCount, 
+		RsslUInt viewType, RsslErrorInfo *pErrorInfo);
+
+void wlViewDestroy(WlSlabAllocator *pSlab, WlView *pView);
+
+/* Checks whether two views contain the same elements. */
+RsslBool wlViewIsEqual(WlView *pView1, WlView *pView2);
+
+/* Encodes into pOutput a copy of an encoded RsslFieldList, keeping only the entries whose field IDs
+ * are in the given field ID view. Entries are copied in their encoded form, so their values are
+ * never decoded. The result is never longer than the original list.
+ * Returns RSSL_RET_UNSUPPORTED_DATA_TYPE if the list contains set-defined data. */
+RsslRet wlViewFilterFieldList(WlView *pView, RsslBuffer *pEncFieldList, RsslUInt8 majorVersion,
+		RsslUInt8 minorVersion, RsslBuffer *pOutput);
+
+/* A field list filtered to a view. */
+typedef struct
+{
+	WlView		*pView;			/* View the payload was filtered to. */
+	RsslBuffer	payload;		/* Filtered field list. */
+	RsslBuffer	memory;			/* Storage for the payload, reused from message to message. */
+} WlFilteredPayload;
 
-void wlViewDestroy(WlView *pView);
+/* Holds the field lists filtered from the message currently being fanned out, so that
+ * requests with identical views share one filtered payload. */
+typedef struct
+{
+	RsslBuffer			source;			/* Field list the payloads were filtered from. */
+	RsslBool			unfilterable;	/* Source contains data that cannot be filtered. */
+	RsslUInt32			count;			/* Payloads filtered from the source. */
+	RsslUInt32			capacity;		/* Payloads allocated. */
+	WlFilteredPayload	*payloads;
+} WlViewFilterCache;
+
+/* Initializes a filter cache. */
+void wlViewFilterCacheInit(WlViewFilterCache *pCache);
+
+/* Frees memory held by a filter cache. */
+void wlViewFilterCacheCleanup(WlViewFilterCache *pCache);
+
+/* Discards the filtered payloads. Call this before fanning out each message. */
+RTR_C_INLINE void wlViewFilterCacheReset(WlViewFilterCache *pCache)
+{
+	pCache->count = 0;
+	pCache->unfilterable = RSSL_FALSE;
+	rsslClearBuffer(&pCache->source);
+}
+
+/* Gets the given field list filtered to the given field ID view, filtering it only if 
+ * no identical view has been filtered from it since the last reset. If the list cannot be 
+ * filtered, the original list is returned. */
+RsslRet wlViewFilterCacheGet(WlViewFilterCache *pCache, WlView *pView, RsslBuffer *pEncFieldList,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion, RsslBuffer **ppPayload, 
+		RsslErrorInfo *pErrorInfo);
 
 /* If the viewType is RDM_VIEW_TYPE_FIELD_ID_LIST, the aggregate viewElemList will consist of 
  * these.*/
@@ -101,10 +154,11 @@ typedef struct
 	RsslUInt32	elemCapacity;		/* Max capacity of viewElemList. */
 	RsslUInt32	elemCount;			/* Number of actual fields in viewElemList. */
 	void		*elemList;			/* List of aggregated elements. */
+	WlSlabAllocator	*pSlab;			/* Allocates elemList and the copies of element names. */
 } WlAggregateView;
 
 /* Initializes an aggregate view structure. */
-WlAggregateView *wlAggregateViewCreate(RsslErrorInfo *pErrorInfo);
+WlAggregateView *wlAggregateViewCreate(WlSlabAllocator *pSlab, RsslErrorInfo *pErrorInfo);
 
 /* Destroys an aggregate view structure. */
 void wlAggregateViewDestroy(WlAggregateView *pView);
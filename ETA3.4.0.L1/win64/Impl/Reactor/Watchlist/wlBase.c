@@ -9,7 +9,7 @@
 
 RsslUInt32 wlStreamAttributesHashSum(void *pKey)
 {
-	return rsslMsgKeyHash(&((WlStreamAttributes*)pKey)->msgKey);
+	return ((WlStreamAttributes*)pKey)->keyHashSum;
 }
 
 RsslBool wlStreamAttributesHashCompare(void *pKey1, void *pKey2)
@@ -17,6 +17,10 @@ RsslBool wlStreamAttributesHashCompare(void *pKey1, void *pKey2)
 	WlStreamAttributes *pStreamAttributes1 = (WlStreamAttributes*)pKey1;
 	WlStreamAttributes *pStreamAttributes2 = (WlStreamAttributes*)pKey2;
 
+	/* Keys are interned, so equal keys have the same handle. */
+	if (pStreamAttributes1->itemKey != pStreamAttributes2->itemKey)
+		return RSSL_FALSE;
+
 	if (pStreamAttributes1->domainType != pStreamAttributes2->domainType)
 		return RSSL_FALSE;
 
@@ -28,14 +32,12 @@ RsslBool wlStreamAttributesHashCompare(void *pKey1, void *pKey2)
 			return RSSL_FALSE;
 	}
 
-	return (rsslCompareMsgKeys(&pStreamAttributes1->msgKey, &pStreamAttributes2->msgKey)
-			== RSSL_RET_SUCCESS ? RSSL_TRUE : RSSL_FALSE);
-
+	return RSSL_TRUE;
 }
 
 
-RsslRDMMsg *wlCreateRdmMsgCopy(RsslRDMMsg *pRdmMsg, RsslBuffer *pMemoryBuffer, 
-		RsslErrorInfo *pErrorInfo)
+RsslRDMMsg *wlCreateRdmMsgCopy(WlSlabAllocator *pSlab, RsslRDMMsg *pRdmMsg, 
+		RsslBuffer *pMemoryBuffer, RsslErrorInfo *pErrorInfo)
 {
 
 	pMemoryBuffer->length = 128 + sizeof(RsslRDMMsg);
@@ -46,7 +48,7 @@ RsslRDMMsg *wlCreateRdmMsgCopy(RsslRDMMsg *pRdmMsg, RsslBuffer *pMemoryBuffer,
 		RsslBuffer memoryBuffer;
 		RsslRet ret;
 
-		pMemoryBuffer->data = (char*)malloc(pMemoryBuffer->length);
+		pMemoryBuffer->data = (char*)wlSlabAlloc(pSlab, pMemoryBuffer->length);
 		verify_malloc(pMemoryBuffer->data, pErrorInfo, NULL);
 
 		memoryBuffer = *pMemoryBuffer;
@@ -60,11 +62,11 @@ RsslRDMMsg *wlCreateRdmMsgCopy(RsslRDMMsg *pRdmMsg, RsslBuffer *pMemoryBuffer,
 		switch(ret)
 		{
 			case RSSL_RET_BUFFER_TOO_SMALL:
-				free(pMemoryBuffer->data);
+				wlSlabFree(pSlab, pMemoryBuffer->data);
 				pMemoryBuffer->length *= 2;
 				break;
 			default:
-				free(pMemoryBuffer->data);
+				wlSlabFree(pSlab, pMemoryBuffer->data);
 				return NULL;
 
 		}
@@ -86,6 +88,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pServiceCache->pUserSpec = (WlBase*)pBase;
 
 	memset(pBase, 0, sizeof(WlBase));
+	wlSlabInit(&pBase->slab);
 
 	if (rsslHeapBufferInit(&pBase->tempDecodeBuffer, 16384) != RSSL_RET_SUCCESS)
 	{
@@ -108,6 +111,8 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->config.msgCallback = pOpts->msgCallback;
 	pBase->config.obeyOpenWindow = pOpts->obeyOpenWindow;
 	pBase->config.requestTimeout = pOpts->requestTimeout;
+	pBase->config.filterViewsPerRequest = pOpts->filterViewsPerRequest;
+	pBase->config.cacheItemImages = pOpts->cacheItemImages;
 	pBase->watchlist.state = 0;
 	pBase->channelState = WL_CHS_START;
 	pBase->pRsslChannel = NULL;
@@ -118,27 +123,33 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	pBase->nextProviderStreamId = MIN_STREAM_ID;
 	pBase->ticksPerMsec = pOpts->ticksPerMsec;
 
-	if ((ret = rsslHashTableInit(&pBase->requestsByStreamId, 10007, rsslHashU32Sum, 
+	if ((ret = rsslOpenHashTableInit(&pBase->requestsByStreamId, 10007, rsslHashU32Sum, 
 			rsslHashU32Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesHashSum, 
+	if ((ret = rsslOpenHashTableInit(&pBase->openStreamsByAttrib, 100003, wlStreamAttributesHashSum, 
 			wlStreamAttributesHashCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
-	if ((ret = rsslHashTableInit(&pBase->streamsById, 100003, rsslHashU32Sum, 
+	if ((ret = rsslOpenHashTableInit(&pBase->streamsById, 100003, rsslHashU32Sum, 
 			rsslHashU32Compare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
 		return ret;
 	}
 
+	if ((ret = wlItemKeyTableInit(&pBase->itemKeys, pErrorInfo)) != RSSL_RET_SUCCESS)
+	{
+		wlBaseCleanup(pBase);
+		return ret;
+	}
+
 	if ((ret = rsslHashTableInit(&pBase->requestedSvcByName, 10007, rsslHashBufferSum, 
 			rsslHashBufferCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
@@ -157,9 +168,12 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	rsslInitQueue(&pBase->requestedServices);
 	rsslInitQueue(&pBase->streamsPendingRequest);
 
-	rsslInitQueue(&pBase->streamsPendingResponse);
 	rsslInitQueue(&pBase->openStreams);
 
+	wlTimerWheelInit(&pBase->timerWheel, getCurrentTimeMs(pOpts->ticksPerMsec));
+	wlRequestPacerInit(&pBase->requestPacer, pOpts->requestPacingRate, pOpts->requestPacingBurst,
+			pOpts->requestPacingLatencyTarget, getCurrentTimeMs(pOpts->ticksPerMsec));
+
 	if ((ret = rsslMemoryPoolInit(&pBase->streamPool, pOpts->streamPoolBlockSize, 
 					pOpts->streamPoolCount, pErrorInfo)) != RSSL_RET_SUCCESS)
 	{
@@ -175,7 +189,7 @@ RsslRet wlBaseInit(WlBase *pBase, WlBaseInitOptions *pOpts, RsslErrorInfo *pErro
 	}
 
 	if ((ret = wlPostTableInit(&pBase->postTable, pOpts->maxOutstandingPosts, 
-					pOpts->postAckTimeout, pErrorInfo))
+					pOpts->postAckTimeout, &pBase->timerWheel, pErrorInfo))
 			!= RSSL_RET_SUCCESS)
 	{
 		wlBaseCleanup(pBase);
@@ -193,21 +207,30 @@ void wlBaseCleanup(WlBase *pBase)
 	wlServiceCacheDestroy(pBase->pServiceCache);
 	rsslHeapBufferCleanup(&pBase->tempDecodeBuffer);
 	rsslHeapBufferCleanup(&pBase->tempEncodeBuffer);
-	rsslHashTableCleanup(&pBase->requestsByStreamId);
-	rsslHashTableCleanup(&pBase->openStreamsByAttrib);
-	rsslHashTableCleanup(&pBase->streamsById);
+	rsslOpenHashTableCleanup(&pBase->requestsByStreamId);
+	rsslOpenHashTableCleanup(&pBase->openStreamsByAttrib);
+	rsslOpenHashTableCleanup(&pBase->streamsById);
+	wlItemKeyTableCleanup(&pBase->itemKeys);
 	rsslHashTableCleanup(&pBase->requestedSvcByName);
 	rsslHashTableCleanup(&pBase->requestedSvcById);
 	rsslMemoryPoolCleanup(&pBase->requestPool);
 	rsslMemoryPoolCleanup(&pBase->streamPool);
 	wlPostTableCleanup(&pBase->postTable);
+	wlSlabCleanup(&pBase->slab);
 }
 
-void wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase)
+RsslRet wlAddRequest(WlBase *pBase, WlRequestBase *pRequestBase, RsslErrorInfo *pErrorInfo)
 {
 	rsslHashLinkInit(&pRequestBase->hlStreamId);
-	rsslHashTableInsertLink(&pBase->requestsByStreamId, &pRequestBase->hlStreamId, 
-			&pRequestBase->streamId, NULL);
+	if (rsslOpenHashTableInsertLink(&pBase->requestsByStreamId, &pRequestBase->hlStreamId, 
+			&pRequestBase->streamId, NULL) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
 }
 
 void wlRemoveRequest(WlBase *pBase, WlRequestBase *pRequestBase)
@@ -220,7 +243,7 @@ void wlRemoveRequest(WlBase *pBase, WlRequestBase *pRequestBase)
 		wlPostTableRemoveRecord(&pBase->postTable, pPostRecord);
 	}
 
-	rsslHashTableRemoveLink(&pBase->requestsByStreamId, &pRequestBase->hlStreamId);
+	rsslOpenHashTableRemoveLink(&pBase->requestsByStreamId, &pRequestBase->hlStreamId);
 	if (pRequestBase->pStateQueue)
 		rsslQueueRemoveLink(pRequestBase->pStateQueue, &pRequestBase->qlStateQueue);
 }
@@ -239,11 +262,10 @@ void wlSetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (!(pStreamBase->requestState & WL_STRS_PENDING_RESPONSE))
 	{
-		rsslQueueAddLinkToBack(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
 		pStreamBase->requestState |= WL_STRS_PENDING_RESPONSE;
 
-		pStreamBase->requestExpireTime = pBase->currentTime + pBase->config.requestTimeout;
+		wlTimerWheelArm(&pBase->timerWheel, &pStreamBase->requestTimer, pBase->currentTime,
+				pBase->config.requestTimeout);
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 	}
 }
@@ -252,8 +274,9 @@ void wlResetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (pStreamBase->requestState & WL_STRS_PENDING_RESPONSE)
 	{
-		wlUnsetStreamPendingResponse(pBase, pStreamBase);
-		wlSetStreamPendingResponse(pBase, pStreamBase);
+		wlTimerWheelArm(&pBase->timerWheel, &pStreamBase->requestTimer, pBase->currentTime,
+				pBase->config.requestTimeout);
+		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 	}
 }
 
@@ -261,8 +284,7 @@ void wlUnsetStreamPendingResponse(WlBase *pBase, WlStreamBase *pStreamBase)
 {
 	if (pStreamBase->requestState & WL_STRS_PENDING_RESPONSE)
 	{
-		rsslQueueRemoveLink(&pBase->streamsPendingResponse,
-				&pStreamBase->qlStreamsPendingResponse);
+		wlTimerWheelCancel(&pBase->timerWheel, &pStreamBase->requestTimer);
 		pStreamBase->requestState &= ~WL_STRS_PENDING_RESPONSE;
 	}
 }
@@ -290,7 +312,7 @@ RsslInt32 wlBaseTakeStreamId(WlBase *pBase)
 	{
 		if (++pBase->nextStreamId == MAX_STREAM_ID) 
 			pBase->nextStreamId = MIN_STREAM_ID;
-	} while (rsslHashTableFind(&pBase->streamsById, &pBase->nextStreamId, NULL));
+	} while (rsslOpenHashTableFind(&pBase->streamsById, &pBase->nextStreamId, NULL));
 	return pBase->nextStreamId;
 }
 
@@ -302,6 +324,6 @@ RsslInt32 wlBaseTakeProviderStreamId(WlBase *pBase)
 		if (++pBase->nextProviderStreamId == MAX_STREAM_ID) 
 			pBase->nextProviderStreamId = MIN_STREAM_ID;
 		streamId = -pBase->nextProviderStreamId;
-	} while (rsslHashTableFind(&pBase->streamsById, &streamId, NULL));
+	} while (rsslOpenHashTableFind(&pBase->streamsById, &streamId, NULL));
 	return streamId;
 }
@@ -65,8 +65,15 @@ WlDirectoryStream *wlDirectoryStreamCreate(WlBase *pBase, WlDirectory *pDirector
 
 	wlStreamBaseInit(&pDirectory->pStream->base, streamId, RSSL_DMT_SOURCE);
 
-	rsslHashTableInsertLink(&pBase->streamsById, &pDirectory->pStream->base.hlStreamId, 
-			&pDirectory->pStream->base.streamId, NULL);
+	if (rsslOpenHashTableInsertLink(&pBase->streamsById, &pDirectory->pStream->base.hlStreamId, 
+			&pDirectory->pStream->base.streamId, NULL) != RSSL_RET_SUCCESS)
+	{
+		free(pDirectory->pStream);
+		pDirectory->pStream = NULL;
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return NULL;
+	}
 
 	wlSetStreamMsgPending(pBase, &pDirectory->pStream->base);
 
@@ -84,7 +91,7 @@ void wlDirectoryStreamClose(WlBase *pBase, WlDirectory *pDirectory, RsslBool sen
 	else
 		wlUnsetStreamFromPendingLists(pBase, &pDirectory->pStream->base);
 
-	rsslHashTableRemoveLink(&pBase->streamsById, &pDirectory->pStream->base.hlStreamId);
+	rsslOpenHashTableRemoveLink(&pBase->streamsById, &pDirectory->pStream->base.hlStreamId);
 	pDirectory->pStream = NULL;
 }
 
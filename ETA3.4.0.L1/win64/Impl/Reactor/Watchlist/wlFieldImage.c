@@ -0,0 +1,313 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/wlFieldImage.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslReactorUtils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define WL_FIELD_IMAGE_MIN_INDEX_BITS	4
+#define WL_FIELD_IMAGE_MIN_VALUES		256
+
+/* Index slot at which to start looking for a field. */
+RTR_C_INLINE RsslUInt32 wlFieldImageSlot(RsslFieldId fieldId, RsslUInt32 indexBits)
+{
+	return ((RsslUInt32)(RsslUInt16)fieldId * 0x9E3779B1U) >> (32 - indexBits);
+}
+
+static WlImageField *wlFieldImageFind(WlFieldImage *pImage, RsslFieldId fieldId)
+{
+	RsslUInt32 mask, slot;
+
+	if (!pImage->fieldCount)
+		return NULL;
+
+	mask = (1U << pImage->indexBits) - 1;
+	for (slot = wlFieldImageSlot(fieldId, pImage->indexBits); pImage->index[slot];
+			slot = (slot + 1) & mask)
+	{
+		WlImageField *pField = &pImage->fields[pImage->index[slot] - 1];
+		if (pField->fieldId == fieldId)
+			return pField;
+	}
+
+	return NULL;
+}
+
+static void wlFieldImageIndexAdd(WlFieldImage *pImage, RsslUInt32 position)
+{
+	RsslUInt32 mask = (1U << pImage->indexBits) - 1;
+	RsslUInt32 slot = wlFieldImageSlot(pImage->fields[position].fieldId, pImage->indexBits);
+
+	while (pImage->index[slot])
+		slot = (slot + 1) & mask;
+
+	pImage->index[slot] = position + 1;
+}
+
+/* Adds a new field to the image, with no value yet. */
+static WlImageField *wlFieldImageAddField(WlFieldImage *pImage, RsslFieldId fieldId,
+		RsslErrorInfo *pErrorInfo)
+{
+	WlImageField *pField;
+
+	if (pImage->fieldCount == pImage->fieldCapacity)
+	{
+		RsslUInt32 newCapacity = pImage->fieldCapacity ? pImage->fieldCapacity * 2 : 16;
+		WlImageField *newFields = (WlImageField*)realloc(pImage->fields,
+				newCapacity * sizeof(WlImageField));
+		verify_malloc(newFields, pErrorInfo, NULL);
+		pImage->fields = newFields;
+		pImage->fieldCapacity = newCapacity;
+	}
+
+	/* Keep the index at most half full. */
+	if ((pImage->fieldCount + 1) * 2 > (1U << pImage->indexBits))
+	{
+		RsslUInt32 newBits = pImage->indexBits ? pImage->indexBits + 1 : WL_FIELD_IMAGE_MIN_INDEX_BITS;
+		RsslUInt32 *newIndex = (RsslUInt32*)calloc((size_t)1 << newBits, sizeof(RsslUInt32));
+		RsslUInt32 ui;
+		verify_malloc(newIndex, pErrorInfo, NULL);
+
+		free(pImage->index);
+		pImage->index = newIndex;
+		pImage->indexBits = newBits;
+
+		for (ui = 0; ui < pImage->fieldCount; ++ui)
+			wlFieldImageIndexAdd(pImage, ui);
+	}
+
+	pField = &pImage->fields[pImage->fieldCount];
+	pField->fieldId = fieldId;
+	pField->offset = WL_FIELD_IMAGE_REMOVED;
+	pField->length = 0;
+	wlFieldImageIndexAdd(pImage, pImage->fieldCount);
+	++pImage->fieldCount;
+
+	return pField;
+}
+
+/* Ensures there is room to append a value of the given length. When the value buffer needs to
+ * grow, only the current values are moved to the new one. */
+static RsslRet wlFieldImageReserve(WlFieldImage *pImage, RsslUInt32 length, RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 newCapacity, newLength, ui;
+	char *newValues;
+
+	if (pImage->valuesLength + length <= pImage->valuesCapacity)
+		return RSSL_RET_SUCCESS;
+
+	newCapacity = (pImage->liveLength + length) * 2;
+	if (newCapacity < WL_FIELD_IMAGE_MIN_VALUES)
+		newCapacity = WL_FIELD_IMAGE_MIN_VALUES;
+
+	newValues = (char*)malloc(newCapacity);
+	verify_malloc(newValues, pErrorInfo, RSSL_RET_FAILURE);
+
+	newLength = 0;
+	for (ui = 0; ui < pImage->fieldCount; ++ui)
+	{
+		WlImageField *pField = &pImage->fields[ui];
+
+		if (pField->offset == WL_FIELD_IMAGE_REMOVED)
+			continue;
+
+		memcpy(newValues + newLength, pImage->values + pField->offset, pField->length);
+		pField->offset = newLength;
+		newLength += pField->length;
+	}
+
+	assert(newLength == pImage->liveLength);
+	free(pImage->values);
+	pImage->values = newValues;
+	pImage->valuesLength = newLength;
+	pImage->valuesCapacity = newCapacity;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Starts decoding a field list. Fails if it contains set-defined data, as its fields
+ * can't be found without the set definitions. */
+static RsslRet wlFieldImageDecodeList(RsslDecodeIterator *pIter, RsslFieldList *pFieldList,
+		RsslBuffer *pEncFieldList, RsslUInt8 majorVersion, RsslUInt8 minorVersion)
+{
+	RsslRet ret;
+
+	rsslClearDecodeIterator(pIter);
+	rsslSetDecodeIteratorRWFVersion(pIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(pIter, pEncFieldList);
+
+	if ((ret = rsslDecodeFieldList(pIter, pFieldList, NULL)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pFieldList->flags & RSSL_FLF_HAS_SET_DATA)
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+
+	return RSSL_RET_SUCCESS;
+}
+
+void wlFieldImageInit(WlFieldImage *pImage)
+{
+	memset(pImage, 0, sizeof(WlFieldImage));
+}
+
+void wlFieldImageCleanup(WlFieldImage *pImage)
+{
+	free(pImage->fields);
+	free(pImage->index);
+	free(pImage->values);
+	memset(pImage, 0, sizeof(WlFieldImage));
+}
+
+void wlFieldImageClear(WlFieldImage *pImage)
+{
+	if (pImage->fieldCount)
+		memset(pImage->index, 0, ((size_t)1 << pImage->indexBits) * sizeof(RsslUInt32));
+
+	pImage->fieldListFlags = 0;
+	pImage->fieldCount = 0;
+	pImage->liveFieldCount = 0;
+	pImage->valuesLength = 0;
+	pImage->liveLength = 0;
+}
+
+RsslRet wlFieldImageMerge(WlFieldImage *pImage, RsslBuffer *pEncFieldList, RsslUInt8 majorVersion,
+		RsslUInt8 minorVersion, RsslErrorInfo *pErrorInfo)
+{
+	RsslDecodeIterator dIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	if ((ret = wlFieldImageDecodeList(&dIter, &fieldList, pEncFieldList, majorVersion,
+					minorVersion)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (fieldList.flags & RSSL_FLF_HAS_FIELD_LIST_INFO)
+	{
+		pImage->fieldListFlags = RSSL_FLF_HAS_FIELD_LIST_INFO;
+		pImage->dictionaryId = fieldList.dictionaryId;
+		pImage->fieldListNum = fieldList.fieldListNum;
+	}
+
+	while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		WlImageField *pField;
+		RsslUInt32 length = fieldEntry.encData.length;
+
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+
+		pField = wlFieldImageFind(pImage, fieldEntry.fieldId);
+
+		/* Replace the current value in place if the new one fits. */
+		if (pField && pField->offset != WL_FIELD_IMAGE_REMOVED && length <= pField->length)
+		{
+			memcpy(pImage->values + pField->offset, fieldEntry.encData.data, length);
+			pImage->liveLength -= pField->length - length;
+			pField->length = length;
+			continue;
+		}
+
+		if ((ret = wlFieldImageReserve(pImage, length, pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		if (!pField)
+		{
+			if (!(pField = wlFieldImageAddField(pImage, fieldEntry.fieldId, pErrorInfo)))
+				return RSSL_RET_FAILURE;
+		}
+
+		if (pField->offset == WL_FIELD_IMAGE_REMOVED)
+			++pImage->liveFieldCount;
+		else
+			pImage->liveLength -= pField->length;
+
+		if (length)
+			memcpy(pImage->values + pImage->valuesLength, fieldEntry.encData.data, length);
+		pField->offset = pImage->valuesLength;
+		pField->length = length;
+		pImage->valuesLength += length;
+		pImage->liveLength += length;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet wlFieldImageRemoveFields(WlFieldImage *pImage, RsslBuffer *pEncFieldList,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion)
+{
+	RsslDecodeIterator dIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	if ((ret = wlFieldImageDecodeList(&dIter, &fieldList, pEncFieldList, majorVersion,
+					minorVersion)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		WlImageField *pField;
+
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (!(pField = wlFieldImageFind(pImage, fieldEntry.fieldId))
+				|| pField->offset == WL_FIELD_IMAGE_REMOVED)
+			continue;
+
+		pImage->liveLength -= pField->length;
+		--pImage->liveFieldCount;
+		pField->offset = WL_FIELD_IMAGE_REMOVED;
+		pField->length = 0;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+RsslUInt32 wlFieldImageEstimateEncodedLength(WlFieldImage *pImage)
+{
+	/* Header: flags, dictionary ID, field list number and count.
+	 * Each entry: field ID and a length of up to three bytes. */
+	return 8 + pImage->liveFieldCount * 5 + pImage->liveLength;
+}
+
+RsslRet wlFieldImageEncode(WlFieldImage *pImage, RsslEncodeIterator *pIter)
+{
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslUInt32 ui;
+	RsslRet ret;
+
+	rsslClearFieldList(&fieldList);
+	fieldList.flags = RSSL_FLF_HAS_STANDARD_DATA | pImage->fieldListFlags;
+	fieldList.dictionaryId = pImage->dictionaryId;
+	fieldList.fieldListNum = pImage->fieldListNum;
+
+	if ((ret = rsslEncodeFieldListInit(pIter, &fieldList, NULL, 0)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	for (ui = 0; ui < pImage->fieldCount; ++ui)
+	{
+		WlImageField *pField = &pImage->fields[ui];
+
+		if (pField->offset == WL_FIELD_IMAGE_REMOVED)
+			continue;
+
+		rsslClearFieldEntry(&fieldEntry);
+		fieldEntry.fieldId = pField->fieldId;
+		fieldEntry.encData.data = pImage->values + pField->offset;
+		fieldEntry.encData.length = pField->length;
+
+		if ((ret = rsslEncodeFieldEntry(pIter, &fieldEntry, NULL)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	return rsslEncodeFieldListComplete(pIter, RSSL_TRUE);
+}
@@ -18,35 +18,29 @@
 static RsslRet _wlItemRequestSaveExtraInfo(WlItemRequest *pItemRequest, RsslRequestMsg *pRequestMsg,
 		RsslErrorInfo *pErrorInfo);
 
-RsslUInt32 wlProviderRequestHashSum(void *pKey)
-{
-	RsslUInt32 i;
-	RsslUInt32 hashSum = 0;
-	WlItemRequest *pItemRequest = (WlItemRequest*)pKey;
-	RsslMsgKey *pMsgKey = &pItemRequest->msgKey;
+/* Applies the conflation options of a request or reissue. */
+static RsslRet wlItemRequestSetConflation(WlItemRequest *pItemRequest, WlItemRequestCreateOpts *pOpts,
+		RsslErrorInfo *pErrorInfo);
 
-	if (pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID)
-		hashSum += pMsgKey->serviceId;
+/* Destroys the conflation state of a request. */
+static void wlItemConflationDestroy(WlBase *pBase, WlItemConflation *pConflation);
 
-	if (pMsgKey->flags & RSSL_MKF_HAS_NAME)
-	{
-		for(i = 0; i < pMsgKey->name.length; ++i)
-		{
-			hashSum = (hashSum << 4) + (RsslUInt32)pMsgKey->name.data[i];
-			hashSum ^= (hashSum >> 12);
-		}
-	}
+/* Applies conflation to a message for a conflated request. Sets *pHeld if the message was
+ * merged into the conflated update instead of being delivered. */
+static RsslRet wlItemRequestConflateMsg(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslMsg *pRsslMsg, RsslBool *pHeld, RsslErrorInfo *pErrorInfo);
 
-	if (pMsgKey->flags & RSSL_MKF_HAS_ATTRIB)
-	{
-		for(i = 0; i < pMsgKey->encAttrib.length; ++i)
-		{
-			hashSum = (hashSum << 4) + (RsslUInt32)pMsgKey->encAttrib.data[i];
-			hashSum ^= (hashSum >> 12);
-		}
-	}
+/* Adds the service ID of a request's matching service to a key. */
+static void wlItemRequestAddServiceIdToKey(WlItemRequest *pItemRequest, RsslMsgKey *pMsgKey);
 
-	return hashSum;
+/* Delivers a message to an item request. */
+static RsslRet wlItemRequestDeliverMsgEvent(WlBase *pBase,
+		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo);
+
+RsslUInt32 wlProviderRequestHashSum(void *pKey)
+{
+	/* Keys are interned, so the handle identifies the key. */
+	return ((WlItemRequest*)pKey)->itemKey;
 }
 
 RsslBool wlProviderRequestHashCompare(void *pKey1, void *pKey2)
@@ -66,8 +60,7 @@ RsslBool wlProviderRequestHashCompare(void *pKey1, void *pKey2)
 	if (!rsslQosIsEqual(&pItemRequest1->qos, &pItemRequest2->qos))
 		return RSSL_FALSE;
 
-	if (rsslCompareMsgKeys(&pItemRequest1->msgKey, &pItemRequest2->msgKey)
-			!= RSSL_RET_SUCCESS)
+	if (pItemRequest1->itemKey != pItemRequest2->itemKey)
 		return RSSL_FALSE;
 
 	/* Requests should have the same requested service attached. */
@@ -90,11 +83,9 @@ RsslRet wlItemsInit(WlItems *pItems, RsslErrorInfo *pErrorInfo)
 
 	memset(pItems->ftGroupTable, 0, sizeof(pItems->ftGroupTable));
 
-	
-	rsslInitQueue(&pItems->ftGroupTimerQueue);
 	rsslInitQueue(&pItems->gapStreamQueue);
-
-	pItems->gapExpireTime = WL_TIME_UNSET;
+	wlTimerInit(&pItems->gapTimer, WL_TMT_GAP);
+	wlViewFilterCacheInit(&pItems->viewFilterCache);
 
 	return RSSL_RET_SUCCESS;
 }
@@ -102,47 +93,7 @@ RsslRet wlItemsInit(WlItems *pItems, RsslErrorInfo *pErrorInfo)
 void wlItemsCleanup(WlItems *pItems)
 {
 	rsslHashTableCleanup(&pItems->providerRequestsByAttrib);
-}
-
-RsslRet wlItemCopyKey(RsslMsgKey *pNewMsgKey, RsslMsgKey *pOldMsgKey, char **pMemoryBuffer,
-		RsslErrorInfo *pErrorInfo)
-{
-	int bufferSize = 0;
-	char *newMemoryBuffer;
-
-	*pNewMsgKey = *pOldMsgKey;
-
-	if (*pMemoryBuffer)
-		free(*pMemoryBuffer);
-
-	if (pOldMsgKey->flags & RSSL_MKF_HAS_NAME && pOldMsgKey->name.data)
-		bufferSize += pOldMsgKey->name.length;
-
-	if (pOldMsgKey->flags & RSSL_MKF_HAS_ATTRIB && pOldMsgKey->encAttrib.data)
-		bufferSize += pOldMsgKey->encAttrib.length;
-
-	if (bufferSize)
-	{
-		newMemoryBuffer = (char*)malloc(bufferSize);
-		verify_malloc(newMemoryBuffer, pErrorInfo, RSSL_RET_FAILURE);
-		*pMemoryBuffer = newMemoryBuffer;
-	}
-
-	if (pOldMsgKey->flags & RSSL_MKF_HAS_NAME && pOldMsgKey->name.length)
-	{
-		pNewMsgKey->name.data = newMemoryBuffer;
-		newMemoryBuffer += pNewMsgKey->name.length;
-		memcpy(pNewMsgKey->name.data, pOldMsgKey->name.data, pNewMsgKey->name.length);
-	}
-
-	if (pOldMsgKey->flags & RSSL_MKF_HAS_ATTRIB && pOldMsgKey->encAttrib.length)
-	{
-		pNewMsgKey->encAttrib.data = newMemoryBuffer;
-		newMemoryBuffer += pNewMsgKey->encAttrib.length;
-		memcpy(pNewMsgKey->encAttrib.data, pOldMsgKey->encAttrib.data, pNewMsgKey->encAttrib.length);
-	}
-
-	return RSSL_RET_SUCCESS;
+	wlViewFilterCacheCleanup(&pItems->viewFilterCache);
 }
 
 RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *pItems, WlItemRequestCreateOpts *pOpts,
@@ -158,11 +109,6 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 
 	pItemRequest->requestMsgFlags = pRequestMsg->flags;
 
-	if ((ret = wlItemCopyKey(&pItemRequest->msgKey, 
-			&pRequestMsg->msgBase.msgKey, &pItemRequest->msgKeyMemoryBuffer, pErrorInfo)) 
-			!= RSSL_RET_SUCCESS)
-		return ret;
-
 	if (pItemRequest->requestMsgFlags & RSSL_RQMF_HAS_QOS)
 		pItemRequest->qos = pRequestMsg->qos;
 
@@ -195,7 +141,7 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 						"Unknown view type %u.", pOpts->viewType);
 				return RSSL_RET_INVALID_DATA;
 			}
-			if (!(pItemRequest->pView = wlViewCreate(pOpts->viewElemList, 
+			if (!(pItemRequest->pView = wlViewCreate(&pBase->slab, pOpts->viewElemList, 
 					pOpts->viewElemCount, pOpts->viewType, pErrorInfo)))
 				return pErrorInfo->rsslError.rsslErrorId;
 			break;
@@ -247,7 +193,24 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 		return RSSL_RET_FAILURE;
 	}
 
-	wlAddRequest(pBase, &pItemRequest->base);
+	if ((pItemRequest->itemKey = wlItemKeyTableIntern(&pBase->itemKeys, 
+					&pRequestMsg->msgBase.msgKey, pErrorInfo)) == WL_ITEM_KEY_NONE)
+	{
+		wlItemRequestDestroy(pBase, pItemRequest);
+		return pErrorInfo->rsslError.rsslErrorId;
+	}
+
+	if ((ret = wlItemRequestSetConflation(pItemRequest, pOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
+	{
+		wlItemRequestDestroy(pBase, pItemRequest);
+		return ret;
+	}
+
+	if ((ret = wlAddRequest(pBase, &pItemRequest->base, pErrorInfo)) != RSSL_RET_SUCCESS)
+	{
+		wlItemRequestDestroy(pBase, pItemRequest);
+		return ret;
+	}
 
 	pItemRequest->base.pStateQueue = &pBase->newRequests;
 	rsslQueueAddLinkToBack(&pBase->newRequests, &pItemRequest->base.qlStateQueue);
@@ -259,7 +222,7 @@ RsslRet wlItemRequestInit(WlItemRequest *pItemRequest, WlBase *pBase, WlItems *p
 
 void wlItemRequestDestroy(WlBase *pBase, WlItemRequest *pItemRequest)
 {
-	wlItemRequestCleanup(pItemRequest);
+	wlItemRequestCleanup(pBase, pItemRequest);
 	rsslMemoryPoolPut(&pBase->requestPool, pItemRequest);
 }
 
@@ -326,19 +289,10 @@ const RsslQos *wlItemRequestMatchQos(WlItemRequest *pItemRequest, RsslQos *qosLi
 RsslRet wlItemStreamInit(WlItemStream *pItemStream, WlStreamAttributes *pStreamAttributes,
 		RsslInt32 streamId, RsslErrorInfo *pErrorInfo)
 {
-	RsslRet ret;
-
 	wlStreamBaseInit(&pItemStream->base, streamId, pStreamAttributes->domainType);
-	pItemStream->msgKeyMemoryBuffer = NULL;
 
 	pItemStream->streamAttributes = *pStreamAttributes;
 
-	/* Copy Msg Key. */
-	if ((ret = wlItemCopyKey(&pItemStream->streamAttributes.msgKey, 
-			&pStreamAttributes->msgKey, &pItemStream->msgKeyMemoryBuffer, pErrorInfo)) 
-			!= RSSL_RET_SUCCESS)
-		return RSSL_RET_FAILURE;
-
 	pItemStream->refreshState = WL_ISRS_NONE;
 	pItemStream->flags = WL_IOSF_NONE;
 	pItemStream->pAggregateView = NULL;
@@ -354,25 +308,31 @@ RsslRet wlItemStreamInit(WlItemStream *pItemStream, WlStreamAttributes *pStreamA
 	pItemStream->pFTGroup = NULL;
 	pItemStream->nextPartNum = 0;
 	pItemStream->pRequestWithExtraInfo = NULL;
+	pItemStream->pCache = NULL;
 	wlMsgReorderQueueInit(&pItemStream->bufferedMsgQueue);
 
 	return RSSL_RET_SUCCESS;
 }
 
-void wlItemStreamResetState(WlItemStream *pItemStream)
+void wlItemStreamResetState(WlBase *pBase, WlItemStream *pItemStream)
 {
 	if (pItemStream->refreshState != WL_ISRS_NONE)
 	{
-		if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
+		if (pItemStream->refreshState == WL_ISRS_PENDING_PACING)
+			wlRequestPacerRemove(&pBase->requestPacer, &pItemStream->qlOpenWindow,
+					pItemStream->pacingLevel);
+		else if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingWindow,
 					&pItemStream->qlOpenWindow);
 		else
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingRefresh,
 					&pItemStream->qlOpenWindow);
 
-		pItemStream->flags = WL_ISRS_NONE;
+		pItemStream->refreshState = WL_ISRS_NONE;
 	}
 
+	wlItemStreamInvalidateCache(pItemStream);
+
 	/* Reset flags(set view change flag so that view gets re-checked). */
 	pItemStream->flags = WL_IOSF_PENDING_VIEW_CHANGE;
 	pItemStream->priorityClass = 1;
@@ -403,14 +363,183 @@ void wlItemStreamDestroy(WlBase *pBase, WlItemStream *pItemStream)
 	if (pItemStream->pAggregateView)
 		wlAggregateViewDestroy(pItemStream->pAggregateView);
 
-	if (pItemStream->msgKeyMemoryBuffer)
-		free(pItemStream->msgKeyMemoryBuffer);
+	wlItemKeyTableRelease(&pBase->itemKeys, pItemStream->streamAttributes.itemKey);
+
+	wlMsgReorderQueueCleanup(&pItemStream->bufferedMsgQueue, pBase);
 
-	wlMsgReorderQueueCleanup(&pItemStream->bufferedMsgQueue);
+	if (pItemStream->pCache)
+	{
+		wlFieldImageCleanup(&pItemStream->pCache->image);
+		wlSlabFree(&pBase->slab, pItemStream->pCache->groupId.data);
+		wlSlabFree(&pBase->slab, pItemStream->pCache->permData.data);
+		wlSlabFree(&pBase->slab, pItemStream->pCache);
+	}
 
 	rsslMemoryPoolPut(&pBase->streamPool, pItemStream);
 }
 
+void wlItemStreamInvalidateCache(WlItemStream *pItemStream)
+{
+	if (!pItemStream->pCache)
+		return;
+
+	pItemStream->pCache->flags = WL_ICF_NONE;
+	wlFieldImageClear(&pItemStream->pCache->image);
+}
+
+/* Replaces a buffer held by the cache with a copy of another. */
+static RsslBool wlItemCacheSetBuffer(WlBase *pBase, RsslBuffer *pCacheBuffer, RsslBuffer *pBuffer)
+{
+	if (pCacheBuffer->length == pBuffer->length
+			&& (!pBuffer->length || rsslBufferIsEqual(pCacheBuffer, pBuffer)))
+		return RSSL_TRUE;
+
+	wlSlabFree(&pBase->slab, pCacheBuffer->data);
+	rsslClearBuffer(pCacheBuffer);
+
+	if (!pBuffer->length)
+		return RSSL_TRUE;
+
+	if (!(pCacheBuffer->data = (char*)wlSlabAlloc(&pBase->slab, pBuffer->length)))
+		return RSSL_FALSE;
+
+	memcpy(pCacheBuffer->data, pBuffer->data, pBuffer->length);
+	pCacheBuffer->length = pBuffer->length;
+	return RSSL_TRUE;
+}
+
+void wlItemStreamCacheMsg(WlBase *pBase, WlItemStream *pItemStream, RsslMsg *pRsslMsg)
+{
+	WlItemCache *pCache = pItemStream->pCache;
+	RsslUInt8 majorVersion = RSSL_RWF_MAJOR_VERSION, minorVersion = RSSL_RWF_MINOR_VERSION;
+	RsslErrorInfo errorInfo;
+
+	if (!pBase->config.cacheItemImages || pItemStream->flags & WL_IOSF_PRIVATE)
+		return;
+
+	/* A viewed stream carries only part of the item. */
+	if (pItemStream->flags & WL_IOSF_VIEWED || pItemStream->requestsWithViewCount)
+	{
+		wlItemStreamInvalidateCache(pItemStream);
+		return;
+	}
+
+	if (pBase->pRsslChannel)
+	{
+		majorVersion = pBase->pRsslChannel->majorVersion;
+		minorVersion = pBase->pRsslChannel->minorVersion;
+	}
+
+	switch(pRsslMsg->msgBase.msgClass)
+	{
+		case RSSL_MC_REFRESH:
+		{
+			RsslRefreshMsg *pRefreshMsg = &pRsslMsg->refreshMsg;
+
+			if (pRsslMsg->msgBase.containerType != RSSL_DT_FIELD_LIST
+					|| pRefreshMsg->flags & RSSL_RFMF_DO_NOT_CACHE)
+			{
+				wlItemStreamInvalidateCache(pItemStream);
+				return;
+			}
+
+			if (!pCache)
+			{
+				if (!(pCache = (WlItemCache*)wlSlabAlloc(&pBase->slab, sizeof(WlItemCache))))
+					return;
+
+				memset(pCache, 0, sizeof(WlItemCache));
+				wlFieldImageInit(&pCache->image);
+				pItemStream->pCache = pCache;
+			}
+
+			/* Each new refresh starts a new image. Later parts of a refresh whose image was
+			 * discarded are ignored, since the earlier parts are missing. */
+			if (pRefreshMsg->flags & RSSL_RFMF_CLEAR_CACHE || !(pCache->flags & WL_ICF_IN_REFRESH))
+			{
+				if (!(pRefreshMsg->flags & RSSL_RFMF_CLEAR_CACHE)
+						&& ((pRefreshMsg->flags & RSSL_RFMF_HAS_PART_NUM) ? pRefreshMsg->partNum != 0
+							: !(pRefreshMsg->flags & RSSL_RFMF_REFRESH_COMPLETE)))
+				{
+					wlItemStreamInvalidateCache(pItemStream);
+					return;
+				}
+
+				wlFieldImageClear(&pCache->image);
+				pCache->flags = WL_ICF_IN_REFRESH;
+			}
+
+			if (wlFieldImageMerge(&pCache->image, &pRsslMsg->msgBase.encDataBody, majorVersion,
+						minorVersion, &errorInfo) != RSSL_RET_SUCCESS
+					|| !wlItemCacheSetBuffer(pBase, &pCache->groupId, &pRefreshMsg->groupId)
+					|| ((pRefreshMsg->flags & RSSL_RFMF_HAS_PERM_DATA)
+						&& !wlItemCacheSetBuffer(pBase, &pCache->permData, &pRefreshMsg->permData)))
+			{
+				wlItemStreamInvalidateCache(pItemStream);
+				return;
+			}
+
+			if (pRefreshMsg->flags & RSSL_RFMF_HAS_QOS)
+			{
+				pCache->qos = pRefreshMsg->qos;
+				pCache->flags |= WL_ICF_HAS_QOS;
+			}
+
+			if (pRefreshMsg->flags & RSSL_RFMF_REFRESH_COMPLETE)
+			{
+				pCache->flags &= ~WL_ICF_IN_REFRESH;
+				if (pRefreshMsg->state.streamState == RSSL_STREAM_OPEN
+						&& pRefreshMsg->state.dataState == RSSL_DATA_OK)
+					pCache->flags |= WL_ICF_COMPLETE;
+				else
+					wlItemStreamInvalidateCache(pItemStream);
+			}
+			return;
+		}
+
+		case RSSL_MC_UPDATE:
+			if (!pCache || !(pCache->flags & (WL_ICF_COMPLETE | WL_ICF_IN_REFRESH))
+					|| pRsslMsg->updateMsg.flags & RSSL_UPMF_DO_NOT_CACHE
+					|| pRsslMsg->msgBase.containerType == RSSL_DT_NO_DATA)
+				return;
+
+			if (pRsslMsg->msgBase.containerType != RSSL_DT_FIELD_LIST
+					|| wlFieldImageMerge(&pCache->image, &pRsslMsg->msgBase.encDataBody,
+						majorVersion, minorVersion, &errorInfo) != RSSL_RET_SUCCESS
+					|| ((pRsslMsg->updateMsg.flags & RSSL_UPMF_HAS_PERM_DATA)
+						&& !wlItemCacheSetBuffer(pBase, &pCache->permData, &pRsslMsg->updateMsg.permData)))
+				wlItemStreamInvalidateCache(pItemStream);
+			return;
+
+		case RSSL_MC_STATUS:
+		{
+			RsslStatusMsg *pStatusMsg = &pRsslMsg->statusMsg;
+
+			if (!pCache)
+				return;
+
+			if ((pStatusMsg->flags & RSSL_STMF_CLEAR_CACHE)
+					|| ((pStatusMsg->flags & RSSL_STMF_HAS_STATE)
+						&& (pStatusMsg->state.streamState != RSSL_STREAM_OPEN
+							|| pStatusMsg->state.dataState != RSSL_DATA_OK)))
+			{
+				wlItemStreamInvalidateCache(pItemStream);
+				return;
+			}
+
+			if (((pStatusMsg->flags & RSSL_STMF_HAS_GROUP_ID)
+						&& !wlItemCacheSetBuffer(pBase, &pCache->groupId, &pStatusMsg->groupId))
+					|| ((pStatusMsg->flags & RSSL_STMF_HAS_PERM_DATA)
+						&& !wlItemCacheSetBuffer(pBase, &pCache->permData, &pStatusMsg->permData)))
+				wlItemStreamInvalidateCache(pItemStream);
+			return;
+		}
+
+		default:
+			return;
+	}
+}
+
 static void wlItemStreamMergePriorityFromRequest(WlItemRequest *pItemRequest,
 		RsslUInt8 *pPriorityClass, RsslUInt16 *pPriorityCount)
 {
@@ -466,8 +595,8 @@ RsslBool wlItemStreamMergePriority(WlItemStream *pItemStream, RsslUInt8 *pPriori
 	return (*pPriorityClass != origPriorityClass || *pPriorityCount != origPriorityCount);
 }
 
-RsslRet wlItemStreamAddRequestView(WlItemStream *pItemStream, WlItemRequest *pItemRequest, 
-		RsslErrorInfo *pErrorInfo)
+RsslRet wlItemStreamAddRequestView(WlBase *pBase, WlItemStream *pItemStream, 
+		WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
 {
 	if (!pItemRequest->pView)
 		return RSSL_RET_SUCCESS;
@@ -475,7 +604,7 @@ RsslRet wlItemStreamAddRequestView(WlItemStream *pItemStream, WlItemRequest *pIt
 	++pItemStream->requestsWithViewCount;
 	if (!pItemStream->pAggregateView)
 	{
-		if (!(pItemStream->pAggregateView = wlAggregateViewCreate(pErrorInfo)))
+		if (!(pItemStream->pAggregateView = wlAggregateViewCreate(&pBase->slab, pErrorInfo)))
 			return RSSL_RET_FAILURE;
 	}
 
@@ -645,8 +774,9 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 
 		pGroup->ftGroupId = ftGroupId;
 		pItems->ftGroupTable[ftGroupId] = pGroup;
-		rsslQueueAddLinkToBack(&pItems->ftGroupTimerQueue, &pGroup->qlGroups);
-		pGroup->expireTime = pBase->currentTime + pBase->pRsslChannel->pingTimeout * 1000;
+		wlTimerInit(&pGroup->timer, WL_TMT_FTGROUP);
+		wlTimerWheelArm(&pBase->timerWheel, &pGroup->timer, pBase->currentTime,
+				pBase->pRsslChannel->pingTimeout * 1000);
 		pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 		rsslInitQueue(&pGroup->openStreamList);
 		
@@ -658,7 +788,7 @@ RsslRet wlFTGroupAddStream(WlBase *pBase, WlItems *pItems, RsslUInt8 ftGroupId,
 	return RSSL_RET_SUCCESS;
 }
 
-void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream)
+void wlFTGroupRemoveStream(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream)
 {
 	WlFTGroup *pGroup;
 
@@ -667,13 +797,13 @@ void wlFTGroupRemoveStream(WlItems *pItems, WlItemStream *pItemStream)
 	rsslQueueRemoveLink(&pGroup->openStreamList, &pItemStream->qlFTGroup);
 	if (pItems->pCurrentFanoutFTGroup != pGroup
 			&& !rsslQueueGetElementCount(&pGroup->openStreamList))
-		wlFTGroupRemove(pItems, pGroup); /* Group is now empty, so remove it. */
+		wlFTGroupRemove(pBase, pItems, pGroup); /* Group is now empty, so remove it. */
 }
 
-void wlFTGroupRemove(WlItems *pItems, WlFTGroup *pGroup)
+void wlFTGroupRemove(WlBase *pBase, WlItems *pItems, WlFTGroup *pGroup)
 {
 	pItems->ftGroupTable[pGroup->ftGroupId] = NULL;
-	rsslQueueRemoveLink(&pItems->ftGroupTimerQueue, &pGroup->qlGroups);
+	wlTimerWheelCancel(&pBase->timerWheel, &pGroup->timer);
 	free(pGroup);
 }
 
@@ -684,7 +814,7 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 {
 	RsslRequestMsg *pRequestMsg = pOpts->pRequestMsg;
 	WlItemStream *pItemStream = (WlItemStream*)pItemRequest->base.pStream;
-	RsslUInt16 msgKeyFlags;
+	RsslMsgKey msgKey;
 	RsslRet ret;
 
 	assert(pRequestMsg);
@@ -729,14 +859,14 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 	/* Match key. */
 
 	/* Name is not required for reissue request, so only match it if it's present. */
-	msgKeyFlags = pItemRequest->msgKey.flags;
+	msgKey = *wlItemKeyTableGetMsgKey(&pBase->itemKeys, pItemRequest->itemKey);
 	if (!(pRequestMsg->msgBase.msgKey.flags & RSSL_MKF_HAS_NAME))
-		pItemRequest->msgKey.flags &= ~RSSL_MKF_HAS_NAME;
+		msgKey.flags &= ~RSSL_MKF_HAS_NAME;
 
 	if (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME)
 		pRequestMsg->msgBase.msgKey.flags &= ~RSSL_MKF_HAS_SERVICE_ID;
 
-	if (rsslCompareMsgKeys(&pItemRequest->msgKey, 
+	if (rsslCompareMsgKeys(&msgKey, 
 				&pRequestMsg->msgBase.msgKey) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_INVALID_DATA, __FILE__, __LINE__, 
@@ -744,8 +874,6 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 		return RSSL_RET_INVALID_DATA;
 	}
 
-	pItemRequest->msgKey.flags = msgKeyFlags;
-
 	/* Match service name. */
 	if (pItemRequest->pRequestedService->flags & WL_RSVC_HAS_NAME
 			&& !pOpts->pServiceName
@@ -809,7 +937,7 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 			else
 				pOldView = NULL;
 
-			if (!(pItemRequest->pView = wlViewCreate(pOpts->viewElemList, 
+			if (!(pItemRequest->pView = wlViewCreate(&pBase->slab, pOpts->viewElemList, 
 					pOpts->viewElemCount, pOpts->viewType, pErrorInfo)))
 			{
 				pItemRequest->pView = pOldView;
@@ -818,16 +946,16 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 
 			if (pItemStream) 
 			{
-				if ((ret = wlItemStreamAddRequestView(pItemStream, pItemRequest, pErrorInfo)) != RSSL_RET_SUCCESS)
+				if ((ret = wlItemStreamAddRequestView(pBase, pItemStream, pItemRequest, pErrorInfo)) != RSSL_RET_SUCCESS)
 				{
-					wlViewDestroy(pItemRequest->pView);
+					wlViewDestroy(&pBase->slab, pItemRequest->pView);
 					pItemRequest->pView = pOldView;
 					return ret;
 				}
 			}
 
 			if (pOldView)
-				wlViewDestroy(pOldView);
+				wlViewDestroy(&pBase->slab, pOldView);
 
 			break;
 		}
@@ -842,7 +970,7 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 				if (pItemStream) 
 					wlItemStreamRemoveRequestView(pItemStream, pItemRequest);
 
-				wlViewDestroy(pItemRequest->pView);
+				wlViewDestroy(&pBase->slab, pItemRequest->pView);
 				pItemRequest->pView = NULL;
 			}
 			break;
@@ -881,6 +1009,9 @@ RsslRet wlItemRequestReissue(WlBase *pBase, WlItems *pItems, WlItemRequest *pIte
 			pItemStream->flags |= WL_IOSF_PENDING_PRIORITY_CHANGE;
 	}
 
+	if ((ret = wlItemRequestSetConflation(pItemRequest, pOpts, pErrorInfo)) != RSSL_RET_SUCCESS)
+		return ret;
+
 	if ((ret = _wlItemRequestSaveExtraInfo(pItemRequest, pRequestMsg, pErrorInfo))
 			   	< RSSL_RET_SUCCESS)
 		return ret;
@@ -934,7 +1065,7 @@ RsslRet wlItemRequestCreate(WlBase *pBase, WlItems *pItems, WlItemRequestCreateO
 }
 
 
-RsslRet wlItemRequestCleanup(WlItemRequest *pItemRequest)
+RsslRet wlItemRequestCleanup(WlBase *pBase, WlItemRequest *pItemRequest)
 {
 	if (pItemRequest->encDataBody.data != NULL)
 		free(pItemRequest->encDataBody.data);
@@ -942,11 +1073,14 @@ RsslRet wlItemRequestCleanup(WlItemRequest *pItemRequest)
 	if (pItemRequest->extendedHeader.data != NULL)
 		free(pItemRequest->extendedHeader.data);
 
-	if (pItemRequest->msgKeyMemoryBuffer)
-		free(pItemRequest->msgKeyMemoryBuffer);
+	if (pItemRequest->itemKey != WL_ITEM_KEY_NONE)
+		wlItemKeyTableRelease(&pBase->itemKeys, pItemRequest->itemKey);
 
 	if (pItemRequest->pView)
-		wlViewDestroy(pItemRequest->pView);
+		wlViewDestroy(&pBase->slab, pItemRequest->pView);
+
+	if (pItemRequest->pConflation)
+		wlItemConflationDestroy(pBase, pItemRequest->pConflation);
 
 	return RSSL_RET_SUCCESS;
 }
@@ -1235,12 +1369,108 @@ RsslRet wlExtractViewFromMsg(WlBase *pBase, WlItemRequestCreateOpts *pOpts,
 }
 
 
+/* Checks whether a request joining a stream can be refreshed from the stream's cached image,
+ * instead of requesting a refresh from the provider. */
+static RsslBool wlItemStreamCanRefreshFromCache(WlBase *pBase, WlItemStream *pItemStream,
+		WlItemRequest *pItemRequest)
+{
+	return pItemStream->pCache
+		&& pItemStream->pCache->flags & WL_ICF_COMPLETE
+		&& pBase->pRsslChannel
+		&& pItemStream->refreshState == WL_ISRS_NONE
+		&& pItemStream->flags & WL_IOSF_ESTABLISHED
+		&& !(pItemStream->flags & (WL_IOSF_PENDING_SNAPSHOT | WL_IOSF_PAUSED | WL_IOSF_VIEWED
+				| WL_IOSF_PENDING_VIEW_CHANGE | WL_IOSF_PENDING_VIEW_REFRESH | WL_IOSF_PRIVATE
+				| WL_IOSF_QUALIFIED | WL_IOSF_HAS_BC_SEQ_GAP | WL_IOSF_HAS_PART_GAP
+				| WL_IOSF_BC_BEHIND_UC))
+		&& !pItemStream->requestsWithViewCount
+		&& pItemRequest->base.domainType != RSSL_DMT_SYMBOL_LIST
+		&& pItemRequest->requestMsgFlags & RSSL_RQMF_STREAMING
+		&& !(pItemRequest->requestMsgFlags & (RSSL_RQMF_PAUSE | RSSL_RQMF_NO_REFRESH))
+		&& !(pItemRequest->flags & WL_IRQF_PROV_DRIVEN)
+		&& !pItemRequest->pView;
+}
+
+/* Refreshes a request from its stream's cached image. The request is opened before the refresh
+ * is delivered, as it may be closed from the callback. Sets *pRefreshed to RSSL_FALSE, leaving
+ * the request unchanged, if the image could not be encoded. */
+static RsslRet wlItemStreamRefreshFromCache(WlBase *pBase, WlItemStream *pItemStream,
+		WlItemRequest *pItemRequest, RsslBool *pRefreshed, RsslErrorInfo *pErrorInfo)
+{
+	WlItemCache *pCache = pItemStream->pCache;
+	RsslMsgKey *pMsgKey = wlItemKeyTableGetMsgKey(&pBase->itemKeys, pItemRequest->itemKey);
+	RsslRefreshMsg refreshMsg;
+	RsslEncodeIterator eIter;
+	RsslBuffer encodeBuffer;
+	RsslRet ret;
+
+	*pRefreshed = RSSL_FALSE;
+
+	encodeBuffer.length = wlFieldImageEstimateEncodedLength(&pCache->image);
+	if (!(encodeBuffer.data = (char*)wlSlabAlloc(&pBase->slab, encodeBuffer.length)))
+		return RSSL_RET_SUCCESS;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, pBase->pRsslChannel->majorVersion,
+			pBase->pRsslChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, &encodeBuffer);
+
+	if (wlFieldImageEncode(&pCache->image, &eIter) != RSSL_RET_SUCCESS)
+	{
+		wlSlabFree(&pBase->slab, encodeBuffer.data);
+		return RSSL_RET_SUCCESS;
+	}
+
+	rsslClearRefreshMsg(&refreshMsg);
+	refreshMsg.msgBase.domainType = pItemRequest->base.domainType;
+	refreshMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	refreshMsg.msgBase.encDataBody.data = encodeBuffer.data;
+	refreshMsg.msgBase.encDataBody.length = rsslGetEncodedBufferLength(&eIter);
+	refreshMsg.flags = RSSL_RFMF_REFRESH_COMPLETE | RSSL_RFMF_CLEAR_CACHE | RSSL_RFMF_HAS_MSG_KEY;
+	refreshMsg.msgBase.msgKey = *pMsgKey;
+	if (!(pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID))
+		wlItemRequestAddServiceIdToKey(pItemRequest, &refreshMsg.msgBase.msgKey);
+
+	refreshMsg.groupId = pCache->groupId;
+	refreshMsg.state.streamState = RSSL_STREAM_OPEN;
+	refreshMsg.state.dataState = RSSL_DATA_OK;
+	refreshMsg.state.code = RSSL_SC_NONE;
+
+	if (pCache->flags & WL_ICF_HAS_QOS)
+	{
+		refreshMsg.flags |= RSSL_RFMF_HAS_QOS;
+		refreshMsg.qos = pCache->qos;
+	}
+
+	if (pCache->permData.length)
+	{
+		refreshMsg.flags |= RSSL_RFMF_HAS_PERM_DATA;
+		refreshMsg.permData = pCache->permData;
+	}
+
+	refreshMsg.flags |= RSSL_RFMF_SOLICITED;
+
+	wlItemRequestEstablishQos(pItemRequest, &pItemStream->streamAttributes.qos);
+	pItemRequest->flags |= WL_IRQF_REFRESHED;
+	rsslQueueAddLinkToBack(&pItemStream->requestsOpen, &pItemRequest->base.qlStateQueue);
+	pItemRequest->base.pStateQueue = &pItemStream->requestsOpen;
+
+	/* Priority may still need to change. */
+	wlItemStreamSetMsgPending(pBase, pItemStream, RSSL_FALSE);
+
+	*pRefreshed = RSSL_TRUE;
+	ret = wlItemRequestSendMsg(pBase, pItemRequest, (RsslMsg*)&refreshMsg, pErrorInfo);
+	wlSlabFree(&pBase->slab, encodeBuffer.data);
+	return ret;
+}
+
 RsslRet wlItemStreamAddRequest(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStream,
 		WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
 {
 	RsslRet ret;
+	RsslBool isReissue = pItemRequest->base.pStream != NULL;
 
-	if (pItemRequest->base.pStream)
+	if (isReissue)
 	{
 		/* This is a reissue. */
 		assert((WlItemStream*)pItemRequest->base.pStream == pItemStream);
@@ -1285,7 +1515,7 @@ RsslRet wlItemStreamAddRequest(WlBase *pBase, WlItems *pItems, WlItemStream *pIt
 				++pItemStream->requestsPausedCount;
 		}
 
-		if ((ret = wlItemStreamAddRequestView(pItemStream, pItemRequest, pErrorInfo))
+		if ((ret = wlItemStreamAddRequestView(pBase, pItemStream, pItemRequest, pErrorInfo))
 				!= RSSL_RET_SUCCESS)
 			return ret;
 
@@ -1320,6 +1550,17 @@ RsslRet wlItemStreamAddRequest(WlBase *pBase, WlItems *pItems, WlItemStream *pIt
 		}
 		else
 		{
+			/* A new request may be refreshed from the cached image. Reissues are submitted
+			 * by the application, so their refreshes are left to arrive from the provider. */
+			if (!isReissue && wlItemStreamCanRefreshFromCache(pBase, pItemStream, pItemRequest))
+			{
+				RsslBool refreshed;
+
+				if ((ret = wlItemStreamRefreshFromCache(pBase, pItemStream, pItemRequest,
+								&refreshed, pErrorInfo)) != RSSL_RET_SUCCESS || refreshed)
+					return ret;
+			}
+
 			/* No requests pending. Send request. */
 			rsslQueueAddLinkToBack(&pItemStream->requestsRecovering, &pItemRequest->base.qlStateQueue);
 			pItemRequest->base.pStateQueue = &pItemStream->requestsRecovering;
@@ -1342,6 +1583,7 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 	RsslHashLink *pHashLink;
 	const RsslQos *pMatchingQos = NULL;
 	WlStreamAttributes streamAttributes;
+	RsslMsgKey *pMsgKey;
 	WlItemStream *pStream;
 	RsslStatusMsg statusMsg;
 	RsslWatchlistMsgEvent msgEvent;
@@ -1400,10 +1642,30 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 		}
 
 
+		/* The stream's key is the request's key, with the service ID. Take a reference
+		 * to it for the stream. */
+		pMsgKey = wlItemKeyTableGetMsgKey(&pBase->itemKeys, pItemRequest->itemKey);
+		if (pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID
+				&& pMsgKey->serviceId == (RsslUInt16)pWlService->pService->rdm.serviceId)
+		{
+			streamAttributes.itemKey = pItemRequest->itemKey;
+			wlItemKeyTableAddRef(&pBase->itemKeys, streamAttributes.itemKey);
+		}
+		else
+		{
+			RsslMsgKey streamMsgKey = *pMsgKey;
+
+			streamMsgKey.flags |= RSSL_MKF_HAS_SERVICE_ID;
+			streamMsgKey.serviceId = (RsslUInt16)pWlService->pService->rdm.serviceId;
+
+			if ((streamAttributes.itemKey = wlItemKeyTableIntern(&pBase->itemKeys, &streamMsgKey,
+							pErrorInfo)) == WL_ITEM_KEY_NONE)
+				return pErrorInfo->rsslError.rsslErrorId;
+		}
+
 		streamAttributes.domainType = pItemRequest->base.domainType;
-		streamAttributes.msgKey = pItemRequest->msgKey;
-		streamAttributes.msgKey.flags |= RSSL_MKF_HAS_SERVICE_ID;
-		streamAttributes.msgKey.serviceId = (RsslUInt16)pWlService->pService->rdm.serviceId;
+		streamAttributes.keyHashSum = rsslMsgKeyHash(wlItemKeyTableGetMsgKey(&pBase->itemKeys, 
+					streamAttributes.itemKey));
 		streamAttributes.qos = *pMatchingQos;
 		streamAttributes.hasQos = RSSL_TRUE;
 
@@ -1412,7 +1674,7 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 		if (!(pItemRequest->flags & WL_IRQF_PRIVATE))
 		{
 			hashSum = wlStreamAttributesHashSum(&streamAttributes);
-			pHashLink = rsslHashTableFind(&pBase->openStreamsByAttrib,
+			pHashLink = rsslOpenHashTableFind(&pBase->openStreamsByAttrib,
 					(void*)&streamAttributes, &hashSum);
 		}
 		else
@@ -1421,15 +1683,39 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 		if (pHashLink)
 		{
 			pStream = RSSL_HASH_LINK_TO_OBJECT(WlItemStream, hlStreamsByAttrib, pHashLink);
+
+			/* The stream already holds a reference to the key. */
+			wlItemKeyTableRelease(&pBase->itemKeys, streamAttributes.itemKey);
 		}
 		else 
 		{
-			pStream = wlCreateItemStream(pBase, &streamAttributes, pErrorInfo);
+			if (!(pStream = wlCreateItemStream(pBase, &streamAttributes, pErrorInfo)))
+			{
+				wlItemKeyTableRelease(&pBase->itemKeys, streamAttributes.itemKey);
+				return pErrorInfo->rsslError.rsslErrorId;
+			}
+
+			if (rsslOpenHashTableInsertLink(&pBase->streamsById, &pStream->base.hlStreamId,
+					(void*)&pStream->base.streamId, NULL) != RSSL_RET_SUCCESS)
+			{
+				wlItemStreamDestroy(pBase, pStream);
+				rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+						"Memory allocation failure.");
+				return RSSL_RET_FAILURE;
+			}
 
 			if (!(pItemRequest->flags & WL_IRQF_PRIVATE))
 			{
-				rsslHashTableInsertLink(&pBase->openStreamsByAttrib, 
-						&pStream->hlStreamsByAttrib, (void*)&pStream->streamAttributes, &hashSum);
+				if (rsslOpenHashTableInsertLink(&pBase->openStreamsByAttrib, 
+						&pStream->hlStreamsByAttrib, (void*)&pStream->streamAttributes, &hashSum)
+						!= RSSL_RET_SUCCESS)
+				{
+					rsslOpenHashTableRemoveLink(&pBase->streamsById, &pStream->base.hlStreamId);
+					wlItemStreamDestroy(pBase, pStream);
+					rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+							"Memory allocation failure.");
+					return RSSL_RET_FAILURE;
+				}
 			}
 			else
 			{
@@ -1455,6 +1741,8 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 									 &pErrorInfo->rsslError)) != RSSL_RET_SUCCESS)
 			{
 				rsslSetErrorInfoLocation(pErrorInfo, __FILE__, __LINE__);
+				rsslOpenHashTableRemoveLink(&pBase->openStreamsByAttrib, &pStream->hlStreamsByAttrib);
+				rsslOpenHashTableRemoveLink(&pBase->streamsById, &pStream->base.hlStreamId);
 				wlItemStreamDestroy(pBase, pStream);
 				return ret;
 			}
@@ -1463,9 +1751,6 @@ RsslRet wlItemRequestFindStream(WlBase *pBase, WlItems *pItems, WlItemRequest *p
 
 			rsslQueueAddLinkToBack(&pWlService->openStreamList, &pStream->qlServiceStreams);
 			rsslQueueAddLinkToBack(&pBase->openStreams, &pStream->base.qlStreamsList);
-			rsslHashTableInsertLink(&pBase->streamsById, &pStream->base.hlStreamId,
-					(void*)&pStream->base.streamId, NULL);
-
 		}
 
 		rsslQueueRemoveLink(&pItemRequest->pRequestedService->recoveringList, 
@@ -1531,6 +1816,25 @@ static void wlItemRequestAddServiceIdToKey(WlItemRequest *pItemRequest, RsslMsgK
 
 RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
+{
+	if (pItemRequest->pConflation)
+	{
+		RsslBool held;
+		RsslRet ret;
+
+		if ((ret = wlItemRequestConflateMsg(pBase, pItemRequest, pEvent->pRsslMsg, &held,
+						pErrorInfo)) != RSSL_RET_SUCCESS)
+			return ret;
+
+		if (held)
+			return RSSL_RET_SUCCESS;
+	}
+
+	return wlItemRequestDeliverMsgEvent(pBase, pEvent, pItemRequest, pErrorInfo);
+}
+
+static RsslRet wlItemRequestDeliverMsgEvent(WlBase *pBase,
+		RsslWatchlistMsgEvent *pEvent, WlItemRequest *pItemRequest, RsslErrorInfo *pErrorInfo)
 {
 	RsslRet ret;
 	RsslMsg rsslMsg, *pRsslMsg;
@@ -1558,6 +1862,8 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 	}
 	else
 	{
+		RsslMsgKey *pMsgKey = wlItemKeyTableGetMsgKey(&pBase->itemKeys, pItemRequest->itemKey);
+
 		pRsslMsg = pEvent->pRsslMsg;
 		pItemRequest->flags |= WL_IRQF_HAS_PROV_KEY;
 
@@ -1569,9 +1875,9 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 				{
 					rsslMsg.refreshMsg = pEvent->pRsslMsg->refreshMsg;
 					rsslMsg.refreshMsg.flags |= RSSL_RFMF_HAS_MSG_KEY;
-					rsslMsg.refreshMsg.msgBase.msgKey = pItemRequest->msgKey;
+					rsslMsg.refreshMsg.msgBase.msgKey = *pMsgKey;
 
-					if (!(pItemRequest->msgKey.flags & RSSL_MKF_HAS_SERVICE_ID))
+					if (!(pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID))
 						wlItemRequestAddServiceIdToKey(pItemRequest, &rsslMsg.msgBase.msgKey);
 
 					pEvent->pRsslMsg = &rsslMsg;
@@ -1582,9 +1888,9 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 				{
 					rsslMsg.updateMsg = pEvent->pRsslMsg->updateMsg;
 					rsslMsg.updateMsg.flags |= RSSL_UPMF_HAS_MSG_KEY;
-					rsslMsg.updateMsg.msgBase.msgKey = pItemRequest->msgKey;
+					rsslMsg.updateMsg.msgBase.msgKey = *pMsgKey;
 
-					if (!(pItemRequest->msgKey.flags & RSSL_MKF_HAS_SERVICE_ID))
+					if (!(pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID))
 						wlItemRequestAddServiceIdToKey(pItemRequest, &rsslMsg.msgBase.msgKey);
 
 					pEvent->pRsslMsg = &rsslMsg;
@@ -1595,9 +1901,9 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 				{
 					rsslMsg.statusMsg = pEvent->pRsslMsg->statusMsg;
 					rsslMsg.statusMsg.flags |= RSSL_STMF_HAS_MSG_KEY;
-					rsslMsg.statusMsg.msgBase.msgKey = pItemRequest->msgKey;
+					rsslMsg.statusMsg.msgBase.msgKey = *pMsgKey;
 
-					if (!(pItemRequest->msgKey.flags & RSSL_MKF_HAS_SERVICE_ID))
+					if (!(pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID))
 						wlItemRequestAddServiceIdToKey(pItemRequest, &rsslMsg.msgBase.msgKey);
 
 					pEvent->pRsslMsg = &rsslMsg;
@@ -1608,9 +1914,9 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 				{
 					rsslMsg.genericMsg = pEvent->pRsslMsg->genericMsg;
 					rsslMsg.genericMsg.flags |= RSSL_GNMF_HAS_MSG_KEY;
-					rsslMsg.genericMsg.msgBase.msgKey = pItemRequest->msgKey;
+					rsslMsg.genericMsg.msgBase.msgKey = *pMsgKey;
 
-					if (!(pItemRequest->msgKey.flags & RSSL_MKF_HAS_SERVICE_ID))
+					if (!(pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID))
 						wlItemRequestAddServiceIdToKey(pItemRequest, &rsslMsg.msgBase.msgKey);
 
 					pEvent->pRsslMsg = &rsslMsg;
@@ -1621,9 +1927,9 @@ RsslRet wlItemRequestSendMsgEvent(WlBase *pBase,
 				{
 					rsslMsg.ackMsg = pEvent->pRsslMsg->ackMsg;
 					rsslMsg.ackMsg.flags |= RSSL_AKMF_HAS_MSG_KEY;
-					rsslMsg.ackMsg.msgBase.msgKey = pItemRequest->msgKey;
+					rsslMsg.ackMsg.msgBase.msgKey = *pMsgKey;
 
-					if (!(pItemRequest->msgKey.flags & RSSL_MKF_HAS_SERVICE_ID))
+					if (!(pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID))
 						wlItemRequestAddServiceIdToKey(pItemRequest, &rsslMsg.msgBase.msgKey);
 
 					pEvent->pRsslMsg = &rsslMsg;
@@ -1658,6 +1964,230 @@ RsslRet wlItemRequestSendMsg(WlBase *pBase,
 
 }
 
+static RsslRet wlItemRequestSetConflation(WlItemRequest *pItemRequest, WlItemRequestCreateOpts *pOpts,
+		RsslErrorInfo *pErrorInfo)
+{
+	WlItemConflation *pConflation = pItemRequest->pConflation;
+
+	/* Once conflated, a request keeps its state so that any update waiting in it is still
+	 * delivered; an interval of 0 then only passes updates through. */
+	if (!pConflation)
+	{
+		if (!pOpts->conflationInterval)
+			return RSSL_RET_SUCCESS;
+
+		pConflation = (WlItemConflation*)malloc(sizeof(WlItemConflation));
+		verify_malloc(pConflation, pErrorInfo, RSSL_RET_FAILURE);
+
+		memset(pConflation, 0, sizeof(WlItemConflation));
+		wlTimerInit(&pConflation->timer, WL_TMT_CONFLATION);
+		wlFieldImageInit(&pConflation->image);
+		pConflation->pItemRequest = pItemRequest;
+		pItemRequest->pConflation = pConflation;
+	}
+
+	pConflation->interval = pOpts->conflationInterval;
+	pConflation->bypassUpdateTypes = pOpts->conflationBypassUpdateTypes;
+	return RSSL_RET_SUCCESS;
+}
+
+static void wlItemConflationDestroy(WlBase *pBase, WlItemConflation *pConflation)
+{
+	wlTimerWheelCancel(&pBase->timerWheel, &pConflation->timer);
+	wlFieldImageCleanup(&pConflation->image);
+	free(pConflation->encodeBuffer.data);
+	free(pConflation);
+}
+
+/* Discards the conflated update, if any. */
+static void wlItemConflationClear(WlBase *pBase, WlItemConflation *pConflation)
+{
+	wlFieldImageClear(&pConflation->image);
+	wlTimerWheelCancel(&pBase->timerWheel, &pConflation->timer);
+	pConflation->updateCount = 0;
+}
+
+/* Removes fields that were delivered by another message from the conflated update,
+ * since that message carried newer values. */
+static void wlItemConflationRemoveFields(WlBase *pBase, WlItemConflation *pConflation,
+		RsslBuffer *pEncFieldList, RsslUInt8 majorVersion, RsslUInt8 minorVersion)
+{
+	if (wlFieldImageIsEmpty(&pConflation->image))
+		return;
+
+	/* If the fields can't be identified, the waiting values are still delivered. */
+	if (wlFieldImageRemoveFields(&pConflation->image, pEncFieldList, majorVersion, minorVersion)
+			!= RSSL_RET_SUCCESS)
+		return;
+
+	if (wlFieldImageIsEmpty(&pConflation->image))
+		wlItemConflationClear(pBase, pConflation);
+}
+
+static RsslRet wlItemRequestConflateMsg(WlBase *pBase, WlItemRequest *pItemRequest,
+		RsslMsg *pRsslMsg, RsslBool *pHeld, RsslErrorInfo *pErrorInfo)
+{
+	WlItemConflation *pConflation = pItemRequest->pConflation;
+	RsslUInt8 majorVersion = RSSL_RWF_MAJOR_VERSION, minorVersion = RSSL_RWF_MINOR_VERSION;
+	RsslRet ret;
+
+	*pHeld = RSSL_FALSE;
+
+	if (pBase->pRsslChannel)
+	{
+		majorVersion = pBase->pRsslChannel->majorVersion;
+		minorVersion = pBase->pRsslChannel->minorVersion;
+	}
+
+	switch(pRsslMsg->msgBase.msgClass)
+	{
+		case RSSL_MC_UPDATE:
+		{
+			RsslUpdateMsg *pUpdateMsg = &pRsslMsg->updateMsg;
+
+			if (pRsslMsg->msgBase.containerType != RSSL_DT_FIELD_LIST)
+				return RSSL_RET_SUCCESS;
+
+			if ((pUpdateMsg->flags & RSSL_UPMF_DO_NOT_CONFLATE)
+					|| (pUpdateMsg->updateType < 32 
+						&& (pConflation->bypassUpdateTypes & (1U << pUpdateMsg->updateType))))
+			{
+				wlItemConflationRemoveFields(pBase, pConflation, &pRsslMsg->msgBase.encDataBody,
+						majorVersion, minorVersion);
+				return RSSL_RET_SUCCESS;
+			}
+
+			if (wlFieldImageIsEmpty(&pConflation->image)
+					&& pBase->currentTime >= pConflation->nextUpdateTime)
+			{
+				pConflation->nextUpdateTime = pBase->currentTime + pConflation->interval;
+				return RSSL_RET_SUCCESS;
+			}
+
+			if ((ret = wlFieldImageMerge(&pConflation->image, &pRsslMsg->msgBase.encDataBody,
+						majorVersion, minorVersion, pErrorInfo)) != RSSL_RET_SUCCESS)
+			{
+				/* The merge may have stopped partway.  If nothing was held before, the image
+				 * holds only part of this update and no timer would deliver it, so drop it. */
+				if (!wlTimerIsArmed(&pConflation->timer))
+					wlItemConflationClear(pBase, pConflation);
+
+				if (ret == RSSL_RET_FAILURE)
+					return ret;
+
+				/* Can't be merged (e.g. set-defined data), so deliver it as it is. */
+				return RSSL_RET_SUCCESS;
+			}
+
+			pConflation->updateCount += (pUpdateMsg->flags & RSSL_UPMF_HAS_CONF_INFO) ?
+				pUpdateMsg->conflationCount : 1;
+			pConflation->updateType = pUpdateMsg->updateType;
+			*pHeld = RSSL_TRUE;
+
+			if (!wlTimerIsArmed(&pConflation->timer))
+			{
+				wlTimerWheelArm(&pBase->timerWheel, &pConflation->timer, pBase->currentTime,
+						pConflation->nextUpdateTime > pBase->currentTime ? 
+						pConflation->nextUpdateTime - pBase->currentTime : 0);
+				pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+			}
+
+			return RSSL_RET_SUCCESS;
+		}
+
+		case RSSL_MC_REFRESH:
+			/* The refresh carries the latest values of its fields. */
+			if (pRsslMsg->refreshMsg.flags & RSSL_RFMF_CLEAR_CACHE)
+				wlItemConflationClear(pBase, pConflation);
+			else if (pRsslMsg->msgBase.containerType == RSSL_DT_FIELD_LIST)
+				wlItemConflationRemoveFields(pBase, pConflation, &pRsslMsg->msgBase.encDataBody,
+						majorVersion, minorVersion);
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_MC_STATUS:
+		{
+			RsslStatusMsg *pStatusMsg = &pRsslMsg->statusMsg;
+
+			/* The held values are stale once the stream is no longer open and ok; the next
+			 * refresh brings the current ones. */
+			if ((pStatusMsg->flags & RSSL_STMF_CLEAR_CACHE)
+					|| ((pStatusMsg->flags & RSSL_STMF_HAS_STATE)
+						&& (pStatusMsg->state.streamState != RSSL_STREAM_OPEN
+							|| pStatusMsg->state.dataState != RSSL_DATA_OK)))
+				wlItemConflationClear(pBase, pConflation);
+			return RSSL_RET_SUCCESS;
+		}
+
+		default:
+			return RSSL_RET_SUCCESS;
+	}
+}
+
+RsslRet wlItemRequestProcessConflationTimer(WlBase *pBase, WlItemConflation *pConflation,
+		RsslErrorInfo *pErrorInfo)
+{
+	WlItemRequest *pItemRequest = pConflation->pItemRequest;
+	RsslUInt32 encodedLength;
+	RsslEncodeIterator eIter;
+	RsslUpdateMsg updateMsg;
+	RsslWatchlistMsgEvent msgEvent;
+	RsslRet ret;
+
+	if (wlFieldImageIsEmpty(&pConflation->image))
+		return RSSL_RET_SUCCESS;
+
+	/* Only an open request gets the conflated update; one waiting for a refresh gets that instead. */
+	if (!pItemRequest->base.pStream
+			|| pItemRequest->base.pStateQueue != &((WlItemStream*)pItemRequest->base.pStream)->requestsOpen)
+	{
+		wlItemConflationClear(pBase, pConflation);
+		return RSSL_RET_SUCCESS;
+	}
+
+	encodedLength = wlFieldImageEstimateEncodedLength(&pConflation->image);
+	if (pConflation->encodeBuffer.length < encodedLength)
+	{
+		char *newData = (char*)realloc(pConflation->encodeBuffer.data, encodedLength);
+		verify_malloc(newData, pErrorInfo, RSSL_RET_FAILURE);
+		pConflation->encodeBuffer.data = newData;
+		pConflation->encodeBuffer.length = encodedLength;
+	}
+
+	rsslClearUpdateMsg(&updateMsg);
+	updateMsg.msgBase.domainType = pItemRequest->base.domainType;
+	updateMsg.msgBase.containerType = RSSL_DT_FIELD_LIST;
+	updateMsg.msgBase.encDataBody = pConflation->encodeBuffer;
+	updateMsg.updateType = pConflation->updateType;
+	updateMsg.flags = RSSL_UPMF_HAS_CONF_INFO;
+	updateMsg.conflationCount = (RsslUInt16)(pConflation->updateCount < 0x7fff ? 
+			pConflation->updateCount : 0x7fff);
+	updateMsg.conflationTime = (RsslUInt16)(pConflation->interval < 0xffff ?
+			pConflation->interval : 0xffff);
+
+	rsslClearEncodeIterator(&eIter);
+	if (pBase->pRsslChannel)
+		rsslSetEncodeIteratorRWFVersion(&eIter, pBase->pRsslChannel->majorVersion,
+				pBase->pRsslChannel->minorVersion);
+	rsslSetEncodeIteratorBuffer(&eIter, &updateMsg.msgBase.encDataBody);
+
+	if ((ret = wlFieldImageEncode(&pConflation->image, &eIter)) != RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__,
+				"Failed to encode conflated update.");
+		return ret;
+	}
+	updateMsg.msgBase.encDataBody.length = rsslGetEncodedBufferLength(&eIter);
+
+	/* Reset before delivering, as the request may be closed from the callback. */
+	wlFieldImageClear(&pConflation->image);
+	pConflation->updateCount = 0;
+	pConflation->nextUpdateTime = pBase->currentTime + pConflation->interval;
+
+	wlMsgEventClear(&msgEvent);
+	msgEvent.pRsslMsg = (RsslMsg*)&updateMsg;
+	return wlItemRequestDeliverMsgEvent(pBase, &msgEvent, pItemRequest, pErrorInfo);
+}
+
 void wlItemStreamRemoveRequest(WlItemStream *pItemStream, WlItemRequest *pItemRequest)
 {
 	assert(pItemRequest->base.pStream == &pItemStream->base);
@@ -1703,20 +2233,23 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 		wlItemGroupRemoveStream(pItems, pItemStream->pItemGroup, pItemStream);
 
 	if (pItemStream->pFTGroup)
-		wlFTGroupRemoveStream(pItems, pItemStream);
+		wlFTGroupRemoveStream(pBase, pItems, pItemStream);
 
 	if (!(pItemStream->flags & WL_IOSF_PRIVATE))
-		rsslHashTableRemoveLink(&pBase->openStreamsByAttrib, &pItemStream->hlStreamsByAttrib);
+		rsslOpenHashTableRemoveLink(&pBase->openStreamsByAttrib, &pItemStream->hlStreamsByAttrib);
 
 	if (pItemStream->flags & (WL_IOSF_HAS_BC_SEQ_GAP | WL_IOSF_HAS_PART_GAP | WL_IOSF_BC_BEHIND_UC))
 		rsslQueueRemoveLink(&pItems->gapStreamQueue, &pItemStream->qlGap);
 
 	rsslQueueRemoveLink(&pBase->openStreams, &pItemStream->base.qlStreamsList);
-	rsslHashTableRemoveLink(&pBase->streamsById, &pItemStream->base.hlStreamId);
+	rsslOpenHashTableRemoveLink(&pBase->streamsById, &pItemStream->base.hlStreamId);
 
 	if (pItemStream->refreshState != WL_ISRS_NONE)
 	{
-		if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
+		if (pItemStream->refreshState == WL_ISRS_PENDING_PACING)
+			wlRequestPacerRemove(&pBase->requestPacer, &pItemStream->qlOpenWindow,
+					pItemStream->pacingLevel);
+		else if (pItemStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW)
 			rsslQueueRemoveLink(&pItemStream->pWlService->streamsPendingWindow,
 					&pItemStream->qlOpenWindow);
 		else
@@ -1744,37 +2277,77 @@ RsslRet wlItemStreamClose(WlBase *pBase, WlItems *pItems, WlItemStream *pItemStr
 	return RSSL_RET_SUCCESS;
 }
 
+/* Requests a refresh for an item stream, if there is room in its service's OpenWindow. */
+static void wlItemStreamRequestRefresh(WlBase *pBase, WlItemStream *pItemStream)
+{
+	/* Check service open window before requesting. */
+	WlService *pWlService = pItemStream->pWlService;
+
+	assert(pItemStream->refreshState == WL_ISRS_NONE);
+
+	if ( pBase->config.obeyOpenWindow && pWlService->pService->rdm.flags & RDM_SVCF_HAS_LOAD
+			&& pWlService->pService->rdm.load.flags & RDM_SVC_LDF_HAS_OPEN_WINDOW
+			&& (pWlService->streamsPendingRefresh.count 
+				>= pWlService->pService->rdm.load.openWindow))
+	{
+		pItemStream->refreshState = WL_ISRS_PENDING_OPEN_WINDOW;
+		rsslQueueAddLinkToBack(&pWlService->streamsPendingWindow,
+				&pItemStream->qlOpenWindow);
+
+	}
+	else
+	{
+		wlSetStreamMsgPending(pBase, &pItemStream->base);
+		pItemStream->refreshState = WL_ISRS_REQUEST_REFRESH;
+		rsslQueueAddLinkToBack(&pWlService->streamsPendingRefresh,
+				&pItemStream->qlOpenWindow);
+	}
+}
+
+/* Arms the request pacer's timer, if streams are waiting for it. */
+static void wlItemStreamSetPacingTimer(WlBase *pBase)
+{
+	WlRequestPacer *pPacer = &pBase->requestPacer;
+
+	if (!pPacer->waitingCount || wlTimerIsArmed(&pPacer->timer))
+		return;
+
+	wlTimerWheelArm(&pBase->timerWheel, &pPacer->timer, pBase->currentTime,
+			wlRequestPacerGetWaitTime(pPacer, pBase->currentTime));
+	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
+}
+
 void wlItemStreamSetMsgPending(WlBase *pBase, WlItemStream *pItemStream, RsslBool requestRefresh)
 {
 	if (requestRefresh)
 	{
 		if (pItemStream->refreshState == WL_ISRS_NONE)
 		{
-			/* Check service open window before requesting. */
-			WlService *pWlService = pItemStream->pWlService;
-
-			if ( pBase->config.obeyOpenWindow && pWlService->pService->rdm.flags & RDM_SVCF_HAS_LOAD
-					&& pWlService->pService->rdm.load.flags & RDM_SVC_LDF_HAS_OPEN_WINDOW
-					&& (pWlService->streamsPendingRefresh.count 
-						>= pWlService->pService->rdm.load.openWindow))
+			/* Wait for the request pacer, if it has no request to spare. Waiting streams are
+			 * released by the priority class their requests will aggregate to. */
+			if (wlRequestPacerIsEnabled(&pBase->requestPacer)
+					&& !wlRequestPacerTryAcquire(&pBase->requestPacer, pBase->currentTime))
 			{
-				pItemStream->refreshState = WL_ISRS_PENDING_OPEN_WINDOW;
-				rsslQueueAddLinkToBack(&pWlService->streamsPendingWindow,
-						&pItemStream->qlOpenWindow);
+				RsslUInt8 priorityClass = pItemStream->priorityClass;
+				RsslUInt16 priorityCount = pItemStream->priorityCount;
+
+				wlItemStreamMergePriority(pItemStream, &priorityClass, &priorityCount);
 
+				pItemStream->refreshState = WL_ISRS_PENDING_PACING;
+				pItemStream->pacingLevel = wlRequestPacerGetLevel(priorityClass);
+				wlRequestPacerAdd(&pBase->requestPacer, &pItemStream->qlOpenWindow,
+						pItemStream->pacingLevel);
+				wlItemStreamSetPacingTimer(pBase);
 			}
 			else
-			{
-				wlSetStreamMsgPending(pBase, &pItemStream->base);
-				pItemStream->refreshState = WL_ISRS_REQUEST_REFRESH;
-				rsslQueueAddLinkToBack(&pWlService->streamsPendingRefresh,
-						&pItemStream->qlOpenWindow);
-			}
+				wlItemStreamRequestRefresh(pBase, pItemStream);
 		}
-		else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
+		else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW
+				&& pItemStream->refreshState != WL_ISRS_PENDING_PACING)
 			wlSetStreamMsgPending(pBase, &pItemStream->base);
 	}
-	else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW)
+	else if (pItemStream->refreshState != WL_ISRS_PENDING_OPEN_WINDOW
+			&& pItemStream->refreshState != WL_ISRS_PENDING_PACING)
 		wlSetStreamMsgPending(pBase, &pItemStream->base);
 }
 
@@ -1819,12 +2392,31 @@ void wlItemStreamCheckOpenWindow(WlBase *pBase, WlService *pWlService)
 
 			assert(pWaitingStream->refreshState == WL_ISRS_PENDING_OPEN_WINDOW);
 			
+			/* The stream has already been through the request pacer. */
 			pWaitingStream->refreshState = WL_ISRS_NONE;
-			wlItemStreamSetMsgPending(pBase, pWaitingStream, RSSL_TRUE);
+			wlItemStreamRequestRefresh(pBase, pWaitingStream);
 		}
 	}
 }
 
+void wlItemStreamProcessPacing(WlBase *pBase)
+{
+	RsslQueueLink *pLink;
+
+	while ((pLink = wlRequestPacerTake(&pBase->requestPacer, pBase->currentTime)))
+	{
+		WlItemStream *pWaitingStream = RSSL_QUEUE_LINK_TO_OBJECT(WlItemStream,
+				qlOpenWindow, pLink);
+
+		assert(pWaitingStream->refreshState == WL_ISRS_PENDING_PACING);
+
+		pWaitingStream->refreshState = WL_ISRS_NONE;
+		wlItemStreamRequestRefresh(pBase, pWaitingStream);
+	}
+
+	wlItemStreamSetPacingTimer(pBase);
+}
+
 void wlItemStreamProcessRefreshComplete(WlBase *pBase, WlItemStream *pItemStream)
 {
 	WlService *pWlService = pItemStream->pWlService;
@@ -1836,6 +2428,10 @@ void wlItemStreamProcessRefreshComplete(WlBase *pBase, WlItemStream *pItemStream
 	rsslQueueRemoveLink(&pWlService->streamsPendingRefresh, &pItemStream->qlOpenWindow);
 	pItemStream->refreshState = WL_ISRS_NONE;
 
+	if (wlRequestPacerIsEnabled(&pBase->requestPacer))
+		wlRequestPacerProcessLatency(&pBase->requestPacer,
+				pBase->currentTime - pItemStream->refreshRequestTime, pBase->currentTime);
+
 	wlItemStreamCheckOpenWindow(pBase, pWlService);
 }
 
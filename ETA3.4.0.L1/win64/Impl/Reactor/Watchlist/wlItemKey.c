@@ -0,0 +1,328 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/wlItemKey.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Flags that are part of a key's identity. RSSL_MKF_HAS_NAME_TYPE is not, since
+ * rsslCompareMsgKeys() treats a missing name type as name type 1. */
+#define WL_ITEM_KEY_FLAGS (RSSL_MKF_HAS_SERVICE_ID | RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_FILTER \
+		| RSSL_MKF_HAS_IDENTIFIER | RSSL_MKF_HAS_ATTRIB)
+
+/* Hash sum of a message key.  Covers every member compared by rsslCompareMsgKeys(), so that
+ * keys that share a name (which is all rsslMsgKeyHash() uses) still spread across the table. */
+static RsslUInt32 wlItemKeyHashSum(void *pKey)
+{
+	RsslMsgKey *pMsgKey = (RsslMsgKey*)pKey;
+	RsslUInt32 hashSum = rsslMsgKeyHash(pMsgKey);
+	RsslUInt32 i;
+
+	hashSum = hashSum * 31 + (pMsgKey->flags & WL_ITEM_KEY_FLAGS);
+	hashSum = hashSum * 31 + ((pMsgKey->flags & RSSL_MKF_HAS_NAME_TYPE) ? pMsgKey->nameType : 1);
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_SERVICE_ID)
+		hashSum = hashSum * 31 + pMsgKey->serviceId;
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_FILTER)
+		hashSum = hashSum * 31 + pMsgKey->filter;
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_IDENTIFIER)
+		hashSum = hashSum * 31 + (RsslUInt32)pMsgKey->identifier;
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_ATTRIB)
+	{
+		hashSum = hashSum * 31 + pMsgKey->attribContainerType;
+		for (i = 0; i < pMsgKey->encAttrib.length; ++i)
+			hashSum = hashSum * 31 + (RsslUInt8)pMsgKey->encAttrib.data[i];
+	}
+
+	return hashSum;
+}
+
+static RsslBool wlItemKeyHashCompare(void *pKey1, void *pKey2)
+{
+	return (rsslCompareMsgKeys((RsslMsgKey*)pKey1, (RsslMsgKey*)pKey2) == RSSL_RET_SUCCESS)
+		? RSSL_TRUE : RSSL_FALSE;
+}
+
+#define WL_ITEM_KEY_MAX_BLOCK (WL_ITEM_KEY_BLOCK_ALIGN * WL_ITEM_KEY_BLOCK_CLASSES)
+
+/* Size of the block needed for a key. */
+static RsslUInt32 wlItemKeyBlockSize(const RsslMsgKey *pMsgKey)
+{
+	RsslUInt32 size = sizeof(WlItemKey);
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_NAME)
+		size += pMsgKey->name.length;
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_ATTRIB)
+		size += pMsgKey->encAttrib.length;
+
+	return (size + WL_ITEM_KEY_BLOCK_ALIGN - 1) & ~(RsslUInt32)(WL_ITEM_KEY_BLOCK_ALIGN - 1);
+}
+
+/* Gets a block from a size class's free list, or from the arena. */
+static void *wlItemKeyBlockGet(WlItemKeyTable *pTable, RsslUInt32 blockSize)
+{
+	RsslUInt32 sizeClass = blockSize / WL_ITEM_KEY_BLOCK_ALIGN - 1;
+	void *pBlock;
+
+	assert(sizeClass < WL_ITEM_KEY_BLOCK_CLASSES);
+
+	if ((pBlock = pTable->freeBlocks[sizeClass]))
+	{
+		pTable->freeBlocks[sizeClass] = *(void**)pBlock;
+		return pBlock;
+	}
+
+	if (pTable->chunkRemaining < blockSize)
+	{
+		/* Start a new chunk.  Whatever is left of the current one is not used. */
+		char *pChunk = (char*)malloc(WL_ITEM_KEY_CHUNK_SIZE);
+		if (!pChunk)
+			return NULL;
+
+		*(char**)pChunk = pTable->pChunkList;
+		pTable->pChunkList = pChunk;
+		pTable->pChunkPos = pChunk + WL_ITEM_KEY_BLOCK_ALIGN;
+		pTable->chunkRemaining = WL_ITEM_KEY_CHUNK_SIZE - WL_ITEM_KEY_BLOCK_ALIGN;
+	}
+
+	pBlock = pTable->pChunkPos;
+	pTable->pChunkPos += blockSize;
+	pTable->chunkRemaining -= blockSize;
+	return pBlock;
+}
+
+/* Returns a block to its size class's free list. */
+static void wlItemKeyBlockPut(WlItemKeyTable *pTable, void *pBlock, RsslUInt32 blockSize)
+{
+	RsslUInt32 sizeClass = blockSize / WL_ITEM_KEY_BLOCK_ALIGN - 1;
+
+	*(void**)pBlock = pTable->freeBlocks[sizeClass];
+	pTable->freeBlocks[sizeClass] = pBlock;
+}
+
+/* Takes an unused handle, growing the handle arrays if needed. */
+static WlItemKeyHandle wlItemKeyTakeHandle(WlItemKeyTable *pTable)
+{
+	if (pTable->freeHandleCount)
+		return pTable->freeHandles[--pTable->freeHandleCount];
+
+	if (pTable->nextHandle == pTable->handleCapacity)
+	{
+		RsslUInt32 newCapacity = pTable->handleCapacity * 2;
+		WlItemKey **newKeys;
+		WlItemKeyHandle *newFreeHandles;
+
+		if (newCapacity <= pTable->handleCapacity) /* overflow */
+			return WL_ITEM_KEY_NONE;
+
+		if (!(newKeys = (WlItemKey**)realloc(pTable->keys, newCapacity * sizeof(WlItemKey*))))
+			return WL_ITEM_KEY_NONE;
+		pTable->keys = newKeys;
+
+		if (!(newFreeHandles = (WlItemKeyHandle*)realloc(pTable->freeHandles,
+						newCapacity * sizeof(WlItemKeyHandle))))
+			return WL_ITEM_KEY_NONE;
+		pTable->freeHandles = newFreeHandles;
+
+		pTable->handleCapacity = newCapacity;
+	}
+
+	return pTable->nextHandle++;
+}
+
+RsslRet wlItemKeyTableInit(WlItemKeyTable *pTable, RsslErrorInfo *pErrorInfo)
+{
+	RsslRet ret;
+
+	memset(pTable, 0, sizeof(WlItemKeyTable));
+
+	if ((ret = rsslOpenHashTableInit(&pTable->keysByMsgKey, 100003, wlItemKeyHashSum,
+			wlItemKeyHashCompare, RSSL_TRUE, pErrorInfo)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	pTable->handleCapacity = 1024;
+	pTable->keys = (WlItemKey**)malloc(pTable->handleCapacity * sizeof(WlItemKey*));
+	pTable->freeHandles = (WlItemKeyHandle*)malloc(pTable->handleCapacity * sizeof(WlItemKeyHandle));
+
+	if (!pTable->keys || !pTable->freeHandles)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		wlItemKeyTableCleanup(pTable);
+		return RSSL_RET_FAILURE;
+	}
+
+	pTable->keys[WL_ITEM_KEY_NONE] = NULL;
+	pTable->nextHandle = WL_ITEM_KEY_NONE + 1;
+
+	return RSSL_RET_SUCCESS;
+}
+
+void wlItemKeyTableCleanup(WlItemKeyTable *pTable)
+{
+	RsslUInt32 handle;
+
+	/* Free keys that were too large for the arena. */
+	if (pTable->keys)
+	{
+		for (handle = WL_ITEM_KEY_NONE + 1; handle < pTable->nextHandle; ++handle)
+		{
+			if (pTable->keys[handle] 
+					&& wlItemKeyBlockSize(&pTable->keys[handle]->msgKey) > WL_ITEM_KEY_MAX_BLOCK)
+				free(pTable->keys[handle]);
+		}
+	}
+
+	while (pTable->pChunkList)
+	{
+		char *pChunk = pTable->pChunkList;
+		pTable->pChunkList = *(char**)pChunk;
+		free(pChunk);
+	}
+
+	rsslOpenHashTableCleanup(&pTable->keysByMsgKey);
+
+	if (pTable->keys)
+		free(pTable->keys);
+
+	if (pTable->freeHandles)
+		free(pTable->freeHandles);
+
+	memset(pTable, 0, sizeof(WlItemKeyTable));
+}
+
+WlItemKeyHandle wlItemKeyTableIntern(WlItemKeyTable *pTable, const RsslMsgKey *pMsgKey,
+		RsslErrorInfo *pErrorInfo)
+{
+	RsslUInt32 hashSum = wlItemKeyHashSum((void*)pMsgKey);
+	RsslHashLink *pHashLink;
+	WlItemKey *pItemKey;
+	WlItemKeyHandle handle;
+	RsslUInt32 blockSize;
+	char *pData;
+
+	if ((pHashLink = rsslOpenHashTableFind(&pTable->keysByMsgKey, (void*)pMsgKey, &hashSum)))
+	{
+		pItemKey = RSSL_HASH_LINK_TO_OBJECT(WlItemKey, hlTable, pHashLink);
+		++pItemKey->refCount;
+		return pItemKey->handle;
+	}
+
+	blockSize = wlItemKeyBlockSize(pMsgKey);
+
+	if (blockSize <= WL_ITEM_KEY_MAX_BLOCK)
+		pItemKey = (WlItemKey*)wlItemKeyBlockGet(pTable, blockSize);
+	else
+		pItemKey = (WlItemKey*)malloc(blockSize);
+
+	if (!pItemKey)
+	{
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return WL_ITEM_KEY_NONE;
+	}
+
+	if ((handle = wlItemKeyTakeHandle(pTable)) == WL_ITEM_KEY_NONE)
+	{
+		if (blockSize <= WL_ITEM_KEY_MAX_BLOCK)
+			wlItemKeyBlockPut(pTable, pItemKey, blockSize);
+		else
+			free(pItemKey);
+
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return WL_ITEM_KEY_NONE;
+	}
+
+	/* Copy the key, storing its name and attrib after it. */
+	pItemKey->msgKey = *pMsgKey;
+	pData = (char*)(pItemKey + 1);
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_NAME)
+	{
+		pItemKey->msgKey.name.data = pData;
+		if (pMsgKey->name.length)
+			memcpy(pData, pMsgKey->name.data, pMsgKey->name.length);
+		pData += pMsgKey->name.length;
+	}
+	else
+	{
+		pItemKey->msgKey.name.data = NULL;
+		pItemKey->msgKey.name.length = 0;
+	}
+
+	if (pMsgKey->flags & RSSL_MKF_HAS_ATTRIB)
+	{
+		pItemKey->msgKey.encAttrib.data = pData;
+		if (pMsgKey->encAttrib.length)
+			memcpy(pData, pMsgKey->encAttrib.data, pMsgKey->encAttrib.length);
+	}
+	else
+	{
+		pItemKey->msgKey.encAttrib.data = NULL;
+		pItemKey->msgKey.encAttrib.length = 0;
+	}
+
+	pItemKey->refCount = 1;
+	pItemKey->handle = handle;
+
+	rsslHashLinkInit(&pItemKey->hlTable);
+	if (rsslOpenHashTableInsertLink(&pTable->keysByMsgKey, &pItemKey->hlTable,
+			(void*)&pItemKey->msgKey, &hashSum) != RSSL_RET_SUCCESS)
+	{
+		pTable->freeHandles[pTable->freeHandleCount++] = handle;
+
+		if (blockSize <= WL_ITEM_KEY_MAX_BLOCK)
+			wlItemKeyBlockPut(pTable, pItemKey, blockSize);
+		else
+			free(pItemKey);
+
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return WL_ITEM_KEY_NONE;
+	}
+
+	pTable->keys[handle] = pItemKey;
+	++pTable->keyCount;
+
+	return handle;
+}
+
+WlItemKeyHandle wlItemKeyTableFind(WlItemKeyTable *pTable, const RsslMsgKey *pMsgKey)
+{
+	RsslHashLink *pHashLink;
+
+	if (!(pHashLink = rsslOpenHashTableFind(&pTable->keysByMsgKey, (void*)pMsgKey, NULL)))
+		return WL_ITEM_KEY_NONE;
+
+	return RSSL_HASH_LINK_TO_OBJECT(WlItemKey, hlTable, pHashLink)->handle;
+}
+
+void wlItemKeyTableRelease(WlItemKeyTable *pTable, WlItemKeyHandle handle)
+{
+	WlItemKey *pItemKey = wlItemKeyTableGet(pTable, handle);
+	RsslUInt32 blockSize;
+
+	assert(pItemKey->refCount);
+	if (--pItemKey->refCount)
+		return;
+
+	rsslOpenHashTableRemoveLink(&pTable->keysByMsgKey, &pItemKey->hlTable);
+
+	pTable->keys[handle] = NULL;
+	pTable->freeHandles[pTable->freeHandleCount++] = handle;
+	--pTable->keyCount;
+
+	if ((blockSize = wlItemKeyBlockSize(&pItemKey->msgKey)) <= WL_ITEM_KEY_MAX_BLOCK)
+		wlItemKeyBlockPut(pTable, pItemKey, blockSize);
+	else
+		free(pItemKey);
+}
@@ -44,16 +44,16 @@ static RsslBool wlMatchLoginParameterUInt(RsslUInt newVal, RsslUInt32 newFlags,
 }
 
 
-WlLoginRequest *wlLoginRequestCreate(RsslRDMLoginRequest *pLoginReqMsg, void *pUserSpec,
-		RsslErrorInfo *pErrorInfo)
+WlLoginRequest *wlLoginRequestCreate(WlBase *pBase, RsslRDMLoginRequest *pLoginReqMsg, 
+		void *pUserSpec, RsslErrorInfo *pErrorInfo)
 {
 	WlLoginRequest *pLoginRequest = (WlLoginRequest*)malloc(sizeof(WlLoginRequest));
 	verify_malloc(pLoginRequest, pErrorInfo, NULL);
 	memset(pLoginRequest, 0, sizeof(WlLoginRequest));
 
 	if (!(pLoginRequest->pLoginReqMsg = 
-				(RsslRDMLoginRequest*)wlCreateRdmMsgCopy((RsslRDMMsg*)pLoginReqMsg, 
-					&pLoginRequest->rdmMsgMemoryBuffer, pErrorInfo)))
+				(RsslRDMLoginRequest*)wlCreateRdmMsgCopy(&pBase->slab, 
+					(RsslRDMMsg*)pLoginReqMsg, &pLoginRequest->rdmMsgMemoryBuffer, pErrorInfo)))
 	{
 		free(pLoginRequest);
 		return NULL;
@@ -69,7 +69,7 @@ void wlLoginRequestDestroy(WlBase *pBase, WlLoginRequest *pLoginRequest)
 {
 	RsslQueueLink *pLink;
 
-	free(pLoginRequest->pLoginReqMsg);
+	wlSlabFree(&pBase->slab, pLoginRequest->pLoginReqMsg);
 	
 	if (pLoginRequest->pCurrentToken)
 		free(pLoginRequest->pCurrentToken);
@@ -98,9 +98,16 @@ WlLoginStream *wlLoginStreamCreate(WlBase *pBase, WlLogin *pLogin, RsslErrorInfo
 	wlStreamBaseInit(&pLoginStream->base, pLoginStream->base.streamId, RSSL_DMT_LOGIN);
 	pLoginStream->flags = WL_LSF_NONE;
 
+	if (rsslOpenHashTableInsertLink(&pBase->streamsById, &pLoginStream->base.hlStreamId, 
+			&pLoginStream->base.streamId, NULL) != RSSL_RET_SUCCESS)
+	{
+		free(pLoginStream);
+		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__,
+				"Memory allocation failure.");
+		return NULL;
+	}
+
 	pLogin->pStream = pLoginStream;
-	rsslHashTableInsertLink(&pBase->streamsById, &pLogin->pStream->base.hlStreamId, 
-			&pLogin->pStream->base.streamId, NULL);
 
 	wlSetStreamMsgPending(pBase, &pLogin->pStream->base);
 
@@ -118,7 +125,7 @@ void wlLoginStreamClose(WlBase *pBase, WlLogin *pLogin, RsslBool sendCloseMsg)
 	else
 		wlUnsetStreamFromPendingLists(pBase, &pLogin->pStream->base);
 
-	rsslHashTableRemoveLink(&pBase->streamsById, &pLogin->pStream->base.hlStreamId);
+	rsslOpenHashTableRemoveLink(&pBase->streamsById, &pLogin->pStream->base.hlStreamId);
 	pLogin->pStream = NULL;
 }
 
@@ -652,7 +659,7 @@ RsslRet wlLoginProcessConsumerMsg(WlLogin *pLogin, WlBase *pBase,
 				return RSSL_RET_SUCCESS;
 			}
 
-			if (!(pLogin->pRequest[pLogin->index] = wlLoginRequestCreate(&pLoginMsg->request, 
+			if (!(pLogin->pRequest[pLogin->index] = wlLoginRequestCreate(pBase, &pLoginMsg->request, 
 					pUserSpec, pErrorInfo)))
 				return pErrorInfo->rsslError.rsslErrorId;
 
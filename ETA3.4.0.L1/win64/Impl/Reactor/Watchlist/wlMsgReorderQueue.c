@@ -25,7 +25,7 @@ RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 
 	/* Allocate space for header and RsslMsg. */
 	msgSize = rsslSizeOfMsg(pRsslMsg, RSSL_CMF_ALL_FLAGS & ~RSSL_CMF_MSG_BUFFER);
-	pBufferedMsg = (WlBufferedMsg*)malloc(sizeof(WlBufferedMsg) + msgSize);
+	pBufferedMsg = (WlBufferedMsg*)wlSlabAlloc(&pBase->slab, sizeof(WlBufferedMsg) + msgSize);
 	verify_malloc(pBufferedMsg, pErrorInfo, RSSL_RET_FAILURE);
 
 	msgBuffer.data = (char*)pBufferedMsg + sizeof(WlBufferedMsg);
@@ -34,6 +34,7 @@ RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 	{
 		rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
 				"Failed to copy message for buffering.");
+		wlSlabFree(&pBase->slab, pBufferedMsg);
 		return RSSL_RET_FAILURE;
 	}
 
@@ -58,7 +59,7 @@ RsslRet wlMsgReorderQueuePush(WlMsgReorderQueue *pQueue, RsslMsg *pRsslMsg,
 	if (rsslQueueGetElementCount(&pQueue->msgQueue) >= pBase->maxBufferedBroadcastMsgs)
 	{
 		WlBufferedMsg *pOldMsg = wlMsgReorderQueuePop(pQueue);
-		wlBufferedMsgDestroy(pOldMsg);
+		wlBufferedMsgDestroy(pBase, pOldMsg);
 	}
 
 	rsslQueueAddLinkToBack(&pQueue->msgQueue, &pBufferedMsg->qlMsg);
@@ -107,17 +108,17 @@ WlBufferedMsg *wlMsgReorderQueuePopUntil(WlMsgReorderQueue *pQueue, RsslUInt32 s
 		
 }
 
-void wlBufferedMsgDestroy(WlBufferedMsg *pBufferedMsg)
+void wlBufferedMsgDestroy(WlBase *pBase, WlBufferedMsg *pBufferedMsg)
 {
-	free(pBufferedMsg);
+	wlSlabFree(&pBase->slab, pBufferedMsg);
 }
 
-void wlMsgReorderQueueCleanup(WlMsgReorderQueue *pQueue)
+void wlMsgReorderQueueCleanup(WlMsgReorderQueue *pQueue, WlBase *pBase)
 {
-	wlMsgReorderQueueDiscardAllMessages(pQueue);
+	wlMsgReorderQueueDiscardAllMessages(pQueue, pBase);
 }
 
-void wlMsgReorderQueueDiscardAllMessages(WlMsgReorderQueue *pQueue)
+void wlMsgReorderQueueDiscardAllMessages(WlMsgReorderQueue *pQueue, WlBase *pBase)
 {
 	RsslQueueLink *pLink;
 	WlBufferedMsg *pBufferedMsg;
@@ -126,12 +127,12 @@ void wlMsgReorderQueueDiscardAllMessages(WlMsgReorderQueue *pQueue)
 	{
 		pBufferedMsg = RSSL_QUEUE_LINK_TO_OBJECT(WlBufferedMsg, 
 				qlMsg, pLink);
-		wlBufferedMsgDestroy(pBufferedMsg);
+		wlBufferedMsgDestroy(pBase, pBufferedMsg);
 	}
 }
 
 RsslUInt32 wlMsgReorderQueueCheckBroadcastSequence(WlMsgReorderQueue *pQueue, RsslUInt32 *pSeqNum,
-		RsslBool *pHasGap)
+		RsslBool *pHasGap, WlBase *pBase)
 {
 	RsslUInt32 ret = rsslQueueGetElementCount(&pQueue->msgQueue);
 	RsslQueueLink *pLink;
@@ -147,7 +148,7 @@ RsslUInt32 wlMsgReorderQueueCheckBroadcastSequence(WlMsgReorderQueue *pQueue, Rs
 		if (pBufferedMsg->seqNum != wlGetNextSeqNum(*pSeqNum))
 		{
 			rsslQueueRemoveLink(&pQueue->msgQueue, pLink);
-			wlBufferedMsgDestroy(pBufferedMsg);
+			wlBufferedMsgDestroy(pBase, pBufferedMsg);
 			*pHasGap = RSSL_TRUE;
 		}
 		else
@@ -61,7 +61,7 @@ RsslBool wlPostRecordCompare(void *pKey1, void *pKey2)
 }
 
 RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize,
-		RsslUInt32 postAckTimeout, RsslErrorInfo *pErrorInfo)
+		RsslUInt32 postAckTimeout, WlTimerWheel *pTimerWheel, RsslErrorInfo *pErrorInfo)
 {
 	RsslUInt32 ui;
 	RsslRet ret;
@@ -74,7 +74,7 @@ RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize,
 
 	pTable->postAckTimeout = postAckTimeout;
 	rsslInitQueue(&pTable->pool);
-	rsslInitQueue(&pTable->timeoutQueue);
+	pTable->pTimerWheel = pTimerWheel;
 
 	for (ui = 0; ui < maxPoolSize; ++ui)
 	{
@@ -86,6 +86,7 @@ RsslRet wlPostTableInit(WlPostTable *pTable, RsslUInt32 maxPoolSize,
 			wlPostTableCleanup(pTable);
 			return RSSL_RET_FAILURE;
 		}
+		wlTimerInit(&pRecord->timer, WL_TMT_POST);
 		rsslQueueAddLinkToBack(&pTable->pool, &pRecord->qlUser);
 	}
 
@@ -226,8 +227,8 @@ WlPostRecord *wlPostTableAddRecord(struct WlBase *pBase, WlPostTable *pTable,
 
 	/* Add timer. */
 	/* Time is currently only set when dispatching, so we must get an up-to-date time. */
-	pRecord->expireTime = getCurrentTimeMs(pBase->ticksPerMsec) + pTable->postAckTimeout;
-	rsslQueueAddLinkToBack(&pTable->timeoutQueue, &pRecord->qlTimeout);
+	wlTimerWheelArm(pTable->pTimerWheel, &pRecord->timer, getCurrentTimeMs(pBase->ticksPerMsec),
+			pTable->postAckTimeout);
 	pBase->watchlist.state |= RSSLWL_STF_NEED_TIMER;
 
 	return pRecord;
@@ -237,5 +238,5 @@ void wlPostTableRemoveRecord(WlPostTable *pTable, WlPostRecord *pRecord)
 {
 	rsslHashTableRemoveLink(&pTable->records, &pRecord->hlTable);
 	rsslQueueAddLinkToBack(&pTable->pool, &pRecord->qlUser);
-	rsslQueueRemoveLink(&pTable->timeoutQueue, &pRecord->qlTimeout);
+	wlTimerWheelCancel(pTable->pTimerWheel, &pRecord->timer);
 }
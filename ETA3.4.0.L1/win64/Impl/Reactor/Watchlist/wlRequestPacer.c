@@ -0,0 +1,162 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/wlRequestPacer.h"
+#include <assert.h>
+#include <string.h>
+
+/* One request's worth of tokens. */
+#define WL_REQUEST_PACER_TOKEN				1000
+
+/* Shortest time between rate adjustments, in milliseconds. */
+#define WL_REQUEST_PACER_MIN_ADJUST_INTERVAL	250
+
+/* Adds the tokens accumulated since the last refill. Since the rate is in requests per second,
+ * each millisecond adds rate thousandths of a request. */
+static void wlRequestPacerRefill(WlRequestPacer *pPacer, RsslInt64 currentTime)
+{
+	if (currentTime <= pPacer->refillTime)
+		return;
+
+	pPacer->tokens += (currentTime - pPacer->refillTime) * pPacer->rate;
+	if (pPacer->tokens > pPacer->burst)
+		pPacer->tokens = pPacer->burst;
+	pPacer->refillTime = currentTime;
+}
+
+void wlRequestPacerInit(WlRequestPacer *pPacer, RsslUInt32 maxRate, RsslUInt32 burst,
+		RsslUInt32 latencyTarget, RsslInt64 currentTime)
+{
+	int i;
+
+	memset(pPacer, 0, sizeof(WlRequestPacer));
+	wlTimerInit(&pPacer->timer, WL_TMT_PACER);
+
+	for (i = 0; i < WL_REQUEST_PACER_LEVELS; ++i)
+		rsslInitQueue(&pPacer->waiting[i]);
+
+	if (!maxRate)
+		return;
+
+	if (!burst)
+		burst = maxRate >= 10 ? maxRate / 10 : 1;
+
+	pPacer->maxRate = maxRate;
+	pPacer->minRate = maxRate >= 64 ? maxRate / 64 : 1;
+	pPacer->rate = maxRate;
+	pPacer->burst = (RsslInt64)burst * WL_REQUEST_PACER_TOKEN;
+	pPacer->tokens = pPacer->burst;
+	pPacer->refillTime = currentTime;
+	pPacer->latencyTarget = latencyTarget;
+	pPacer->adjustTime = currentTime;
+}
+
+RsslBool wlRequestPacerTryAcquire(WlRequestPacer *pPacer, RsslInt64 currentTime)
+{
+	if (pPacer->waitingCount)
+		return RSSL_FALSE;
+
+	wlRequestPacerRefill(pPacer, currentTime);
+	if (pPacer->tokens < WL_REQUEST_PACER_TOKEN)
+		return RSSL_FALSE;
+
+	pPacer->tokens -= WL_REQUEST_PACER_TOKEN;
+	++pPacer->requestsReleased;
+	return RSSL_TRUE;
+}
+
+void wlRequestPacerAdd(WlRequestPacer *pPacer, RsslQueueLink *pLink, RsslUInt8 level)
+{
+	assert(level < WL_REQUEST_PACER_LEVELS);
+	rsslQueueAddLinkToBack(&pPacer->waiting[level], pLink);
+	++pPacer->waitingCount;
+}
+
+void wlRequestPacerRemove(WlRequestPacer *pPacer, RsslQueueLink *pLink, RsslUInt8 level)
+{
+	assert(level < WL_REQUEST_PACER_LEVELS);
+	assert(pPacer->waitingCount);
+	rsslQueueRemoveLink(&pPacer->waiting[level], pLink);
+	--pPacer->waitingCount;
+}
+
+RsslQueueLink *wlRequestPacerTake(WlRequestPacer *pPacer, RsslInt64 currentTime)
+{
+	int i;
+
+	if (!pPacer->waitingCount)
+		return NULL;
+
+	wlRequestPacerRefill(pPacer, currentTime);
+	if (pPacer->tokens < WL_REQUEST_PACER_TOKEN)
+		return NULL;
+
+	for (i = WL_REQUEST_PACER_LEVELS - 1; i >= 0; --i)
+	{
+		if (rsslQueueGetElementCount(&pPacer->waiting[i]))
+		{
+			pPacer->tokens -= WL_REQUEST_PACER_TOKEN;
+			--pPacer->waitingCount;
+			++pPacer->requestsReleased;
+			return rsslQueueRemoveFirstLink(&pPacer->waiting[i]);
+		}
+	}
+
+	assert(0);
+	return NULL;
+}
+
+RsslInt64 wlRequestPacerGetWaitTime(WlRequestPacer *pPacer, RsslInt64 currentTime)
+{
+	assert(pPacer->rate);
+
+	wlRequestPacerRefill(pPacer, currentTime);
+	if (pPacer->tokens >= WL_REQUEST_PACER_TOKEN)
+		return 0;
+
+	return (WL_REQUEST_PACER_TOKEN - pPacer->tokens + pPacer->rate - 1) / pPacer->rate;
+}
+
+void wlRequestPacerProcessLatency(WlRequestPacer *pPacer, RsslInt64 latency, RsslInt64 currentTime)
+{
+	RsslInt64 adjustInterval;
+
+	++pPacer->refreshesCompleted;
+
+	if (latency < 0)
+		latency = 0;
+
+	/* Average with a weight of 1/8 for the new sample. */
+	if (pPacer->refreshesCompleted == 1)
+		pPacer->averageLatency = (RsslUInt32)latency;
+	else
+		pPacer->averageLatency = (RsslUInt32)((RsslInt64)pPacer->averageLatency
+				+ (latency - (RsslInt64)pPacer->averageLatency) / 8);
+
+	if (!pPacer->latencyTarget)
+		return;
+
+	adjustInterval = pPacer->latencyTarget > WL_REQUEST_PACER_MIN_ADJUST_INTERVAL ?
+		pPacer->latencyTarget : WL_REQUEST_PACER_MIN_ADJUST_INTERVAL;
+
+	if (currentTime - pPacer->adjustTime < adjustInterval)
+		return;
+
+	/* Tokens accumulated so far were earned at the old rate. */
+	wlRequestPacerRefill(pPacer, currentTime);
+
+	if (pPacer->averageLatency > pPacer->latencyTarget)
+		pPacer->rate = pPacer->rate / 2 > pPacer->minRate ? pPacer->rate / 2 : pPacer->minRate;
+	else
+	{
+		RsslUInt32 increase = pPacer->maxRate >= 16 ? pPacer->maxRate / 16 : 1;
+		pPacer->rate = pPacer->maxRate - pPacer->rate > increase ?
+			pPacer->rate + increase : pPacer->maxRate;
+	}
+
+	pPacer->adjustTime = currentTime;
+}
@@ -0,0 +1,228 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/wlSlab.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#define WL_SLAB_MIN_BLOCK_BITS	5
+
+/* Precedes each block. Kept at 8 bytes so that blocks stay 8-byte aligned. */
+typedef struct
+{
+	RsslUInt32		sizeClass;		/* Index of the block's class, or WL_SLAB_LARGE_CLASS. */
+	RsslUInt32		size;			/* Usable bytes in the block. */
+} WlSlabHeader;
+
+/* Precedes the header of each large block. */
+typedef struct
+{
+	RsslQueueLink	qlLargeBlocks;
+} WlSlabLargeHeader;
+
+/* Precedes the blocks of each slab. */
+typedef union
+{
+	void			*pNextSlab;
+	RsslInt64		align;
+} WlSlabSlabHeader;
+
+RTR_C_INLINE WlSlabHeader *wlSlabGetHeader(void *pBlock)
+{
+	return (WlSlabHeader*)((char*)pBlock - sizeof(WlSlabHeader));
+}
+
+RTR_C_INLINE WlSlabLargeHeader *wlSlabGetLargeHeader(WlSlabHeader *pHeader)
+{
+	return (WlSlabLargeHeader*)((char*)pHeader - sizeof(WlSlabLargeHeader));
+}
+
+/* Returns the smallest class with blocks of at least the given size, or WL_SLAB_LARGE_CLASS. */
+static RsslUInt32 wlSlabGetClass(size_t size)
+{
+	RsslUInt32 sizeClass = 0;
+
+	while (sizeClass < WL_SLAB_CLASS_COUNT
+			&& ((size_t)1 << (sizeClass + WL_SLAB_MIN_BLOCK_BITS)) < size)
+		++sizeClass;
+
+	return sizeClass;
+}
+
+/* Carves a new slab into free blocks for a class. */
+static RsslBool wlSlabAddSlab(WlSlabAllocator *pSlab, WlSlabClass *pClass, RsslUInt32 sizeClass)
+{
+	size_t stride = sizeof(WlSlabHeader) + pClass->blockSize;
+	char *pSlabMemory = (char*)malloc(WL_SLAB_SIZE);
+	char *pHeaderPos;
+	RsslUInt32 ui;
+
+	if (!pSlabMemory)
+		return RSSL_FALSE;
+
+	((WlSlabSlabHeader*)pSlabMemory)->pNextSlab = pSlab->pSlabs;
+	pSlab->pSlabs = pSlabMemory;
+	++pClass->slabCount;
+
+	/* Push the blocks in reverse, so they are handed out in address order. */
+	pHeaderPos = pSlabMemory + sizeof(WlSlabSlabHeader) + (pClass->blocksPerSlab - 1) * stride;
+	for (ui = 0; ui < pClass->blocksPerSlab; ++ui, pHeaderPos -= stride)
+	{
+		WlSlabHeader *pHeader = (WlSlabHeader*)pHeaderPos;
+		void **pBlock = (void**)(pHeader + 1);
+
+		pHeader->sizeClass = sizeClass;
+		pHeader->size = pClass->blockSize;
+		*pBlock = pClass->pFreeList;
+		pClass->pFreeList = pBlock;
+	}
+
+	return RSSL_TRUE;
+}
+
+void wlSlabInit(WlSlabAllocator *pSlab)
+{
+	RsslUInt32 ui;
+
+	memset(pSlab, 0, sizeof(WlSlabAllocator));
+
+	for (ui = 0; ui < WL_SLAB_CLASS_COUNT; ++ui)
+	{
+		WlSlabClass *pClass = &pSlab->classes[ui];
+		pClass->blockSize = (RsslUInt32)1 << (ui + WL_SLAB_MIN_BLOCK_BITS);
+		pClass->blocksPerSlab = (RsslUInt32)((WL_SLAB_SIZE - sizeof(WlSlabSlabHeader))
+				/ (sizeof(WlSlabHeader) + pClass->blockSize));
+	}
+
+	rsslInitQueue(&pSlab->largeBlocks);
+}
+
+void wlSlabCleanup(WlSlabAllocator *pSlab)
+{
+	RsslQueueLink *pLink;
+
+	while (pSlab->pSlabs)
+	{
+		void *pNextSlab = ((WlSlabSlabHeader*)pSlab->pSlabs)->pNextSlab;
+		free(pSlab->pSlabs);
+		pSlab->pSlabs = pNextSlab;
+	}
+
+	while ((pLink = rsslQueueRemoveFirstLink(&pSlab->largeBlocks)))
+		free(RSSL_QUEUE_LINK_TO_OBJECT(WlSlabLargeHeader, qlLargeBlocks, pLink));
+
+	wlSlabInit(pSlab);
+}
+
+void *wlSlabAlloc(WlSlabAllocator *pSlab, size_t size)
+{
+	RsslUInt32 sizeClass = wlSlabGetClass(size);
+	WlSlabClass *pClass;
+	void **pBlock;
+
+	if (sizeClass == WL_SLAB_LARGE_CLASS)
+	{
+		WlSlabLargeHeader *pLargeHeader;
+		WlSlabHeader *pHeader;
+
+		if (size > 0xffffffff - sizeof(WlSlabLargeHeader) - sizeof(WlSlabHeader))
+			return NULL;
+
+		if (!(pLargeHeader = (WlSlabLargeHeader*)malloc(sizeof(WlSlabLargeHeader)
+						+ sizeof(WlSlabHeader) + size)))
+			return NULL;
+
+		rsslQueueAddLinkToBack(&pSlab->largeBlocks, &pLargeHeader->qlLargeBlocks);
+		if (pSlab->largeBlocks.count > pSlab->largeBlocksHighWater)
+			pSlab->largeBlocksHighWater = pSlab->largeBlocks.count;
+
+		pHeader = (WlSlabHeader*)(pLargeHeader + 1);
+		pHeader->sizeClass = WL_SLAB_LARGE_CLASS;
+		pHeader->size = (RsslUInt32)size;
+		return pHeader + 1;
+	}
+
+	pClass = &pSlab->classes[sizeClass];
+
+	if (!pClass->pFreeList && !wlSlabAddSlab(pSlab, pClass, sizeClass))
+		return NULL;
+
+	pBlock = (void**)pClass->pFreeList;
+	pClass->pFreeList = *pBlock;
+
+	if (++pClass->blocksInUse > pClass->blocksHighWater)
+		pClass->blocksHighWater = pClass->blocksInUse;
+
+	return pBlock;
+}
+
+void wlSlabFree(WlSlabAllocator *pSlab, void *pBlock)
+{
+	WlSlabHeader *pHeader;
+	WlSlabClass *pClass;
+
+	if (!pBlock)
+		return;
+
+	pHeader = wlSlabGetHeader(pBlock);
+
+	if (pHeader->sizeClass == WL_SLAB_LARGE_CLASS)
+	{
+		WlSlabLargeHeader *pLargeHeader = wlSlabGetLargeHeader(pHeader);
+		rsslQueueRemoveLink(&pSlab->largeBlocks, &pLargeHeader->qlLargeBlocks);
+		free(pLargeHeader);
+		return;
+	}
+
+	assert(pHeader->sizeClass < WL_SLAB_CLASS_COUNT);
+	pClass = &pSlab->classes[pHeader->sizeClass];
+
+	assert(pClass->blocksInUse);
+	--pClass->blocksInUse;
+	*(void**)pBlock = pClass->pFreeList;
+	pClass->pFreeList = pBlock;
+}
+
+void *wlSlabRealloc(WlSlabAllocator *pSlab, void *pBlock, size_t size)
+{
+	WlSlabHeader *pHeader;
+	void *pNewBlock;
+
+	if (!pBlock)
+		return wlSlabAlloc(pSlab, size);
+
+	pHeader = wlSlabGetHeader(pBlock);
+	if (size <= pHeader->size)
+		return pBlock;
+
+	if (!(pNewBlock = wlSlabAlloc(pSlab, size)))
+		return NULL;
+
+	memcpy(pNewBlock, pBlock, pHeader->size);
+	wlSlabFree(pSlab, pBlock);
+	return pNewBlock;
+}
+
+void wlSlabGetStats(WlSlabAllocator *pSlab, WlSlabClassStats *pStats)
+{
+	RsslUInt32 ui;
+
+	for (ui = 0; ui < WL_SLAB_CLASS_COUNT; ++ui)
+	{
+		WlSlabClass *pClass = &pSlab->classes[ui];
+		pStats[ui].blockSize = pClass->blockSize;
+		pStats[ui].blocksAllocated = pClass->slabCount * pClass->blocksPerSlab;
+		pStats[ui].blocksInUse = pClass->blocksInUse;
+		pStats[ui].blocksHighWater = pClass->blocksHighWater;
+	}
+
+	pStats[WL_SLAB_LARGE_CLASS].blockSize = 0;
+	pStats[WL_SLAB_LARGE_CLASS].blocksAllocated = pSlab->largeBlocks.count;
+	pStats[WL_SLAB_LARGE_CLASS].blocksInUse = pSlab->largeBlocks.count;
+	pStats[WL_SLAB_LARGE_CLASS].blocksHighWater = pSlab->largeBlocksHighWater;
+}
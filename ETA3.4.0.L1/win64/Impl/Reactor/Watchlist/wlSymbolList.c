@@ -184,7 +184,7 @@ RsslRet wlSymbolListRequestReissue(WlBase *pBase, WlItems *pItems, WlSymbolListR
 
 void wlSymbolListRequestDestroy(WlBase *pBase, WlItems *pItems, WlSymbolListRequest *pSymbolListRequest)
 {
-	wlItemRequestCleanup(&pSymbolListRequest->itemBase);
+	wlItemRequestCleanup(pBase, &pSymbolListRequest->itemBase);
 	free(pSymbolListRequest);
 }
 
@@ -205,6 +205,7 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 			RsslMapEntry mapEntry;
 			RsslRequestMsg requestMsg;
 			WlItemRequest matchRequest;
+			RsslMsgKey matchKey;
 			RsslQos itemQos;
 			WlService *pWlService = pRequest->itemBase.pRequestedService->pMatchingService;
 			RDMCachedService *pCachedService = pWlService->pService;
@@ -253,13 +254,13 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 			requestMsg.qos = itemQos;
 
 			matchRequest.base.domainType = RSSL_DMT_MARKET_PRICE;
-			rsslClearMsgKey(&matchRequest.msgKey);
-			matchRequest.msgKey.flags = RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
-			matchRequest.msgKey.serviceId = (RsslUInt16)pWlService->pService->rdm.serviceId;
+			rsslClearMsgKey(&matchKey);
+			matchKey.flags = RSSL_MKF_HAS_NAME | RSSL_MKF_HAS_SERVICE_ID;
+			matchKey.serviceId = (RsslUInt16)pWlService->pService->rdm.serviceId;
 
 			if (pRequest->itemBase.pRequestedService->flags & WL_RSVC_HAS_NAME)
 			{
-				matchRequest.msgKey.flags &= ~RSSL_MKF_HAS_SERVICE_ID;
+				matchKey.flags &= ~RSSL_MKF_HAS_SERVICE_ID;
 				matchRequest.pRequestedService = pRequest->itemBase.pRequestedService;
 			}
 
@@ -279,7 +280,7 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 				return RSSL_RET_INVALID_DATA;
 			}
 
-			while ((ret = rsslDecodeMapEntry(&dIter, &mapEntry, &matchRequest.msgKey.name)) !=
+			while ((ret = rsslDecodeMapEntry(&dIter, &mapEntry, &matchKey.name)) !=
 					RSSL_RET_END_OF_CONTAINER)
 			{
 				if (ret != RSSL_RET_SUCCESS)
@@ -298,12 +299,14 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 						RsslUInt32 hashSum;
 						RsslHashLink *pHashLink;
 
-						hashSum = wlProviderRequestHashSum(&matchRequest);
-
 						/* If streaming items were requested, check that a provider-driven
-						 * stream is not already open before requesting. */
-						if (pRequest->flags & RDM_SYMBOL_LIST_DATA_STREAMS)
+						 * stream is not already open before requesting. (Keys are interned, so 
+						 * if the key is not in the table, no request has it.) */
+						if (pRequest->flags & RDM_SYMBOL_LIST_DATA_STREAMS
+								&& (matchRequest.itemKey = wlItemKeyTableFind(&pBase->itemKeys, &matchKey))
+								!= WL_ITEM_KEY_NONE)
 						{
+							hashSum = wlProviderRequestHashSum(&matchRequest);
 							pHashLink = rsslHashTableFind(&pItems->providerRequestsByAttrib,
 									(void*)&matchRequest, &hashSum);
 
@@ -314,7 +317,7 @@ RsslRet wlProcessSymbolListMsg(WlBase *pBase, WlItems *pItems, RsslMsg *pRsslMsg
 
 						requestMsg.msgBase.streamId = wlBaseTakeProviderStreamId(pBase);
 
-						requestMsg.msgBase.msgKey = matchRequest.msgKey;
+						requestMsg.msgBase.msgKey = matchKey;
 						requestMsg.msgBase.msgKey.flags &= ~RSSL_MKF_HAS_SERVICE_ID;
 
 						wlClearItemRequestCreateOptions(&opts);
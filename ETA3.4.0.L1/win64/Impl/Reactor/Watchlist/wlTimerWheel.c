@@ -0,0 +1,238 @@
+/*
+ * This source code is provided under the Apache 2.0 license and is provided
+ * AS IS with no warranty or guarantee of fit for purpose.  See the project's
+ * LICENSE.md for details.
+ * Copyright (C) 2019 Refinitiv. All rights reserved.
+*/
+
+#include "rtr/wlTimerWheel.h"
+#include "rtr/wlBase.h"
+#include <assert.h>
+#include <string.h>
+
+#define WL_TIMER_WHEEL_MASK		(WL_TIMER_WHEEL_SLOTS - 1)
+#define WL_TIMER_WHEEL_OVERFLOW	WL_TIMER_WHEEL_LEVELS
+#define WL_TIMER_WHEEL_EXPIRED	(WL_TIMER_WHEEL_LEVELS + 1)
+
+/* Number of bits of time covered by one slot at the given level. */
+#define WL_TIMER_WHEEL_SHIFT(__level) (WL_TIMER_WHEEL_BITS * (__level))
+
+/* Returns the number of timers still waiting in the wheel (i.e. not expired). */
+static RsslUInt32 wlTimerWheelPendingCount(WlTimerWheel *pWheel)
+{
+	return pWheel->count - pWheel->levelCounts[WL_TIMER_WHEEL_EXPIRED];
+}
+
+/* Places a timer in the slot for its expire time, relative to the wheel's current time. */
+static void wlTimerWheelInsert(WlTimerWheel *pWheel, WlTimer *pTimer)
+{
+	RsslInt64 slotTime = pTimer->expireTime;
+	RsslInt64 delta;
+	RsslUInt8 level;
+	RsslQueue *pQueue;
+
+	/* Timers that are already due go in the current slot. */
+	if (slotTime < pWheel->time)
+		slotTime = pWheel->time;
+
+	delta = slotTime - pWheel->time;
+
+	for (level = 0; level < WL_TIMER_WHEEL_LEVELS; ++level)
+	{
+		if (delta < ((RsslInt64)1 << WL_TIMER_WHEEL_SHIFT(level + 1)))
+			break;
+	}
+
+	if (level == WL_TIMER_WHEEL_OVERFLOW)
+		pQueue = &pWheel->overflow;
+	else
+		pQueue = &pWheel->slots[level][(slotTime >> WL_TIMER_WHEEL_SHIFT(level)) & WL_TIMER_WHEEL_MASK];
+
+	rsslQueueAddLinkToBack(pQueue, &pTimer->qlTimer);
+	pTimer->pQueue = pQueue;
+	pTimer->level = level;
+	++pWheel->levelCounts[level];
+}
+
+/* Moves the timers in a slot (or the overflow list) to the slots for their expire times. */
+static void wlTimerWheelCascade(WlTimerWheel *pWheel, RsslQueue *pQueue, RsslUInt8 level)
+{
+	RsslQueue cascadeQueue;
+	RsslQueueLink *pLink;
+
+	if (!rsslQueueGetElementCount(pQueue))
+		return;
+
+	/* Take the whole list first, since overflow timers may be put back into it. */
+	rsslInitQueue(&cascadeQueue);
+	rsslQueueAppend(&cascadeQueue, pQueue);
+	pWheel->levelCounts[level] -= rsslQueueGetElementCount(&cascadeQueue);
+
+	while ((pLink = rsslQueueRemoveFirstLink(&cascadeQueue)))
+		wlTimerWheelInsert(pWheel, RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink));
+}
+
+void wlTimerWheelInit(WlTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	int level, slot;
+
+	for (level = 0; level < WL_TIMER_WHEEL_LEVELS; ++level)
+		for (slot = 0; slot < WL_TIMER_WHEEL_SLOTS; ++slot)
+			rsslInitQueue(&pWheel->slots[level][slot]);
+
+	memset(pWheel->levelCounts, 0, sizeof(pWheel->levelCounts));
+	rsslInitQueue(&pWheel->overflow);
+	rsslInitQueue(&pWheel->expired);
+	pWheel->time = currentTime;
+	pWheel->count = 0;
+}
+
+void wlTimerWheelArm(WlTimerWheel *pWheel, WlTimer *pTimer, RsslInt64 currentTime,
+		RsslInt64 timeout)
+{
+	wlTimerWheelCancel(pWheel, pTimer);
+
+	/* Nothing is waiting, so the wheel can catch up without visiting any slots. */
+	if (!wlTimerWheelPendingCount(pWheel) && currentTime > pWheel->time)
+		pWheel->time = currentTime;
+
+	pTimer->expireTime = currentTime + timeout;
+	wlTimerWheelInsert(pWheel, pTimer);
+	++pWheel->count;
+}
+
+void wlTimerWheelCancel(WlTimerWheel *pWheel, WlTimer *pTimer)
+{
+	if (!pTimer->pQueue)
+		return;
+
+	rsslQueueRemoveLink(pTimer->pQueue, &pTimer->qlTimer);
+	--pWheel->levelCounts[pTimer->level];
+	--pWheel->count;
+	pTimer->pQueue = NULL;
+}
+
+void wlTimerWheelAdvance(WlTimerWheel *pWheel, RsslInt64 currentTime)
+{
+	while (pWheel->time <= currentTime)
+	{
+		RsslInt64 time = pWheel->time;
+		RsslInt64 nextTime;
+		RsslQueue *pQueue;
+		RsslQueueLink *pLink;
+		RsslUInt8 level;
+
+		if (!wlTimerWheelPendingCount(pWheel))
+		{
+			pWheel->time = currentTime + 1;
+			break;
+		}
+
+		/* Move down the timers of any higher level slot that comes due now, from the top level
+		 * down so that they can continue on to the levels below. */
+		if (!(time & (((RsslInt64)1 << WL_TIMER_WHEEL_SHIFT(WL_TIMER_WHEEL_OVERFLOW)) - 1)))
+			wlTimerWheelCascade(pWheel, &pWheel->overflow, WL_TIMER_WHEEL_OVERFLOW);
+
+		for (level = WL_TIMER_WHEEL_LEVELS - 1; level > 0; --level)
+		{
+			if (!(time & (((RsslInt64)1 << WL_TIMER_WHEEL_SHIFT(level)) - 1)))
+				wlTimerWheelCascade(pWheel,
+						&pWheel->slots[level][(time >> WL_TIMER_WHEEL_SHIFT(level)) & WL_TIMER_WHEEL_MASK],
+						level);
+		}
+
+		/* Expire the current level 0 slot. */
+		pQueue = &pWheel->slots[0][time & WL_TIMER_WHEEL_MASK];
+		while ((pLink = rsslQueueRemoveFirstLink(pQueue)))
+		{
+			WlTimer *pTimer = RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink);
+
+			rsslQueueAddLinkToBack(&pWheel->expired, &pTimer->qlTimer);
+			pTimer->pQueue = &pWheel->expired;
+			pTimer->level = WL_TIMER_WHEEL_EXPIRED;
+			--pWheel->levelCounts[0];
+			++pWheel->levelCounts[WL_TIMER_WHEEL_EXPIRED];
+		}
+
+		/* Skip ahead to the next slot that has timers, or the next time a slot of the
+		 * lowest non-empty level comes due. */
+		for (level = 0; level < WL_TIMER_WHEEL_EXPIRED; ++level)
+		{
+			if (pWheel->levelCounts[level])
+				break;
+		}
+
+		nextTime = time + 1;
+		if (level == 0)
+		{
+			while ((nextTime & WL_TIMER_WHEEL_MASK) && nextTime <= currentTime
+					&& !rsslQueueGetElementCount(&pWheel->slots[0][nextTime & WL_TIMER_WHEEL_MASK]))
+				++nextTime;
+		}
+		else if (level < WL_TIMER_WHEEL_EXPIRED)
+			nextTime = ((time >> WL_TIMER_WHEEL_SHIFT(level)) + 1) << WL_TIMER_WHEEL_SHIFT(level);
+		else
+			nextTime = currentTime + 1;
+
+		pWheel->time = (nextTime > currentTime + 1) ? currentTime + 1 : nextTime;
+	}
+}
+
+WlTimer *wlTimerWheelPopExpired(WlTimerWheel *pWheel)
+{
+	RsslQueueLink *pLink;
+	WlTimer *pTimer;
+
+	if (!(pLink = rsslQueueRemoveFirstLink(&pWheel->expired)))
+		return NULL;
+
+	pTimer = RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink);
+	pTimer->pQueue = NULL;
+	--pWheel->levelCounts[WL_TIMER_WHEEL_EXPIRED];
+	--pWheel->count;
+	return pTimer;
+}
+
+RsslInt64 wlTimerWheelGetNextTimeout(WlTimerWheel *pWheel)
+{
+	RsslInt64 nextTime = WL_TIME_UNSET;
+	RsslQueueLink *pLink;
+	RsslUInt8 level;
+
+	if ((pLink = rsslQueuePeekFront(&pWheel->expired)))
+		return RSSL_QUEUE_LINK_TO_OBJECT(WlTimer, qlTimer, pLink)->expireTime;
+
+	for (level = 0; level <= WL_TIMER_WHEEL_OVERFLOW; ++level)
+	{
+		RsslInt64 block;
+		int i;
+
+		if (!pWheel->levelCounts[level])
+			continue;
+
+		/* The slot for the current time at this level has already come due unless
+		 * the time falls exactly on its start. */
+		block = pWheel->time >> WL_TIMER_WHEEL_SHIFT(level);
+		if (pWheel->time & (((RsslInt64)1 << WL_TIMER_WHEEL_SHIFT(level)) - 1))
+			++block;
+
+		if (level == WL_TIMER_WHEEL_OVERFLOW)
+		{
+			if ((block << WL_TIMER_WHEEL_SHIFT(level)) < nextTime)
+				nextTime = block << WL_TIMER_WHEEL_SHIFT(level);
+			continue;
+		}
+
+		for (i = 0; i < WL_TIMER_WHEEL_SLOTS; ++i, ++block)
+		{
+			if (rsslQueueGetElementCount(&pWheel->slots[level][block & WL_TIMER_WHEEL_MASK]))
+			{
+				if ((block << WL_TIMER_WHEEL_SHIFT(level)) < nextTime)
+					nextTime = block << WL_TIMER_WHEEL_SHIFT(level);
+				break;
+			}
+		}
+	}
+
+	return nextTime;
+}
@@ -7,10 +7,10 @@
 
 #include "rtr/wlView.h"
 #include "rtr/rsslArray.h"
+#include "rtr/rsslFieldList.h"
 #include "rtr/rsslDataUtils.h"
 #include "rtr/rsslRDM.h"
 #include "rtr/rsslReactorUtils.h"
-#include "rtr/rsslHeapBuffer.h"
 #include <stdlib.h>
 #include <assert.h>
 
@@ -94,6 +94,24 @@ int wlaCompareViewNameWithName(const void *p1, const void *p2)
 	return wlaCompareRsslString(pName, &pViewName->name);
 }
 
+/* Copies an element name for the aggregate view's name list. */
+static RsslRet wlaCopyName(WlSlabAllocator *pSlab, RsslBuffer *pName, const RsslBuffer *pSourceName)
+{
+	if (!(pName->data = (char*)wlSlabAlloc(pSlab, pSourceName->length)))
+		return RSSL_RET_FAILURE;
+
+	memcpy(pName->data, pSourceName->data, pSourceName->length);
+	pName->length = pSourceName->length;
+	return RSSL_RET_SUCCESS;
+}
+
+/* Frees an element name copied by wlaCopyName. */
+static void wlaFreeName(WlSlabAllocator *pSlab, RsslBuffer *pName)
+{
+	wlSlabFree(pSlab, pName->data);
+	rsslClearBuffer(pName);
+}
+
 /* Merges a view into the aggregated view. */
 static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *pUpdated,
 		RsslErrorInfo *pErrorInfo);
@@ -123,7 +141,7 @@ static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *
 
 		if (!aggViewFieldList)
 		{
-			aggViewFieldList = (WlViewField*)malloc(pView->elemCount 
+			aggViewFieldList = (WlViewField*)wlSlabAlloc(pAggView->pSlab, pView->elemCount 
 					* sizeof(WlViewField));
 			verify_malloc(aggViewFieldList, pErrorInfo, RSSL_RET_FAILURE);
 			pAggView->elemCapacity = pView->elemCount;
@@ -152,9 +170,10 @@ static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *
 				if (aggViewFieldCount == aggViewFieldCapacity)
 				{
 					/* Out of space -- grow the list. */
-					aggViewFieldCapacity *= 2;
-					aggViewFieldList = (WlViewField*)realloc(aggViewFieldList,
-							aggViewFieldCapacity * sizeof(WlViewField));
+					aggViewFieldCapacity = aggViewFieldCapacity ? aggViewFieldCapacity * 2
+						: pView->elemCount;
+					aggViewFieldList = (WlViewField*)wlSlabRealloc(pAggView->pSlab,
+							aggViewFieldList, aggViewFieldCapacity * sizeof(WlViewField));
 					verify_malloc(aggViewFieldList, pErrorInfo, RSSL_RET_FAILURE);
 					pAggView->elemList = (void*)aggViewFieldList;
 				}
@@ -186,7 +205,7 @@ static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *
 
 		if (!aggViewNameList)
 		{
-			aggViewNameList = (WlViewName*)malloc(pView->elemCount 
+			aggViewNameList = (WlViewName*)wlSlabAlloc(pAggView->pSlab, pView->elemCount 
 					* sizeof(WlViewName));
 			verify_malloc(aggViewNameList, pErrorInfo, RSSL_RET_FAILURE);
 			pAggView->elemCapacity = pView->elemCount;
@@ -217,9 +236,12 @@ static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *
 				if (aggViewNameCount == aggViewNameCapacity)
 				{
 					/* Out of space -- grow the list. */
-					aggViewNameCapacity *= 2;
-					aggViewNameList = (WlViewName*)realloc(aggViewNameList,
-							aggViewNameCapacity * sizeof(WlViewName));
+					aggViewNameCapacity = aggViewNameCapacity ? aggViewNameCapacity * 2
+						: pView->elemCount;
+					aggViewNameList = (WlViewName*)wlSlabRealloc(pAggView->pSlab,
+							aggViewNameList, aggViewNameCapacity * sizeof(WlViewName));
+					if (!aggViewNameList)
+						pAggView->elemCount = aggViewNameCount;
 					verify_malloc(aggViewNameList, pErrorInfo, RSSL_RET_FAILURE);
 					pAggView->elemList = (void*)aggViewNameList;
 				}
@@ -229,7 +251,7 @@ static RsslRet wlaMergeView(WlAggregateView *pAggView, WlView *pView, RsslBool *
 				 * component views already have any duplicates removed). */
 				aggViewNameList[aggViewNameCount].count = 1;
 				aggViewNameList[aggViewNameCount].committed = RSSL_FALSE;
-				if (rsslHeapBufferCreateCopy(&aggViewNameList[aggViewNameCount].name, 
+				if (wlaCopyName(pAggView->pSlab, &aggViewNameList[aggViewNameCount].name, 
 						&viewNameList[ui]) != RSSL_RET_SUCCESS)
 				{
 					rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
@@ -437,7 +459,7 @@ static RsslBool wlaUnmergeView(WlAggregateView *pAggView, WlView *pView, RsslBoo
 				if (aggViewNameList[ui].count == 0 && !aggViewNameList[ui].committed)
 				{
 					viewUpdated = RSSL_TRUE;
-					rsslHeapBufferCleanup(&aggViewNameList[ui].name);
+					wlaFreeName(pAggView->pSlab, &aggViewNameList[ui].name);
 					aggViewNameList[ui] = 
 						aggViewNameList[pAggView->elemCount - 1];
 					--pAggView->elemCount;
@@ -459,8 +481,8 @@ static RsslBool wlaUnmergeView(WlAggregateView *pAggView, WlView *pView, RsslBoo
 
 
 
-WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
-		RsslErrorInfo *pErrorInfo)
+WlView *wlViewCreate(WlSlabAllocator *pSlab, void *elemList, RsslUInt32 elemCount, 
+		RsslUInt viewType, RsslErrorInfo *pErrorInfo)
 {
 	RsslUInt32 ui;
 
@@ -480,7 +502,7 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			int startingCount;
 			int nextValidPos = 1;
 
-			WlView *pView = (WlView*)malloc(sizeof(WlView) + sizeof(RsslFieldId) * elemCount);
+			WlView *pView = (WlView*)wlSlabAlloc(pSlab, sizeof(WlView) + sizeof(RsslFieldId) * elemCount);
 			RsslFieldId *viewFieldIdList = (RsslFieldId*)((char*)pView + sizeof(WlView));
 			verify_malloc(pView, pErrorInfo, NULL);
 
@@ -508,12 +530,14 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 		}
 		else
 		{
-			WlView *pView = (WlView*)malloc(sizeof(WlView));
+			WlView *pView = (WlView*)wlSlabAlloc(pSlab, sizeof(WlView));
 			verify_malloc(pView, pErrorInfo, NULL);
 			assert(elemCount == 0);
+			pView->viewType = RDM_VIEW_TYPE_FIELD_ID_LIST;
 			pView->elemList = NULL;
 			pView->elemCount = 0;
 			pView->nameBuf = NULL;
+			pView->pParentQueue = NULL;
 			return pView;
 		}
 	}
@@ -533,9 +557,16 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			RsslBuffer *viewNameList;
 			RsslUInt32 elementNameBufSize = 0;
 
-			pView = (WlView*)malloc(sizeof(WlView) + sizeof(RsslBuffer) * elemCount);
+			/* The names are copied into the same block, after the name list. Size it for all 
+			 * of them, since duplicates are not known until the list is sorted. */
+			for(ui = 0; ui < elemCount; ++ui)
+				elementNameBufSize += nameList[ui].length; 
+
+			pView = (WlView*)wlSlabAlloc(pSlab, sizeof(WlView) + sizeof(RsslBuffer) * elemCount
+					+ elementNameBufSize);
 			verify_malloc(pView, pErrorInfo, NULL);
 			viewNameList = (RsslBuffer*)((char*)pView + sizeof(WlView));
+			pView->nameBuf = (char*)(viewNameList + elemCount);
 
 			pView->viewType = RDM_VIEW_TYPE_ELEMENT_NAME_LIST;
 			pView->elemCount = elemCount;
@@ -558,18 +589,8 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 			  }
 
 			/* Copy element names. */
-			for(ui = 0; ui < pView->elemCount; ++ui)
-				elementNameBufSize += viewNameList[ui].length; 
-
-			if (elementNameBufSize)
 			{
-				char *nameBuf = pView->nameBuf = (char*)malloc(elementNameBufSize);
-
-				if (!pView->nameBuf)
-				{
-					free(pView);
-					verify_malloc(0, pErrorInfo, NULL);
-				}
+				char *nameBuf = pView->nameBuf;
 
 				for(ui = 0; ui < pView->elemCount; ++ui)
 				{
@@ -583,12 +604,14 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 		}
 		else
 		{
-			WlView *pView = (WlView*)malloc(sizeof(WlView));
+			WlView *pView = (WlView*)wlSlabAlloc(pSlab, sizeof(WlView));
 			verify_malloc(pView, pErrorInfo, NULL);
 			assert(elemCount == 0);
+			pView->viewType = RDM_VIEW_TYPE_ELEMENT_NAME_LIST;
 			pView->elemList = NULL;
 			pView->elemCount = 0;
 			pView->nameBuf = NULL;
+			pView->pParentQueue = NULL;
 			return pView;
 		}
 	}
@@ -597,18 +620,17 @@ WlView *wlViewCreate(void *elemList, RsslUInt32 elemCount, RsslUInt viewType,
 	}
 }
 
-void wlViewDestroy(WlView *pView)
+void wlViewDestroy(WlSlabAllocator *pSlab, WlView *pView)
 {
-	if (pView->nameBuf)
-		free(pView->nameBuf);
-	free(pView);
+	wlSlabFree(pSlab, pView);
 }
 
-WlAggregateView *wlAggregateViewCreate(RsslErrorInfo *pErrorInfo)
+WlAggregateView *wlAggregateViewCreate(WlSlabAllocator *pSlab, RsslErrorInfo *pErrorInfo)
 {
 	WlAggregateView *pView = (WlAggregateView*)malloc(sizeof(WlAggregateView));
 	verify_malloc(pView, pErrorInfo, NULL);
 	memset(pView, 0, sizeof(WlAggregateView));
+	pView->pSlab = pSlab;
 	rsslInitQueue(&pView->newViews);
 	rsslInitQueue(&pView->mergedViews);
 	rsslInitQueue(&pView->committedViews);
@@ -624,10 +646,10 @@ void wlAggregateViewDestroy(WlAggregateView *pView)
 		{
 			RsslUInt32 ui;
 			for (ui = 0; ui < pView->elemCount; ++ui)
-				rsslHeapBufferCleanup(&(((WlViewName*)pView->elemList)[ui].name));
+				wlaFreeName(pView->pSlab, &(((WlViewName*)pView->elemList)[ui].name));
 		}
 
-		free(pView->elemList);
+		wlSlabFree(pView->pSlab, pView->elemList);
 	}
 	free(pView);
 }
@@ -899,7 +921,7 @@ void wlAggregateViewCommitViews(WlAggregateView *pAggView)
 			if (pAggView->elemList && pAggView->committedViews.count == 0)
 			{
 				/* We can free the overall list. */
-				free(pAggView->elemList);
+				wlSlabFree(pAggView->pSlab, pAggView->elemList);
 				pAggView->elemList = NULL;
 				break;
 			}
@@ -933,8 +955,8 @@ void wlAggregateViewCommitViews(WlAggregateView *pAggView)
 			{
 				/* We can free the overall list. */
 				for(ui = 0; ui < pAggView->elemCount; ++ui)
-					rsslHeapBufferCleanup(&aggViewNameList[ui].name);
-				free(pAggView->elemList);
+					wlaFreeName(pAggView->pSlab, &aggViewNameList[ui].name);
+				wlSlabFree(pAggView->pSlab, pAggView->elemList);
 				pAggView->elemList = NULL;
 				break;
 			}
@@ -944,7 +966,7 @@ void wlAggregateViewCommitViews(WlAggregateView *pAggView)
 				if (aggViewNameList[ui].count == 0)
 				{
 					fieldsRemoved = RSSL_TRUE;
-					rsslHeapBufferCleanup(&aggViewNameList[ui].name);
+					wlaFreeName(pAggView->pSlab, &aggViewNameList[ui].name);
 					aggViewNameList[ui] = aggViewNameList[pAggView->elemCount - 1];
 					--pAggView->elemCount;
 				}
@@ -967,3 +989,177 @@ void wlAggregateViewCommitViews(WlAggregateView *pAggView)
 	}
 
 }
+
+RsslBool wlViewIsEqual(WlView *pView1, WlView *pView2)
+{
+	RsslUInt32 ui;
+
+	if (pView1 == pView2)
+		return RSSL_TRUE;
+
+	if (pView1->viewType != pView2->viewType || pView1->elemCount != pView2->elemCount)
+		return RSSL_FALSE;
+
+	/* Elements are sorted and unique, so they can be compared in order. */
+	switch(pView1->viewType)
+	{
+		case RDM_VIEW_TYPE_FIELD_ID_LIST:
+			return memcmp(pView1->elemList, pView2->elemList, 
+					pView1->elemCount * sizeof(RsslFieldId)) == 0;
+
+		case RDM_VIEW_TYPE_ELEMENT_NAME_LIST:
+			for (ui = 0; ui < pView1->elemCount; ++ui)
+				if (!rsslBufferIsEqual(&((RsslBuffer*)pView1->elemList)[ui],
+							&((RsslBuffer*)pView2->elemList)[ui]))
+					return RSSL_FALSE;
+			return RSSL_TRUE;
+
+		default: assert(0); return RSSL_FALSE;
+	}
+}
+
+RsslRet wlViewFilterFieldList(WlView *pView, RsslBuffer *pEncFieldList, RsslUInt8 majorVersion,
+		RsslUInt8 minorVersion, RsslBuffer *pOutput)
+{
+	RsslDecodeIterator dIter;
+	RsslEncodeIterator eIter;
+	RsslFieldList fieldList;
+	RsslFieldEntry fieldEntry;
+	RsslRet ret;
+
+	assert(pView->viewType == RDM_VIEW_TYPE_FIELD_ID_LIST);
+
+	rsslClearDecodeIterator(&dIter);
+	rsslSetDecodeIteratorRWFVersion(&dIter, majorVersion, minorVersion);
+	rsslSetDecodeIteratorBuffer(&dIter, pEncFieldList);
+
+	/* Set-defined entries are not length-specified, so they can't be copied individually.
+	 * Without set definitions, the decoder reports them by returning RSSL_RET_SET_SKIPPED. */
+	if ((ret = rsslDecodeFieldList(&dIter, &fieldList, NULL)) == RSSL_RET_SET_SKIPPED
+			|| (ret == RSSL_RET_SUCCESS && fieldList.flags & RSSL_FLF_HAS_SET_DATA))
+		return RSSL_RET_UNSUPPORTED_DATA_TYPE;
+
+	if (ret != RSSL_RET_SUCCESS)
+		return ret;
+
+	rsslClearEncodeIterator(&eIter);
+	rsslSetEncodeIteratorRWFVersion(&eIter, majorVersion, minorVersion);
+	if ((ret = rsslSetEncodeIteratorBuffer(&eIter, pOutput)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if ((ret = rsslEncodeFieldListInit(&eIter, &fieldList, NULL, 0)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	/* Copy the entries in the view, using their encoded data as-is. */
+	while ((ret = rsslDecodeFieldEntry(&dIter, &fieldEntry)) != RSSL_RET_END_OF_CONTAINER)
+	{
+		if (ret < RSSL_RET_SUCCESS)
+			return ret;
+
+		if (!bsearch(&fieldEntry.fieldId, pView->elemList, pView->elemCount, sizeof(RsslFieldId),
+					wlaCompareFieldId))
+			continue;
+
+		if ((ret = rsslEncodeFieldEntry(&eIter, &fieldEntry, NULL)) != RSSL_RET_SUCCESS)
+			return ret;
+	}
+
+	if ((ret = rsslEncodeFieldListComplete(&eIter, RSSL_TRUE)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	pOutput->length = rsslGetEncodedBufferLength(&eIter);
+	return RSSL_RET_SUCCESS;
+}
+
+void wlViewFilterCacheInit(WlViewFilterCache *pCache)
+{
+	memset(pCache, 0, sizeof(WlViewFilterCache));
+}
+
+void wlViewFilterCacheCleanup(WlViewFilterCache *pCache)
+{
+	RsslUInt32 ui;
+
+	for (ui = 0; ui < pCache->capacity; ++ui)
+		free(pCache->payloads[ui].memory.data);
+
+	free(pCache->payloads);
+	memset(pCache, 0, sizeof(WlViewFilterCache));
+}
+
+RsslRet wlViewFilterCacheGet(WlViewFilterCache *pCache, WlView *pView, RsslBuffer *pEncFieldList,
+		RsslUInt8 majorVersion, RsslUInt8 minorVersion, RsslBuffer **ppPayload, 
+		RsslErrorInfo *pErrorInfo)
+{
+	WlFilteredPayload *pPayload;
+	RsslUInt32 ui;
+	RsslRet ret;
+
+	/* A different source means another message is being fanned out(e.g. from within a
+	 * callback), so the payloads no longer apply. */
+	if (pCache->source.data != pEncFieldList->data || pCache->source.length != pEncFieldList->length)
+	{
+		wlViewFilterCacheReset(pCache);
+		pCache->source = *pEncFieldList;
+	}
+
+	if (pCache->unfilterable)
+	{
+		*ppPayload = pEncFieldList;
+		return RSSL_RET_SUCCESS;
+	}
+
+	for (ui = 0; ui < pCache->count; ++ui)
+	{
+		if (wlViewIsEqual(pCache->payloads[ui].pView, pView))
+		{
+			*ppPayload = &pCache->payloads[ui].payload;
+			return RSSL_RET_SUCCESS;
+		}
+	}
+
+	if (pCache->count == pCache->capacity)
+	{
+		RsslUInt32 newCapacity = pCache->capacity ? pCache->capacity * 2 : 4;
+		WlFilteredPayload *newPayloads = (WlFilteredPayload*)realloc(pCache->payloads,
+				newCapacity * sizeof(WlFilteredPayload));
+		verify_malloc(newPayloads, pErrorInfo, RSSL_RET_FAILURE);
+
+		memset(&newPayloads[pCache->capacity], 0, 
+				(newCapacity - pCache->capacity) * sizeof(WlFilteredPayload));
+		pCache->payloads = newPayloads;
+		pCache->capacity = newCapacity;
+	}
+
+	/* The filtered list is never longer than the original. */
+	pPayload = &pCache->payloads[pCache->count];
+	if (pPayload->memory.length < pEncFieldList->length)
+	{
+		char *newData = (char*)realloc(pPayload->memory.data, pEncFieldList->length);
+		verify_malloc(newData, pErrorInfo, RSSL_RET_FAILURE);
+		pPayload->memory.data = newData;
+		pPayload->memory.length = pEncFieldList->length;
+	}
+
+	pPayload->pView = pView;
+	pPayload->payload = pPayload->memory;
+
+	switch(ret = wlViewFilterFieldList(pView, pEncFieldList, majorVersion, minorVersion,
+				&pPayload->payload))
+	{
+		case RSSL_RET_SUCCESS:
+			++pCache->count;
+			*ppPayload = &pPayload->payload;
+			return RSSL_RET_SUCCESS;
+
+		case RSSL_RET_UNSUPPORTED_DATA_TYPE:
+			pCache->unfilterable = RSSL_TRUE;
+			*ppPayload = pEncFieldList;
+			return RSSL_RET_SUCCESS;
+
+		default:
+			rsslSetErrorInfo(pErrorInfo, RSSL_EIC_FAILURE, ret, __FILE__, __LINE__, 
+					"Failed to filter field list to request view.");
+			return ret;
+	}
+}
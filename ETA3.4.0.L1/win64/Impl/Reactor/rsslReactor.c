@@ -36,6 +36,9 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 /* Reads from the given channel and handles the message or return code. */
 static RsslRet _reactorDispatchFromChannel(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pReactorChannel, RsslErrorInfo *pError);
 
+/* Stages reads on the channels about to be dispatched and submits queued socket I/O in one call. */
+static RsslRet _reactorSubmitChannelIo(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pDispatchChannel, RsslErrorInfo *pError);
+
 /* Reads and handles an event from the given queue. */
 static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, RsslReactorEventQueue *pQueue, RsslErrorInfo *pError);
 
@@ -181,7 +184,11 @@ static RsslReactorChannelImpl* _reactorTakeChannel(RsslReactorImpl *pReactorImpl
 
 		rsslClearReactorChannelImpl(pReactorImpl, pReactorChannel);
 		rsslInitQueueLink(&pReactorChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pReactorChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		if (rsslInitReactorEventQueue(&pReactorChannel->eventQueue, RSSL_REACTOR_CHANNEL_EVENT_RING_SIZE, &pReactorImpl->activeEventQueueGroup, &pReactorImpl->eventPool) != RSSL_RET_SUCCESS)
+		{
+			free(pReactorChannel);
+			return NULL;
+		}
 
 		if ((pReactorChannel->pWorkerNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -288,6 +295,115 @@ static RsslRet _reactorSendShutdownEvent(RsslReactorImpl *pReactorImpl, RsslErro
 	return RSSL_RET_SUCCESS;
 }
 
+/* Creates a reactor that routes calls to dispatchShardCount shards, each created as an ordinary reactor. */
+static RsslReactor *_reactorCreateSharded(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
+{
+	RsslReactorImpl *pReactorImpl;
+	RsslCreateReactorOptions shardOpts;
+	RsslErrorInfo cleanupError;
+	RsslUInt32 i;
+
+	if (!(pReactorImpl = (RsslReactorImpl*)malloc(sizeof(RsslReactorImpl))))
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor object.");
+		return NULL;
+	}
+
+	rsslClearReactorImpl(pReactorImpl);
+
+	if (!(pReactorImpl->pShards = (RsslReactorImpl**)malloc(pReactorOpts->dispatchShardCount * sizeof(RsslReactorImpl*))))
+	{
+		free(pReactorImpl);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor shards.");
+		return NULL;
+	}
+
+	if (rsslInitReactorEventAggregateSignal(&pReactorImpl->shardEventSignal) != RSSL_RET_SUCCESS)
+	{
+		free(pReactorImpl->pShards);
+		free(pReactorImpl);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize shard event signal.");
+		return NULL;
+	}
+
+	shardOpts = *pReactorOpts;
+	shardOpts.dispatchShardCount = 0;
+
+	for (i = 0; i < pReactorOpts->dispatchShardCount; ++i)
+	{
+		RsslReactorImpl *pShard = (RsslReactorImpl*)rsslCreateReactor(&shardOpts, pError);
+
+		/* Every shard's events trigger the sharded reactor's descriptor. */
+		if (pShard && rsslReactorEventQueueGroupSetAggregateSignal(&pShard->activeEventQueueGroup, &pReactorImpl->shardEventSignal) != RSSL_RET_SUCCESS)
+		{
+			rsslDestroyReactor(&pShard->reactor, &cleanupError);
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to set shard event signal.");
+			pShard = NULL;
+		}
+
+		if (!pShard)
+		{
+			while (i > 0)
+				rsslDestroyReactor(&pReactorImpl->pShards[--i]->reactor, &cleanupError);
+			rsslCleanupReactorEventAggregateSignal(&pReactorImpl->shardEventSignal);
+			free(pReactorImpl->pShards);
+			free(pReactorImpl);
+			return NULL;
+		}
+
+		pShard->pShardParent = pReactorImpl;
+		pReactorImpl->pShards[i] = pShard;
+	}
+
+	pReactorImpl->shardCount = pReactorOpts->dispatchShardCount;
+	pReactorImpl->reactor.eventFd = rsslGetEventSignalFD(&pReactorImpl->shardEventSignal.eventSignal);
+	pReactorImpl->reactor.userSpecPtr = pReactorOpts->userSpecPtr;
+	pReactorImpl->state = RSSL_REACTOR_ST_ACTIVE;
+
+	return (RsslReactor*)pReactorImpl;
+}
+
+/* Picks the shard for a new channel. The channel counts are read without the shards' locks, so this is only a hint. */
+static RsslReactor *_reactorTakeShard(RsslReactorImpl *pReactorImpl)
+{
+	RsslReactorImpl *pShard = pReactorImpl->pShards[0];
+	RsslUInt32 i;
+
+	for (i = 1; i < pReactorImpl->shardCount; ++i)
+	{
+		if (pReactorImpl->pShards[i]->channelCount < pShard->channelCount)
+			pShard = pReactorImpl->pShards[i];
+	}
+
+	return &pShard->reactor;
+}
+
+/* Returns the shard of a sharded reactor that owns the channel. */
+static RsslReactor *_reactorGetChannelShard(RsslReactorImpl *pReactorImpl, RsslReactorChannel *pChannel, RsslErrorInfo *pError)
+{
+	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
+
+	if (!pReactorChannel || !pReactorChannel->pParentReactor || pReactorChannel->pParentReactor->pShardParent != pReactorImpl)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Invalid channel was specified.");
+		return NULL;
+	}
+
+	return &pReactorChannel->pParentReactor->reactor;
+}
+
+RSSL_VA_API RsslUInt32 rsslReactorGetShardCount(RsslReactor *pReactor)
+{
+	return ((RsslReactorImpl*)pReactor)->shardCount;
+}
+
+RSSL_VA_API RsslReactor *rsslReactorGetShard(RsslReactor *pReactor, RsslUInt32 index)
+{
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+
+	return (index < pReactorImpl->shardCount) ? &pReactorImpl->pShards[index]->reactor : NULL;
+}
+
 RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpts, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl;
@@ -298,6 +414,8 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	LARGE_INTEGER	perfFrequency;
 #endif
 
+	if (pReactorOpts->dispatchShardCount > 1)
+		return _reactorCreateSharded(pReactorOpts, pError);
 	
 	/* Call rsslInitialize to ensure that Rssl is initialized with global & channel locks. It is reference counted per call to rsslInitialize/rsslUninitialize. */
 	if (rsslInitialize(RSSL_LOCK_GLOBAL_AND_CHANNEL, &pError->rsslError) != RSSL_RET_SUCCESS)
@@ -332,8 +450,17 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 	
 	rsslClearReactorImpl(pReactorImpl);
 
+	if (rsslInitReactorEventPool(&pReactorImpl->eventPool) != RSSL_RET_SUCCESS)
+	{
+		rsslCleanupReactorEventPool(&pReactorImpl->eventPool);
+		free(pReactorImpl);
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor event pool.");
+		return NULL;
+	}
+
 	/* Copy options */
 	pReactorImpl->dispatchDecodeMemoryBufferSize = pReactorOpts->dispatchDecodeMemoryBufferSize;
+	pReactorImpl->notifierType = (pReactorOpts->notifierType == RSSL_RC_NT_EPOLL) ? RSSL_NOTIFIER_TYPE_EPOLL : RSSL_NOTIFIER_TYPE_DEFAULT;
 	pReactorImpl->reactor.userSpecPtr = pReactorOpts->userSpecPtr;
 	pReactorImpl->tokenReissueRatio = pReactorOpts->tokenReissueRatio;
 	pReactorImpl->reissueTokenAttemptLimit = pReactorOpts->reissueTokenAttemptLimit;
@@ -403,7 +530,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 
 
 	/* Setup reactor */
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorEventQueue, 10, &pReactorImpl->activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	if (rsslInitReactorEventQueue(&pReactorImpl->reactorEventQueue, RSSL_REACTOR_EVENT_RING_SIZE, &pReactorImpl->activeEventQueueGroup, &pReactorImpl->eventPool) != RSSL_RET_SUCCESS)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize event queue.");
@@ -450,7 +577,12 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		}
 		rsslClearReactorChannelImpl(pReactorImpl, pNewChannel);
 		rsslInitQueueLink(&pNewChannel->reactorQueueLink);
-		rsslInitReactorEventQueue(&pNewChannel->eventQueue, 5, &pReactorImpl->activeEventQueueGroup);
+		if (rsslInitReactorEventQueue(&pNewChannel->eventQueue, RSSL_REACTOR_CHANNEL_EVENT_RING_SIZE, &pReactorImpl->activeEventQueueGroup, &pReactorImpl->eventPool) != RSSL_RET_SUCCESS)
+		{
+			free(pNewChannel);
+			rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor channel pool.");
+			return NULL;
+		}
 
 		if ((pNewChannel->pNotifierEvent = rsslCreateNotifierEvent()) == NULL)
 			return NULL;
@@ -461,7 +593,7 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
 		_reactorMoveChannel(&pReactorImpl->channelPool, pNewChannel);
 	}
 
-	if ((pReactorImpl->pNotifier = rsslCreateNotifier(1024)) == NULL)
+	if ((pReactorImpl->pNotifier = rsslCreateNotifierEx(1024, pReactorImpl->notifierType)) == NULL)
 	{
 		_reactorWorkerCleanupReactor(pReactorImpl);
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to create reactor notifier.");
@@ -563,6 +695,23 @@ RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pEr
 {
 	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
 
+	if (pReactorImpl->shardCount)
+	{
+		RsslRet ret = RSSL_RET_SUCCESS, shardRet;
+		RsslUInt32 i;
+
+		for (i = 0; i < pReactorImpl->shardCount; ++i)
+		{
+			if ((shardRet = rsslDestroyReactor(&pReactorImpl->pShards[i]->reactor, pError)) != RSSL_RET_SUCCESS)
+				ret = shardRet;
+		}
+
+		rsslCleanupReactorEventAggregateSignal(&pReactorImpl->shardEventSignal);
+		free(pReactorImpl->pShards);
+		free(pReactorImpl);
+		return ret;
+	}
+
 	switch(pReactorImpl->state)
 	{
 		case RSSL_REACTOR_ST_ACTIVE:
@@ -788,17 +937,17 @@ RSSL_VA_API RsslRet rsslReactorQueryServiceDiscovery(RsslReactor *pReactor, Rssl
 	RsslReactorServiceEndpointEvent reactorServicEndpointEvent;
 	RsslErrorInfo errorInfo;
 
-	rsslClearReactorServiceEndpointEvent(&reactorServicEndpointEvent);
-	reactorServicEndpointEvent.userSpecPtr = pOpts->userSpecPtr;
-
-	pRsslReactorImpl = (RsslReactorImpl *)pReactor;
-
 	if (!pReactor)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
+	pRsslReactorImpl = (RsslReactorImpl *)pReactor;
+
+	if (pRsslReactorImpl->shardCount)
+		return rsslReactorQueryServiceDiscovery(&pRsslReactorImpl->pShards[0]->reactor, pOpts, pError);
+
 	if ((rsslRet = reactorLockInterface(pRsslReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return rsslRet;
 
@@ -814,6 +963,9 @@ RSSL_VA_API RsslRet rsslReactorQueryServiceDiscovery(RsslReactor *pReactor, Rssl
 		return (reactorUnlockInterface(pRsslReactorImpl), RSSL_RET_INVALID_ARGUMENT);
 	}
 
+	rsslClearReactorServiceEndpointEvent(&reactorServicEndpointEvent);
+	reactorServicEndpointEvent.userSpecPtr = pOpts->userSpecPtr;
+
 	if ((!pOpts->userName.data) || (!pOpts->userName.length))
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorServiceDiscoveryOptions.userName not provided.");
@@ -1090,6 +1242,9 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 	RsslReactorCallbackRet cret;
 	RsslReactorAuthTokenEvent authTokenEvent;
 
+	if (pReactorImpl->shardCount)
+		return rsslReactorConnect(_reactorTakeShard(pReactorImpl), pOpts, pRole, pError);
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -1162,6 +1317,11 @@ RSSL_VA_API RsslRet rsslReactorConnect(RsslReactor *pReactor, RsslReactorConnect
 		watchlistCreateOpts.maxOutstandingPosts = pRole->ommConsumerRole.watchlistOptions.maxOutstandingPosts;
 		watchlistCreateOpts.postAckTimeout = pRole->ommConsumerRole.watchlistOptions.postAckTimeout;
 		watchlistCreateOpts.requestTimeout = pRole->ommConsumerRole.watchlistOptions.requestTimeout;
+		watchlistCreateOpts.filterViewsPerRequest = pRole->ommConsumerRole.watchlistOptions.filterViewsPerRequest;
+		watchlistCreateOpts.requestPacingRate = pRole->ommConsumerRole.watchlistOptions.requestPacingRate;
+		watchlistCreateOpts.requestPacingBurst = pRole->ommConsumerRole.watchlistOptions.requestPacingBurst;
+		watchlistCreateOpts.requestPacingLatencyTarget = pRole->ommConsumerRole.watchlistOptions.requestPacingLatencyTarget;
+		watchlistCreateOpts.cacheItemImages = pRole->ommConsumerRole.watchlistOptions.cacheItemImages;
 		watchlistCreateOpts.ticksPerMsec = pReactorImpl->ticksPerMsec;
 		watchlistCreateOpts.loginRequestCount = pReactorChannel->supportSessionMgnt ? pReactorChannel->connectionListCount : 1;
 		pWatchlist = rsslWatchlistCreate(&watchlistCreateOpts, pError);
@@ -1399,6 +1559,9 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	RsslReactorChannelImpl *pReactorChannel;
 	RsslRet ret;
 
+	if (pReactorImpl->shardCount)
+		return rsslReactorAccept(_reactorTakeShard(pReactorImpl), pServer, pOpts, pRole, pError);
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -1470,12 +1633,82 @@ RSSL_VA_API RsslRet rsslReactorAccept(RsslReactor *pReactor, RsslServer *pServer
 	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 }
 
+static RsslRet _reactorDispatch(RsslReactorImpl *pReactorImpl, RsslReactorDispatchOptions *pDispatchOpts, RsslUInt32 *pMaxMsgs, RsslErrorInfo *pError);
+
+/* Dispatches a sharded reactor from one thread: the given channel's shard, or every shard in turn.
+ * maxMessages is shared by all shards, and each call starts from the shard after the last one visited. */
+static RsslRet _reactorDispatchShards(RsslReactorImpl *pReactorImpl, RsslReactorDispatchOptions *pDispatchOpts, RsslErrorInfo *pError)
+{
+	RsslRet ret = RSSL_RET_SUCCESS, shardRet;
+	RsslUInt32 maxMsgs = pDispatchOpts->maxMessages;
+	RsslUInt32 i, shardIndex;
+
+	if (pDispatchOpts->pReactorChannel)
+	{
+		RsslReactor *pShard;
+
+		if (!(pShard = _reactorGetChannelShard(pReactorImpl, pDispatchOpts->pReactorChannel, pError)))
+			return RSSL_RET_INVALID_ARGUMENT;
+
+		return rsslReactorDispatch(pShard, pDispatchOpts, pError);
+	}
+
+	/* Reset the shared descriptor before dispatching; a shard that gets an event from here on sets it again. */
+	if (rsslResetReactorEventAggregateSignal(&pReactorImpl->shardEventSignal) < 0)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to reset shard event signal.");
+		return RSSL_RET_FAILURE;
+	}
+
+	for (i = 0; i < pReactorImpl->shardCount && maxMsgs > 0; ++i)
+	{
+		shardIndex = pReactorImpl->nextDispatchShard;
+		pReactorImpl->nextDispatchShard = (shardIndex + 1) % pReactorImpl->shardCount;
+
+		if ((shardRet = _reactorDispatch(pReactorImpl->pShards[shardIndex], pDispatchOpts, &maxMsgs, pError)) < RSSL_RET_SUCCESS)
+			return shardRet;
+
+		if (shardRet > ret)
+			ret = shardRet;
+	}
+
+	/* Shards not reached before maxMessages ran out may have something to dispatch. */
+	if (i < pReactorImpl->shardCount)
+		ret = 1;
+
+	/* Events left in any shard's queues keep the descriptor triggered. */
+	for (i = 0; i < pReactorImpl->shardCount; ++i)
+	{
+		if (rsslReactorEventQueueGroupIsActive(&pReactorImpl->pShards[i]->activeEventQueueGroup))
+		{
+			if (rsslSetReactorEventAggregateSignal(&pReactorImpl->shardEventSignal) < 0)
+			{
+				rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to set shard event signal.");
+				return RSSL_RET_FAILURE;
+			}
+			break;
+		}
+	}
+
+	return ret;
+}
+
 RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispatchOptions *pDispatchOpts, RsslErrorInfo *pError)
 {
 	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslUInt32 maxMsgs = pDispatchOpts->maxMessages;
+
+	if (pReactorImpl->shardCount)
+		return _reactorDispatchShards(pReactorImpl, pDispatchOpts, pError);
+
+	return _reactorDispatch(pReactorImpl, pDispatchOpts, &maxMsgs, pError);
+}
+
+/* Dispatches the reactor, taking each message dispatched out of *pMaxMsgs. */
+static RsslRet _reactorDispatch(RsslReactorImpl *pReactorImpl, RsslReactorDispatchOptions *pDispatchOpts, RsslUInt32 *pMaxMsgs, RsslErrorInfo *pError)
+{
 	RsslRet ret;
 	RsslUInt32  channelsToCheck, channelsWithData;
-	RsslUInt32 maxMsgs = pDispatchOpts->maxMessages;
 
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_FALSE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
@@ -1503,6 +1736,13 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 
 	if (pReactorImpl->state == RSSL_REACTOR_ST_ACTIVE)
 	{
+		if (_reactorSubmitChannelIo(pReactorImpl, (RsslReactorChannelImpl*)pDispatchOpts->pReactorChannel, pError) != RSSL_RET_SUCCESS)
+		{
+			_reactorShutdown(pReactorImpl, pError);
+			_reactorSendShutdownEvent(pReactorImpl, pError);
+			return (reactorUnlockInterface(pReactorImpl), RSSL_RET_FAILURE);
+		}
+
 		/* No particular channel was specified. Loop in round-robin fashion on all channels until either:
 		 * - The desired number of messages has been dispatched
 		 * - There is nothing more to read */
@@ -1515,7 +1755,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 				RsslReactorEventQueue *pQueue;
 
 				/* Dispatch events from queues in a round-robin fashion until all are processed. */
-				while (maxMsgs > 0 && (pQueue = rsslReactorEventQueueGroupShift(&pReactorImpl->activeEventQueueGroup)))
+				while (*pMaxMsgs > 0 && (pQueue = rsslReactorEventQueueGroupShift(&pReactorImpl->activeEventQueueGroup)))
 				{
 					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, pQueue, pError)) < RSSL_RET_SUCCESS)
 					{
@@ -1523,13 +1763,13 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 						_reactorSendShutdownEvent(pReactorImpl, pError);
 						return (reactorUnlockInterface(pReactorImpl), ret);
 					}
-					if (maxMsgs > 0) --maxMsgs;
+					if (*pMaxMsgs > 0) --(*pMaxMsgs);
 				}
 			}
 
 			channelsWithData = channelsToCheck = rsslQueueGetElementCount(&pReactorImpl->activeChannels);
 
-			while(maxMsgs > 0 && channelsWithData > 0)
+			while(*pMaxMsgs > 0 && channelsWithData > 0)
 			{
 				RsslQueueLink *pLink;
 				RsslBool isFdReadable;
@@ -1566,7 +1806,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 							rsslNotifierEventClearNotifiedFlags(pReactorChannel->pNotifierEvent);
 					}
 					if (channelsToCheck > 0) --channelsToCheck;
-					if (maxMsgs > 0) --maxMsgs;
+					if (*pMaxMsgs > 0) --(*pMaxMsgs);
 				}
 				/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
 				else 
@@ -1632,7 +1872,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 			{
 
 				/* Dispatch from reactor queue */
-				while (maxMsgs > 0)
+				while (*pMaxMsgs > 0)
 				{
 					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, &pReactorImpl->reactorEventQueue, pError)) < RSSL_RET_SUCCESS)
 					{
@@ -1648,14 +1888,14 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					else
 					{
 						/* Message was successfully processed. */
-						--maxMsgs;
+						--(*pMaxMsgs);
 						if (ret == RSSL_RET_SUCCESS)
 							break;
 					}
 				}
 
 				/* Dispatch from channel queue */
-				while (maxMsgs > 0)
+				while (*pMaxMsgs > 0)
 				{
 					if ((ret = _reactorDispatchEventFromQueue(pReactorImpl, &pReactorChannel->eventQueue, pError)) < RSSL_RET_SUCCESS)
 					{
@@ -1671,7 +1911,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 					else
 					{
 						/* Message was successfully processed. */
-						--maxMsgs;
+						--(*pMaxMsgs);
 						if (ret == RSSL_RET_SUCCESS)
 							break;
 					}
@@ -1689,7 +1929,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 				if (pReactorChannel->readRet > 0 || rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
 				{
 					channelsToCheck = 1;
-					while (maxMsgs > 0 && channelsToCheck > 0)
+					while (*pMaxMsgs > 0 && channelsToCheck > 0)
 					{
 						if ((ret = _reactorDispatchFromChannel(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
 						{
@@ -1710,7 +1950,7 @@ RSSL_VA_API RsslRet rsslReactorDispatch(RsslReactor *pReactor, RsslReactorDispat
 							channelsToCheck = 0;
 							break;
 						}
-						if (maxMsgs > 0) --maxMsgs;
+						if (*pMaxMsgs > 0) --(*pMaxMsgs);
 					}
 				}
 				/* If not triggered to read, check if this channel has passed its ping timeout without sending either a ping or some data. */
@@ -1748,6 +1988,12 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslUInt32 dummyBytesWritten, dummyUncompBytesWritten;
 
+	if (pReactorImpl->shardCount)
+	{
+		RsslReactor *pShard = _reactorGetChannelShard(pReactorImpl, pChannel, pError);
+		return pShard ? rsslReactorSubmit(pShard, pChannel, buffer, pSubmitOptions, pError) : RSSL_RET_INVALID_ARGUMENT;
+	}
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -1856,6 +2102,11 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 	RsslReactorChannelImpl *pReactorChannel = (RsslReactorChannelImpl*)pChannel;
 	RsslRet ret;
 
+	if (pReactorImpl->shardCount)
+	{
+		RsslReactor *pShard = _reactorGetChannelShard(pReactorImpl, pChannel, pError);
+		return pShard ? rsslReactorSubmitMsg(pShard, pChannel, pOptions, pError) : RSSL_RET_INVALID_ARGUMENT;
+	}
 
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
@@ -1880,6 +2131,8 @@ RSSL_VA_API RsslRet rsslReactorSubmitMsg(RsslReactor *pReactor, RsslReactorChann
 		processOpts.pRdmMsg = pOptions->pRDMMsg;
 		processOpts.pServiceName = pOptions->pServiceName;
 		processOpts.pUserSpec = pOptions->requestMsgOptions.pUserSpec;
+		processOpts.conflationInterval = pOptions->requestMsgOptions.conflationInterval;
+		processOpts.conflationBypassUpdateTypes = pOptions->requestMsgOptions.conflationBypassUpdateTypes;
 		processOpts.majorVersion = pOptions->majorVersion;
 		processOpts.minorVersion = pOptions->minorVersion;
 
@@ -2263,6 +2516,12 @@ RSSL_VA_API RsslRet rsslReactorCloseChannel(RsslReactor *pReactor, RsslReactorCh
 	RsslReactorChannelImpl *pReactorChannel;
 	RsslRet ret;
 
+	if (pReactorImpl->shardCount)
+	{
+		RsslReactor *pShard = _reactorGetChannelShard(pReactorImpl, pChannel, pError);
+		return pShard ? rsslReactorCloseChannel(pShard, pChannel, pError) : RSSL_RET_INVALID_ARGUMENT;
+	}
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -2368,6 +2627,34 @@ static RsslRet _reactorHandleTunnelManagerRet(RsslReactorImpl *pReactorImpl, Rss
 
 }
 
+static RsslRet _reactorSubmitChannelIo(RsslReactorImpl *pReactorImpl, RsslReactorChannelImpl *pDispatchChannel, RsslErrorInfo *pError)
+{
+	RsslQueueLink *pLink;
+	RsslReactorChannelImpl *pReactorChannel;
+
+	/* Channels using RSSL_SOCKET_IO_URING receive here, so the rsslRead calls that follow
+	 * only consume the results; other channels ignore rsslPrepareRead. */
+	RSSL_QUEUE_FOR_EACH_LINK(&pReactorImpl->activeChannels, pLink)
+	{
+		pReactorChannel = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorChannelImpl, reactorQueueLink, pLink);
+
+		if (pDispatchChannel && pDispatchChannel != pReactorChannel)
+			continue;
+
+		/* A failure here is left for rsslRead to report on this channel. */
+		if (pReactorChannel->reactorChannel.pRsslChannel && rsslNotifierEventIsReadable(pReactorChannel->pNotifierEvent))
+			rsslPrepareRead(pReactorChannel->reactorChannel.pRsslChannel, &pError->rsslError);
+	}
+
+	if (rsslSubmitIo(&pError->rsslError) < RSSL_RET_SUCCESS)
+	{
+		rsslSetErrorInfoLocation(pError, __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, RsslReactorEventQueue *pQueue, RsslErrorInfo *pError)
 {
 	RsslRet ret;
@@ -2645,6 +2932,14 @@ static RsslRet _reactorDispatchEventFromQueue(RsslReactorImpl *pReactorImpl, Rss
 					if ((ret = rsslWatchlistProcessTimer(pReactorChannel->pWatchlist, pEvent->timerEvent.expireTime, pError))
 							!= RSSL_RET_SUCCESS)
 						return (_reactorHandleChannelDown(pReactorImpl, pReactorChannel, pError));
+
+					/* Send any requests the timers released. */
+					if (pReactorChannel->pWatchlist->state & RSSLWL_STF_NEED_DISPATCH)
+					{
+						pReactorChannel->pWatchlist->state &= ~RSSLWL_STF_NEED_DISPATCH;
+						if ((ret = _reactorDispatchWatchlist(pReactorImpl, pReactorChannel, pError)) < RSSL_RET_SUCCESS)
+							return ret;
+					}
 				}
 
 				if (pReactorChannel->pTunnelManager)
@@ -4339,6 +4634,24 @@ RSSL_VA_API RsslRet rsslReactorSubmitOAuthCredentialRenewal(RsslReactor *pReacto
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
+	if (pReactorImpl->shardCount)
+	{
+		/* Pass the call to the shard whose credential renewal callback is running, if any. */
+		RsslUInt32 i;
+		RsslReactorImpl *pShard = pReactorImpl->pShards[0];
+
+		for (i = 0; i < pReactorImpl->shardCount; ++i)
+		{
+			if (pReactorImpl->pShards[i]->pTokenSessionForCredentialRenewalCallback)
+			{
+				pShard = pReactorImpl->pShards[i];
+				break;
+			}
+		}
+
+		return rsslReactorSubmitOAuthCredentialRenewal(&pShard->reactor, pOptions, pReactorOAuthCredentialRenewal, pError);
+	}
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -4459,6 +4772,12 @@ RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, R
 		return RSSL_RET_INVALID_ARGUMENT;
 	}
 
+	if (pReactorImpl->shardCount)
+	{
+		RsslReactor *pShard = _reactorGetChannelShard(pReactorImpl, pReactorChannel, pError);
+		return pShard ? rsslReactorRetrieveChannelStatistic(pShard, pReactorChannel, pRsslReactorChannelStatistic, pError) : RSSL_RET_INVALID_ARGUMENT;
+	}
+
 	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
 		return ret;
 
@@ -4498,6 +4817,134 @@ RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, R
 	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
 }
 
+RSSL_VA_API RsslRet rsslReactorRetrieveRequestPacingStatistic(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
+	RsslReactorRequestPacingStatistic *pRsslReactorRequestPacingStatistic, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
+	RsslWatchlistPacingStats pacingStats;
+
+	if (!pError)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (!pReactor)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pReactorImpl->shardCount)
+	{
+		RsslReactor *pShard = _reactorGetChannelShard(pReactorImpl, pReactorChannel, pError);
+		return pShard ? rsslReactorRetrieveRequestPacingStatistic(pShard, pReactorChannel, pRsslReactorRequestPacingStatistic, pError) : RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pReactorChannel)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pRsslReactorRequestPacingStatistic)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorRequestPacingStatistic not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pReactorChannelImpl->pWatchlist)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel does not have a watchlist.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	rsslWatchlistGetPacingStats(pReactorChannelImpl->pWatchlist, &pacingStats);
+
+	rsslClearReactorRequestPacingStatistic(pRsslReactorRequestPacingStatistic);
+	pRsslReactorRequestPacingStatistic->requestsWaiting = pacingStats.requestsWaiting;
+	pRsslReactorRequestPacingStatistic->requestsSent = pacingStats.requestsReleased;
+	pRsslReactorRequestPacingStatistic->refreshesCompleted = pacingStats.refreshesCompleted;
+	pRsslReactorRequestPacingStatistic->requestRate = pacingStats.requestRate;
+	pRsslReactorRequestPacingStatistic->averageRefreshLatency = pacingStats.averageRefreshLatency;
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
+RSSL_VA_API RsslRet rsslReactorRetrieveWatchlistMemoryStatistic(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
+	RsslReactorWatchlistMemoryStatistic *pRsslReactorWatchlistMemoryStatistic, RsslErrorInfo *pError)
+{
+	RsslRet ret;
+	RsslReactorImpl *pReactorImpl = (RsslReactorImpl*)pReactor;
+	RsslReactorChannelImpl *pReactorChannelImpl = (RsslReactorChannelImpl*)pReactorChannel;
+	WlSlabClassStats slabStats[WL_SLAB_CLASS_COUNT + 1];
+	RsslUInt32 ui;
+
+	if (!pError)
+		return RSSL_RET_INVALID_ARGUMENT;
+
+	if (!pReactor)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactor not provided.");
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if (pReactorImpl->shardCount)
+	{
+		RsslReactor *pShard = _reactorGetChannelShard(pReactorImpl, pReactorChannel, pError);
+		return pShard ? rsslReactorRetrieveWatchlistMemoryStatistic(pShard, pReactorChannel, pRsslReactorWatchlistMemoryStatistic, pError) : RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	if ((ret = reactorLockInterface(pReactorImpl, RSSL_TRUE, pError)) != RSSL_RET_SUCCESS)
+		return ret;
+
+	if (pReactorImpl->state != RSSL_REACTOR_ST_ACTIVE)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "Reactor is shutting down.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pReactorChannel)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pRsslReactorWatchlistMemoryStatistic)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorWatchlistMemoryStatistic not provided.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	if (!pReactorChannelImpl->pWatchlist)
+	{
+		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_INVALID_ARGUMENT, __FILE__, __LINE__, "RsslReactorChannel does not have a watchlist.");
+		return (reactorUnlockInterface(pReactorImpl), RSSL_RET_INVALID_ARGUMENT);
+	}
+
+	rsslWatchlistGetMemoryStats(pReactorChannelImpl->pWatchlist, slabStats);
+
+	rsslClearReactorWatchlistMemoryStatistic(pRsslReactorWatchlistMemoryStatistic);
+	for (ui = 0; ui < WL_SLAB_CLASS_COUNT + 1 && ui < RSSL_REACTOR_WATCHLIST_MEMORY_CLASSES; ++ui)
+	{
+		RsslReactorWatchlistMemoryClass *pClass = &pRsslReactorWatchlistMemoryStatistic->classes[ui];
+		pClass->blockSize = slabStats[ui].blockSize;
+		pClass->blocksAllocated = slabStats[ui].blocksAllocated;
+		pClass->blocksInUse = slabStats[ui].blocksInUse;
+		pClass->blocksHighWater = slabStats[ui].blocksHighWater;
+	}
+
+	return (reactorUnlockInterface(pReactorImpl), RSSL_RET_SUCCESS);
+}
+
 RsslRet reactorUnlockInterface(RsslReactorImpl *pReactorImpl)
 {
 	RSSL_MUTEX_UNLOCK(&pReactorImpl->interfaceLock);
@@ -92,7 +92,8 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 		return RSSL_RET_FAILURE;
 	}
 
-	if (rsslInitReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue, 10, &pReactorImpl->reactorWorker.activeEventQueueGroup) != RSSL_RET_SUCCESS)
+	if (rsslInitReactorEventQueue(&pReactorImpl->reactorWorker.workerQueue, RSSL_REACTOR_EVENT_RING_SIZE, &pReactorImpl->reactorWorker.activeEventQueueGroup,
+			&pReactorImpl->eventPool) != RSSL_RET_SUCCESS)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to init worker event queue.");
 		return RSSL_RET_FAILURE;
@@ -125,7 +126,7 @@ RsslRet _reactorWorkerStart(RsslReactorImpl *pReactorImpl, RsslCreateReactorOpti
 		rsslQueueAddLinkToBack(&pReactorImpl->reactorWorker.errorInfoPool, &pReactorErrorInfoImpl->poolLink);
 	}
 
-	pReactorImpl->reactorWorker.pNotifier = rsslCreateNotifier(1024);
+	pReactorImpl->reactorWorker.pNotifier = rsslCreateNotifierEx(1024, pReactorImpl->notifierType);
 	if (pReactorImpl->reactorWorker.pNotifier == NULL)
 	{
 		rsslSetErrorInfo(pError, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to initialize notifier.");
@@ -268,6 +269,9 @@ void _reactorWorkerCleanupReactor(RsslReactorImpl *pReactorImpl)
 		free(pReactorChannel);
 	}
 
+	/* Events are returned to the pool by the queue cleanups above. */
+	rsslCleanupReactorEventPool(&pReactorImpl->eventPool);
+
 	if (pReactorImpl->pNotifier)
 		rsslDestroyNotifier(pReactorImpl->pNotifier);
 
@@ -528,6 +532,13 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 		RsslRestHandle *pRestHandle;
 		RsslQueueLink *pLink;
 
+		/* Hand any sends queued by RSSL_SOCKET_IO_URING channels during the last pass to the kernel before sleeping. */
+		if (rsslSubmitIo(&pReactorWorker->workerCerr.rsslError) < RSSL_RET_SUCCESS)
+		{
+			rsslSetErrorInfoLocation(&pReactorWorker->workerCerr, __FILE__, __LINE__);
+			return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+		}
+
 		ret = rsslNotifierWait(pReactorWorker->pNotifier, pReactorWorker->sleepTimeMs * 1000);
 
 		pReactorWorker->lastRecordedTimeMs = getCurrentTimeMs(pReactorImpl->ticksPerMsec);
@@ -750,6 +761,18 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 											pReactorChannel = (RsslReactorChannelImpl*)pFlushEvent->pReactorChannel;
 											if (pReactorChannel->reactorChannel.pRsslChannel != NULL && pReactorChannel->reactorChannel.pRsslChannel->socketId != REACTOR_INVALID_SOCKET)
 											{
+												/* The reactor thread may have seen an FD change on this channel. */
+												if (pReactorChannel->reactorChannel.pRsslChannel->socketId != pReactorChannel->workerNotifierFd)
+												{
+													if (rsslNotifierUpdateEventFd(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent, (int)pReactorChannel->reactorChannel.pRsslChannel->socketId) < 0)
+													{
+														rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
+																"Failed to update file descriptor for flushing channel.");
+														return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
+													}
+													pReactorChannel->workerNotifierFd = pReactorChannel->reactorChannel.pRsslChannel->socketId;
+												}
+
 												if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 												{
 													rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
@@ -1118,6 +1141,7 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 									"Failed to update file descriptor for channel.");
 							return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 						}
+						pReactorChannel->workerNotifierFd = pReactorChannel->reactorChannel.pRsslChannel->socketId;
 					}
 					else if (pReactorChannel->reactorChannel.pRsslChannel->state == RSSL_CH_STATE_INITIALIZING)
 					{
@@ -1149,6 +1173,7 @@ RSSL_THREAD_DECLARE(runReactorWorker, pArg)
 													"Failed to update notification event for initializing channel that is changing descriptor.");
 											return (_reactorWorkerShutdown(pReactorImpl, &pReactorWorker->workerCerr), RSSL_THREAD_RETURN());
 										}
+										pReactorChannel->workerNotifierFd = pReactorChannel->reactorChannel.pRsslChannel->socketId;
 										if (rsslNotifierRegisterRead(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 										{
 											rsslSetErrorInfo(&pReactorWorker->workerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, 
@@ -1968,6 +1993,7 @@ RsslRet _reactorWorkerProcessNewChannel(RsslReactorImpl *pReactorImpl, RsslReact
 		rsslSetErrorInfo(&pReactorChannel->channelWorkerCerr, RSSL_EIC_FAILURE, RSSL_RET_FAILURE, __FILE__, __LINE__, "Failed to add notifier event for initializing channel.");
 		return RSSL_RET_FAILURE;
 	}
+	pReactorChannel->workerNotifierFd = pReactorChannel->reactorChannel.pRsslChannel->socketId;
 
 	if (rsslNotifierRegisterWrite(pReactorWorker->pNotifier, pReactorChannel->pWorkerNotifierEvent) < 0)
 	{
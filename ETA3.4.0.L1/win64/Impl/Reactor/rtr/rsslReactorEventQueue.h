@@ -12,6 +12,7 @@
 #include "rtr/rsslRDMMsg.h"
 #include "rtr/rsslEventSignal.h"
 #include "rtr/rsslThread.h"
+#include "rtr/rtratomic.h"
 
 #include <stdlib.h>
 
@@ -21,6 +22,7 @@
 #include <fcntl.h>
 #include <process.h>
 #include <math.h>
+#include <intrin.h>
 #endif
 
 #ifdef __cplusplus
@@ -29,16 +31,363 @@ extern "C" {
 
 /* Event Queue */
 
+#define RSSL_REACTOR_EVENT_RING_SIZE 1024			/* Ring size for the reactor and worker queues */
+#define RSSL_REACTOR_CHANNEL_EVENT_RING_SIZE 64		/* Ring size for each channel's queue */
+#define RSSL_REACTOR_EVENT_POOL_RING_SIZE 4096		/* Free events the pool can hold without taking its lock */
+#define RSSL_REACTOR_EVENT_SLAB_SIZE 64				/* Events allocated at a time when the pool runs dry */
+
+/* Reads a value that other threads update, with acquire semantics: later reads, such as of the
+ * event a ring cell points to, see everything written before the matching release store. */
+RTR_C_INLINE rtr_atomic_val _rsslReactorEventAtomicRead(rtr_atomic_val *pVar)
+{
+#ifdef WIN32
+	/* x64 does not reorder a load with later loads or stores, so only the compiler needs fencing */
+	rtr_atomic_val val = *(volatile rtr_atomic_val*)pVar;
+	_ReadWriteBarrier();
+	return val;
+#else
+	return __atomic_load_n(pVar, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/* Writes a value with release semantics, so a thread that reads it with _rsslReactorEventAtomicRead
+ * also sees every write made before it. */
+RTR_C_INLINE void _rsslReactorEventAtomicWrite(rtr_atomic_val *pVar, rtr_atomic_val val)
+{
+#ifdef WIN32
+	_ReadWriteBarrier();
+	*(volatile rtr_atomic_val*)pVar = val;
+#else
+	__atomic_store_n(pVar, val, __ATOMIC_RELEASE);
+#endif
+}
+
+/* Adds delta to *pVar and returns the new value. */
+RTR_C_INLINE rtr_atomic_val _rsslReactorEventAtomicAdd(rtr_atomic_val *pVar, rtr_atomic_val delta)
+{
+	rtr_atomic_val oldVal;
+
+	do
+	{
+		oldVal = _rsslReactorEventAtomicRead(pVar);
+	} while (RTR_ATOMIC_COMPARE_AND_SWAP(*pVar, oldVal, oldVal + delta) != oldVal);
+
+	return oldVal + delta;
+}
+
+/* RsslReactorEventRing
+ * Bounded ring of event pointers that any number of threads can put to without a lock.
+ * Each cell's sequence says whether it is free for the position being put (sequence == position)
+ * or holds the event for the position being taken (sequence == position + 1).
+ * Positions are free-running and compared with unsigned arithmetic, so they may wrap. */
+typedef struct
+{
+	rtr_atomic_val sequence;
+	RsslReactorEventImpl *pEvent;
+} RsslReactorEventRingCell;
+
+typedef struct
+{
+	RsslReactorEventRingCell *cells;
+	RsslUInt32 mask;
+	rtr_atomic_val putPos;
+	char pad[64];	/* Keeps producers and the consumer off each other's cache line */
+	rtr_atomic_val getPos;
+} RsslReactorEventRing;
+
+/* size must be a power of 2. */
+RTR_C_INLINE RsslRet _rsslReactorEventRingInit(RsslReactorEventRing *pRing, RsslUInt32 size)
+{
+	RsslUInt32 i;
+
+	memset(pRing, 0, sizeof(RsslReactorEventRing));
+
+	if ((pRing->cells = (RsslReactorEventRingCell*)malloc(size * sizeof(RsslReactorEventRingCell))) == NULL)
+		return RSSL_RET_FAILURE;
+
+	for (i = 0; i < size; ++i)
+	{
+		pRing->cells[i].sequence = (rtr_atomic_val)i;
+		pRing->cells[i].pEvent = NULL;
+	}
+
+	pRing->mask = size - 1;
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE void _rsslReactorEventRingCleanup(RsslReactorEventRing *pRing)
+{
+	free(pRing->cells);
+	pRing->cells = NULL;
+}
+
+/* Returns RSSL_FALSE if the ring is full. */
+RTR_C_INLINE RsslBool _rsslReactorEventRingPut(RsslReactorEventRing *pRing, RsslReactorEventImpl *pEvent)
+{
+	RsslReactorEventRingCell *pCell;
+	rtr_atomic_val pos = _rsslReactorEventAtomicRead(&pRing->putPos);
+
+	while (RSSL_TRUE)
+	{
+		RsslInt32 diff;
+
+		pCell = &pRing->cells[(RsslUInt32)pos & pRing->mask];
+		diff = (RsslInt32)((RsslUInt32)_rsslReactorEventAtomicRead(&pCell->sequence) - (RsslUInt32)pos);
+
+		if (diff == 0)
+		{
+			/* Cell is free; claim the position. */
+			rtr_atomic_val prevPos = RTR_ATOMIC_COMPARE_AND_SWAP(pRing->putPos, pos, (rtr_atomic_val)((RsslUInt32)pos + 1));
+			if (prevPos == pos)
+				break;
+			pos = prevPos;
+		}
+		else if (diff < 0)
+			return RSSL_FALSE; /* Cell still holds the event from one lap ago. */
+		else
+			pos = _rsslReactorEventAtomicRead(&pRing->putPos); /* Another producer claimed this position. */
+	}
+
+	pCell->pEvent = pEvent;
+	_rsslReactorEventAtomicWrite(&pCell->sequence, (rtr_atomic_val)((RsslUInt32)pos + 1));
+	return RSSL_TRUE;
+}
+
+/* Takes the next event when any number of threads may be taking. */
+RTR_C_INLINE RsslReactorEventImpl *_rsslReactorEventRingGet(RsslReactorEventRing *pRing)
+{
+	RsslReactorEventRingCell *pCell;
+	RsslReactorEventImpl *pEvent;
+	rtr_atomic_val pos = _rsslReactorEventAtomicRead(&pRing->getPos);
+
+	while (RSSL_TRUE)
+	{
+		RsslInt32 diff;
+
+		pCell = &pRing->cells[(RsslUInt32)pos & pRing->mask];
+		diff = (RsslInt32)((RsslUInt32)_rsslReactorEventAtomicRead(&pCell->sequence) - ((RsslUInt32)pos + 1));
+
+		if (diff == 0)
+		{
+			rtr_atomic_val prevPos = RTR_ATOMIC_COMPARE_AND_SWAP(pRing->getPos, pos, (rtr_atomic_val)((RsslUInt32)pos + 1));
+			if (prevPos == pos)
+				break;
+			pos = prevPos;
+		}
+		else if (diff < 0)
+			return NULL; /* Empty, or the event for this position is not published yet. */
+		else
+			pos = _rsslReactorEventAtomicRead(&pRing->getPos);
+	}
+
+	pEvent = pCell->pEvent;
+	_rsslReactorEventAtomicWrite(&pCell->sequence, (rtr_atomic_val)((RsslUInt32)pos + pRing->mask + 1));
+	return pEvent;
+}
+
+/* Takes the next event when only the calling thread takes from the ring. */
+RTR_C_INLINE RsslReactorEventImpl *_rsslReactorEventRingGetSingle(RsslReactorEventRing *pRing)
+{
+	RsslReactorEventRingCell *pCell;
+	RsslReactorEventImpl *pEvent;
+	RsslUInt32 pos = (RsslUInt32)pRing->getPos;
+
+	pCell = &pRing->cells[pos & pRing->mask];
+	if ((RsslUInt32)_rsslReactorEventAtomicRead(&pCell->sequence) != pos + 1)
+		return NULL;
+
+	pEvent = pCell->pEvent;
+	_rsslReactorEventAtomicWrite(&pCell->sequence, (rtr_atomic_val)(pos + pRing->mask + 1));
+	pRing->getPos = (rtr_atomic_val)(pos + 1);
+	return pEvent;
+}
+
+/* Returns RSSL_TRUE if no position has been claimed past the consumer's, i.e. no producer is still
+ * publishing to the ring.  Only meaningful to the single consumer. */
+RTR_C_INLINE RsslBool _rsslReactorEventRingIsEmpty(RsslReactorEventRing *pRing)
+{
+	return ((RsslUInt32)_rsslReactorEventAtomicRead(&pRing->putPos) == (RsslUInt32)pRing->getPos) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/* RsslReactorEventPool
+ * Events shared by all event queues of a reactor.  An event taken from the pool through one queue
+ * may be returned through another, so the pool belongs to the reactor rather than to a queue.
+ * Events are allocated in slabs that are only freed when the pool is cleaned up.
+ * Free events are kept in a lock-free ring; the lock is only taken to allocate a slab or
+ * when the ring is full. */
+typedef struct _RsslReactorEventSlab
+{
+	struct _RsslReactorEventSlab *pNext;
+	RsslReactorEventImpl events[RSSL_REACTOR_EVENT_SLAB_SIZE];
+} RsslReactorEventSlab;
+
+typedef struct
+{
+	RsslReactorEventRing freeEvents;
+	RsslMutex lock;
+	RsslReactorEventSlab *pSlabs;	/* Protected by lock */
+	RsslQueue spareEvents;			/* Free events that did not fit in freeEvents; protected by lock */
+} RsslReactorEventPool;
+
+/* Allocates a slab, keeps one of its events for the caller and frees the rest.  Used when freeEvents is empty. */
+RTR_C_INLINE RsslReactorEventImpl *_rsslReactorEventPoolGrow(RsslReactorEventPool *pPool)
+{
+	RsslReactorEventSlab *pSlab;
+	RsslReactorEventImpl *pEvent;
+	RsslQueueLink *pLink;
+	int i;
+
+	RSSL_MUTEX_LOCK(&pPool->lock);
+
+	if ((pLink = rsslQueueRemoveFirstLink(&pPool->spareEvents)))
+	{
+		RSSL_MUTEX_UNLOCK(&pPool->lock);
+		return RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+	}
+
+	if ((pSlab = (RsslReactorEventSlab*)malloc(sizeof(RsslReactorEventSlab))) == NULL)
+	{
+		RSSL_MUTEX_UNLOCK(&pPool->lock);
+		return NULL;
+	}
+
+	pSlab->pNext = pPool->pSlabs;
+	pPool->pSlabs = pSlab;
+
+	for (i = 0; i < RSSL_REACTOR_EVENT_SLAB_SIZE; ++i)
+	{
+		pEvent = &pSlab->events[i];
+		rsslClearReactorEventImpl(pEvent);
+		rsslInitQueueLink(&pEvent->base.eventQueueLink);
+
+		if (i > 0 && !_rsslReactorEventRingPut(&pPool->freeEvents, pEvent))
+			rsslQueueAddLinkToBack(&pPool->spareEvents, &pEvent->base.eventQueueLink);
+	}
+
+	RSSL_MUTEX_UNLOCK(&pPool->lock);
+
+	return &pSlab->events[0];
+}
+
+RTR_C_INLINE RsslRet rsslInitReactorEventPool(RsslReactorEventPool *pPool)
+{
+	RsslReactorEventImpl *pEvent;
+
+	memset(pPool, 0, sizeof(RsslReactorEventPool));
+
+	if (_rsslReactorEventRingInit(&pPool->freeEvents, RSSL_REACTOR_EVENT_POOL_RING_SIZE) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	RSSL_MUTEX_INIT(&pPool->lock);
+	rsslInitQueue(&pPool->spareEvents);
+
+	/* Start with one slab. */
+	if ((pEvent = _rsslReactorEventPoolGrow(pPool)) == NULL)
+		return RSSL_RET_FAILURE;
+	_rsslReactorEventRingPut(&pPool->freeEvents, pEvent);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rsslCleanupReactorEventPool
+ * Frees all events, so must be called after all queues using the pool are cleaned up. */
+RTR_C_INLINE void rsslCleanupReactorEventPool(RsslReactorEventPool *pPool)
+{
+	RsslReactorEventSlab *pSlab;
+
+	if (!pPool->freeEvents.cells)
+		return;
+
+	while ((pSlab = pPool->pSlabs))
+	{
+		pPool->pSlabs = pSlab->pNext;
+		free(pSlab);
+	}
+
+	_rsslReactorEventRingCleanup(&pPool->freeEvents);
+	RSSL_MUTEX_DESTROY(&pPool->lock);
+}
+
+RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventPoolGet(RsslReactorEventPool *pPool)
+{
+	RsslReactorEventImpl *pEvent;
+
+	if ((pEvent = _rsslReactorEventRingGet(&pPool->freeEvents)))
+		return pEvent;
+
+	return _rsslReactorEventPoolGrow(pPool);
+}
+
+RTR_C_INLINE void rsslReactorEventPoolPut(RsslReactorEventPool *pPool, RsslReactorEventImpl *pEvent)
+{
+	if (_rsslReactorEventRingPut(&pPool->freeEvents, pEvent))
+		return;
+
+	RSSL_MUTEX_LOCK(&pPool->lock);
+	rsslQueueAddLinkToBack(&pPool->spareEvents, &pEvent->base.eventQueueLink);
+	RSSL_MUTEX_UNLOCK(&pPool->lock);
+}
+
 typedef struct _RsslReactorEventQueueGroup RsslReactorEventQueueGroup;
 
+/* RsslReactorEventAggregateSignal
+ * Descriptor shared by several event queue groups, such as those of a sharded reactor's shards.
+ * A group sets it along with its own signal, from whichever thread activates the group, so it has its own lock.
+ * Only the owner resets it. */
+typedef struct
+{
+	RsslMutex lock;
+	RsslEventSignal eventSignal;
+} RsslReactorEventAggregateSignal;
+
+RTR_C_INLINE RsslRet rsslInitReactorEventAggregateSignal(RsslReactorEventAggregateSignal *pSignal)
+{
+	if (!rsslInitEventSignal(&pSignal->eventSignal))
+		return RSSL_RET_FAILURE;
+
+	RSSL_MUTEX_INIT(&pSignal->lock);
+	return RSSL_RET_SUCCESS;
+}
+
+RTR_C_INLINE void rsslCleanupReactorEventAggregateSignal(RsslReactorEventAggregateSignal *pSignal)
+{
+	rsslCleanupEventSignal(&pSignal->eventSignal);
+	RSSL_MUTEX_DESTROY(&pSignal->lock);
+}
+
+RTR_C_INLINE int rsslSetReactorEventAggregateSignal(RsslReactorEventAggregateSignal *pSignal)
+{
+	int ret;
+
+	RSSL_MUTEX_LOCK(&pSignal->lock);
+	ret = rsslSetEventSignal(&pSignal->eventSignal);
+	RSSL_MUTEX_UNLOCK(&pSignal->lock);
+	return ret;
+}
+
+RTR_C_INLINE int rsslResetReactorEventAggregateSignal(RsslReactorEventAggregateSignal *pSignal)
+{
+	int ret;
+
+	RSSL_MUTEX_LOCK(&pSignal->lock);
+	ret = rsslResetEventSignal(&pSignal->eventSignal);
+	RSSL_MUTEX_UNLOCK(&pSignal->lock);
+	return ret;
+}
+
 /* RsslReactorEventQueue
- * Queue of RsslReactorEvents */
+ * Queue of RsslReactorEvents.  Any number of threads may put events; only one thread takes them.
+ * Events go through a lock-free ring.  If the ring is full they go to overflowQueue instead, and
+ * keep going there until the consumer has emptied it, so that events from one producer stay in order
+ * (the consumer only takes from overflowQueue once every claimed ring position has been taken). */
 typedef struct
 {
-	RsslQueue eventPool;
-	RsslQueue eventQueue;
-	RsslMutex eventPoolLock;
-	RsslMutex eventQueueLock;
+	RsslReactorEventRing eventRing;
+	RsslQueue overflowQueue;			/* Protected by overflowLock */
+	RsslMutex overflowLock;
+	rtr_atomic_val overflowCount;		/* Events in overflowQueue */
+	rtr_atomic_val eventCount;			/* Events put and not yet taken; counted before they are published */
+	RsslReactorEventPool *pEventPool;
 	RsslReactorEventImpl *pLastEvent;
 
 	RsslReactorEventQueueGroup *pParentGroup;
@@ -54,6 +403,7 @@ struct _RsslReactorEventQueueGroup
 	RsslQueue readyEventQueueGroup;
 	RsslMutex lock;
 	RsslEventSignal eventSignal;
+	RsslReactorEventAggregateSignal *pAggregateSignal; /* If set, also triggered whenever eventSignal is; protected by lock */
 };
 
 RTR_C_INLINE RsslRet rsslInitReactorEventQueueGroup(RsslReactorEventQueueGroup *pList)
@@ -64,10 +414,39 @@ RTR_C_INLINE RsslRet rsslInitReactorEventQueueGroup(RsslReactorEventQueueGroup *
 	RSSL_MUTEX_INIT(&pList->lock);
 
 	rsslInitQueue(&pList->readyEventQueueGroup);
+	pList->pAggregateSignal = NULL;
 
 	return RSSL_RET_SUCCESS;
 }
 
+/* rsslReactorEventQueueGroupSetAggregateSignal
+ * Makes the group also trigger pSignal, triggering it now if the group already has active queues. */
+RTR_C_INLINE RsslRet rsslReactorEventQueueGroupSetAggregateSignal(RsslReactorEventQueueGroup *pQueueList, RsslReactorEventAggregateSignal *pSignal)
+{
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	RSSL_MUTEX_LOCK(&pQueueList->lock);
+	pQueueList->pAggregateSignal = pSignal;
+	if (pSignal && rsslQueueGetElementCount(&pQueueList->readyEventQueueGroup) > 0 && rsslSetReactorEventAggregateSignal(pSignal) < 0)
+		ret = RSSL_RET_FAILURE;
+	RSSL_MUTEX_UNLOCK(&pQueueList->lock);
+
+	return ret;
+}
+
+/* rsslReactorEventQueueGroupIsActive
+ * Returns RSSL_TRUE if any queue in the group has events to dispatch. */
+RTR_C_INLINE RsslBool rsslReactorEventQueueGroupIsActive(RsslReactorEventQueueGroup *pQueueList)
+{
+	RsslBool isActive;
+
+	RSSL_MUTEX_LOCK(&pQueueList->lock);
+	isActive = (rsslQueueGetElementCount(&pQueueList->readyEventQueueGroup) > 0) ? RSSL_TRUE : RSSL_FALSE;
+	RSSL_MUTEX_UNLOCK(&pQueueList->lock);
+
+	return isActive;
+}
+
 /* rsslReactorEventQueueGroupShift
  * "Rotates" the queues in the group, by taking the first queue, moving it to the back, and returning it. */
 RTR_C_INLINE RsslReactorEventQueue* rsslReactorEventQueueGroupShift(RsslReactorEventQueueGroup *pQueueList)
@@ -87,19 +466,55 @@ RTR_C_INLINE int rsslGetEventQueueGroupSignalFD(RsslReactorEventQueueGroup *pQue
 	return rsslGetEventSignalFD(&pQueueList->eventSignal);
 }
 
+/* Adds the event queue to its parent's event queue list if it has events.
+ * Triggers the event queue list's signal if appropriate.
+ * The event count is checked again under the parent's lock, since the consumer may have emptied the queue. */
+RTR_C_INLINE RsslRet _rsslReactorEventQueueSetActive(RsslReactorEventQueue *pQueue)
+{
+	RsslUInt32 count;
+
+	RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
+
+	if (pQueue->isInActiveEventQueueGroup || _rsslReactorEventAtomicRead(&pQueue->eventCount) <= 0)
+		return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
+
+	/* Add to parent list of active queues */
+	rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
+	pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
+
+	count = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
+	if (count == 1)
+	{
+		/* List was previously empty; Need to trigger queue list descriptor */
+		int ret;
+
+		ret = rsslSetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
+
+		if (ret < 0)
+			return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_FAILURE);
+
+		if (pQueue->pParentGroup->pAggregateSignal && rsslSetReactorEventAggregateSignal(pQueue->pParentGroup->pAggregateSignal) < 0)
+			return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_FAILURE);
+	}
+
+	RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+
+	return RSSL_RET_SUCCESS;
+}
 
-/* Removes the event queue from its parent's event queue list if appropriate.
- * Resets the event queue list's signal if appropriate. */
-/* Ownership of pQueue->eventQueueLock is assumed */
+/* Removes the event queue from its parent's event queue list if it has no events.
+ * Resets the event queue list's signal if appropriate.
+ * The event count is checked again under the parent's lock, since a producer may have added an event. */
 RTR_C_INLINE RsslRet rsslReactorEventQueueSetInactive(RsslReactorEventQueue *pQueue)
 {
 	RsslUInt32 count;
 
 	RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
 
-	if (!pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
+	if (!pQueue->isInActiveEventQueueGroup || _rsslReactorEventAtomicRead(&pQueue->eventCount) > 0)
+		return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
 
-	/* Add to parent list of active queues */
+	/* Remove from parent list of active queues */
 	rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
 	pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
 
@@ -133,211 +548,137 @@ RTR_C_INLINE RsslRet rsslCleanupReactorEventQueueGroup(RsslReactorEventQueueGrou
 
 /* rsslInitReactorEventQueue 
  * Initializes an RsslReactorEventQueue.
+ * ringSize must be a power of 2.  Events are taken from and returned to pEventPool.
  */
-RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, int poolSize, RsslReactorEventQueueGroup *pParentGroup)
+RTR_C_INLINE RsslRet rsslInitReactorEventQueue(RsslReactorEventQueue *pQueue, RsslUInt32 ringSize, RsslReactorEventQueueGroup *pParentGroup,
+		RsslReactorEventPool *pEventPool)
 {
-	int i;
-
-	if (!pParentGroup) return RSSL_RET_INVALID_ARGUMENT;
+	if (!pParentGroup || !pEventPool) return RSSL_RET_INVALID_ARGUMENT;
 
 	memset(pQueue, 0, sizeof(RsslReactorEventQueue));
 
-	RSSL_MUTEX_INIT(&pQueue->eventPoolLock);
-	RSSL_MUTEX_INIT(&pQueue->eventQueueLock);
+	if (_rsslReactorEventRingInit(&pQueue->eventRing, ringSize) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
 
-	rsslInitQueue(&pQueue->eventPool);
-	rsslInitQueue(&pQueue->eventQueue);
+	RSSL_MUTEX_INIT(&pQueue->overflowLock);
+	rsslInitQueue(&pQueue->overflowQueue);
 
+	pQueue->pEventPool = pEventPool;
 	pQueue->pParentGroup = pParentGroup;
 
-	for (i = 0; i < poolSize; ++i)
-	{
-		RsslReactorEventImpl *pNewEvent = (RsslReactorEventImpl*)malloc(sizeof(RsslReactorEventImpl));
-		if (pNewEvent)
-		{
-			rsslClearReactorEventImpl(pNewEvent);
-			rsslInitQueueLink(&pNewEvent->base.eventQueueLink);
-			rsslQueueAddLinkToBack(&pQueue->eventPool, &pNewEvent->base.eventQueueLink);
-		}
-	}
-
 	return RSSL_RET_SUCCESS;
 }
 
 /* rsslCleanupReactorEventQueue
- * Cleans up an RsslReactorEventQueue */
+ * Cleans up an RsslReactorEventQueue, returning any events left in it to the pool. */
 RTR_C_INLINE RsslRet rsslCleanupReactorEventQueue(RsslReactorEventQueue *pQueue)
 {
 	RsslQueueLink *pLink;
 	RsslReactorEventImpl *pEvent;
 
-	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue)))
-	{
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-		free(pEvent);
-	}
+	if (!pQueue->pEventPool)
+		return RSSL_RET_SUCCESS;
+
+	while ((pEvent = _rsslReactorEventRingGetSingle(&pQueue->eventRing)))
+		rsslReactorEventPoolPut(pQueue->pEventPool, pEvent);
 
-	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
+	while ((pLink = rsslQueueRemoveFirstLink(&pQueue->overflowQueue)))
 	{
 		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-		free(pEvent);
+		rsslReactorEventPoolPut(pQueue->pEventPool, pEvent);
 	}
 
 	if (pQueue->pLastEvent)
 	{
-		free(pQueue->pLastEvent);
+		rsslReactorEventPoolPut(pQueue->pEventPool, pQueue->pLastEvent);
 		pQueue->pLastEvent = 0;
 	}
 
-	RSSL_MUTEX_DESTROY(&pQueue->eventPoolLock);
-	RSSL_MUTEX_DESTROY(&pQueue->eventQueueLock);
+	_rsslReactorEventRingCleanup(&pQueue->eventRing);
+	RSSL_MUTEX_DESTROY(&pQueue->overflowLock);
+	pQueue->pEventPool = NULL;
 
 	return RSSL_RET_SUCCESS;
 }
 
 RTR_C_INLINE RsslReactorEventImpl *rsslReactorEventQueueGetFromPool(RsslReactorEventQueue *pQueue)
 {
-	RsslReactorEventImpl *pEvent;
-	RsslQueueLink *pLink;
-
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-	if ( (pLink = rsslQueueRemoveFirstLink(&pQueue->eventPool)))
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-	else
-	{
-		pEvent = (RsslReactorEventImpl*)malloc(sizeof(RsslReactorEventImpl));
-		if (pEvent)
-		{
-			rsslClearReactorEventImpl(pEvent);
-			rsslInitQueueLink(&pEvent->base.eventQueueLink);
-		}
-	}
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
-
-	return pEvent;
+	return rsslReactorEventPoolGet(pQueue->pEventPool);
 }
 
 
 /* This should not be run if the event has alredy been placed into an event queue. */
 RTR_C_INLINE void rsslReactorEventQueueReturnToPool(RsslReactorEventImpl *pEvent, RsslReactorEventQueue *pQueue)
 {
-	RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-	rsslQueueAddLinkToBack(&pQueue->eventPool, &pEvent->base.eventQueueLink);
-	RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
+	rsslReactorEventPoolPut(pQueue->pEventPool, pEvent);
 }
 
 RTR_C_INLINE RsslRet rsslReactorEventQueuePut(RsslReactorEventQueue *pQueue, RsslReactorEventImpl *pEvent)
 {
-	RsslUInt32 count;
-
-	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
+	RsslRet ret = RSSL_RET_SUCCESS;
 
-	rsslQueueAddLinkToBack(&pQueue->eventQueue, &pEvent->base.eventQueueLink);
-
-	count = rsslQueueGetElementCount(&pQueue->eventQueue);
-	if (count == 1)
+	/* Count the event before publishing it, so the count never drops below the number of events the consumer can see. */
+	if (_rsslReactorEventAtomicAdd(&pQueue->eventCount, 1) == 1)
 	{
 		/* May need to trigger parent EventQueueGroup */
-		RsslUInt32 count;
-
-		RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
-
-		if (pQueue->isInActiveEventQueueGroup) return (RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock), RSSL_RET_SUCCESS);
-
-		/* Add to parent list of active queues */
-		rsslQueueAddLinkToBack(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-		pQueue->isInActiveEventQueueGroup = RSSL_TRUE;
-
-		count = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-		if (count == 1)
-		{
-			/* List was previously empty; Need to trigger queue list descriptor */
-			int ret;
-
-			ret = rsslSetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
-
-			if (ret < 0)
-			{
-				RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-				RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-				return RSSL_RET_FAILURE;
-			}
-
-		}
-
-		RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+		ret = _rsslReactorEventQueueSetActive(pQueue);
 	}
 
-	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	if (_rsslReactorEventAtomicRead(&pQueue->overflowCount) != 0 || !_rsslReactorEventRingPut(&pQueue->eventRing, pEvent))
+	{
+		RSSL_MUTEX_LOCK(&pQueue->overflowLock);
+		rsslQueueAddLinkToBack(&pQueue->overflowQueue, &pEvent->base.eventQueueLink);
+		RTR_ATOMIC_INCREMENT(pQueue->overflowCount);
+		RSSL_MUTEX_UNLOCK(&pQueue->overflowLock);
+	}
 
-	return RSSL_RET_SUCCESS;
+	return ret;
 }
 
 RTR_C_INLINE RsslReactorEventImpl* rsslReactorEventQueueGet(RsslReactorEventQueue *pQueue, RsslRet *pRet)
 {
-	RsslRet count;
+	rtr_atomic_val count;
 	RsslReactorEventImpl *pEvent;
-	RsslQueueLink *pLink;
 
 	if (pQueue->pLastEvent)
 	{
 		/* Return previous event to pool */
-
-		RSSL_MUTEX_LOCK(&pQueue->eventPoolLock);
-		rsslQueueAddLinkToBack(&pQueue->eventPool, &pQueue->pLastEvent->base.eventQueueLink);
-		RSSL_MUTEX_UNLOCK(&pQueue->eventPoolLock);
-
+		rsslReactorEventPoolPut(pQueue->pEventPool, pQueue->pLastEvent);
 		pQueue->pLastEvent = 0;
 	}
 
-	RSSL_MUTEX_LOCK(&pQueue->eventQueueLock);
-
-	count = rsslQueueGetElementCount(&pQueue->eventQueue);
+	pEvent = _rsslReactorEventRingGetSingle(&pQueue->eventRing);
 
-	if(count)
+	/* An unpublished head cell may be followed by published events that were put before the ones in
+	 * overflowQueue, so overflowQueue is only drained when no ring position is still claimed. */
+	if (!pEvent && _rsslReactorEventAtomicRead(&pQueue->overflowCount) != 0 && _rsslReactorEventRingIsEmpty(&pQueue->eventRing))
 	{
-		pLink = rsslQueueRemoveFirstLink(&pQueue->eventQueue);
-		pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
-		if (count == 1)
+		RsslQueueLink *pLink;
+
+		RSSL_MUTEX_LOCK(&pQueue->overflowLock);
+		if ((pLink = rsslQueueRemoveFirstLink(&pQueue->overflowQueue)))
 		{
-			/* May need to reset parent EventQueueGroup. */
-
-			RSSL_MUTEX_LOCK(&pQueue->pParentGroup->lock);
-
-			if (pQueue->isInActiveEventQueueGroup) 
-			{
-				RsslUInt32 parentQueueCount;
-
-				/* Remove from parent list of active queues */
-				rsslQueueRemoveLink(&pQueue->pParentGroup->readyEventQueueGroup, &pQueue->readyEventQueueLink);
-				pQueue->isInActiveEventQueueGroup = RSSL_FALSE;
-
-				parentQueueCount = rsslQueueGetElementCount(&pQueue->pParentGroup->readyEventQueueGroup);
-				if (parentQueueCount == 0)
-				{
-					/* List is now empty; need to reset queue list descriptor */
-					int ret;
-					ret = rsslResetEventSignal(&pQueue->pParentGroup->eventSignal); /* Read pointer of event */
-
-					if (ret < 0)
-					{
-						RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
-						RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
-						*pRet = RSSL_RET_FAILURE;
-						return NULL;
-					}
-				}
-			}
-
-			RSSL_MUTEX_UNLOCK(&pQueue->pParentGroup->lock);
+			pEvent = RSSL_QUEUE_LINK_TO_OBJECT(RsslReactorEventImpl, base.eventQueueLink, pLink);
+			RTR_ATOMIC_DECREMENT(pQueue->overflowCount);
 		}
-		--count;
+		RSSL_MUTEX_UNLOCK(&pQueue->overflowLock);
 	}
-	else
-		pEvent = NULL;
 
-	RSSL_MUTEX_UNLOCK(&pQueue->eventQueueLock);
+	if (pEvent)
+		count = _rsslReactorEventAtomicAdd(&pQueue->eventCount, -1);
+	else
+		count = _rsslReactorEventAtomicRead(&pQueue->eventCount); /* Non-zero if an event is counted but not yet published; the queue stays active. */
 
+	if (count == 0)
+	{
+		/* May need to reset parent EventQueueGroup. */
+		if (rsslReactorEventQueueSetInactive(pQueue) != RSSL_RET_SUCCESS)
+		{
+			pQueue->pLastEvent = pEvent;
+			*pRet = RSSL_RET_FAILURE;
+			return NULL;
+		}
+	}
 
 	pQueue->pLastEvent = pEvent;
 	*pRet = count;
@@ -128,6 +128,7 @@ typedef struct
 	RsslInt64 lastRequestedExpireTime;
 	RsslInt64 nextExpireTime;
 	RsslNotifierEvent *pWorkerNotifierEvent;
+	RsslSocket workerNotifierFd;	/* Descriptor associated with pWorkerNotifierEvent. Checked before flushing, since epoll does not report descriptors that were closed by an FD change. */
 
 	/* Reconnection logic */
 	RsslInt32 reconnectMinDelay;
@@ -473,10 +474,12 @@ struct _RsslReactorImpl
 
 	RsslThreadId thread;
 
+	RsslReactorEventPool eventPool;		/* Events for all of the reactor's event queues */
 	RsslReactorEventQueue reactorEventQueue;
 
 	RsslNotifier *pNotifier; /* Notifier for reactorEventQueue and channels */
 	RsslNotifierEvent *pQueueNotifierEvent; /* Notification for reactorEventQueue */
+	RsslNotifierType notifierType; /* Notification mechanism used by the reactor and worker notifiers. */
 
 	RsslBuffer memoryBuffer;
 
@@ -517,6 +520,14 @@ struct _RsslReactorImpl
 	RsslReactorTokenSessionImpl	*pTokenSessionForCredentialRenewalCallback; /* This is set before calling the callback to get user's credential */
 	RsslBool			rsslWorkerStarted;
 	RsslUInt32			restRequestTimeout; /* Keeps the request timeout */
+
+	/* Sharded reactors. The reactor returned to the application by rsslCreateReactor only routes calls to its shards,
+	 * each of which is a complete reactor with its own worker. */
+	RsslUInt32			shardCount; /* Number of shards, or 0 if this reactor is not sharded */
+	RsslReactorImpl		**pShards;
+	RsslReactorImpl		*pShardParent; /* Set on a shard to the reactor it belongs to */
+	RsslReactorEventAggregateSignal	shardEventSignal; /* Set by every shard's event queue group; its descriptor is the sharded reactor's eventFd */
+	RsslUInt32			nextDispatchShard; /* Shard the next rsslReactorDispatch starts from, so a spent maxMessages does not starve the others */
 };
 
 RTR_C_INLINE void rsslClearReactorImpl(RsslReactorImpl *pReactorImpl)
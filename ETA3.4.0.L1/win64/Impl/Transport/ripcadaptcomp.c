@@ -0,0 +1,186 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/ripcadaptcomp.h"
+#include "rtr/rsslAlloc.h"
+
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+/* Size range i covers [32 << i, 64 << i); the first range also covers everything
+ * smaller and the last everything larger */
+static RsslInt32 ripcAdaptCompBucketIndex(RsslUInt32 length)
+{
+	RsslInt32 idx = 0;
+
+	length >>= 6;
+	while (length && (idx < RSSL_COMP_ADAPTIVE_BUCKETS - 1))
+	{
+		idx++;
+		length >>= 1;
+	}
+	return idx;
+}
+
+static void ripcAdaptCompDecide(ripcAdaptComp *adaptComp, ripcAdaptCompBucket *bucket)
+{
+	RsslUInt64 saved;
+
+	/* keep compressing until there is enough to go on */
+	if (bucket->samples < RIPC_ADAPT_COMP_WINDOW)
+	{
+		bucket->skip = 0;
+		return;
+	}
+
+	saved = (bucket->bytesIn > bucket->bytesOut) ? bucket->bytesIn - bucket->bytesOut : 0;
+
+	if ((saved * 100) < (bucket->bytesIn * RIPC_ADAPT_COMP_MIN_SAVING))
+		bucket->skip = 1;
+	else if (!adaptComp->congested && (bucket->compressNs > saved * RIPC_ADAPT_COMP_WIRE_NS_PER_BYTE))
+		/* the link keeps up without it, so only compress when that is cheaper than sending the bytes */
+		bucket->skip = 1;
+	else
+		bucket->skip = 0;
+}
+
+ripcAdaptComp *ripcAdaptCompNew(RsslInt32 level)
+{
+	ripcAdaptComp *adaptComp = (ripcAdaptComp*)_rsslMalloc(sizeof(ripcAdaptComp));
+
+	if (adaptComp == 0)
+		return 0;
+
+	memset(adaptComp, 0, sizeof(ripcAdaptComp));
+	adaptComp->level = level;
+	if (level > 0)
+	{
+		adaptComp->minLevel = 1;
+		adaptComp->maxLevel = (level > RIPC_ADAPT_COMP_MAX_LEVEL) ? level : RIPC_ADAPT_COMP_MAX_LEVEL;
+	}
+	return adaptComp;
+}
+
+void ripcAdaptCompFree(ripcAdaptComp *adaptComp)
+{
+	_rsslFree(adaptComp);
+}
+
+RsslUInt64 ripcAdaptCompTime()
+{
+#ifdef _WIN32
+	static LARGE_INTEGER	frequency = { 0 };
+	LARGE_INTEGER			now;
+
+	if (frequency.QuadPart == 0)
+		QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&now);
+	return (RsslUInt64)((double)now.QuadPart * 1000000000.0 / (double)frequency.QuadPart);
+#else
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (RsslUInt64)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+RsslInt32 ripcAdaptCompCheck(ripcAdaptComp *adaptComp, RsslUInt32 length)
+{
+	ripcAdaptCompBucket *bucket = &adaptComp->buckets[ripcAdaptCompBucketIndex(length)];
+
+	bucket->messages++;
+	if (!bucket->skip)
+		return 1;
+
+	if (++bucket->skipCount >= RIPC_ADAPT_COMP_PROBE)
+	{
+		bucket->skipCount = 0;
+		return 1;
+	}
+	return 0;
+}
+
+void ripcAdaptCompRecord(ripcAdaptComp *adaptComp, RsslUInt32 length, RsslUInt32 compLen, RsslUInt64 compressNs)
+{
+	ripcAdaptCompBucket *bucket = &adaptComp->buckets[ripcAdaptCompBucketIndex(length)];
+
+	bucket->compressed++;
+	bucket->bytesIn += length;
+	bucket->bytesOut += compLen;
+	bucket->compressNs += compressNs;
+
+	if (++bucket->samples >= 2 * RIPC_ADAPT_COMP_WINDOW)
+	{
+		bucket->bytesIn >>= 1;
+		bucket->bytesOut >>= 1;
+		bucket->compressNs >>= 1;
+		bucket->samples = RIPC_ADAPT_COMP_WINDOW;
+	}
+
+	ripcAdaptCompDecide(adaptComp, bucket);
+}
+
+RsslInt32 ripcAdaptCompFlushed(ripcAdaptComp *adaptComp, RsslInt32 queuedBytes)
+{
+	RsslUInt8 idle;
+
+	if (queuedBytes > 0)
+	{
+		adaptComp->pressureFlushes++;
+		adaptComp->backPressureEvents++;
+	}
+
+	if (++adaptComp->flushes < RIPC_ADAPT_COMP_FLUSH_INTERVAL)
+		return 0;
+
+	/* an occasional partial write is normal; call it congestion when at least 1 flush in 8 leaves data behind */
+	adaptComp->congested = ((adaptComp->pressureFlushes * 8) >= adaptComp->flushes);
+	idle = (adaptComp->pressureFlushes == 0);
+	adaptComp->flushes = 0;
+	adaptComp->pressureFlushes = 0;
+
+	if (adaptComp->congested && (adaptComp->level < adaptComp->maxLevel))
+		return ++adaptComp->level;
+
+	if (idle && (adaptComp->level > adaptComp->minLevel))
+		return --adaptComp->level;
+
+	return 0;
+}
+
+void ripcAdaptCompFixLevel(ripcAdaptComp *adaptComp, RsslInt32 level)
+{
+	adaptComp->level = adaptComp->minLevel = adaptComp->maxLevel = level;
+}
+
+void ripcAdaptCompGetInfo(ripcAdaptComp *adaptComp, RsslAdaptiveCompInfo *info)
+{
+	RsslInt32 i;
+
+	info->enabled = RSSL_TRUE;
+	info->compressionLevel = (RsslUInt32)adaptComp->level;
+	info->backPressureEvents = adaptComp->backPressureEvents;
+
+	for (i = 0; i < RSSL_COMP_ADAPTIVE_BUCKETS; i++)
+	{
+		ripcAdaptCompBucket *bucket = &adaptComp->buckets[i];
+		RsslCompBucketInfo *bucketInfo = &info->buckets[i];
+
+		bucketInfo->minLength = (i == 0) ? 0 : (32 << i);
+		bucketInfo->messages = bucket->messages;
+		bucketInfo->compressed = bucket->compressed;
+		bucketInfo->ratio = bucket->bytesIn ? (RsslUInt32)((bucket->bytesOut * 100) / bucket->bytesIn) : 0;
+		bucketInfo->compressTime = bucket->samples ? (RsslUInt32)(bucket->compressNs / bucket->samples) : 0;
+		bucketInfo->skipped = bucket->skip ? RSSL_TRUE : RSSL_FALSE;
+	}
+}
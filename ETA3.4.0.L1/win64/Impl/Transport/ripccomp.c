@@ -22,7 +22,7 @@ static RsslInt32 compressionDebug = 0;
 //
 // zlib routines start here
 //
-static void *zlibCompInit(RsslInt32 compressionLevel, RsslError *error)
+static void *zlibCompInit(RsslInt32 compressionLevel, void *compDict, RsslError *error)
 {
 	RsslInt32 err;
 	z_stream *zs=(z_stream*)_rsslMalloc(sizeof(z_stream));
@@ -61,7 +61,7 @@ static void *zlibCompInit(RsslInt32 compressionLevel, RsslError *error)
 	return zs;
 }
 
-static void *zlibDecompInit(RsslError *error)
+static void *zlibDecompInit(void *compDict, RsslError *error)
 {
 	RsslInt32 err;
 	z_stream *zs = (z_stream*)_rsslMalloc(sizeof(z_stream));
@@ -136,6 +136,32 @@ static RsslRet zlibcompress(void *zstream, ripcCompBuffer *buf, RsslError *error
     return 1;
 }
 
+/* Called between messages; every message ends with a sync flush, so deflate has
+ * nothing pending and changing the parameters does not put anything on the wire */
+static RsslRet zlibSetLevel(void *zstream, RsslInt32 compressionLevel, RsslError *error)
+{
+	RsslInt32 err;
+	z_stream *zs=(z_stream*)zstream;
+	Byte scratch[16];
+	uLong totalOut = zs->total_out;
+
+	zs->avail_in = 0;
+	zs->next_out = scratch;
+	zs->avail_out = sizeof(scratch);
+
+	err = deflateParams(zs, compressionLevel, Z_DEFAULT_STRATEGY);
+	if (((err != Z_OK) && (err != Z_BUF_ERROR)) || (zs->total_out != totalOut))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 deflateParams() failed.  Zlib error: %d\n",
+				__FILE__,__LINE__,err);
+		return -1;
+	}
+
+	if (rtrUnlikely(compressionDebug)) printf("zlib changed compression level to %d\n", compressionLevel);
+	return 1;
+}
+
 static RsslRet zlibdecompress(void *zstream, ripcCompBuffer *buf, RsslError *error)
 {
 	RsslInt32 err;
@@ -176,6 +202,8 @@ RsslInt32 ripcInitZlibComp()
 	funcs.decompressEnd = zlibDecompEnd;
 	funcs.compress = zlibcompress;
 	funcs.decompress = zlibdecompress;
+	funcs.compressBound = 0;	/* zlib streams across buffers */
+	funcs.setLevel = zlibSetLevel;
 
 	return(ipcSetCompFunc(RSSL_COMP_ZLIB,&funcs));
 }
@@ -184,12 +212,12 @@ RsslInt32 ripcInitZlibComp()
 //	LZ4 compression routines start here
 //
 static char lz4PlaceHolder;
-static void *lz4CompInit(RsslInt32 compressionLevel, RsslError *error)
+static void *lz4CompInit(RsslInt32 compressionLevel, void *compDict, RsslError *error)
 {
 	return(&lz4PlaceHolder);	// returning NULL is considered a failure, so return a valid address as a fake zstream
 }
 
-static void *lz4DecompInit(RsslError *error)
+static void *lz4DecompInit(void *compDict, RsslError *error)
 {
 	return(&lz4PlaceHolder);	// returning NULL is considered a failure, so return a valid address as a fake zstream
 }
@@ -267,8 +295,449 @@ int ripcInitLz4Comp()
 	funcs.decompressEnd = lz4DecompEnd;
 	funcs.compress = lz4Comp;
 	funcs.decompress = lz4Decomp;
+	funcs.compressBound = LZ4_compressBound;
+	funcs.setLevel = 0;		/* LZ4 has no levels */
 
 	return(ipcSetCompFunc(RSSL_COMP_LZ4,&funcs));
 }
 
 #endif
+
+//
+//	zstd compression routines start here
+//
+//	Like LZ4, every message is compressed on its own so nothing carries over between
+//	messages.  The small, repetitive messages seen on most channels compress well when
+//	both sides load the same dictionary trained offline on captured traffic; the
+//	dictionary ID is offered by the client in its connection request and the server
+//	only agrees to zstd when it loaded the same one.  Loaded dictionaries are kept for
+//	the life of the transport so channels can share them.
+//
+#ifdef _RIPC_ZSTD
+
+#include <string.h>
+#include <errno.h>
+#include "zstd.h"
+#include "rtr/rsslThread.h"
+
+#define RIPC_ZSTD_MAX_LEVEL	19
+
+typedef struct ripcZstdDict
+{
+	struct ripcZstdDict	*next;
+	char				*fileName;
+	RsslUInt32			dictId;
+	char				*dictBuffer;
+	size_t				dictSize;
+	ZSTD_DDict			*ddict;
+	ZSTD_CDict			*cdicts[RIPC_ZSTD_MAX_LEVEL + 1];	/* created the first time a level is used */
+} ripcZstdDict;
+
+typedef struct
+{
+	ZSTD_CCtx			*cctx;
+	ZSTD_DCtx			*dctx;
+	ripcZstdDict		*dict;
+} ripcZstdStream;
+
+static ripcZstdDict		*zstdDicts = 0;
+static RsslMutex		zstdDictMutex;
+static RsslUInt8		zstdDictMutexInit = 0;
+
+static ripcZstdStream *zstdNewStream(RsslError *error)
+{
+	ripcZstdStream *zs = (ripcZstdStream*)_rsslMalloc(sizeof(ripcZstdStream));
+
+	if (zs == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1001 Could not allocate memory for zstd stream.\n",
+			__FILE__, __LINE__);
+		return 0;
+	}
+	zs->cctx = 0;
+	zs->dctx = 0;
+	zs->dict = 0;
+	return zs;
+}
+
+/* Applies compressionLevel to the compression context.  Every message is a frame
+ * of its own, so this may be called between any two messages */
+static RsslRet zstdSetLevel(void *zstream, RsslInt32 compressionLevel, RsslError *error)
+{
+	ripcZstdStream *zs = (ripcZstdStream*)zstream;
+	ripcZstdDict *dict = zs->dict;
+	size_t err;
+
+	if (compressionLevel < 0 || compressionLevel > RIPC_ZSTD_MAX_LEVEL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 Invalid zstd compression level %d.  Level must be between 0 and %d.\n",
+			__FILE__, __LINE__, compressionLevel, RIPC_ZSTD_MAX_LEVEL);
+		return -1;
+	}
+
+	if (dict)
+	{
+		/* the level is part of the prepared dictionary */
+		RSSL_MUTEX_LOCK(&zstdDictMutex);
+		if (dict->cdicts[compressionLevel] == 0)
+			dict->cdicts[compressionLevel] = ZSTD_createCDict(dict->dictBuffer, dict->dictSize, compressionLevel);
+		RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+
+		if (dict->cdicts[compressionLevel] == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1001 ZSTD_createCDict() failed.\n",
+				__FILE__, __LINE__);
+			return -1;
+		}
+		err = ZSTD_CCtx_refCDict(zs->cctx, dict->cdicts[compressionLevel]);
+	}
+	else
+		err = ZSTD_CCtx_setParameter(zs->cctx, ZSTD_c_compressionLevel, compressionLevel);
+
+	if (ZSTD_isError(err))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1002 Could not set zstd compression level. zstd error: %s\n",
+			__FILE__, __LINE__, ZSTD_getErrorName(err));
+		return -1;
+	}
+
+	if (rtrUnlikely(compressionDebug)) printf("zstd using compression level=%d dictId=%u\n", compressionLevel, dict ? dict->dictId : 0);
+	return 1;
+}
+
+static void *zstdCompInit(RsslInt32 compressionLevel, void *compDict, RsslError *error)
+{
+	ripcZstdStream *zs;
+	size_t err;
+
+	if ((zs = zstdNewStream(error)) == 0)
+		return 0;
+	zs->dict = (ripcZstdDict*)compDict;
+
+	if ((zs->cctx = ZSTD_createCCtx()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1001 ZSTD_createCCtx() failed.\n",
+			__FILE__, __LINE__);
+		_rsslFree(zs);
+		return 0;
+	}
+
+	/* both sides agreed on the dictionary during the handshake and the receiver sizes
+	 * its buffer from maxMsgSize, so leave the dictionary ID and content size out of the frame */
+	err = ZSTD_CCtx_setParameter(zs->cctx, ZSTD_c_contentSizeFlag, 0);
+	if (!ZSTD_isError(err))
+		err = ZSTD_CCtx_setParameter(zs->cctx, ZSTD_c_dictIDFlag, 0);
+
+	if (ZSTD_isError(err))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1002 Could not initialize zstd compression. zstd error: %s\n",
+			__FILE__, __LINE__, ZSTD_getErrorName(err));
+		ZSTD_freeCCtx(zs->cctx);
+		_rsslFree(zs);
+		return 0;
+	}
+
+	if (zstdSetLevel(zs, compressionLevel, error) < 0)
+	{
+		ZSTD_freeCCtx(zs->cctx);
+		_rsslFree(zs);
+		return 0;
+	}
+
+	return zs;
+}
+
+static void *zstdDecompInit(void *compDict, RsslError *error)
+{
+	ripcZstdDict *dict = (ripcZstdDict*)compDict;
+	ripcZstdStream *zs;
+	size_t err = 0;
+
+	if ((zs = zstdNewStream(error)) == 0)
+		return 0;
+
+	if ((zs->dctx = ZSTD_createDCtx()) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1001 ZSTD_createDCtx() failed.\n",
+			__FILE__, __LINE__);
+		_rsslFree(zs);
+		return 0;
+	}
+
+	if (dict)
+		err = ZSTD_DCtx_refDDict(zs->dctx, dict->ddict);
+
+	if (ZSTD_isError(err))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1002 Could not initialize zstd decompression. zstd error: %s\n",
+			__FILE__, __LINE__, ZSTD_getErrorName(err));
+		ZSTD_freeDCtx(zs->dctx);
+		_rsslFree(zs);
+		return 0;
+	}
+	return zs;
+}
+
+static void zstdCompEnd(void *zstream)
+{
+	ripcZstdStream *zs = (ripcZstdStream*)zstream;
+	if (zs)
+	{
+		ZSTD_freeCCtx(zs->cctx);
+		_rsslFree(zs);
+	}
+}
+
+static void zstdDecompEnd(void *zstream)
+{
+	ripcZstdStream *zs = (ripcZstdStream*)zstream;
+	if (zs)
+	{
+		ZSTD_freeDCtx(zs->dctx);
+		_rsslFree(zs);
+	}
+}
+
+static RsslRet zstdComp(void *zstream, ripcCompBuffer *buf, RsslError *error)
+{
+	ripcZstdStream *zs = (ripcZstdStream*)zstream;
+	size_t ret;
+
+	ret = ZSTD_compress2(zs->cctx, buf->next_out, buf->avail_out, buf->next_in, buf->avail_in);
+	if (ZSTD_isError(ret))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_compress2 failed. zstd error: %s\n", __FILE__, __LINE__, ZSTD_getErrorName(ret));
+		return -1;
+	}
+
+	if (rtrUnlikely(compressionDebug)) printf("zstd Compressed %u inbytes to %d outbytes\n", buf->avail_in, (int)ret);
+
+	buf->bytes_in_used = buf->avail_in;
+	buf->bytes_out_used = (int)ret;
+
+	buf->next_in = buf->next_in + buf->bytes_in_used;
+	buf->avail_in = 0;
+	buf->next_out = buf->next_out + buf->bytes_out_used;
+	buf->avail_out = buf->avail_out - buf->bytes_out_used;
+
+	return 1;
+}
+
+static RsslRet zstdDecomp(void *zstream, ripcCompBuffer *buf, RsslError *error)
+{
+	ripcZstdStream *zs = (ripcZstdStream*)zstream;
+	size_t ret;
+
+	ret = ZSTD_decompressDCtx(zs->dctx, buf->next_out, buf->avail_out, buf->next_in, buf->avail_in);
+	if (ZSTD_isError(ret))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> Error: 1002 ZSTD_decompressDCtx failed. zstd error: %s\n", __FILE__, __LINE__, ZSTD_getErrorName(ret));
+		return -1;
+	}
+
+	if (rtrUnlikely(compressionDebug)) printf("zstd Decompressed %u inbytes to %d outbytes\n", buf->avail_in, (int)ret);
+
+	buf->bytes_in_used = buf->avail_in;
+	buf->bytes_out_used = (int)ret;
+
+	buf->avail_in = 0;
+	buf->next_in = buf->next_in + buf->bytes_in_used;
+	buf->next_out = buf->next_out + buf->bytes_out_used;
+	buf->avail_out = buf->avail_out - buf->bytes_out_used;
+
+	return 1;
+}
+
+static int zstdCompBound(int length)
+{
+	return (int)ZSTD_compressBound((size_t)length);
+}
+
+static void zstdFreeDict(ripcZstdDict *dict)
+{
+	RsslInt32 i;
+
+	for (i = 0; i <= RIPC_ZSTD_MAX_LEVEL; i++)
+		ZSTD_freeCDict(dict->cdicts[i]);
+	ZSTD_freeDDict(dict->ddict);
+	_rsslFree(dict->dictBuffer);
+	_rsslFree(dict->fileName);
+	_rsslFree(dict);
+}
+
+RsslInt32 ripcInitZstdComp()
+{
+	ripcCompFuncs funcs;
+
+	if (!zstdDictMutexInit)
+	{
+		(void) RSSL_MUTEX_INIT(&zstdDictMutex);
+		zstdDictMutexInit = 1;
+	}
+
+	funcs.compressInit = zstdCompInit;
+	funcs.decompressInit = zstdDecompInit;
+	funcs.compressEnd = zstdCompEnd;
+	funcs.decompressEnd = zstdDecompEnd;
+	funcs.compress = zstdComp;
+	funcs.decompress = zstdDecomp;
+	funcs.compressBound = zstdCompBound;
+	funcs.setLevel = zstdSetLevel;
+
+	return(ipcSetCompFunc(RSSL_COMP_ZSTD,&funcs));
+}
+
+void ripcCompUninitialize()
+{
+	ripcZstdDict *dict;
+
+	if (!zstdDictMutexInit)
+		return;
+
+	while ((dict = zstdDicts) != 0)
+	{
+		zstdDicts = dict->next;
+		zstdFreeDict(dict);
+	}
+
+	(void) RSSL_MUTEX_DESTROY(&zstdDictMutex);
+	zstdDictMutexInit = 0;
+}
+
+void *ripcLoadCompDict(const char *fileName, RsslError *error)
+{
+	ripcZstdDict *dict;
+	FILE *fp;
+	long fileSize;
+
+	if (!zstdDictMutexInit)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 zstd compression is not initialized.\n",
+			__FILE__, __LINE__);
+		return 0;
+	}
+
+	RSSL_MUTEX_LOCK(&zstdDictMutex);
+
+	/* every channel naming the same file shares one copy */
+	for (dict = zstdDicts; dict != 0; dict = dict->next)
+	{
+		if (strcmp(dict->fileName, fileName) == 0)
+		{
+			RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+			return dict;
+		}
+	}
+
+	if ((dict = (ripcZstdDict*)_rsslMalloc(sizeof(ripcZstdDict))) == 0)
+	{
+		RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1001 Could not allocate memory for compression dictionary.\n",
+			__FILE__, __LINE__);
+		return 0;
+	}
+	memset(dict, 0, sizeof(ripcZstdDict));
+
+	if ((dict->fileName = (char*)_rsslMalloc(strlen(fileName) + 1)) != 0)
+		strcpy(dict->fileName, fileName);
+
+	fileSize = -1;
+	if ((fp = fopen(fileName, "rb")) != 0)
+	{
+		if (fseek(fp, 0, SEEK_END) == 0)
+			fileSize = ftell(fp);
+		if ((fileSize > 0) && (fseek(fp, 0, SEEK_SET) == 0) &&
+			((dict->dictBuffer = (char*)_rsslMalloc((size_t)fileSize)) != 0) &&
+			(fread(dict->dictBuffer, 1, (size_t)fileSize, fp) == (size_t)fileSize))
+			dict->dictSize = (size_t)fileSize;
+		fclose(fp);
+	}
+
+	if ((dict->fileName == 0) || (dict->dictSize == 0))
+	{
+		RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1002 Could not read compression dictionary <%s>. System errno: (%d)\n",
+			__FILE__, __LINE__, fileName, errno);
+		zstdFreeDict(dict);
+		return 0;
+	}
+
+	/* raw content dictionaries report an ID of 0; those can not be told apart during
+	 * the handshake, so require a dictionary trained by zstd */
+	dict->dictId = (RsslUInt32)ZSTD_getDictID_fromDict(dict->dictBuffer, dict->dictSize);
+	if ((dict->dictId == 0) || ((dict->ddict = ZSTD_createDDict(dict->dictBuffer, dict->dictSize)) == 0))
+	{
+		RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+			"<%s:%d> Error: 1004 <%s> is not a zstd dictionary.\n",
+			__FILE__, __LINE__, fileName);
+		zstdFreeDict(dict);
+		return 0;
+	}
+
+	dict->next = zstdDicts;
+	zstdDicts = dict;
+
+	RSSL_MUTEX_UNLOCK(&zstdDictMutex);
+
+	if (rtrUnlikely(compressionDebug)) printf("zstd loaded dictionary %s (dictId=%u, %lu bytes)\n", fileName, dict->dictId, (unsigned long)dict->dictSize);
+	return dict;
+}
+
+RsslUInt32 ripcCompDictId(void *compDict)
+{
+	return compDict ? ((ripcZstdDict*)compDict)->dictId : 0;
+}
+
+#else
+
+/* built without zstd; RSSL_COMP_ZSTD is never negotiated */
+RsslInt32 ripcInitZstdComp()
+{
+	return(1);
+}
+
+void ripcCompUninitialize()
+{
+}
+
+void *ripcLoadCompDict(const char *fileName, RsslError *error)
+{
+	_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+		"<%s:%d> Error: 1004 zstd compression is not supported by this build.\n",
+		__FILE__, __LINE__);
+	return 0;
+}
+
+RsslUInt32 ripcCompDictId(void *compDict)
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,449 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/ripcuring.h"
+#include "rtr/rsslErrors.h"
+#include "rtr/rsslThread.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef RIPC_HAS_IO_URING
+
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+
+/* the process wide ring */
+typedef struct
+{
+	int					fd;
+	unsigned			*sqHead;
+	unsigned			*sqTail;
+	unsigned			*sqMask;
+	unsigned			*sqArray;
+	unsigned			sqEntries;
+	struct io_uring_sqe	*sqes;
+	unsigned			*cqHead;
+	unsigned			*cqTail;
+	unsigned			*cqMask;
+	struct io_uring_cqe	*cqes;
+	void				*sqRing;
+	size_t				sqRingLen;
+	void				*cqRing;
+	size_t				cqRingLen;
+	size_t				sqesLen;
+	unsigned			toSubmit;		/* sqes filled in since the last submit */
+	unsigned			inFlight;		/* submitted, completion not yet reaped */
+} ripcUringRing;
+
+static ripcUringRing	uringRing;
+static RsslInt32		uringReady = 0;		/* 1 ring usable, -1 unavailable, 0 not tried yet */
+static RsslInt32		uringMutexInit = 0;
+static RsslMutex		uringMutex;
+
+static int ripcUringSetup(unsigned entries, struct io_uring_params *params)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ripcUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+static int ripcUringRegister(int fd, unsigned opcode, void *arg, unsigned nrArgs)
+{
+	return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs);
+}
+
+static void ripcUringDestroyRing()
+{
+	if (uringRing.sqes)
+		munmap(uringRing.sqes, uringRing.sqesLen);
+	if (uringRing.cqRing && uringRing.cqRing != uringRing.sqRing)
+		munmap(uringRing.cqRing, uringRing.cqRingLen);
+	if (uringRing.sqRing)
+		munmap(uringRing.sqRing, uringRing.sqRingLen);
+	if (uringRing.fd >= 0)
+		close(uringRing.fd);
+
+	memset(&uringRing, 0, sizeof(uringRing));
+	uringRing.fd = -1;
+}
+
+/* Sets up the ring and checks the kernel supports the operations we use.  Caller holds uringMutex */
+static RsslInt32 ripcUringCreateRing()
+{
+	struct io_uring_params params;
+	struct io_uring_probe *probe;
+	size_t probeLen = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+	RsslInt32 supported = 0;
+	char *sqRing;
+	char *cqRing;
+
+	memset(&uringRing, 0, sizeof(uringRing));
+	memset(&params, 0, sizeof(params));
+
+	if ((uringRing.fd = ripcUringSetup(RIPC_URING_ENTRIES, &params)) < 0)
+		return -1;
+
+	/* IORING_OP_RECV needs a 5.6 kernel; older kernels fail the probe and fall back */
+	if ((probe = (struct io_uring_probe*)calloc(1, probeLen)) != 0)
+	{
+		if (ripcUringRegister(uringRing.fd, IORING_REGISTER_PROBE, probe, 256) == 0 &&
+			probe->last_op >= IORING_OP_RECV &&
+			(probe->ops[IORING_OP_RECV].flags & IO_URING_OP_SUPPORTED) &&
+			(probe->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED))
+			supported = 1;
+		free(probe);
+	}
+
+	if (!supported)
+	{
+		ripcUringDestroyRing();
+		return -1;
+	}
+
+	uringRing.sqRingLen = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	uringRing.cqRingLen = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if ((params.features & IORING_FEAT_SINGLE_MMAP) && uringRing.cqRingLen > uringRing.sqRingLen)
+		uringRing.sqRingLen = uringRing.cqRingLen;
+
+	sqRing = (char*)mmap(0, uringRing.sqRingLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uringRing.fd, IORING_OFF_SQ_RING);
+	if (sqRing == MAP_FAILED)
+	{
+		ripcUringDestroyRing();
+		return -1;
+	}
+	uringRing.sqRing = sqRing;
+
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		cqRing = sqRing;
+		uringRing.cqRingLen = uringRing.sqRingLen;
+	}
+	else
+	{
+		cqRing = (char*)mmap(0, uringRing.cqRingLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uringRing.fd, IORING_OFF_CQ_RING);
+		if (cqRing == MAP_FAILED)
+		{
+			ripcUringDestroyRing();
+			return -1;
+		}
+	}
+	uringRing.cqRing = cqRing;
+
+	uringRing.sqesLen = params.sq_entries * sizeof(struct io_uring_sqe);
+	uringRing.sqes = (struct io_uring_sqe*)mmap(0, uringRing.sqesLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uringRing.fd, IORING_OFF_SQES);
+	if (uringRing.sqes == MAP_FAILED)
+	{
+		uringRing.sqes = 0;
+		ripcUringDestroyRing();
+		return -1;
+	}
+
+	uringRing.sqHead = (unsigned*)(sqRing + params.sq_off.head);
+	uringRing.sqTail = (unsigned*)(sqRing + params.sq_off.tail);
+	uringRing.sqMask = (unsigned*)(sqRing + params.sq_off.ring_mask);
+	uringRing.sqArray = (unsigned*)(sqRing + params.sq_off.array);
+	uringRing.sqEntries = params.sq_entries;
+	uringRing.cqHead = (unsigned*)(cqRing + params.cq_off.head);
+	uringRing.cqTail = (unsigned*)(cqRing + params.cq_off.tail);
+	uringRing.cqMask = (unsigned*)(cqRing + params.cq_off.ring_mask);
+	uringRing.cqes = (struct io_uring_cqe*)(cqRing + params.cq_off.cqes);
+
+	return 1;
+}
+
+/* Returns the next free sqe, or 0 if the ring is full.  Caller holds uringMutex */
+static struct io_uring_sqe *ripcUringGetSqe()
+{
+	unsigned tail = *uringRing.sqTail;
+	struct io_uring_sqe *sqe;
+
+	/* the completion queue is twice the size of the submission queue, so
+	 * bounding everything outstanding by sqEntries means it never overflows */
+	if (uringRing.toSubmit + uringRing.inFlight >= uringRing.sqEntries)
+		return 0;
+
+	sqe = &uringRing.sqes[tail & *uringRing.sqMask];
+	memset(sqe, 0, sizeof(*sqe));
+	return sqe;
+}
+
+/* Publishes the sqe returned by ripcUringGetSqe.  Caller holds uringMutex */
+static void ripcUringCommitSqe()
+{
+	unsigned tail = *uringRing.sqTail;
+
+	uringRing.sqArray[tail & *uringRing.sqMask] = tail & *uringRing.sqMask;
+	__atomic_store_n(uringRing.sqTail, tail + 1, __ATOMIC_RELEASE);
+	++uringRing.toSubmit;
+}
+
+/* Moves every posted completion into its operation.  Caller holds uringMutex */
+static RsslInt32 ripcUringReap()
+{
+	unsigned head = *uringRing.cqHead;
+	unsigned tail = __atomic_load_n(uringRing.cqTail, __ATOMIC_ACQUIRE);
+	RsslInt32 count = 0;
+
+	while (head != tail)
+	{
+		struct io_uring_cqe *cqe = &uringRing.cqes[head & *uringRing.cqMask];
+		ripcUringOp *op = (ripcUringOp*)(uintptr_t)cqe->user_data;
+
+		op->result = cqe->res;
+		__atomic_store_n(&op->state, RIPC_URING_OP_DONE, __ATOMIC_RELEASE);
+
+		++head;
+		--uringRing.inFlight;
+		++count;
+	}
+
+	__atomic_store_n(uringRing.cqHead, head, __ATOMIC_RELEASE);
+	return count;
+}
+
+void ripcUringInitialize()
+{
+	if (!uringMutexInit)
+	{
+		(void) RSSL_MUTEX_INIT(&uringMutex);
+		uringMutexInit = 1;
+	}
+	uringRing.fd = -1;
+}
+
+void ripcUringUninitialize()
+{
+	RsslError error;
+
+	if (!uringMutexInit)
+		return;
+
+	if (uringReady == 1)
+		(void) ripcUringSubmit(&error);
+
+	(void) RSSL_MUTEX_LOCK(&uringMutex);
+	if (uringReady == 1)
+		ripcUringDestroyRing();
+	uringReady = 0;
+	(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+
+	(void) RSSL_MUTEX_DESTROY(&uringMutex);
+	uringMutexInit = 0;
+}
+
+ripcUringChannel *ripcUringNewChannel()
+{
+	ripcUringChannel *uringChnl;
+
+	if (!uringMutexInit)
+		return 0;
+
+	(void) RSSL_MUTEX_LOCK(&uringMutex);
+	if (uringReady == 0)
+		uringReady = ripcUringCreateRing();
+	(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+
+	if (uringReady != 1)
+		return 0;
+
+	if ((uringChnl = (ripcUringChannel*)calloc(1, sizeof(ripcUringChannel))) == 0)
+		return 0;
+
+	return uringChnl;
+}
+
+void ripcUringFreeChannel(ripcUringChannel *uringChnl)
+{
+	RsslError error;
+
+	/* the kernel may still be writing into the input buffer or reading the
+	 * output vector; submit and wait so nothing refers to them after this */
+	if (__atomic_load_n(&uringChnl->readOp.state, __ATOMIC_ACQUIRE) == RIPC_URING_OP_PENDING ||
+		__atomic_load_n(&uringChnl->writeOp.state, __ATOMIC_ACQUIRE) == RIPC_URING_OP_PENDING)
+		(void) ripcUringSubmit(&error);
+
+	free(uringChnl);
+}
+
+RsslInt32 ripcUringQueueRecv(ripcUringChannel *uringChnl, RsslSocket fd, char *buf, RsslInt32 len)
+{
+	struct io_uring_sqe *sqe;
+
+	(void) RSSL_MUTEX_LOCK(&uringMutex);
+
+	if (uringChnl->readOp.state != RIPC_URING_OP_IDLE || (sqe = ripcUringGetSqe()) == 0)
+	{
+		(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+		return 0;
+	}
+
+	sqe->opcode = IORING_OP_RECV;
+	sqe->fd = fd;
+	sqe->addr = (__u64)(uintptr_t)buf;
+	sqe->len = (__u32)len;
+	sqe->msg_flags = MSG_DONTWAIT;
+	sqe->user_data = (__u64)(uintptr_t)&uringChnl->readOp;
+
+	uringChnl->readOp.state = RIPC_URING_OP_PENDING;
+	ripcUringCommitSqe();
+
+	(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+	return 1;
+}
+
+RsslInt32 ripcUringQueueSend(ripcUringChannel *uringChnl, RsslSocket fd)
+{
+	struct io_uring_sqe *sqe;
+
+	(void) RSSL_MUTEX_LOCK(&uringMutex);
+
+	if (uringChnl->writeOp.state != RIPC_URING_OP_IDLE || (sqe = ripcUringGetSqe()) == 0)
+	{
+		(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+		return 0;
+	}
+
+	memset(&uringChnl->msg, 0, sizeof(uringChnl->msg));
+	uringChnl->msg.msg_iov = uringChnl->wrtvec;
+	uringChnl->msg.msg_iovlen = uringChnl->wrtveclen;
+
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = fd;
+	sqe->addr = (__u64)(uintptr_t)&uringChnl->msg;
+	sqe->len = 1;
+	sqe->msg_flags = MSG_DONTWAIT | MSG_NOSIGNAL;
+	sqe->user_data = (__u64)(uintptr_t)&uringChnl->writeOp;
+
+	uringChnl->writeOp.state = RIPC_URING_OP_PENDING;
+	ripcUringCommitSqe();
+
+	(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+	return 1;
+}
+
+ripcUringOpState ripcUringTakeResult(ripcUringOp *op, RsslInt32 *result)
+{
+	ripcUringOpState state = (ripcUringOpState)__atomic_load_n(&op->state, __ATOMIC_ACQUIRE);
+
+	if (state == RIPC_URING_OP_DONE)
+	{
+		*result = op->result;
+		__atomic_store_n(&op->state, RIPC_URING_OP_IDLE, __ATOMIC_RELEASE);
+	}
+
+	return state;
+}
+
+RsslInt32 ripcUringSubmit(RsslError *error)
+{
+	RsslInt32 completions = 0;
+	int ret;
+
+	if (uringReady != 1)
+		return 0;
+
+	(void) RSSL_MUTEX_LOCK(&uringMutex);
+
+	while (uringRing.toSubmit > 0 || uringRing.inFlight > 0)
+	{
+		/* everything is MSG_DONTWAIT, so waiting for all of it only waits for the copies */
+		ret = ripcUringEnter(uringRing.fd, uringRing.toSubmit, uringRing.toSubmit + uringRing.inFlight, IORING_ENTER_GETEVENTS);
+
+		if (ret < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EBUSY)
+			{
+				/* the kernel is short of resources; make room by reaping what is done */
+				if (ripcUringReap() > 0)
+					continue;
+			}
+
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1002 ripcUringSubmit() io_uring_enter() failed. System errno: (%d)\n",
+				__FILE__, __LINE__, errno);
+
+			(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+			return RSSL_RET_FAILURE;
+		}
+
+		uringRing.toSubmit -= ret;
+		uringRing.inFlight += ret;
+
+		if ((ret = ripcUringReap()) == 0 && uringRing.inFlight == 0 && uringRing.toSubmit > 0)
+		{
+			/* the kernel accepted nothing and has nothing to complete */
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1002 ripcUringSubmit() io_uring_enter() did not accept queued operations.\n",
+				__FILE__, __LINE__);
+
+			(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+			return RSSL_RET_FAILURE;
+		}
+		completions += ret;
+	}
+
+	(void) RSSL_MUTEX_UNLOCK(&uringMutex);
+	return completions;
+}
+
+#else
+
+/* io_uring is not available on this platform; channels use the plain system calls */
+
+void ripcUringInitialize()
+{
+}
+
+void ripcUringUninitialize()
+{
+}
+
+ripcUringChannel *ripcUringNewChannel()
+{
+	return 0;
+}
+
+void ripcUringFreeChannel(ripcUringChannel *uringChnl)
+{
+	free(uringChnl);
+}
+
+RsslInt32 ripcUringQueueRecv(ripcUringChannel *uringChnl, RsslSocket fd, char *buf, RsslInt32 len)
+{
+	return 0;
+}
+
+RsslInt32 ripcUringQueueSend(ripcUringChannel *uringChnl, RsslSocket fd)
+{
+	return 0;
+}
+
+ripcUringOpState ripcUringTakeResult(ripcUringOp *op, RsslInt32 *result)
+{
+	return RIPC_URING_OP_IDLE;
+}
+
+RsslInt32 ripcUringSubmit(RsslError *error)
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,1579 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#if defined(Linux) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE		/* for accept4() */
+#endif
+
+#include "rtr/rsslBiShMemTransport.h"
+#include "rtr/rsslBiShMemTransportImpl.h"
+#include "rtr/rsslAlloc.h"
+#include "rtr/rsslErrors.h"
+#include "rtr/rsslDataUtils.h"
+#include <string.h>
+
+#if defined(Linux)
+#include <unistd.h>
+#include <time.h>
+#include <stddef.h>
+#include <sys/syscall.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/eventfd.h>
+#include <linux/futex.h>
+/* blocking readers can sleep on a word in shared memory until the other process writes */
+#define RSSL_BISHM_FUTEX
+/* the channel's descriptor is an eventfd the writer signals when it publishes to an idle reader */
+#define RSSL_BISHM_EVENTFD
+#endif
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+/* global debug function pointers */
+static void(*rsslBiShMemDumpInFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
+static void(*rsslBiShMemDumpOutFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
+
+/***************************
+ * START INLINE HELPER FUNCTIONS
+ ***************************/
+
+/* client channels hang off transportClientInfo, accepted channels off transportServerInfo */
+RTR_C_ALWAYS_INLINE rsslBiShmChannel *_rsslBiShMemGetChannel(rsslChannelImpl *chnl)
+{
+	if (chnl->transportServerInfo)
+		return (rsslBiShmChannel*)chnl->transportServerInfo;
+	return (rsslBiShmChannel*)chnl->transportClientInfo;
+}
+
+/* grabs new buffer from freeList */
+/* we limit the user to only one rsslBuffer per channel so records are published in order */
+RTR_C_ALWAYS_INLINE rsslBufferImpl *_rsslBiShMemNewBuffer(rsslChannelImpl *chnl)
+{
+	RsslQueueLink *pLink = rsslQueueRemoveFirstLink(&(chnl->freeBufferList));
+
+	return RSSL_QUEUE_LINK_TO_OBJECT(rsslBufferImpl, link1, pLink);
+}
+
+/* sets bits in the segment flags; both processes update them */
+RTR_C_ALWAYS_INLINE void _rsslBiShMemSetFlags(rsslBiShmHdr *hdr, rtr_atomic_val flags)
+{
+	rtr_atomic_val oldFlags;
+
+	do
+	{
+		oldFlags = *(volatile rtr_atomic_val*)&hdr->flags;
+	} while (RTR_ATOMIC_COMPARE_AND_SWAP(hdr->flags, oldFlags, oldFlags | flags) != oldFlags);
+}
+
+RTR_C_ALWAYS_INLINE rtr_atomic_val _rsslBiShMemGetFlags(rsslBiShmHdr *hdr)
+{
+	return *(volatile rtr_atomic_val*)&hdr->flags;
+}
+
+/* size of a ring that holds numMsgs records of maxMsgSize, rounded up to a power of 2 */
+static rtrUInt32 _rsslBiShMemRingSize(rtrUInt32 maxMsgSize, rtrUInt32 numMsgs)
+{
+	RsslUInt64 needed;
+	RsslUInt64 size = 64;
+
+	/* with room for two records, a full size record always fits behind a pad record */
+	if (numMsgs < 2)
+		numMsgs = 2;
+
+	needed = (RsslUInt64)RSSL_BISHM_REC_LEN(maxMsgSize) * numMsgs;
+	while (size < needed)
+		size <<= 1;
+
+	return (size > RSSL_BISHM_MAX_RING_SIZE) ? 0 : (rtrUInt32)size;
+}
+
+/* ring offsets are stored with release and loaded with acquire semantics, so the records
+ * they cover are complete before the other process sees them */
+#ifdef _WIN32
+/* x86 and x64 only reorder a store with a later load, so acquire and release need just a compiler barrier */
+RTR_C_ALWAYS_INLINE rtrUInt32 _rsslBiShMemLoadAcquire(volatile rtrUInt32 *pOffset)
+{
+	rtrUInt32 offset = *pOffset;
+	_ReadWriteBarrier();
+	return offset;
+}
+
+RTR_C_ALWAYS_INLINE void _rsslBiShMemStoreRelease(volatile rtrUInt32 *pOffset, rtrUInt32 offset)
+{
+	_ReadWriteBarrier();
+	*pOffset = offset;
+}
+#else
+RTR_C_ALWAYS_INLINE rtrUInt32 _rsslBiShMemLoadAcquire(volatile rtrUInt32 *pOffset)
+{
+	return __atomic_load_n(pOffset, __ATOMIC_ACQUIRE);
+}
+
+RTR_C_ALWAYS_INLINE void _rsslBiShMemStoreRelease(volatile rtrUInt32 *pOffset, rtrUInt32 offset)
+{
+	__atomic_store_n(pOffset, offset, __ATOMIC_RELEASE);
+}
+#endif
+
+#ifdef RSSL_BISHM_EVENTFD
+/* makes an eventfd readable; a failed write means the counter is already far above zero */
+RTR_C_ALWAYS_INLINE void _rsslBiShMemSignal(int fd)
+{
+	if (fd >= 0)
+		(void)eventfd_write(fd, 1);
+}
+#endif
+
+/* wakes the reader of our outbound ring if it is asleep on the futex or waiting on its eventfd */
+RTR_C_ALWAYS_INLINE void _rsslBiShMemWakeReader(rsslBiShmChannel *shMemChnl)
+{
+#ifdef RSSL_BISHM_EVENTFD
+	rsslBiShmRing *ring = shMemChnl->outRing;
+
+	/* the reader sets readerSleeping or readerArmed before it rechecks writeOffset, so order our store of writeOffset before these loads */
+	__sync_synchronize();
+
+	if (ring->wakeupType == RSSL_SHMEM_WAKEUP_FUTEX && *(volatile rtr_atomic_val*)&ring->readerSleeping)
+	{
+		RTR_ATOMIC_INCREMENT(ring->wakeSeq);
+		syscall(SYS_futex, &ring->wakeSeq, FUTEX_WAKE, 1, NULL, NULL, 0);
+	}
+
+	/* only the writer that disarms the reader signals it, so a busy ring makes no system calls */
+	if (*(volatile rtr_atomic_val*)&ring->readerArmed && RTR_ATOMIC_COMPARE_AND_SWAP(ring->readerArmed, 1, 0) == 1)
+		_rsslBiShMemSignal(shMemChnl->_peerReadyFd);
+#endif
+}
+
+/* wakes the other side however it waits, so it finds the channel closed */
+static void _rsslBiShMemWakeOnClose(rsslBiShmChannel *shMemChnl)
+{
+	RTR_ATOMIC_INCREMENT(shMemChnl->outRing->wakeSeq);
+	_rsslBiShMemWakeReader(shMemChnl);
+#ifdef RSSL_BISHM_EVENTFD
+	_rsslBiShMemSignal(shMemChnl->_peerReadyFd);
+#endif
+}
+
+/* makes all records up to writeOffset visible to the reader */
+RTR_C_ALWAYS_INLINE void _rsslBiShMemPublish(rsslBiShmChannel *shMemChnl, rtrUInt32 writeOffset)
+{
+	_rsslBiShMemStoreRelease(&shMemChnl->outRing->writeOffset, writeOffset);
+	_rsslBiShMemWakeReader(shMemChnl);
+}
+
+/* called by a non-blocking reader that found the ring empty, so the writer signals its eventfd on the next publish.
+ * Returns RSSL_TRUE if the writer published while we were arming, in which case the caller reads again */
+RTR_C_ALWAYS_INLINE RsslBool _rsslBiShMemArmReader(rsslBiShmChannel *shMemChnl, rtrUInt32 readOffset)
+{
+#ifdef RSSL_BISHM_EVENTFD
+	rsslBiShmRing *ring = shMemChnl->inRing;
+	eventfd_t count;
+
+	/* still armed means the writer has not published since we drained the eventfd */
+	if (*(volatile rtr_atomic_val*)&ring->readerArmed)
+		return RSSL_FALSE;
+
+	/* clear the signal that disarmed us before arming again.  RTR_ATOMIC_SET is a full barrier,
+	 * so the writer either sees us armed or we see its new writeOffset */
+	(void)eventfd_read(shMemChnl->_readyFd, &count);
+	RTR_ATOMIC_SET(ring->readerArmed, 1);
+	return (_rsslBiShMemLoadAcquire(&ring->writeOffset) != readOffset) ? RSSL_TRUE : RSSL_FALSE;
+#else
+	return RSSL_FALSE;
+#endif
+}
+
+/* blocking readers only - sleeps until the writer moves writeOffset past readOffset or timeout (in microseconds) expires */
+static void _rsslBiShMemWait(rsslBiShmRing *ring, rtrUInt32 readOffset, rtrUInt32 timeout)
+{
+#ifdef RSSL_BISHM_FUTEX
+	struct timespec ts;
+	rtr_atomic_val wakeSeq;
+
+	/* RTR_ATOMIC_SET is a full barrier, so the writer either sees us sleeping or we see its new writeOffset */
+	RTR_ATOMIC_SET(ring->readerSleeping, 1);
+	wakeSeq = *(volatile rtr_atomic_val*)&ring->wakeSeq;
+
+	if (_rsslBiShMemLoadAcquire(&ring->writeOffset) == readOffset)
+	{
+		ts.tv_sec = timeout / 1000000;
+		ts.tv_nsec = (timeout % 1000000) * 1000;
+		syscall(SYS_futex, &ring->wakeSeq, FUTEX_WAIT, wakeSeq, &ts, NULL, 0);
+	}
+
+	RTR_ATOMIC_SET(ring->readerSleeping, 0);
+#endif
+}
+
+/* reserves space for a record of length bytes at the write position, putting a pad
+ * record in front of it if it would otherwise wrap.  Returns NULL if the ring is full. */
+RTR_C_ALWAYS_INLINE rsslBiShmRec *_rsslBiShMemReserve(rsslBiShmChannel *shMemChnl, rtrUInt32 length)
+{
+	rsslBiShmRing *ring = shMemChnl->outRing;
+	rtrUInt32 writeOffset = ring->writeOffset;
+	rtrUInt32 used = writeOffset - _rsslBiShMemLoadAcquire(&ring->readOffset);
+	rtrUInt32 position = writeOffset & (ring->size - 1);
+	rtrUInt32 contiguous = ring->size - position;
+	rtrUInt32 recLen = RSSL_BISHM_REC_LEN(length);
+	rtrUInt32 padLen = (recLen > contiguous) ? contiguous : 0;
+	rsslBiShmRec *rec;
+
+	if (rtrUnlikely(used + padLen + recLen > ring->size))
+		return NULL;
+
+	if (padLen)
+	{
+		rec = (rsslBiShmRec*)(shMemChnl->outData + position);
+		rec->length = padLen - (rtrUInt32)sizeof(rsslBiShmRec);
+		rec->flags = RSSL_BISHM_REC_PAD;
+	}
+
+	shMemChnl->outPadLen = padLen;
+	return (rsslBiShmRec*)(shMemChnl->outData + ((writeOffset + padLen) & (ring->size - 1)));
+}
+
+/* releases the segment, mutex and descriptors held by this process */
+static void _rsslBiShMemFreeChannel(rsslBiShmChannel *shMemChnl)
+{
+	if (shMemChnl->controlMutex)
+	{
+		rtrWaitForMutex(shMemChnl->controlMutex);
+		if (shMemChnl->shMemSeg.base)
+		{
+			if (shMemChnl->isServer)
+				rtrShmSegDestroy(&shMemChnl->shMemSeg);
+			else
+				rtrShmSegDetach(&shMemChnl->shMemSeg);
+		}
+		rtrReleaseMutex(shMemChnl->controlMutex);
+		rtrShmSegDestroyMutex(shMemChnl->controlMutex);
+		shMemChnl->controlMutex = 0;
+	}
+
+#ifdef RSSL_BISHM_EVENTFD
+	if (shMemChnl->_fdSocket >= 0)
+		close(shMemChnl->_fdSocket);
+	if (shMemChnl->_readyFd >= 0)
+		close(shMemChnl->_readyFd);
+	if (shMemChnl->_peerReadyFd >= 0)
+		close(shMemChnl->_peerReadyFd);
+#else
+	rssl_pipe_close(&shMemChnl->_bindPipe);
+	rssl_pipe_close(&shMemChnl->_pipe);
+#endif
+	_rsslFree(shMemChnl);
+}
+
+/* marks the channel's descriptors as not yet created */
+RTR_C_ALWAYS_INLINE void _rsslBiShMemInitDescriptors(rsslBiShmChannel *shMemChnl)
+{
+#ifdef RSSL_BISHM_EVENTFD
+	shMemChnl->_fdSocket = -1;
+	shMemChnl->_readyFd = -1;
+	shMemChnl->_peerReadyFd = -1;
+#else
+	rssl_pipe_init(&shMemChnl->_bindPipe);
+	rssl_pipe_init(&shMemChnl->_pipe);
+#endif
+}
+
+#ifdef RSSL_BISHM_EVENTFD
+/* the server listens on an abstract unix socket named after the segment, so nothing is left in the file system */
+static socklen_t _rsslBiShMemSocketAddr(struct sockaddr_un *addr, const char *shMemKey)
+{
+	memset(addr, 0, sizeof(struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+	snprintf(addr->sun_path + 1, sizeof(addr->sun_path) - 1, "rsslBiShMem.%s", shMemKey);
+	return (socklen_t)(offsetof(struct sockaddr_un, sun_path) + 1 + strlen(addr->sun_path + 1));
+}
+
+/* creates the eventfds for both rings and the socket the client collects them from */
+static RsslRet _rsslBiShMemListen(rsslBiShmChannel *shMemChnl, const char *shMemKey, RsslError *error)
+{
+	struct sockaddr_un addr;
+	socklen_t addrLen = _rsslBiShMemSocketAddr(&addr, shMemKey);
+
+	if ((shMemChnl->_readyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0 ||
+		(shMemChnl->_peerReadyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() unable to create eventfd.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* a blocking server waits in rsslAccept() for the client to connect */
+	if ((shMemChnl->_fdSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | (shMemChnl->channelsBlocking ? 0 : SOCK_NONBLOCK), 0)) < 0 ||
+		bind(shMemChnl->_fdSocket, (struct sockaddr*)&addr, addrLen) < 0 ||
+		listen(shMemChnl->_fdSocket, 1) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() unable to listen on socket %s.\n", __FILE__, __LINE__, addr.sun_path + 1);
+		return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* client side - connects to the server, which sends the eventfds once it accepts the channel */
+static RsslRet _rsslBiShMemConnectSocket(rsslBiShmChannel *shMemChnl, const char *shMemKey, RsslError *error)
+{
+	struct sockaddr_un addr;
+	socklen_t addrLen = _rsslBiShMemSocketAddr(&addr, shMemKey);
+
+	if ((shMemChnl->_fdSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | (shMemChnl->channelsBlocking ? 0 : SOCK_NONBLOCK), 0)) < 0 ||
+		connect(shMemChnl->_fdSocket, (struct sockaddr*)&addr, addrLen) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemConnect() unable to connect to socket %s.\n", __FILE__, __LINE__, addr.sun_path + 1);
+		return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* fds[0] is the eventfd the client reads, fds[1] the one it signals */
+static RsslRet _rsslBiShMemSendFds(int sock, int *fds)
+{
+	union { struct cmsghdr align; char buf[CMSG_SPACE(2 * sizeof(int))]; } control;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char byte = 0;
+
+	memset(&msg, 0, sizeof(msg));
+	memset(&control, 0, sizeof(control));
+	iov.iov_base = &byte;
+	iov.iov_len = 1;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buf;
+	msg.msg_controllen = sizeof(control.buf);
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(2 * sizeof(int));
+	memcpy(CMSG_DATA(cmsg), fds, 2 * sizeof(int));
+
+	return (sendmsg(sock, &msg, MSG_NOSIGNAL) == 1) ? RSSL_RET_SUCCESS : RSSL_RET_FAILURE;
+}
+
+/* receives the eventfds sent by _rsslBiShMemSendFds.  Returns RSSL_RET_SUCCESS once they arrive,
+ * RSSL_RET_CHAN_INIT_IN_PROGRESS if they have not been sent yet and RSSL_RET_FAILURE if the server went away */
+static RsslRet _rsslBiShMemRecvFds(int sock, int *fds)
+{
+	union { struct cmsghdr align; char buf[CMSG_SPACE(2 * sizeof(int))]; } control;
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	char byte;
+	ssize_t bytes;
+
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = &byte;
+	iov.iov_len = 1;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control.buf;
+	msg.msg_controllen = sizeof(control.buf);
+
+	if ((bytes = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC)) < 0)
+		return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? RSSL_RET_CHAN_INIT_IN_PROGRESS : RSSL_RET_FAILURE;
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	if (bytes != 1 || cmsg == NULL || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(2 * sizeof(int)))
+		return RSSL_RET_FAILURE;
+
+	memcpy(fds, CMSG_DATA(cmsg), 2 * sizeof(int));
+	return RSSL_RET_SUCCESS;
+}
+#else
+/* puts an always readable pipe in front of the channel so the user keeps calling rsslRead */
+static RsslRet _rsslBiShMemCreatePipe(rssl_pipe *pipe, const char *functionName, RsslError *error)
+{
+	if (rssl_pipe_create(pipe) < 1)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> %s() unable to create pipe.\n", __FILE__, __LINE__, functionName);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rssl_pipe_write(pipe, "1", 1) < 1)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> %s() unable to write byte to pipe.\n", __FILE__, __LINE__, functionName);
+		rssl_pipe_close(pipe);
+		return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+}
+#endif
+
+/* builds the shared memory key from the interface and service names */
+static RsslRet _rsslBiShMemKey(char *shMemKey, char *interfaceName, char *serviceName, const char *functionName, RsslError *error)
+{
+	RsslInt32 nBytes;
+
+	if (interfaceName)
+		nBytes = snprintf(shMemKey, SHMKEY_SIZE, "%s%s", interfaceName, serviceName);
+	else
+		nBytes = snprintf(shMemKey, SHMKEY_SIZE, "%s", serviceName);
+
+	if ((nBytes >= SHMKEY_SIZE) || nBytes < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> %s() bad interface and/or service name\n", __FILE__, __LINE__, functionName);
+		return RSSL_RET_FAILURE;
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* the wakeup type a reader advertises in its ring; futex mode falls back to polling where it is unavailable */
+RTR_C_ALWAYS_INLINE rtrUInt32 _rsslBiShMemWakeupType(RsslShmemWakeupTypes wakeupType)
+{
+#ifdef RSSL_BISHM_FUTEX
+	if (wakeupType == RSSL_SHMEM_WAKEUP_FUTEX)
+		return RSSL_SHMEM_WAKEUP_FUTEX;
+#endif
+	return RSSL_SHMEM_WAKEUP_POLL;
+}
+
+
+/***************************
+ * START NON-PUBLIC ABSTRACTED FUNCTIONS
+ ***************************/
+
+/* rssl BiShMem Bind call */
+RsslRet rsslBiShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl;
+	char shMemKey[SHMKEY_SIZE];
+	char errBuff[256];
+	rtrUInt32 maxMsgSize = opts->maxFragmentSize;
+	rtrUInt32 numOutputBuffers;
+	rtrUInt32 serverRingSize;
+	rtrUInt32 clientRingSize;
+	size_t segSize;
+	rsslBiShmRing *serverRing;
+	rsslBiShmRing *clientRing;
+
+	if (_rsslBiShMemKey(shMemKey, opts->interfaceName, opts->serviceName, "rsslBiShMemBind", error) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if (opts->maxOutputBuffers < opts->guaranteedOutputBuffers)
+		numOutputBuffers = opts->guaranteedOutputBuffers;
+	else
+		numOutputBuffers = opts->maxOutputBuffers;
+
+	if (maxMsgSize == 0 || maxMsgSize > RSSL_BISHM_MAX_RING_SIZE / 2)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() invalid maxFragmentSize %u\n", __FILE__, __LINE__, maxMsgSize);
+		return RSSL_RET_FAILURE;
+	}
+
+	serverRingSize = _rsslBiShMemRingSize(maxMsgSize, numOutputBuffers);
+	clientRingSize = _rsslBiShMemRingSize(maxMsgSize, opts->numInputBuffers);
+	if (serverRingSize == 0 || clientRingSize == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() %u buffers of %u bytes exceed the largest shared memory ring of %u bytes\n",
+				__FILE__, __LINE__, (serverRingSize == 0 ? numOutputBuffers : opts->numInputBuffers), maxMsgSize, RSSL_BISHM_MAX_RING_SIZE);
+		return RSSL_RET_FAILURE;
+	}
+
+	if ((shMemChnl = (rsslBiShmChannel*)_rsslMalloc(sizeof(rsslBiShmChannel))) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() unable to allocate shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+	memset(shMemChnl, 0, sizeof(rsslBiShmChannel));
+	_rsslBiShMemInitDescriptors(shMemChnl);
+	shMemChnl->isServer = RSSL_TRUE;
+	shMemChnl->channelsBlocking = opts->channelsBlocking;
+	shMemChnl->wakeupSpinCount = opts->shmemOpts.wakeupSpinCount;
+	shMemChnl->wakeupTimeout = opts->shmemOpts.wakeupTimeout;
+
+	if ((shMemChnl->controlMutex = rtrShmSegCreateMutex(&shMemChnl->shMemSeg, shMemKey, 0, errBuff)) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() unable to create control mutex (%s).\n", __FILE__, __LINE__, errBuff);
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+
+#ifdef RSSL_BISHM_EVENTFD
+	/* the listening socket becomes readable when the client connects, which tells the user to call accept */
+	if (_rsslBiShMemListen(shMemChnl, shMemKey, error) != RSSL_RET_SUCCESS)
+#else
+	/* write a byte into the bind pipe to trick user into calling accept */
+	if (_rsslBiShMemCreatePipe(&shMemChnl->_bindPipe, "rsslBiShMemBind", error) != RSSL_RET_SUCCESS)
+#endif
+	{
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+
+	segSize = RTR_SHM_ALIGNBYTES(sizeof(rsslBiShmHdr)) + 2 * RTR_SHM_ALIGNBYTES(sizeof(rsslBiShmRing)) + serverRingSize + clientRingSize;
+
+	/* the control mutex is used for segment control (attach/create/destroy) */
+	rtrWaitForMutex(shMemChnl->controlMutex);
+
+	if (rtrShmSegCreate(&shMemChnl->shMemSeg, shMemKey, segSize, errBuff) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBind() unable to create shared memory segment with key %s and size %zu (%s).\n", __FILE__, __LINE__, shMemKey, segSize, errBuff);
+		rtrReleaseMutex(shMemChnl->controlMutex);
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* the segment is zeroed by rtrShmSegCreate */
+	shMemChnl->hdr = (rsslBiShmHdr*)rtrShmBytesReserve(&shMemChnl->shMemSeg, sizeof(rsslBiShmHdr));
+	serverRing = (rsslBiShmRing*)rtrShmBytesReserve(&shMemChnl->shMemSeg, sizeof(rsslBiShmRing));
+	clientRing = (rsslBiShmRing*)rtrShmBytesReserve(&shMemChnl->shMemSeg, sizeof(rsslBiShmRing));
+	shMemChnl->outData = rtrShmBytesReserve(&shMemChnl->shMemSeg, serverRingSize);
+	shMemChnl->inData = rtrShmBytesReserve(&shMemChnl->shMemSeg, clientRingSize);
+	shMemChnl->outRing = serverRing;
+	shMemChnl->inRing = clientRing;
+
+	serverRing->size = serverRingSize;
+	serverRing->wakeupType = RSSL_SHMEM_WAKEUP_POLL;		/* set by the client when it attaches */
+	clientRing->size = clientRingSize;
+	clientRing->wakeupType = _rsslBiShMemWakeupType(opts->shmemOpts.wakeupType);
+
+	/* both readers start armed, so the first write to each ring signals its eventfd even if
+	 * that side has not called rsslRead yet */
+	serverRing->readerArmed = 1;
+	clientRing->readerArmed = 1;
+
+	/* max ping timeout is 255 seconds (which is an eternity for a shmem connection) */
+	shMemChnl->hdr->pingTimeout = (opts->pingTimeout <= 0xFF) ? opts->pingTimeout : 0xFF;
+	shMemChnl->hdr->protocolType = opts->protocolType;
+	shMemChnl->hdr->majorVersion = opts->majorVersion;
+	shMemChnl->hdr->minorVersion = opts->minorVersion;
+	shMemChnl->hdr->maxMsgSize = maxMsgSize;
+	shMemChnl->hdr->flags = opts->serverToClientPings ? RSSL_BISHM_SERVER_PING_ENABLED : 0;
+	shMemChnl->hdr->shmemVersion = RSSL_BISHM_VERSION;
+
+	rtrReleaseMutex(shMemChnl->controlMutex);
+
+	rsslSrvrImpl->connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+	rsslSrvrImpl->transportInfo = shMemChnl;
+#ifdef RSSL_BISHM_EVENTFD
+	rsslSrvrImpl->Server.socketId = shMemChnl->_fdSocket;
+#else
+	rsslSrvrImpl->Server.socketId = rssl_pipe_get_read_fd(&shMemChnl->_bindPipe);
+#endif
+	rsslSrvrImpl->Server.userSpecPtr = opts->userSpecPtr;
+	rsslSrvrImpl->Server.state = RSSL_CH_STATE_ACTIVE;
+	rsslSrvrImpl->Server.portNumber = 0;
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem Connect */
+RsslRet rsslBiShMemConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opts, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl;
+	char shMemKey[SHMKEY_SIZE];
+	char errBuff[256];
+	char *curLoc;
+	rsslBiShmRing *serverRing;
+	rsslBiShmRing *clientRing;
+	rtr_atomic_val flags;
+	RsslRet ret;
+
+	/* For all connection types we minimally need this value populated (unified.serviceName == segmented.recvPort) */
+	if (RSSL_NULL_PTR(opts->connectionInfo.unified.serviceName, "rsslConnect", "opts->connectionInfo.unified.serviceName", error))
+		return RSSL_RET_FAILURE;
+
+	if (_rsslBiShMemKey(shMemKey, opts->connectionInfo.unified.interfaceName, opts->connectionInfo.unified.serviceName, "rsslBiShMemConnect", error) != RSSL_RET_SUCCESS)
+		return RSSL_RET_FAILURE;
+
+	if ((shMemChnl = (rsslBiShmChannel*)_rsslMalloc(sizeof(rsslBiShmChannel))) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemConnect() unable to allocate memory for shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+	memset(shMemChnl, 0, sizeof(rsslBiShmChannel));
+	_rsslBiShMemInitDescriptors(shMemChnl);
+	shMemChnl->isServer = RSSL_FALSE;
+	shMemChnl->channelsBlocking = opts->blocking;
+	shMemChnl->wakeupSpinCount = opts->shmemOpts.wakeupSpinCount;
+	shMemChnl->wakeupTimeout = opts->shmemOpts.wakeupTimeout;
+
+	if ((shMemChnl->controlMutex = rtrShmSegAttachMutex(&shMemChnl->shMemSeg, shMemKey, 0, errBuff)) == 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemConnect() unable to attach to control mutex (%s).\n", __FILE__, __LINE__, errBuff);
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+
+#ifndef RSSL_BISHM_EVENTFD
+	if (_rsslBiShMemCreatePipe(&shMemChnl->_pipe, "rsslBiShMemConnect", error) != RSSL_RET_SUCCESS)
+	{
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+#endif
+
+	/* the control mutex is used for segment control (attach/create/destroy) */
+	rtrWaitForMutex(shMemChnl->controlMutex);
+
+	if (rtrShmSegAttach(&shMemChnl->shMemSeg, shMemKey, errBuff) < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemConnect() unable to attach to shared memory segment with key %s (%s).\n", __FILE__, __LINE__, shMemKey, errBuff);
+		rtrReleaseMutex(shMemChnl->controlMutex);
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+
+	curLoc = (char*)shMemChnl->shMemSeg.base + shMemChnl->shMemSeg.hdr->headerLen;
+	shMemChnl->hdr = (rsslBiShmHdr*)rtrShmBytesAttach(&curLoc, sizeof(rsslBiShmHdr));
+
+	/* make sure the shmem seg we are attaching to is the right version */
+	if (shMemChnl->hdr->shmemVersion != RSSL_BISHM_VERSION)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemConnect() incompatible shmem segment (version = %u).\n", __FILE__, __LINE__, shMemChnl->hdr->shmemVersion);
+		rtrReleaseMutex(shMemChnl->controlMutex);
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* each server accepts one client */
+	do
+	{
+		flags = _rsslBiShMemGetFlags(shMemChnl->hdr);
+		if (flags & (RSSL_BISHM_CLIENT_ATTACHED | RSSL_BISHM_SERVER_SHUTDOWN))
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemConnect() shared memory segment with key %s %s.\n", __FILE__, __LINE__, shMemKey,
+					(flags & RSSL_BISHM_SERVER_SHUTDOWN) ? "is shutting down" : "already has a client");
+			rtrReleaseMutex(shMemChnl->controlMutex);
+			_rsslBiShMemFreeChannel(shMemChnl);
+			return RSSL_RET_FAILURE;
+		}
+	} while (RTR_ATOMIC_COMPARE_AND_SWAP(shMemChnl->hdr->flags, flags, flags | RSSL_BISHM_CLIENT_ATTACHED) != flags);
+
+	serverRing = (rsslBiShmRing*)rtrShmBytesAttach(&curLoc, sizeof(rsslBiShmRing));
+	clientRing = (rsslBiShmRing*)rtrShmBytesAttach(&curLoc, sizeof(rsslBiShmRing));
+	shMemChnl->inData = rtrShmBytesAttach(&curLoc, serverRing->size);
+	shMemChnl->outData = rtrShmBytesAttach(&curLoc, clientRing->size);
+	shMemChnl->inRing = serverRing;
+	shMemChnl->outRing = clientRing;
+	serverRing->wakeupType = _rsslBiShMemWakeupType(opts->shmemOpts.wakeupType);
+
+	rtrReleaseMutex(shMemChnl->controlMutex);
+
+#ifdef RSSL_BISHM_EVENTFD
+	/* until the server sends the eventfds, the connection is the channel's descriptor */
+	if (_rsslBiShMemConnectSocket(shMemChnl, shMemKey, error) != RSSL_RET_SUCCESS)
+	{
+		_rsslBiShMemSetFlags(shMemChnl->hdr, RSSL_BISHM_CLIENT_DETACHED);
+		_rsslBiShMemFreeChannel(shMemChnl);
+		return RSSL_RET_FAILURE;
+	}
+#endif
+
+	rsslChnlImpl->transportClientInfo = shMemChnl;
+	rsslChnlImpl->maxMsgSize = shMemChnl->hdr->maxMsgSize;
+	rsslChnlImpl->maxGuarMsgs = clientRing->size / RSSL_BISHM_REC_LEN(shMemChnl->hdr->maxMsgSize);
+
+	rsslChnlImpl->Channel.pingTimeout = shMemChnl->hdr->pingTimeout;		/* the server dictates the ping timeout */
+	rsslChnlImpl->Channel.majorVersion = shMemChnl->hdr->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = shMemChnl->hdr->minorVersion;
+	rsslChnlImpl->Channel.protocolType = shMemChnl->hdr->protocolType;
+	rsslChnlImpl->Channel.connectionType = RSSL_CONN_TYPE_BIDIR_SHMEM;
+
+	/* both sides can write, so the client always pings; the server pings if it was asked to */
+	rsslChnlImpl->rsslFlags = CLIENT_TO_SERVER;
+	if (shMemChnl->hdr->flags & RSSL_BISHM_SERVER_PING_ENABLED)
+		rsslChnlImpl->rsslFlags |= SERVER_TO_CLIENT;
+
+#ifdef RSSL_BISHM_EVENTFD
+	rsslChnlImpl->Channel.socketId = shMemChnl->_fdSocket;
+#else
+	rsslChnlImpl->Channel.socketId = rssl_pipe_get_read_fd(&shMemChnl->_pipe);
+#endif
+	rsslChnlImpl->Channel.userSpecPtr = opts->userSpecPtr;
+	rsslChnlImpl->Channel.state	= RSSL_CH_STATE_INITIALIZING;
+
+	/* if its a nonblocking connect, we are done here */
+	if (opts->blocking == 0)
+		return RSSL_RET_SUCCESS;
+
+	while (rsslChnlImpl->Channel.state == RSSL_CH_STATE_INITIALIZING)
+	{
+		/* for a blocking connection, call rsslInitChannel (which will set state to active) for the user */
+		if ((ret = rsslBiShMemInitChannel(rsslChnlImpl, NULL/* not used */, error )) < RSSL_RET_SUCCESS)
+			return RSSL_RET_FAILURE;	/* error will have been set by rsslBiShMemInitChannel() */
+	}
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem accept */
+rsslChannelImpl* rsslBiShMemAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error)
+{
+	rsslChannelImpl	*rsslChnlImpl;
+	rsslBiShmChannel *shMemChnl = rsslSrvrImpl->transportInfo;
+	RsslRet ret;
+#ifdef RSSL_BISHM_EVENTFD
+	int sock;
+	int fds[2];
+#else
+	char temp[4];
+#endif
+
+	if (shMemChnl->accepted)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() bidirectional shared memory server already accepted its channel\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if ((rsslChnlImpl = _rsslNewChannel()) == 0)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() could not allocate memory for new channel\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+#ifdef RSSL_BISHM_EVENTFD
+	/* the client connects after it attaches to the segment; hand it the eventfds for both rings */
+	if ((sock = accept4(shMemChnl->_fdSocket, NULL, NULL, SOCK_CLOEXEC)) < 0)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() no client is connecting to the bidirectional shared memory server.\n", __FILE__, __LINE__);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+
+	fds[0] = shMemChnl->_peerReadyFd;
+	fds[1] = shMemChnl->_readyFd;
+	ret = _rsslBiShMemSendFds(sock, fds);
+	close(sock);
+
+	if (ret != RSSL_RET_SUCCESS)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() unable to send eventfds to the client.\n", __FILE__, __LINE__);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+#else
+	/* take the byte out of the bind pipe so the user doesnt call rsslAccept() again */
+	if (rssl_pipe_read(&shMemChnl->_bindPipe, temp, 1) <= 0)
+	{
+		_rsslSetError(error, (RsslChannel*)(&rsslSrvrImpl->Server), RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslAccept() unable to read byte from bind pipe.\n", __FILE__, __LINE__);
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+
+	if (_rsslBiShMemCreatePipe(&shMemChnl->_pipe, "rsslBiShMemAccept", error) != RSSL_RET_SUCCESS)
+	{
+		_rsslReleaseChannel(rsslChnlImpl);
+		return NULL;
+	}
+#endif
+
+	shMemChnl->accepted = RSSL_TRUE;
+	shMemChnl->_hasBuffer = 0;
+
+	rsslChnlImpl->Channel.connectionType = rsslSrvrImpl->connectionType;
+	rsslChnlImpl->transportServerInfo = shMemChnl;
+
+	/* these are all set from the segment and are the same values passed in on rsslBind */
+	rsslChnlImpl->maxMsgSize = shMemChnl->hdr->maxMsgSize;
+	rsslChnlImpl->maxGuarMsgs = shMemChnl->outRing->size / RSSL_BISHM_REC_LEN(shMemChnl->hdr->maxMsgSize);
+	rsslChnlImpl->Channel.pingTimeout = shMemChnl->hdr->pingTimeout;
+	rsslChnlImpl->Channel.majorVersion = shMemChnl->hdr->majorVersion;
+	rsslChnlImpl->Channel.minorVersion = shMemChnl->hdr->minorVersion;
+	rsslChnlImpl->Channel.protocolType = shMemChnl->hdr->protocolType;
+
+	rsslChnlImpl->rsslFlags = CLIENT_TO_SERVER;
+	if (shMemChnl->hdr->flags & RSSL_BISHM_SERVER_PING_ENABLED)
+		rsslChnlImpl->rsslFlags |= SERVER_TO_CLIENT;
+
+#ifdef RSSL_BISHM_EVENTFD
+	rsslChnlImpl->Channel.socketId = shMemChnl->_readyFd;
+#else
+	rsslChnlImpl->Channel.socketId = rssl_pipe_get_read_fd(&shMemChnl->_pipe);
+#endif
+
+	rsslChnlImpl->Channel.clientHostname = (char*)_rsslMalloc(32);
+	strncpy(rsslChnlImpl->Channel.clientHostname, "localhost", 32);
+	rsslChnlImpl->Channel.clientIP = (char*)_rsslMalloc(32);
+	strncpy(rsslChnlImpl->Channel.clientIP, "127.0.0.1", 32);
+
+	if (!opts->userSpecPtr)
+	{
+		rsslChnlImpl->Channel.userSpecPtr = rsslSrvrImpl->Server.userSpecPtr;
+	}
+	else
+	{
+		rsslChnlImpl->Channel.userSpecPtr = opts->userSpecPtr;
+	}
+
+	rsslChnlImpl->channelFuncs = rsslSrvrImpl->channelFuncs;
+	rsslChnlImpl->Channel.state	= RSSL_CH_STATE_INITIALIZING;
+
+	/* if its a nonblocking channel, then set to initializing and exit */
+	/* the user will need to call rsslInitChannel until the client attaches */
+	if (shMemChnl->channelsBlocking == 0)
+		return rsslChnlImpl;
+
+	/* for a blocking channel, wait here for the client */
+	while (rsslChnlImpl->Channel.state == RSSL_CH_STATE_INITIALIZING)
+	{
+		if ((ret = rsslBiShMemInitChannel(rsslChnlImpl, NULL/* not used */, error )) < RSSL_RET_SUCCESS)
+			return NULL;
+	}
+
+	return rsslChnlImpl;
+}
+
+/* rssl BiShMem ReConnect (for tunneling, basically a no-op) */
+RsslRet rsslBiShMemReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem InitChannel */
+RsslRet rsslBiShMemInitChannel(rsslChannelImpl *rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error )
+{
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+	rtr_atomic_val flags;
+
+	/* state may have been set to active by accept and connect */
+	if (rsslChnlImpl->Channel.state == RSSL_CH_STATE_ACTIVE)
+		return RSSL_RET_SUCCESS;
+
+	if (rsslChnlImpl->Channel.state != RSSL_CH_STATE_INITIALIZING || !shMemChnl)
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemInitChannel failed. Unexpected Channel state(%d)\n", __FILE__, __LINE__, rsslChnlImpl->Channel.state);
+		return RSSL_RET_FAILURE;
+	}
+
+	flags = _rsslBiShMemGetFlags(shMemChnl->hdr);
+
+	if (shMemChnl->isServer)
+	{
+		/* copy the component version into the shmem seg and set the seg as initialized */
+		if (!(flags & RSSL_BISHM_SERVER_INITIALIZED))
+		{
+			if (rsslChnlImpl->componentVer.componentVersion.length > 0)
+			{
+				shMemChnl->hdr->serverComponentVersionLen = (rtrUInt8)rsslChnlImpl->componentVer.componentVersion.length;
+				memcpy(shMemChnl->hdr->serverComponentVersion,
+						rsslChnlImpl->componentVer.componentVersion.data,
+						shMemChnl->hdr->serverComponentVersionLen);
+			}
+			_rsslBiShMemSetFlags(shMemChnl->hdr, RSSL_BISHM_SERVER_INITIALIZED);
+#ifdef RSSL_BISHM_EVENTFD
+			/* the client waits on its eventfd for this */
+			_rsslBiShMemSignal(shMemChnl->_peerReadyFd);
+#endif
+		}
+
+		if (flags & RSSL_BISHM_CLIENT_DETACHED)
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemInitChannel client has detached\n", __FILE__, __LINE__);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+
+		/* the channel becomes active once a client has attached to the segment */
+		if (!(flags & RSSL_BISHM_CLIENT_ATTACHED))
+			return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+	}
+	else
+	{
+		if (flags & RSSL_BISHM_SERVER_SHUTDOWN)
+		{
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemInitChannel server has shutdown\n", __FILE__, __LINE__);
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			return RSSL_RET_FAILURE;
+		}
+
+		if (shMemChnl->hdr->clientComponentVersionLen == 0 && rsslChnlImpl->componentVer.componentVersion.length > 0)
+		{
+			memcpy(shMemChnl->hdr->clientComponentVersion,
+					rsslChnlImpl->componentVer.componentVersion.data,
+					(rtrUInt8)rsslChnlImpl->componentVer.componentVersion.length);
+			shMemChnl->hdr->clientComponentVersionLen = (rtrUInt8)rsslChnlImpl->componentVer.componentVersion.length;
+		}
+
+#ifdef RSSL_BISHM_EVENTFD
+		if (shMemChnl->_readyFd < 0)
+		{
+			int fds[2];
+			RsslRet ret;
+
+			if ((ret = _rsslBiShMemRecvFds(shMemChnl->_fdSocket, fds)) == RSSL_RET_CHAN_INIT_IN_PROGRESS)
+				return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+
+			if (ret != RSSL_RET_SUCCESS)
+			{
+				_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, errno);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemInitChannel server closed the connection before sending its eventfds\n", __FILE__, __LINE__);
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+				return RSSL_RET_FAILURE;
+			}
+
+			/* our eventfd replaces the connection as the channel's descriptor; the server signals it once the segment is ready */
+			shMemChnl->_readyFd = fds[0];
+			shMemChnl->_peerReadyFd = fds[1];
+			close(shMemChnl->_fdSocket);
+
+			if (inProg)
+			{
+				inProg->flags = RSSL_IP_FD_CHANGE;
+				inProg->oldSocket = (RsslSocket)shMemChnl->_fdSocket;
+				inProg->newSocket = (RsslSocket)shMemChnl->_readyFd;
+			}
+			rsslChnlImpl->Channel.oldSocketId = rsslChnlImpl->Channel.socketId;
+			rsslChnlImpl->Channel.socketId = (RsslSocket)shMemChnl->_readyFd;
+			shMemChnl->_fdSocket = -1;
+			return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+		}
+#endif
+
+		/* set the channel state to active once the server says the shmem seg is ready */
+		if (!(flags & RSSL_BISHM_SERVER_INITIALIZED))
+			return RSSL_RET_CHAN_INIT_IN_PROGRESS;
+	}
+
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_ACTIVE;
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem CloseChannel */
+RsslRet rsslBiShMemCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+
+	if (!shMemChnl)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemCloseChannel failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	rsslChnlImpl->Channel.state = RSSL_CH_STATE_INACTIVE;
+
+	/* let the other side know, and wake it if it is sleeping on our data */
+	_rsslBiShMemSetFlags(shMemChnl->hdr, (shMemChnl->isServer ? RSSL_BISHM_SERVER_SHUTDOWN : RSSL_BISHM_CLIENT_DETACHED));
+	_rsslBiShMemWakeOnClose(shMemChnl);
+
+	if (rsslChnlImpl->transportClientInfo)
+	{	/* client */
+		_rsslBiShMemFreeChannel(shMemChnl);
+		rsslChnlImpl->transportClientInfo = 0;
+	}
+	if (rsslChnlImpl->transportServerInfo)
+	{	/* server - the segment and eventfds stay with the rsslServer until it is closed */
+#ifndef RSSL_BISHM_EVENTFD
+		rssl_pipe_close(&shMemChnl->_pipe);
+#endif
+		shMemChnl->_hasBuffer = 0;
+		rsslChnlImpl->transportServerInfo = 0;
+	}
+
+	/* Release memory allocated by rsslBiShMemAccept */
+	if (rsslChnlImpl->Channel.clientHostname)
+	{
+		_rsslFree(rsslChnlImpl->Channel.clientHostname);
+	}
+
+	if (rsslChnlImpl->Channel.clientIP)
+	{
+		_rsslFree(rsslChnlImpl->Channel.clientIP);
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem read */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBiShMemRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+	rsslBiShmRing *ring;
+	rsslBiShmRec *rec;
+	rtrUInt32 readOffset;
+	rtrUInt32 writeOffset;
+	rtrUInt32 remaining;
+
+	if (rtrUnlikely(!shMemChnl))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemRead failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		*readRet = RSSL_RET_FAILURE;
+		return NULL;
+	}
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+#ifdef WIN32
+	  EnterCriticalSection(&rsslChnlImpl->chanMutex);
+#else
+	  if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
+	  {
+		*readRet = RSSL_RET_READ_IN_PROGRESS;
+		return NULL;
+	  }
+#endif
+	}
+
+	ring = shMemChnl->inRing;
+
+	/* the record returned by the last read belongs to the writer again once we come back */
+	readOffset = ring->readOffset + shMemChnl->inPendingLen;
+	shMemChnl->inPendingLen = 0;
+
+	while (1)
+	{
+		writeOffset = _rsslBiShMemLoadAcquire(&ring->writeOffset);
+
+		if (writeOffset != readOffset)
+		{
+			rec = (rsslBiShmRec*)(shMemChnl->inData + (readOffset & (ring->size - 1)));
+			if (!(rec->flags & RSSL_BISHM_REC_PAD))
+				break;
+			readOffset += RSSL_BISHM_REC_LEN(rec->length);
+			continue;
+		}
+
+		/* nothing to read - give the writer back the space we have finished with */
+		_rsslBiShMemStoreRelease(&ring->readOffset, readOffset);
+
+		if (_rsslBiShMemGetFlags(shMemChnl->hdr) & (shMemChnl->isServer ? RSSL_BISHM_CLIENT_DETACHED : RSSL_BISHM_SERVER_SHUTDOWN))
+		{
+			/* the other side is gone and we have read everything it wrote */
+			if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+			_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslRead() %s has closed the shared memory channel\n", __FILE__, __LINE__, shMemChnl->isServer ? "client" : "server");
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			*readRet = RSSL_RET_FAILURE;
+			return NULL;
+		}
+
+		/* a non-blocking read never waits; the eventfd wakes the user once the writer publishes again */
+		if (!shMemChnl->channelsBlocking)
+		{
+			if (_rsslBiShMemArmReader(shMemChnl, readOffset))
+				continue;
+
+			if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+			  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+			*readRet = RSSL_RET_READ_WOULD_BLOCK;
+			return NULL;
+		}
+
+		/* do not hold up writers on this channel while we spin or sleep */
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+		/* blocking channels spin until there is something to read, sleeping on the futex after wakeupSpinCount empty reads */
+		if (ring->wakeupType == RSSL_SHMEM_WAKEUP_FUTEX && ++shMemChnl->emptyReads >= shMemChnl->wakeupSpinCount)
+		{
+			shMemChnl->emptyReads = 0;
+			_rsslBiShMemWait(ring, readOffset, shMemChnl->wakeupTimeout);
+		}
+
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+		readOffset = ring->readOffset + shMemChnl->inPendingLen;
+		shMemChnl->inPendingLen = 0;
+	}
+
+	/* if we got here, we read something */
+	shMemChnl->emptyReads = 0;
+
+	if (rtrUnlikely(rec->flags & RSSL_BISHM_REC_PING))
+	{
+		_rsslBiShMemStoreRelease(&ring->readOffset, readOffset + RSSL_BISHM_REC_LEN(rec->length));
+
+		if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+		*readRet = RSSL_RET_READ_PING;
+		return NULL;	/* we read a ping, but we return it as a NULL buffer */
+	}
+
+	/* the record stays in the ring until the next read, so the user reads it in place */
+	_rsslBiShMemStoreRelease(&ring->readOffset, readOffset);
+	shMemChnl->inPendingLen = RSSL_BISHM_REC_LEN(rec->length);
+	remaining = writeOffset - readOffset - shMemChnl->inPendingLen;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	rsslChnlImpl->returnBuffer.length = rec->length;
+	rsslChnlImpl->returnBuffer.data = (char*)rec + sizeof(rsslBiShmRec);
+
+	if (readOutArgs != NULL)
+	{
+		readOutArgs->bytesRead = rec->length;
+		readOutArgs->uncompressedBytesRead = rec->length;
+	}
+
+	if (rtrUnlikely((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_IN) && (rsslChnlImpl->returnBuffer.length )))
+		(*(rsslBiShMemDumpInFunc))(__FUNCTION__, rsslChnlImpl->returnBuffer.data, rsslChnlImpl->returnBuffer.length, rsslChnlImpl->Channel.socketId);
+
+	/* readRet is the number of bytes left to read */
+	*readRet = (remaining > 0x7FFFFFFF) ? 0x7FFFFFFF : (RsslRet)remaining;
+	return &(rsslChnlImpl->returnBuffer);
+}
+
+/* rssl BiShMem Write */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+	rsslBiShmRec *rec = rsslBufImpl->bufferInfo;
+
+	if (rtrUnlikely(!shMemChnl))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWrite() RSSL shared memory transport not available", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* make sure the length they gave us doesnt exceed the space we reserved */
+	if (rtrUnlikely(rsslBufImpl->buffer.length > rsslBufImpl->totalLength))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_TOO_SMALL, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "Buffer too small - %d bytes written into buffer of %d bytes\n", rsslBufImpl->buffer.length, rsslBufImpl->totalLength);
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		return RSSL_RET_BUFFER_TOO_SMALL;
+	}
+
+	if (rtrUnlikely((rsslChnlImpl->debugFlags & RSSL_DEBUG_RSSL_DUMP_OUT) && (rsslBufImpl->buffer.length)))
+		(*(rsslBiShMemDumpOutFunc))(__FUNCTION__, rsslBufImpl->buffer.data, rsslBufImpl->buffer.length, rsslChnlImpl->Channel.socketId);
+
+	writeOutArgs->bytesWritten = rsslBufImpl->buffer.length;
+	writeOutArgs->uncompressedBytesWritten = rsslBufImpl->buffer.length;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	rec->length = rsslBufImpl->buffer.length;
+	rec->flags = 0;
+	_rsslBiShMemPublish(shMemChnl, shMemChnl->outRing->writeOffset + shMemChnl->outPadLen + RSSL_BISHM_REC_LEN(rec->length));
+
+	/* since it was a successful write, free the RsslBuffer */
+	/* remove it from the active buffer list and then add to free buffer list */
+	_rsslCleanBuffer(rsslBufImpl);
+	if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+		rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+
+	rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+	shMemChnl->_hasBuffer = 0;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	/* always return success(0) since there would never be any bytes left to be written */
+	return RSSL_RET_SUCCESS;
+}
+
+
+/* rssl BiShMem GetBuffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslBiShMemGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error)
+{
+	rsslBufferImpl *rsslBufImpl;
+	rsslBiShmRec *rec;
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+
+	if (rtrUnlikely(!shMemChnl))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemGetBuffer failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if (rtrUnlikely(size > rsslChnlImpl->maxMsgSize))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() requested buffer size of %d exceeds the maxMsgSize of %d. Fragmented messages are not supported for shared memory transport.\n", __FILE__, __LINE__, size, rsslChnlImpl->maxMsgSize);
+		return NULL;
+	}
+
+	if (rtrUnlikely(packedBuffer))
+	{
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() packed messages are not supported for shared memory transport.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	if (rtrUnlikely(shMemChnl->_hasBuffer != 0))
+	{
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() Cannot allocate more than one rsslBuffer for shmem connections.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	/* a full ring pushes back on the writer; the reader is never dropped for being slow */
+	if ((rec = _rsslBiShMemReserve(shMemChnl, size)) == NULL)
+	{
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() shared memory ring is full.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	rsslBufImpl = _rsslBiShMemNewBuffer(rsslChnlImpl);
+
+	if (rtrUnlikely(rsslBufImpl == NULL))
+	{
+		/* We didnt get an rsslBuffer */
+		/* nothing was published, so the next rsslGetBuffer will reserve the same space */
+		if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+		  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+		_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_BUFFER_NO_BUFFERS, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslGetBuffer() Cannot allocate more than one rsslBuffer for shmem connections.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	shMemChnl->_hasBuffer = 1;
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	rsslBufImpl->buffer.data = (char*)rec + sizeof(rsslBiShmRec);
+	rsslBufImpl->buffer.length = size;
+	rsslBufImpl->bufferInfo = rec;
+	rsslBufImpl->packingOffset = 0;
+	rsslBufImpl->totalLength = size;
+
+	return rsslBufImpl;
+}
+
+/* rssl BiShMem ReleaseBuffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+
+	if (rtrUnlikely(!shMemChnl))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemReleaseBuffer failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* nothing was published, so the reserved space is simply reused */
+	shMemChnl->_hasBuffer = 0;
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem PackBuffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBiShMemPackBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error)
+{
+	_rsslSetError(error, &rsslChnlImpl->Channel, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslPackBuffer() packed messages currently not supported for shared memory transport.\n", __FILE__, __LINE__);
+
+	return NULL;
+}
+
+/* rssl BiShMem Flush */
+/* Since we are writing directly to memory, we dont need to flush. All written messages are available to read immediately */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem Ping */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemPing(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	rsslBiShmRec *rec;
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+
+	if (rtrUnlikely(!shMemChnl))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemPing failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex);
+
+	/* a buffer in progress or a full ring means the reader already has data coming, so skip the ping */
+	if (!shMemChnl->_hasBuffer && (rec = _rsslBiShMemReserve(shMemChnl, 0)) != NULL)
+	{
+		rec->length = 0;
+		rec->flags = RSSL_BISHM_REC_PING;
+		_rsslBiShMemPublish(shMemChnl, shMemChnl->outRing->writeOffset + shMemChnl->outPadLen + RSSL_BISHM_REC_LEN(0));
+	}
+
+	if (rtrUnlikely(multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL))
+	  (void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem GetChannelInfo */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemGetChannelInfo(rsslChannelImpl *rsslChnlImpl, RsslChannelInfo *info, RsslError *error)
+{
+	RsslInt32 i;
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+
+	if (rtrUnlikely(!shMemChnl))
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemGetChannelInfo failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	info->maxFragmentSize = rsslChnlImpl->maxMsgSize;
+	info->guaranteedOutputBuffers = rsslChnlImpl->maxGuarMsgs;
+	info->maxOutputBuffers = rsslChnlImpl->maxGuarMsgs;
+	info->numInputBuffers = shMemChnl->inRing->size / RSSL_BISHM_REC_LEN(rsslChnlImpl->maxMsgSize);
+	info->tcpRecvBufSize = 0;
+	info->tcpSendBufSize = 0;
+	info->sysRecvBufSize = shMemChnl->inRing->size;
+	info->sysSendBufSize = shMemChnl->outRing->size;
+	info->compressionType = RSSL_COMP_NONE;	/* we dont support compression with shmem connection */
+	info->compressionThreshold = 0;
+	info->pingTimeout = rsslChnlImpl->Channel.pingTimeout;
+
+	if (rsslChnlImpl->rsslFlags & SERVER_TO_CLIENT)
+	{
+		info->serverToClientPings = RSSL_TRUE;
+	}
+	else
+	{
+		info->serverToClientPings = RSSL_FALSE;
+	}
+
+	if (rsslChnlImpl->rsslFlags & CLIENT_TO_SERVER)
+	{
+		info->clientToServerPings = RSSL_TRUE;
+	}
+	else
+	{
+		info->clientToServerPings = RSSL_FALSE;
+	}
+
+	/* get connected component version info here */
+	/* if memory is here, it means user already called get channel info so just reuse it.
+	 * it will be cleaned up when connection is closed */
+	if (!rsslChnlImpl->componentInfo)
+	{
+		rsslChnlImpl->componentInfo = (RsslComponentInfo **)_rsslMalloc(sizeof(void*));
+		rsslChnlImpl->componentInfo[0] = (RsslComponentInfo *)_rsslMalloc(sizeof(RsslComponentInfo));
+	}
+
+	if (shMemChnl->isServer)
+	{
+		rsslChnlImpl->componentInfo[0]->componentVersion.length = shMemChnl->hdr->clientComponentVersionLen;
+		rsslChnlImpl->componentInfo[0]->componentVersion.data = shMemChnl->hdr->clientComponentVersion;
+	}
+	else
+	{
+		rsslChnlImpl->componentInfo[0]->componentVersion.length = shMemChnl->hdr->serverComponentVersionLen;
+		rsslChnlImpl->componentInfo[0]->componentVersion.data = shMemChnl->hdr->serverComponentVersion;
+	}
+
+	info->componentInfoCount = 1;
+	info->componentInfo = rsslChnlImpl->componentInfo;
+
+	/* clear out other fields not used by shmem connection */
+	for (i=0; i < RSSL_RSSL_MAX_FLUSH_STRATEGY; i++)
+	{
+		info->priorityFlushStrategy[i] = 0;
+	}
+
+	info->encryptionProtocol = RSSL_ENC_NONE;
+
+	/* clear other stats types */
+	info->multicastStats.mcastRcvd = 0;
+	info->multicastStats.mcastSent = 0;
+	info->multicastStats.retransPktsRcvd = 0;
+	info->multicastStats.retransPktsSent = 0;
+	info->multicastStats.retransReqRcvd = 0;
+	info->multicastStats.retransReqSent = 0;
+	info->multicastStats.unicastRcvd = 0;
+	info->multicastStats.unicastSent = 0;
+	info->multicastStats.gapsDetected = 0;
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem GetServerInfo */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemGetSrvrInfo(rsslServerImpl *rsslSrvrImpl, RsslServerInfo *info, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = rsslSrvrImpl->transportInfo;
+
+	if (!shMemChnl)
+	{
+		_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemGetSrvrInfo failed due to no shared memory transport.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	info->currentBufferUsage = shMemChnl->_hasBuffer ? 1 : 0;
+	info->peakBufferUsage = 1;		/* shmem has only one rsslBuffer, so the peak cannot be more than that */
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* rssl BiShMem Buffer Usage */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBiShMemBufferUsage(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = _rsslBiShMemGetChannel(rsslChnlImpl);
+
+	if (shMemChnl)
+	{	/* There's only one buffer. Either we have a buffer or we don't */
+		return shMemChnl->_hasBuffer;
+	}
+
+	_rsslSetError(error, 0, RSSL_RET_FAILURE, 0);
+	snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslBiShMemBufferUsage failed due to no shared memory transport.\n", __FILE__, __LINE__);
+	return 0;
+}
+
+/* get info about the shared buffer pool. */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBiShMemSrvrBufferUsage(rsslServerImpl *rsslSrvrImpl, RsslError *error)
+{
+	/* shmem doesnt used a shared buffer pool */
+	return 0;
+}
+
+
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemSrvrIoctl(rsslServerImpl *rsslSrvrImpl, RsslIoctlCodes code, void *value, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemCloseServer(rsslServerImpl *rsslSrvrImpl, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error)
+{
+	return RSSL_RET_SUCCESS;
+}
+
+/* called from _rsslReleaseServer to remove the segment */
+RsslRet rsslBiShMemDestroy(void *transportInfo, RsslError *error)
+{
+	rsslBiShmChannel *shMemChnl = transportInfo;
+
+	if (shMemChnl->hdr)
+	{
+		/* let the client know that the server is shutting down */
+		_rsslBiShMemSetFlags(shMemChnl->hdr, RSSL_BISHM_SERVER_SHUTDOWN);
+		_rsslBiShMemWakeOnClose(shMemChnl);
+	}
+
+	_rsslBiShMemFreeChannel(shMemChnl);
+	return RSSL_RET_SUCCESS;
+}
+
+
+
+/***************************
+ * START PUBLIC ABSTRACTED FUNCTIONS
+ ***************************/
+
+RsslRet rsslBiShMemSetChannelFunctions()
+{
+	RsslTransportChannelFuncs funcs;
+
+	funcs.channelBufferUsage = rsslBiShMemBufferUsage;
+	funcs.channelClose = rsslBiShMemCloseChannel;
+	funcs.channelConnect = rsslBiShMemConnect;
+	funcs.channelFlush = rsslBiShMemFlush;
+	funcs.channelGetBuffer = rsslBiShMemGetBuffer;
+	funcs.channelGetInfo = rsslBiShMemGetChannelInfo;
+	funcs.channelIoctl = rsslBiShMemIoctl;
+	funcs.channelPackBuffer = rsslBiShMemPackBuffer;
+	funcs.channelPing = rsslBiShMemPing;
+	funcs.channelRead = rsslBiShMemRead;
+	funcs.channelReconnect = rsslBiShMemReconnect;
+	funcs.channelReleaseBuffer = rsslBiShMemReleaseBuffer;
+	funcs.channelWrite = rsslBiShMemWrite;
+	funcs.initChannel = rsslBiShMemInitChannel;
+
+	return(rsslSetTransportChannelFunc(RSSL_BIDIRECTION_SHMEM_TRANSPORT,&funcs));
+}
+
+RsslRet rsslBiShMemSetServerFunctions()
+{
+	RsslTransportServerFuncs funcs;
+
+	funcs.serverAccept = rsslBiShMemAccept;
+	funcs.serverBind = rsslBiShMemBind;
+	funcs.serverIoctl = rsslBiShMemSrvrIoctl;
+	funcs.serverGetInfo = rsslBiShMemGetSrvrInfo;
+	funcs.serverBufferUsage = rsslBiShMemSrvrBufferUsage;
+	funcs.closeServer = rsslBiShMemCloseServer;
+
+	return(rsslSetTransportServerFunc(RSSL_BIDIRECTION_SHMEM_TRANSPORT,&funcs));
+}
+
+/* init, uninit, set function pointers */
+RsslRet rsslBiShMemInitialize(RsslLockingTypes lockingType, RsslError *error)
+{
+	rsslBiShMemSetServerFunctions();
+	rsslBiShMemSetChannelFunctions();
+	/* nothing to do for this function for now */
+	return RSSL_RET_SUCCESS;
+}
+
+RsslRet rsslBiShMemUninitialize()
+{
+	/* nothing to do for this function for now */
+
+	return RSSL_RET_SUCCESS;
+}
+
+/* Sets BiShMem debug dump functions */
+RsslRet rsslSetBiShMemDebugFunctions(
+		void(*dumpRsslIn)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+		void(*dumpRsslOut)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+		RsslError *error)
+{
+	RsslRet retVal = 0;
+
+	if ((dumpRsslIn && rsslBiShMemDumpInFunc) || (dumpRsslOut && rsslBiShMemDumpOutFunc))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetDebugFunctions() Cannot set shared memory Rssl dump functions.\n", __FILE__, __LINE__);
+
+		retVal = RSSL_RET_FAILURE;
+	}
+	else
+	{
+		rsslBiShMemDumpInFunc = dumpRsslIn;
+		rsslBiShMemDumpOutFunc = dumpRsslOut;
+		retVal = RSSL_RET_SUCCESS;
+	}
+
+	return retVal;
+}
@@ -0,0 +1,638 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#include "rtr/rsslCapture.h"
+#include "rtr/rsslErrors.h"
+#include "rtr/rsslThread.h"
+#include "rtr/rtratomic.h"
+#include "rtr/rwfNetwork.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef WIN32
+#include <windows.h>
+#define RSSL_CAPTURE_COMPILER_BARRIER() _ReadWriteBarrier()
+#define RSSL_CAPTURE_SLEEP_MS(__ms) Sleep(__ms)
+#else
+#include <time.h>
+#include <unistd.h>
+#define RSSL_CAPTURE_COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#define RSSL_CAPTURE_SLEEP_MS(__ms) usleep((__ms) * 1000)
+#endif
+
+#define RSSL_CAPTURE_MAGIC "RSSLCAP"
+#define RSSL_CAPTURE_VERSION 1
+#define RSSL_CAPTURE_FILE_HEADER_SIZE 8
+#define RSSL_CAPTURE_RECORD_HEADER_SIZE 21	/* length, direction, timestamp, channel id */
+
+#define RSSL_CAPTURE_CELL_SIZE 64
+#define RSSL_CAPTURE_MIN_RING_SIZE (64*1024)
+#define RSSL_CAPTURE_FILE_BUFFER_SIZE (1024*1024)
+
+/* Header of a message in the ring.  It always fits in the first cell of the message. */
+typedef struct
+{
+	RsslUInt32	length;
+	RsslUInt8	direction;
+	RsslUInt64	timestamp;
+	RsslUInt64	channelId;
+} RsslCaptureRecord;
+
+/* RsslCapture
+ * The ring is an array of 64-byte cells, each with a sequence, and a message takes as many cells as its
+ * header and data need.  Producers claim the cells of a message with one compare-and-swap of putPos and
+ * publish it through the sequence of its first cell (sequence == position + 1), while the writer thread
+ * frees cells in order (sequence == position + cellCount).  A producer that finds the last cell of its
+ * claim still in use drops the message rather than wait.  Positions are free-running and compared with
+ * unsigned arithmetic, so they may wrap. */
+typedef struct
+{
+	rtr_atomic_val		*sequences;
+	char				*cells;
+	RsslUInt32			cellCount;
+	RsslUInt32			mask;
+	rtr_atomic_val		putPos;
+	char				pad[64];	/* Keeps producers and the writer thread off each other's cache line */
+	RsslUInt32			getPos;
+
+	FILE				*file;
+	RsslThreadId		threadId;
+	rtr_atomic_val		stopping;
+	rtr_atomic_val		messagesDropped;
+	RsslUInt64			messagesCaptured;
+	RsslUInt64			bytesWritten;
+	RsslBool			writeFailed;
+} RsslCapture;
+
+static RSSL_STATIC_MUTEX_DECL(s_rsslCaptureMutex);
+static void *s_pActiveCapture = NULL;	/* RsslCapture, read by the dump functions without the lock */
+static rtr_atomic_val s_captureCallsInProgress = 0;
+static RsslBool s_captureFuncsSet = RSSL_FALSE;
+static RsslCaptureStats s_lastCaptureStats;
+
+RTR_C_INLINE rtr_atomic_val _rsslCaptureAtomicRead(rtr_atomic_val *pVar)
+{
+	rtr_atomic_val val = *(volatile rtr_atomic_val*)pVar;
+	RSSL_CAPTURE_COMPILER_BARRIER();
+	return val;
+}
+
+/* Nanoseconds since 1 January 1970 UTC. */
+static RsslUInt64 _rsslCaptureWallTime()
+{
+#ifdef WIN32
+	FILETIME fileTime;
+	ULARGE_INTEGER time;
+
+	GetSystemTimeAsFileTime(&fileTime);
+	time.LowPart = fileTime.dwLowDateTime;
+	time.HighPart = fileTime.dwHighDateTime;
+
+	/* FILETIME counts 100ns intervals from 1 January 1601. */
+	return (time.QuadPart - RTR_ULL(116444736000000000)) * 100;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (RsslUInt64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/* Nanoseconds from an arbitrary start, for pacing a replay. */
+static RsslUInt64 _rsslCaptureMonotonicTime()
+{
+#ifdef WIN32
+	static LARGE_INTEGER frequency = { 0 };
+	LARGE_INTEGER counter;
+
+	if (frequency.QuadPart == 0)
+		QueryPerformanceFrequency(&frequency);
+
+	QueryPerformanceCounter(&counter);
+	return (RsslUInt64)((RsslDouble)counter.QuadPart * 1000000000.0 / (RsslDouble)frequency.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (RsslUInt64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+static void _rsslCapturePut(RsslUInt8 direction, char *buffer, RsslUInt32 length, RsslSocket socketId)
+{
+	RsslCapture *pCapture;
+	RsslCaptureRecord record;
+	RsslUInt32 cells, pos, offset, ringSize, firstLength;
+	RsslInt32 diff;
+
+	/* Stop clears the active capture and then waits for this count to reach 0, so a capture
+	 * read after the increment is not freed until the decrement. */
+	RTR_ATOMIC_INCREMENT(s_captureCallsInProgress);
+	pCapture = (RsslCapture*)*(void* volatile*)&s_pActiveCapture;
+
+	if (pCapture == NULL)
+	{
+		RTR_ATOMIC_DECREMENT(s_captureCallsInProgress);
+		return;
+	}
+
+	ringSize = pCapture->cellCount * RSSL_CAPTURE_CELL_SIZE;
+	if (length > ringSize / 2)
+	{
+		RTR_ATOMIC_INCREMENT(pCapture->messagesDropped);
+		RTR_ATOMIC_DECREMENT(s_captureCallsInProgress);
+		return;
+	}
+
+	record.length = length;
+	record.direction = direction;
+	record.timestamp = _rsslCaptureWallTime();
+	record.channelId = (RsslUInt64)socketId;
+
+	cells = (RsslUInt32)((sizeof(RsslCaptureRecord) + length + RSSL_CAPTURE_CELL_SIZE - 1) / RSSL_CAPTURE_CELL_SIZE);
+	pos = (RsslUInt32)_rsslCaptureAtomicRead(&pCapture->putPos);
+
+	for(;;)
+	{
+		/* The writer thread frees cells in order, so the claim is free if its last cell is. */
+		RsslUInt32 lastPos = pos + cells - 1;
+		diff = (RsslInt32)((RsslUInt32)_rsslCaptureAtomicRead(&pCapture->sequences[lastPos & pCapture->mask]) - lastPos);
+
+		if (diff == 0)
+		{
+			rtr_atomic_val prevPos = RTR_ATOMIC_COMPARE_AND_SWAP(pCapture->putPos, (rtr_atomic_val)pos, (rtr_atomic_val)(pos + cells));
+			if ((RsslUInt32)prevPos == pos)
+				break;
+			pos = (RsslUInt32)prevPos;
+		}
+		else if (diff < 0)
+		{
+			/* Ring is full. */
+			RTR_ATOMIC_INCREMENT(pCapture->messagesDropped);
+			RTR_ATOMIC_DECREMENT(s_captureCallsInProgress);
+			return;
+		}
+		else
+			pos = (RsslUInt32)_rsslCaptureAtomicRead(&pCapture->putPos); /* Another producer claimed this position. */
+	}
+
+	offset = (pos & pCapture->mask) * RSSL_CAPTURE_CELL_SIZE;
+	memcpy(pCapture->cells + offset, &record, sizeof(RsslCaptureRecord));
+	offset += sizeof(RsslCaptureRecord);
+
+	firstLength = ringSize - offset;
+	if (length <= firstLength)
+		memcpy(pCapture->cells + offset, buffer, length);
+	else
+	{
+		memcpy(pCapture->cells + offset, buffer, firstLength);
+		memcpy(pCapture->cells, buffer + firstLength, length - firstLength);
+	}
+
+	RTR_ATOMIC_SET(pCapture->sequences[pos & pCapture->mask], (rtr_atomic_val)(pos + 1));
+	RTR_ATOMIC_DECREMENT(s_captureCallsInProgress);
+}
+
+static void _rsslCaptureDumpIn(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId)
+{
+	_rsslCapturePut(RSSL_CAPTURE_DIR_IN, buffer, length, socketId);
+}
+
+static void _rsslCaptureDumpOut(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId)
+{
+	_rsslCapturePut(RSSL_CAPTURE_DIR_OUT, buffer, length, socketId);
+}
+
+/* Writes the published messages in the ring to the file.  Returns the number written. */
+static RsslUInt32 _rsslCaptureDrain(RsslCapture *pCapture)
+{
+	RsslCaptureRecord record;
+	char header[RSSL_CAPTURE_RECORD_HEADER_SIZE];
+	char *position;
+	RsslUInt32 ringSize = pCapture->cellCount * RSSL_CAPTURE_CELL_SIZE;
+	RsslUInt32 pos, offset, firstLength, cells, i;
+	RsslUInt32 count = 0;
+
+	for(;;)
+	{
+		pos = pCapture->getPos;
+		if ((RsslUInt32)_rsslCaptureAtomicRead(&pCapture->sequences[pos & pCapture->mask]) != pos + 1)
+			return count;
+
+		offset = (pos & pCapture->mask) * RSSL_CAPTURE_CELL_SIZE;
+		memcpy(&record, pCapture->cells + offset, sizeof(RsslCaptureRecord));
+		offset += sizeof(RsslCaptureRecord);
+
+		position = header;
+		position += rwfPut32(position, record.length);
+		position += rwfPut8(position, record.direction);
+		position += rwfPut64(position, record.timestamp);
+		position += rwfPut64(position, record.channelId);
+
+		if (!pCapture->writeFailed)
+		{
+			size_t written = fwrite(header, 1, sizeof(header), pCapture->file);
+
+			firstLength = ringSize - offset;
+			if (record.length <= firstLength)
+				written += fwrite(pCapture->cells + offset, 1, record.length, pCapture->file);
+			else
+			{
+				written += fwrite(pCapture->cells + offset, 1, firstLength, pCapture->file);
+				written += fwrite(pCapture->cells, 1, record.length - firstLength, pCapture->file);
+			}
+
+			if (written != sizeof(header) + record.length)
+				pCapture->writeFailed = RSSL_TRUE;
+
+			pCapture->bytesWritten += written;
+			++pCapture->messagesCaptured;
+		}
+		else
+			RTR_ATOMIC_INCREMENT(pCapture->messagesDropped);
+
+		/* Free the cells for the next lap.  Each is set with a barrier, as a producer may check any of them. */
+		cells = (RsslUInt32)((sizeof(RsslCaptureRecord) + record.length + RSSL_CAPTURE_CELL_SIZE - 1) / RSSL_CAPTURE_CELL_SIZE);
+		for (i = 0; i < cells; ++i)
+			RTR_ATOMIC_SET(pCapture->sequences[(pos + i) & pCapture->mask], (rtr_atomic_val)(pos + i + pCapture->cellCount));
+
+		pCapture->getPos = pos + cells;
+		++count;
+	}
+}
+
+static RSSL_THREAD_DECLARE(_rsslCaptureThread, pArg)
+{
+	RsslCapture *pCapture = (RsslCapture*)pArg;
+	rtr_atomic_val stopping;
+
+	for(;;)
+	{
+		/* Producers have finished before stopping is set, so a drain after seeing it gets everything. */
+		stopping = _rsslCaptureAtomicRead(&pCapture->stopping);
+
+		if (_rsslCaptureDrain(pCapture) == 0)
+		{
+			if (stopping)
+				break;
+
+			if (!pCapture->writeFailed)
+				fflush(pCapture->file);
+			RSSL_CAPTURE_SLEEP_MS(1);
+		}
+	}
+
+	return RSSL_THREAD_RETURN();
+}
+
+static void _rsslCaptureFree(RsslCapture *pCapture)
+{
+	if (pCapture->file)
+		fclose(pCapture->file);
+	free(pCapture->sequences);
+	free(pCapture->cells);
+	free(pCapture);
+}
+
+RSSL_API RsslRet rsslCaptureStart(RsslCaptureOpts *pOpts, RsslError *error)
+{
+	RsslCapture *pCapture;
+	RsslUInt32 ringSize, i;
+	char fileHeader[RSSL_CAPTURE_FILE_HEADER_SIZE];
+
+	if (pOpts == NULL || pOpts->fileName == NULL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_INVALID_ARGUMENT, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStart() No capture file name.\n", __FILE__, __LINE__);
+		return RSSL_RET_INVALID_ARGUMENT;
+	}
+
+	for (ringSize = RSSL_CAPTURE_MIN_RING_SIZE; ringSize < pOpts->ringSize && ringSize < 0x80000000; ringSize <<= 1);
+
+	RSSL_STATIC_MUTEX_LOCK(s_rsslCaptureMutex);
+
+	if (s_pActiveCapture != NULL)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStart() A capture is already running.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* The dump functions stay set after the capture stops, and do nothing until the next one starts. */
+	if (!s_captureFuncsSet)
+	{
+		if (rsslSetDebugFunctions(NULL, NULL, _rsslCaptureDumpIn, _rsslCaptureDumpOut, error) < RSSL_RET_SUCCESS)
+		{
+			RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+			return RSSL_RET_FAILURE;
+		}
+		s_captureFuncsSet = RSSL_TRUE;
+	}
+
+	if ((pCapture = (RsslCapture*)calloc(1, sizeof(RsslCapture))) == NULL
+			|| (pCapture->cells = (char*)malloc(ringSize)) == NULL
+			|| (pCapture->sequences = (rtr_atomic_val*)malloc((ringSize / RSSL_CAPTURE_CELL_SIZE) * sizeof(rtr_atomic_val))) == NULL)
+	{
+		if (pCapture)
+			_rsslCaptureFree(pCapture);
+		RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStart() Failed to allocate capture ring.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	pCapture->cellCount = ringSize / RSSL_CAPTURE_CELL_SIZE;
+	pCapture->mask = pCapture->cellCount - 1;
+	for (i = 0; i < pCapture->cellCount; ++i)
+		pCapture->sequences[i] = (rtr_atomic_val)i;
+
+	/* Touch the ring now rather than fault its pages in while capturing. */
+	memset(pCapture->cells, 0, ringSize);
+
+	if ((pCapture->file = fopen(pOpts->fileName, "wb")) == NULL)
+	{
+		int err = errno;
+
+		_rsslCaptureFree(pCapture);
+		RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, err);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStart() Failed to open capture file %s.\n", __FILE__, __LINE__, pOpts->fileName);
+		return RSSL_RET_FAILURE;
+	}
+
+	setvbuf(pCapture->file, NULL, _IOFBF, RSSL_CAPTURE_FILE_BUFFER_SIZE);
+
+	memcpy(fileHeader, RSSL_CAPTURE_MAGIC, RSSL_CAPTURE_FILE_HEADER_SIZE - 1);
+	fileHeader[RSSL_CAPTURE_FILE_HEADER_SIZE - 1] = RSSL_CAPTURE_VERSION;
+	if (fwrite(fileHeader, 1, RSSL_CAPTURE_FILE_HEADER_SIZE, pCapture->file) != RSSL_CAPTURE_FILE_HEADER_SIZE)
+		pCapture->writeFailed = RSSL_TRUE;
+	else
+		pCapture->bytesWritten = RSSL_CAPTURE_FILE_HEADER_SIZE;
+
+	if (RSSL_THREAD_START(&pCapture->threadId, _rsslCaptureThread, pCapture) < 0)
+	{
+		_rsslCaptureFree(pCapture);
+		RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStart() Failed to start capture thread.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	(void)RTR_ATOMIC_COMPARE_AND_SWAPPTR(s_pActiveCapture, NULL, pCapture);
+
+	RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+	return RSSL_RET_SUCCESS;
+}
+
+RSSL_API RsslRet rsslCaptureStop(RsslError *error)
+{
+	RsslCapture *pCapture;
+	RsslRet ret = RSSL_RET_SUCCESS;
+
+	RSSL_STATIC_MUTEX_LOCK(s_rsslCaptureMutex);
+
+	if ((pCapture = (RsslCapture*)s_pActiveCapture) == NULL)
+	{
+		RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStop() No capture is running.\n", __FILE__, __LINE__);
+		return RSSL_RET_FAILURE;
+	}
+
+	/* Once no dump function is using the capture, none will, and the writer thread can finish. */
+	(void)RTR_ATOMIC_COMPARE_AND_SWAPPTR(s_pActiveCapture, pCapture, NULL);
+	while (_rsslCaptureAtomicRead(&s_captureCallsInProgress) != 0)
+		RSSL_CAPTURE_SLEEP_MS(0);
+
+	RTR_ATOMIC_SET(pCapture->stopping, 1);
+	RSSL_THREAD_JOIN(pCapture->threadId);
+
+	if (fflush(pCapture->file) != 0)
+		pCapture->writeFailed = RSSL_TRUE;
+
+	s_lastCaptureStats.messagesCaptured = pCapture->messagesCaptured;
+	s_lastCaptureStats.messagesDropped = (RsslUInt32)pCapture->messagesDropped;
+	s_lastCaptureStats.bytesWritten = pCapture->bytesWritten;
+
+	if (pCapture->writeFailed)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureStop() Failed to write capture file.\n", __FILE__, __LINE__);
+		ret = RSSL_RET_FAILURE;
+	}
+
+	_rsslCaptureFree(pCapture);
+
+	RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+	return ret;
+}
+
+RSSL_API void rsslCaptureGetStats(RsslCaptureStats *pStats)
+{
+	RsslCapture *pCapture;
+
+	RSSL_STATIC_MUTEX_LOCK(s_rsslCaptureMutex);
+
+	if ((pCapture = (RsslCapture*)s_pActiveCapture) != NULL)
+	{
+		/* Counters of the writer thread may be a message behind. */
+		pStats->messagesCaptured = *(volatile RsslUInt64*)&pCapture->messagesCaptured;
+		pStats->messagesDropped = (RsslUInt32)_rsslCaptureAtomicRead(&pCapture->messagesDropped);
+		pStats->bytesWritten = *(volatile RsslUInt64*)&pCapture->bytesWritten;
+	}
+	else
+		*pStats = s_lastCaptureStats;
+
+	RSSL_STATIC_MUTEX_UNLOCK(s_rsslCaptureMutex);
+}
+
+struct RsslCaptureReplay
+{
+	FILE				*file;
+	RsslUInt8			direction;
+	RsslUInt64			channelId;
+	RsslDouble			speed;
+
+	char				*data;			/* Next message to write */
+	RsslUInt32			dataSize;
+	RsslUInt32			length;
+	RsslUInt64			timestamp;
+	RsslBool			haveMessage;
+
+	RsslBool			started;
+	RsslUInt64			firstTimestamp;
+	RsslUInt64			startTime;
+
+	RsslBuffer			*pPendingBuffer;	/* Message that rsslWrite asked to be written again */
+};
+
+/* Reads the next message to replay.  Returns RSSL_TRUE if one was read, or RSSL_FALSE at the end of the
+ * file, including a last message cut short by a process that stopped while capturing. */
+static RsslBool _rsslCaptureReplayRead(RsslCaptureReplay *pReplay)
+{
+	char header[RSSL_CAPTURE_RECORD_HEADER_SIZE];
+	char *position;
+	RsslUInt8 direction;
+	RsslUInt64 channelId;
+
+	pReplay->haveMessage = RSSL_FALSE;
+
+	while (fread(header, 1, sizeof(header), pReplay->file) == sizeof(header))
+	{
+		position = header;
+		position += rwfGet32(pReplay->length, position);
+		position += rwfGet8(direction, position);
+		position += rwfGet64(pReplay->timestamp, position);
+		position += rwfGet64(channelId, position);
+
+		if (direction != pReplay->direction || (pReplay->channelId != 0 && channelId != pReplay->channelId))
+		{
+			if (fseek(pReplay->file, pReplay->length, SEEK_CUR) != 0)
+				return RSSL_FALSE;
+			continue;
+		}
+
+		if (pReplay->length > pReplay->dataSize)
+		{
+			char *data = (char*)realloc(pReplay->data, pReplay->length);
+
+			if (data == NULL)
+				return RSSL_FALSE;
+			pReplay->data = data;
+			pReplay->dataSize = pReplay->length;
+		}
+
+		if (fread(pReplay->data, 1, pReplay->length, pReplay->file) != pReplay->length)
+			return RSSL_FALSE;
+
+		pReplay->haveMessage = RSSL_TRUE;
+		return RSSL_TRUE;
+	}
+
+	return RSSL_FALSE;
+}
+
+RSSL_API RsslCaptureReplay *rsslCaptureReplayOpen(RsslCaptureReplayOpts *pOpts, RsslError *error)
+{
+	RsslCaptureReplay *pReplay;
+	char fileHeader[RSSL_CAPTURE_FILE_HEADER_SIZE];
+
+	if (pOpts == NULL || pOpts->fileName == NULL || pOpts->speed < 0)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_INVALID_ARGUMENT, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureReplayOpen() Invalid replay options.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if ((pReplay = (RsslCaptureReplay*)calloc(1, sizeof(RsslCaptureReplay))) == NULL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureReplayOpen() Failed to allocate replay.\n", __FILE__, __LINE__);
+		return NULL;
+	}
+
+	if ((pReplay->file = fopen(pOpts->fileName, "rb")) == NULL)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureReplayOpen() Failed to open capture file %s.\n", __FILE__, __LINE__, pOpts->fileName);
+		free(pReplay);
+		return NULL;
+	}
+
+	if (fread(fileHeader, 1, RSSL_CAPTURE_FILE_HEADER_SIZE, pReplay->file) != RSSL_CAPTURE_FILE_HEADER_SIZE
+			|| memcmp(fileHeader, RSSL_CAPTURE_MAGIC, RSSL_CAPTURE_FILE_HEADER_SIZE - 1) != 0
+			|| fileHeader[RSSL_CAPTURE_FILE_HEADER_SIZE - 1] != RSSL_CAPTURE_VERSION)
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslCaptureReplayOpen() %s is not a capture file.\n", __FILE__, __LINE__, pOpts->fileName);
+		rsslCaptureReplayClose(pReplay, NULL);
+		return NULL;
+	}
+
+	pReplay->direction = pOpts->direction;
+	pReplay->channelId = pOpts->channelId;
+	pReplay->speed = pOpts->speed;
+
+	_rsslCaptureReplayRead(pReplay);
+	pReplay->firstTimestamp = pReplay->timestamp;
+	return pReplay;
+}
+
+RSSL_API RsslRet rsslCaptureReplayDispatch(RsslCaptureReplay *pReplay, RsslChannel *chnl, RsslCaptureReplayInfo *pInfo, RsslError *error)
+{
+	RsslUInt32 bytesWritten, uncompBytesWritten;
+	RsslUInt64 elapsed, due;
+	RsslRet ret;
+
+	pInfo->messagesWritten = 0;
+	pInfo->waitTime = 0;
+
+	if (!pReplay->started)
+	{
+		pReplay->startTime = _rsslCaptureMonotonicTime();
+		pReplay->started = RSSL_TRUE;
+	}
+
+	for(;;)
+	{
+		if (pReplay->pPendingBuffer)
+		{
+			ret = rsslWrite(chnl, pReplay->pPendingBuffer, RSSL_MEDIUM_PRIORITY, 0, &bytesWritten, &uncompBytesWritten, error);
+
+			if (ret == RSSL_RET_WRITE_CALL_AGAIN)
+				return 1;
+
+			/* RSSL_RET_WRITE_FLUSH_FAILED still takes the buffer. */
+			if (ret < RSSL_RET_SUCCESS && ret != RSSL_RET_WRITE_FLUSH_FAILED)
+				return ret;
+
+			pReplay->pPendingBuffer = NULL;
+			++pInfo->messagesWritten;
+		}
+
+		if (!pReplay->haveMessage)
+			return 0;
+
+		if (pReplay->speed > 0 && pReplay->timestamp > pReplay->firstTimestamp)
+		{
+			due = (RsslUInt64)((RsslDouble)(pReplay->timestamp - pReplay->firstTimestamp) / pReplay->speed);
+			elapsed = _rsslCaptureMonotonicTime() - pReplay->startTime;
+
+			if (due > elapsed)
+			{
+				pInfo->waitTime = (RsslUInt32)((due - elapsed + 999) / 1000);
+				return 1;
+			}
+		}
+
+		if ((pReplay->pPendingBuffer = rsslGetBuffer(chnl, pReplay->length, RSSL_FALSE, error)) == NULL)
+			return (error->rsslErrorId == RSSL_RET_BUFFER_NO_BUFFERS) ? 1 : error->rsslErrorId;
+
+		memcpy(pReplay->pPendingBuffer->data, pReplay->data, pReplay->length);
+		pReplay->pPendingBuffer->length = pReplay->length;
+
+		_rsslCaptureReplayRead(pReplay);
+	}
+}
+
+RSSL_API void rsslCaptureReplayClose(RsslCaptureReplay *pReplay, RsslChannel *chnl)
+{
+	RsslError error;
+
+	if (pReplay->pPendingBuffer && chnl)
+		rsslReleaseBuffer(pReplay->pPendingBuffer, &error);
+
+	if (pReplay->file)
+		fclose(pReplay->file);
+	free(pReplay->data);
+	free(pReplay);
+}
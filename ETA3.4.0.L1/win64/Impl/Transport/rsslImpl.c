@@ -10,6 +10,7 @@
 #include "rtr/rsslSocketTransport.h"
 #include "rtr/intDataTypes.h"
 #include "rtr/rsslUniShMemTransport.h"
+#include "rtr/rsslBiShMemTransport.h"
 #include "rtr/rsslSeqMcastTransport.h"
 #include "rtr/rsslQueue.h"
 
@@ -42,6 +43,7 @@
 #include "rtr/rsslSeqMcastTransportImpl.h"
 #include "rtr/rsslSocketTransportImpl.h"
 #include "rtr/rsslUniShMemTransportImpl.h"
+#include "rtr/rsslBiShMemTransportImpl.h"
 #include "rtr/rsslLoadInitTransport.h"
 
 /* globals */
@@ -345,6 +347,10 @@ void RTR_FASTCALL _rsslReleaseServer(rsslServerImpl *srvr)
 			/* the variables will be set to null in CleanServer */
 			rtrShmTransDestroy(srvr->transportInfo, &error);
 		}
+		else if (srvr->connectionType == RSSL_CONN_TYPE_BIDIR_SHMEM)
+		{
+			rsslBiShMemDestroy(srvr->transportInfo, &error);
+		}
 		else 
 		{	/* This is used to release all socket connection types */
 			ipcShutdownServer(srvr->transportInfo, &error);
@@ -740,6 +746,15 @@ RsslRet rsslInitializeEx(RsslInitializeExOpts *rsslInitOpts, RsslError *error)
 			return retVal;
 		}
 
+		/* initialize bidirectional shmem transport */
+		retVal = rsslBiShMemInitialize(rsslInitOpts->rsslLocking, error);
+
+		if (retVal < RSSL_RET_SUCCESS)
+		{
+			mutexFuncs.staticMutexUnlock();	
+			return retVal;
+		}
+
 		/* initialize SeqMcast transport */
 		retVal = rsslSeqMcastInitialize(rsslInitOpts->rsslLocking, error);
 
@@ -822,6 +837,13 @@ RsslRet rsslSetDebugFunctions(
 			retVal = RSSL_RET_FAILURE;
 		}
 
+		if(rsslSetBiShMemDebugFunctions(dumpRsslIn, dumpRsslOut, error) < RSSL_RET_SUCCESS)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSetBiShMemDebugFunctions() Cannot set Rssl shared memory dump functions.\n", __FILE__, __LINE__);
+			retVal = RSSL_RET_FAILURE;
+		}
+
 		if (rsslSetSeqMcastDebugFunctions(dumpRsslIn, dumpRsslOut, error) < RSSL_RET_SUCCESS)
 		{
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
@@ -942,6 +964,12 @@ RsslServer* rsslBind(RsslBindOptions *opts, RsslError *error)
 			rsslSrvrImpl->channelFuncs = &(channelTransFuncs[RSSL_UNIDIRECTION_SHMEM_TRANSPORT]);
 		}
 		break;
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+		{
+			rsslSrvrImpl->serverFuncs = &(serverTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+			rsslSrvrImpl->channelFuncs = &(channelTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+		}
+		break;
 		case RSSL_CONN_TYPE_RELIABLE_MCAST:
 		{
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
@@ -1114,6 +1142,9 @@ RsslChannel* rsslConnect(RsslConnectOptions *opts, RsslError *error)
 		case RSSL_CONN_TYPE_UNIDIR_SHMEM:
 			rsslChnlImpl->channelFuncs = &(channelTransFuncs[RSSL_UNIDIRECTION_SHMEM_TRANSPORT]);
 		break;
+		case RSSL_CONN_TYPE_BIDIR_SHMEM:
+			rsslChnlImpl->channelFuncs = &(channelTransFuncs[RSSL_BIDIRECTION_SHMEM_TRANSPORT]);
+		break;
 
 	    case RSSL_CONN_TYPE_RELIABLE_MCAST:
 		{
@@ -1643,6 +1674,45 @@ RSSL_API RsslBuffer* rsslReadEx(RsslChannel *chnl, RsslReadInArgs *readInArgs, R
 	return retBuf;
 }
 
+/* stage an io_uring read; only socket channels using RSSL_SOCKET_IO_URING do anything */
+RSSL_API RsslRet rsslPrepareRead(RsslChannel *chnl, RsslError *error)
+{
+	rsslChannelImpl *rsslChnlImpl=0;
+
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, chnl, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslPrepareRead() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	if (rtrUnlikely(RSSL_NULL_PTR(chnl, "rsslPrepareRead", "chnl", error)))
+		return RSSL_RET_FAILURE;
+
+	if (chnl->state != RSSL_CH_STATE_ACTIVE)
+		return 0;
+
+	rsslChnlImpl = (rsslChannelImpl*)chnl;
+
+	if (rsslChnlImpl->channelFuncs != &(channelTransFuncs[RSSL_SOCKET_TRANSPORT]))
+		return 0;
+
+	return rsslSocketPrepareRead(rsslChnlImpl, error);
+}
+
+/* perform staged io_uring reads and queued writes in one system call */
+RSSL_API RsslRet rsslSubmitIo(RsslError *error)
+{
+	if (rtrUnlikely(!initialized))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_INIT_NOT_INITIALIZED, 0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslSubmitIo() Error: 0001 RSSL not initialized.\n", __FILE__, __LINE__);
+		return RSSL_RET_INIT_NOT_INITIALIZED;
+	}
+
+	return rsslSocketSubmitIo(error);
+}
+
 /* Write */
 RsslRet rsslWrite(RsslChannel *chnl, RsslBuffer *buffer, RsslWritePriorities rsslPriority, RsslUInt8 writeFlags, RsslUInt32 *bytesWritten, RsslUInt32 *uncompressedBytesWritten, RsslError *error)
 {
@@ -1956,6 +2026,9 @@ RsslRet rsslGetChannelInfo(RsslChannel *chnl, RsslChannelInfo *info, RsslError *
 
 	rsslChnlImpl = (rsslChannelImpl*)chnl;
 
+	/* only transports doing adaptive compression fill this in */
+	memset(&info->adaptiveCompression, 0, sizeof(RsslAdaptiveCompInfo));
+
 	return ((*(rsslChnlImpl->channelFuncs->channelGetInfo))(rsslChnlImpl, info, error));
 }
 
@@ -2066,6 +2139,7 @@ RsslRet rsslUninitialize()
 		/* uninitialize various transports */
 		rsslSocketUninitialize();
 		rsslUniShMemUninitialize();
+		rsslBiShMemUninitialize();
 
 		/* Unset the flag here as it is needed by rsslSocketUninitialize()*/
 		multiThread = 0;
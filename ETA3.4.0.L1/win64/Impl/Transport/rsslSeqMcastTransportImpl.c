@@ -6,6 +6,10 @@
  *|-----------------------------------------------------------------------------
  */
 
+#if defined(Linux) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE		/* for recvmmsg() and sendmmsg() */
+#endif
+
 #include "rtr/rsslSeqMcastTransportImpl.h"
 #include "rtr/rsslSeqMcastTransport.h"
 #include "rtr/rsslAlloc.h"
@@ -84,6 +88,14 @@
 /* Ping length is the total number of bytes in the header, minus the message length. */
 #define SEQ_MCAST_PING_LEN 12
 
+/* Largest number of datagrams that can be staged by one batched read or write */
+#define SEQ_MCAST_MAX_BATCH_SIZE 1024
+
+#if defined(Linux)
+/* recvmmsg() and sendmmsg() are available, so datagrams can be read and written in batches */
+#define SEQ_MCAST_MMSG
+#endif
+
 typedef struct
 {
 	RsslMutex			lock;
@@ -107,6 +119,22 @@ typedef struct
 	struct sockaddr_in	sendAddr;
 	struct sockaddr_in	recvAddr;
 	rtrSeqMcastBuffer	writeBuffer;
+	RsslUInt32			slotSize;					/* Size of each datagram buffer in bufferMem and inputBufferMem */
+	RsslUInt32			readBatchSize;				/* Maximum datagrams received per recvmmsg(). 1 when not batching. */
+	RsslUInt32			writeBatchSize;				/* Maximum datagrams sent per sendmmsg(). 1 when not batching. */
+#ifdef SEQ_MCAST_MMSG
+	struct mmsghdr		*readMsgs;					/* Datagrams received by the last recvmmsg() */
+	struct iovec		*readIov;
+	struct sockaddr_in	*readSrcAddrs;
+	RsslUInt32			readBatchCount;				/* Number of datagrams received by the last recvmmsg() */
+	RsslUInt32			readBatchIndex;				/* Next received datagram to process */
+	RsslUInt32			readBatchBytes;				/* Bytes in received datagrams not yet processed */
+	struct mmsghdr		*writeMsgs;					/* Datagrams staged by rsslWrite() for the next sendmmsg() */
+	struct iovec		*writeIov;
+	RsslUInt32			writeBatchHead;				/* First staged datagram that has not been sent */
+	RsslUInt32			writeBatchCount;			/* Number of staged datagrams, including those already sent by a partial sendmmsg() */
+	RsslUInt32			writeBatchBytes;			/* Bytes in staged datagrams not yet sent */
+#endif
 } RsslSeqMcastChannel;
 
 
@@ -114,6 +142,139 @@ typedef struct
 static void(*rsslSeqMcastDumpInFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
 static void(*rsslSeqMcastDumpOutFunc)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId) = 0;
 
+/* Frees the channel's buffer memory and batching structures */
+static void rsslSeqMcastFreeChannelMem(RsslSeqMcastChannel *pSeqMcastChannel)
+{
+	_rsslFree(pSeqMcastChannel->bufferMem);
+	pSeqMcastChannel->bufferMem = 0;
+	_rsslFree(pSeqMcastChannel->inputBufferMem);
+	pSeqMcastChannel->inputBufferMem = 0;
+#ifdef SEQ_MCAST_MMSG
+	_rsslFree(pSeqMcastChannel->readMsgs);
+	pSeqMcastChannel->readMsgs = 0;
+	_rsslFree(pSeqMcastChannel->readIov);
+	pSeqMcastChannel->readIov = 0;
+	_rsslFree(pSeqMcastChannel->readSrcAddrs);
+	pSeqMcastChannel->readSrcAddrs = 0;
+	_rsslFree(pSeqMcastChannel->writeMsgs);
+	pSeqMcastChannel->writeMsgs = 0;
+	_rsslFree(pSeqMcastChannel->writeIov);
+	pSeqMcastChannel->writeIov = 0;
+#endif
+}
+
+#ifdef SEQ_MCAST_MMSG
+/* Sets up the recvmmsg() and sendmmsg() structures over the channel's datagram buffers.
+ * Returns RSSL_FALSE if memory could not be allocated. */
+static RsslBool rsslSeqMcastInitBatches(RsslSeqMcastChannel *pSeqMcastChannel)
+{
+	RsslUInt32 i;
+
+	if (pSeqMcastChannel->readBatchSize > 1)
+	{
+		pSeqMcastChannel->readMsgs = (struct mmsghdr*)_rsslMalloc(pSeqMcastChannel->readBatchSize * sizeof(struct mmsghdr));
+		pSeqMcastChannel->readIov = (struct iovec*)_rsslMalloc(pSeqMcastChannel->readBatchSize * sizeof(struct iovec));
+		pSeqMcastChannel->readSrcAddrs = (struct sockaddr_in*)_rsslMalloc(pSeqMcastChannel->readBatchSize * sizeof(struct sockaddr_in));
+		if (!pSeqMcastChannel->readMsgs || !pSeqMcastChannel->readIov || !pSeqMcastChannel->readSrcAddrs)
+			return RSSL_FALSE;
+
+		memset(pSeqMcastChannel->readMsgs, 0, pSeqMcastChannel->readBatchSize * sizeof(struct mmsghdr));
+		for (i = 0; i < pSeqMcastChannel->readBatchSize; ++i)
+		{
+			pSeqMcastChannel->readIov[i].iov_base = pSeqMcastChannel->inputBufferMem + i * pSeqMcastChannel->slotSize;
+			pSeqMcastChannel->readIov[i].iov_len = pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN;
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_iov = &pSeqMcastChannel->readIov[i];
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_iovlen = 1;
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_name = &pSeqMcastChannel->readSrcAddrs[i];
+		}
+	}
+
+	if (pSeqMcastChannel->writeBatchSize > 1)
+	{
+		pSeqMcastChannel->writeMsgs = (struct mmsghdr*)_rsslMalloc(pSeqMcastChannel->writeBatchSize * sizeof(struct mmsghdr));
+		pSeqMcastChannel->writeIov = (struct iovec*)_rsslMalloc(pSeqMcastChannel->writeBatchSize * sizeof(struct iovec));
+		if (!pSeqMcastChannel->writeMsgs || !pSeqMcastChannel->writeIov)
+			return RSSL_FALSE;
+
+		memset(pSeqMcastChannel->writeMsgs, 0, pSeqMcastChannel->writeBatchSize * sizeof(struct mmsghdr));
+		for (i = 0; i < pSeqMcastChannel->writeBatchSize; ++i)
+		{
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_iov = &pSeqMcastChannel->writeIov[i];
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_iovlen = 1;
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_name = &pSeqMcastChannel->sendAddr;
+			pSeqMcastChannel->writeMsgs[i].msg_hdr.msg_namelen = sizeof(pSeqMcastChannel->sendAddr);
+		}
+	}
+
+	return RSSL_TRUE;
+}
+
+/* Returns the next received datagram, calling recvmmsg() when all previously received datagrams have been processed.
+ * Returns the datagram length, or -1 with errno set by recvmmsg(). */
+static RsslInt32 rsslSeqMcastRecvBatched(RsslSeqMcastChannel *pSeqMcastChannel, RsslSocket socketId, struct sockaddr_in *srcAddr)
+{
+	RsslUInt32 i;
+	RsslInt32 cc;
+
+	if (pSeqMcastChannel->readBatchIndex == pSeqMcastChannel->readBatchCount)
+	{
+		int ret;
+
+		for (i = 0; i < pSeqMcastChannel->readBatchSize; ++i)
+			pSeqMcastChannel->readMsgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+
+		/* MSG_WAITFORONE: only the first datagram may block, so a blocking channel returns as soon as anything arrives */
+		if ((ret = recvmmsg(socketId, pSeqMcastChannel->readMsgs, pSeqMcastChannel->readBatchSize, MSG_WAITFORONE, NULL)) < 0)
+			return -1;
+
+		pSeqMcastChannel->readBatchCount = (RsslUInt32)ret;
+		pSeqMcastChannel->readBatchIndex = 0;
+		pSeqMcastChannel->readBatchBytes = 0;
+		for (i = 0; i < pSeqMcastChannel->readBatchCount; ++i)
+			pSeqMcastChannel->readBatchBytes += pSeqMcastChannel->readMsgs[i].msg_len;
+	}
+
+	i = pSeqMcastChannel->readBatchIndex++;
+	cc = (RsslInt32)pSeqMcastChannel->readMsgs[i].msg_len;
+	pSeqMcastChannel->readBatchBytes -= cc;
+	pSeqMcastChannel->inputBuffer.data = (char*)pSeqMcastChannel->readIov[i].iov_base;
+	*srcAddr = pSeqMcastChannel->readSrcAddrs[i];
+
+	return cc;
+}
+
+/* Sends staged datagrams with sendmmsg().  Returns the number of bytes still staged, 
+ * or -1 with errno set by sendmmsg() on a failure other than EAGAIN. */
+static RsslInt32 rsslSeqMcastSendBatched(RsslSeqMcastChannel *pSeqMcastChannel, RsslSocket socketId)
+{
+	int ret;
+	RsslUInt32 i;
+
+	while (pSeqMcastChannel->writeBatchHead < pSeqMcastChannel->writeBatchCount)
+	{
+		if ((ret = sendmmsg(socketId, &pSeqMcastChannel->writeMsgs[pSeqMcastChannel->writeBatchHead], 
+						pSeqMcastChannel->writeBatchCount - pSeqMcastChannel->writeBatchHead, 0)) < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			if (errno == EWOULDBLOCK || errno == EAGAIN)
+				return pSeqMcastChannel->writeBatchBytes;
+			return -1;
+		}
+
+		for (i = pSeqMcastChannel->writeBatchHead; i < pSeqMcastChannel->writeBatchHead + (RsslUInt32)ret; ++i)
+			pSeqMcastChannel->writeBatchBytes -= (RsslUInt32)pSeqMcastChannel->writeIov[i].iov_len;
+		pSeqMcastChannel->pktSentCount += ret;
+		pSeqMcastChannel->writeBatchHead += ret;
+	}
+
+	pSeqMcastChannel->writeBatchHead = 0;
+	pSeqMcastChannel->writeBatchCount = 0;
+	pSeqMcastChannel->writeBatchBytes = 0;
+	return 0;
+}
+#endif
+
 /* lock information */
 static RsslBool chnlLocking;
 
@@ -240,6 +401,12 @@ RsslRet rsslSeqMcastCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error
 	if (chnlLocking)
 		seqMcastGetLock(&pSeqMcastChannel->lock);
 
+#ifdef SEQ_MCAST_MMSG
+	/* Best effort to send anything still staged */
+	if (pSeqMcastChannel->writeBatchCount)
+		rsslSeqMcastSendBatched(pSeqMcastChannel, rsslChnlImpl->Channel.socketId);
+#endif
+
 	sock_close(rsslChnlImpl->Channel.socketId);
 
 	rsslChnlImpl->Channel.state = RSSL_CH_STATE_INACTIVE;
@@ -253,10 +420,7 @@ RsslRet rsslSeqMcastCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error
 		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), pLink);
 	}
 
-	_rsslFree(pSeqMcastChannel->bufferMem);
-	pSeqMcastChannel->bufferMem = 0;
-	_rsslFree(pSeqMcastChannel->inputBufferMem);
-	pSeqMcastChannel->inputBufferMem = 0;
+	rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 	if (chnlLocking)
 		seqMcastUnlock(&pSeqMcastChannel->lock);
 	if (chnlLocking)
@@ -289,6 +453,8 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 		return RSSL_RET_FAILURE;
 	}
 	
+	memset(pSeqMcastChannel, 0, sizeof(RsslSeqMcastChannel));
+
 	if (chnlLocking)
 		seqMcastInitLock(&pSeqMcastChannel->lock);
 
@@ -297,15 +463,25 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	else
 		pSeqMcastChannel->maxMsgSize = opts->seqMulticastOpts.maxMsgSize;
 
-	/* Add 7 to avoid any full word byte swap issues at the end of the buffer */
-	if (!(pSeqMcastChannel->bufferMem = (char*)_rsslMalloc(opts->seqMulticastOpts.maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7)))
+	/* Add 7 to avoid any full word byte swap issues at the end of the buffer. Round up so each batched datagram is aligned. */
+	pSeqMcastChannel->slotSize = (pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7 + 7) & ~7;
+	pSeqMcastChannel->readBatchSize = 1;
+	pSeqMcastChannel->writeBatchSize = 1;
+#ifdef SEQ_MCAST_MMSG
+	if (opts->seqMulticastOpts.readBatchSize > 1)
+		pSeqMcastChannel->readBatchSize = (opts->seqMulticastOpts.readBatchSize > SEQ_MCAST_MAX_BATCH_SIZE) ? SEQ_MCAST_MAX_BATCH_SIZE : opts->seqMulticastOpts.readBatchSize;
+	if (opts->seqMulticastOpts.writeBatchSize > 1)
+		pSeqMcastChannel->writeBatchSize = (opts->seqMulticastOpts.writeBatchSize > SEQ_MCAST_MAX_BATCH_SIZE) ? SEQ_MCAST_MAX_BATCH_SIZE : opts->seqMulticastOpts.writeBatchSize;
+#endif
+
+	if (!(pSeqMcastChannel->bufferMem = (char*)_rsslMalloc(pSeqMcastChannel->slotSize * pSeqMcastChannel->writeBatchSize)))
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast output buffer.\n", __FILE__, __LINE__);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
-	if (!(pSeqMcastChannel->inputBufferMem = (char*)_rsslMalloc(opts->seqMulticastOpts.maxMsgSize + SEQ_MCAST_MAX_HDR_LEN + 7)))
+	if (!(pSeqMcastChannel->inputBufferMem = (char*)_rsslMalloc(pSeqMcastChannel->slotSize * pSeqMcastChannel->readBatchSize)))
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast input buffer.\n", __FILE__, __LINE__);
@@ -314,6 +490,17 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 		return RSSL_RET_FAILURE;
 	}
 
+#ifdef SEQ_MCAST_MMSG
+	if (!rsslSeqMcastInitBatches(pSeqMcastChannel))
+	{
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  0);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0005 Failed to allocate the sequenced multicast batch structures.\n", __FILE__, __LINE__);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
+		_rsslFree(pSeqMcastChannel);
+		return RSSL_RET_FAILURE;
+	}
+#endif
+
 	rsslChnlImpl->transportInfo = pSeqMcastChannel;
 	
 	pSeqMcastChannel->bufferInUse = RSSL_FALSE;
@@ -330,8 +517,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 	if (opts->connectionInfo.unified.address == NULL)
 	{
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0013 unified.address not provided.\n", __FILE__, __LINE__);
@@ -340,8 +526,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 	if (opts->connectionInfo.unified.serviceName == NULL)
 	{
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 0013 unified.serviceName not provided.\n", __FILE__, __LINE__);
@@ -353,8 +538,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 	{
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Call to socket() failed. System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
@@ -367,8 +551,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_SNDBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
@@ -382,8 +565,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_RCVBUF on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
@@ -400,8 +582,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed. Unable to set SO_REUSEADDR on socket. System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
     }
@@ -420,8 +601,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error 1004: getHostByName() failed.  Interface name (%s) is incorrect.  System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.segmented.interfaceName, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			
 			return RSSL_RET_FAILURE;
@@ -440,8 +620,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT,"<%s:%d> rsslConnect() Error 1004: getHostByName() failed.  Receive address (%s) is incorrect. System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvAddress, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
@@ -457,8 +636,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getServByName() failed.  Receive service (%s) is incorrect.  System errno: (%d)\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvServiceName, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	} 
@@ -469,8 +647,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 Call to system bind() failed. System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	} 
@@ -483,8 +660,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Receive address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvAddress, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
@@ -498,8 +674,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Interface address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.interfaceName, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
@@ -526,8 +701,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed.  Unable to add membership to multicast group.  System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
@@ -538,8 +712,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 		_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 setsockopt() failed.  Unable to set multicast interface.  System errno: (%d).\n", __FILE__, __LINE__, errno);
-		_rsslFree(pSeqMcastChannel->inputBufferMem);
-		_rsslFree(pSeqMcastChannel->bufferMem);
+		rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 		_rsslFree(pSeqMcastChannel);
 		return RSSL_RET_FAILURE;
 	}
@@ -557,8 +730,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1002 fcntl() failed.  Unable to set blocking.  System errno: (%d).\n", __FILE__, __LINE__, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
@@ -574,8 +746,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Send address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.sendAddress, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
@@ -590,8 +761,7 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 
 			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
 			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslConnect() Error: 1004 getHostByName() failed.  Receive address (%s) is incorrect.  System errno: (%d).\n", __FILE__, __LINE__, opts->connectionInfo.segmented.recvAddress, errno);
-			_rsslFree(pSeqMcastChannel->inputBufferMem);
-			_rsslFree(pSeqMcastChannel->bufferMem);
+			rsslSeqMcastFreeChannelMem(pSeqMcastChannel);
 			_rsslFree(pSeqMcastChannel);
 			return RSSL_RET_FAILURE;
 		}
@@ -615,7 +785,35 @@ RsslRet rsslSeqMcastConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *o
 /* Contains code necessary to flush data to Sequence Multicast network (no-op) */
 RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 {
+#ifdef SEQ_MCAST_MMSG
+	RsslSeqMcastChannel *pSeqMcastChannel = (RsslSeqMcastChannel*)rsslChnlImpl->transportInfo;
+	RsslInt32 ret = 0;
+
+	/* Datagrams are only held back when write batching is enabled */
+	if (!pSeqMcastChannel->writeMsgs)
+		return RSSL_RET_SUCCESS;
+
+	if (chnlLocking)
+		seqMcastGetLock(&pSeqMcastChannel->lock);
+
+	if (pSeqMcastChannel->writeBatchCount && (ret = rsslSeqMcastSendBatched(pSeqMcastChannel, rsslChnlImpl->Channel.socketId)) < 0)
+	{
+		rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+		_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
+		snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslFlush() Error: 1002 Call to sendmmsg() failed.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+		if (chnlLocking)
+			seqMcastUnlock(&pSeqMcastChannel->lock);
+		return RSSL_RET_FAILURE;
+	}
+
+	if (chnlLocking)
+		seqMcastUnlock(&pSeqMcastChannel->lock);
+
+	/* Any remaining staged bytes need another flush */
+	return ret;
+#else
 	return RSSL_RET_SUCCESS;
+#endif
 }
 
 /* Contains code necessary to obtain a buffer to put data in for writing to Sequence Multicast network */
@@ -626,6 +824,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 	rsslBufferImpl *pBufferImpl;
 	rtrSeqMcastBuffer *seqMcastBuffer;
 	RsslQueueLink *pLink = 0;
+	char *slotMem = pSeqMcastChannel->bufferMem;
 
 	if (chnlLocking) seqMcastGetLock(&pSeqMcastChannel->lock);
 	if (size > pSeqMcastChannel->maxMsgSize)
@@ -644,6 +843,35 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 		return NULL;
 	}
 
+#ifdef SEQ_MCAST_MMSG
+	if (pSeqMcastChannel->writeMsgs)
+	{
+		/* Each staged datagram occupies its own slot until it is sent, so make room if every slot is staged. */
+		if (pSeqMcastChannel->writeBatchCount == pSeqMcastChannel->writeBatchSize)
+		{
+			RsslInt32 ret = rsslSeqMcastSendBatched(pSeqMcastChannel, rsslChnlImpl->Channel.socketId);
+
+			if (ret < 0)
+			{
+				rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+				_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> RsslGetBuffer() Error: 1002 Call to sendmmsg() failed.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+				if (chnlLocking) seqMcastUnlock(&pSeqMcastChannel->lock);
+				return NULL;
+			}
+
+			if (ret > 0)
+			{
+				_rsslSetError(error, NULL, RSSL_RET_BUFFER_NO_BUFFERS,  0);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> RsslGetBuffer() Error: 0005 All %u staged datagrams are waiting to be sent; call rsslFlush().\n", __FILE__, __LINE__, pSeqMcastChannel->writeBatchSize);
+				if (chnlLocking) seqMcastUnlock(&pSeqMcastChannel->lock);
+				return NULL;
+			}
+		}
+		slotMem = pSeqMcastChannel->bufferMem + pSeqMcastChannel->writeBatchCount * pSeqMcastChannel->slotSize;
+	}
+#endif
+
 	pSeqMcastChannel->bufferInUse = RSSL_TRUE;
 
 	pLink = rsslQueueRemoveFirstLink(&(rsslChnlImpl->freeBufferList));
@@ -660,7 +888,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 	pBufferImpl = RSSL_QUEUE_LINK_TO_OBJECT(rsslBufferImpl, link1, pLink);
 
 	pBufferImpl->buffer.length = size;
-	pBufferImpl->buffer.data = pSeqMcastChannel->bufferMem + SEQ_MCAST_MAX_HDR_LEN;
+	pBufferImpl->buffer.data = slotMem + SEQ_MCAST_MAX_HDR_LEN;
 	/* Since the packing header and non-packed header are identical, every buffer is packable. 
 	   The packingOffset will be initially set to after the seqNum(4 bytes in), then every subsequent pack will place the length at that point
 	   Each subsequent pack should then place the packingOffset to the end of the previous pack's data, without reserving the length in the offset */
@@ -668,7 +896,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(rsslBufferImpl*) rsslSeqMcastGetBuffer(rsslChannel
 	seqMcastBuffer = &(pSeqMcastChannel->writeBuffer);
 	pBufferImpl->packingOffset = SEQ_MCAST_MAX_HDR_LEN;
 	pBufferImpl->bufferInfo = seqMcastBuffer;
-	seqMcastBuffer->buffer = pSeqMcastChannel->bufferMem;
+	seqMcastBuffer->buffer = slotMem;
 	seqMcastBuffer->maxLength = size;
 	/* This memory is owned entirely by the SeqMCast channel */
 	pBufferImpl->owner = 0;
@@ -688,9 +916,9 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastGetChannelInfo(rsslChannelImp
 		seqMcastGetLock(&pSeqMcastChannel->lock);
 	memset(info, 0, sizeof(RsslChannelInfo));
 	info->maxFragmentSize = pSeqMcastChannel->maxMsgSize;
-	info->maxOutputBuffers = 1;
-	info->guaranteedOutputBuffers = 1;
-	info->numInputBuffers = 1;
+	info->maxOutputBuffers = pSeqMcastChannel->writeBatchSize;
+	info->guaranteedOutputBuffers = pSeqMcastChannel->writeBatchSize;
+	info->numInputBuffers = pSeqMcastChannel->readBatchSize;
 	info->pingTimeout = rsslChnlImpl->Channel.pingTimeout;
 	info->clientToServerPings = RSSL_FALSE;
 	info->serverToClientPings = RSSL_FALSE;
@@ -778,6 +1006,7 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastIoctl(rsslChannelImpl *rsslCh
 		case RSSL_PRIORITY_FLUSH_ORDER:
 		case RSSL_SERVER_NUM_POOL_BUFFERS:
 		case RSSL_COMPRESSION_THRESHOLD:
+		case RSSL_COMPRESSION_ADAPTIVE:
 		case RSSL_SERVER_PEAK_BUF_RESET:
 		case RSSL_DEBUG_FLAGS:
 			break;
@@ -841,6 +1070,16 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastPing(rsslChannelImpl *rsslChn
 	if (chnlLocking)
 		seqMcastGetLock(&pSeqMcastChannel->lock);
 
+#ifdef SEQ_MCAST_MMSG
+	/* Keep the ping behind any staged datagrams.  If they cannot all be sent, they carry the same liveness as the ping would. */
+	if (pSeqMcastChannel->writeBatchCount && rsslSeqMcastSendBatched(pSeqMcastChannel, rsslChnlImpl->Channel.socketId) != 0)
+	{
+		if (chnlLocking)
+			seqMcastUnlock(&pSeqMcastChannel->lock);
+		return RSSL_RET_SUCCESS;
+	}
+#endif
+
 	rsslSeqMcastWriteHdr(rsslChnlImpl, sendBuf, 0, pSeqMcastChannel->writeSeqNum, error);
 
 	/* send packet */
@@ -895,9 +1134,17 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 	{
 		if (pSeqMcastChannel->stillProcessingPacket == RSSL_FALSE) /* process a new packet from network */
 		{
-			pSeqMcastChannel->inputBuffer.data = pSeqMcastChannel->inputBufferMem;
+#ifdef SEQ_MCAST_MMSG
+			if (pSeqMcastChannel->readMsgs)
+				cc = rsslSeqMcastRecvBatched(pSeqMcastChannel, rsslChnlImpl->Channel.socketId, &srcAddr);
+			else
+#endif
+			{
+				pSeqMcastChannel->inputBuffer.data = pSeqMcastChannel->inputBufferMem;
+				cc = recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)&srcAddr, (socklen_t*)&srcAddrLen);
+			}
 
-			if ((cc = recvfrom(rsslChnlImpl->Channel.socketId, pSeqMcastChannel->inputBuffer.data, pSeqMcastChannel->maxMsgSize + SEQ_MCAST_MAX_HDR_LEN, 0, (struct sockaddr*)&srcAddr, (socklen_t*)&srcAddrLen)) < 0)
+			if (cc < 0)
 			{
 				if(errno == EINTR || errno == EWOULDBLOCK || errno == EAGAIN)
 				{
@@ -1038,6 +1285,13 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 				readOutArgs->nodeId.nodeAddr = pSeqMcastChannel->readAddr;
 				readOutArgs->nodeId.port = pSeqMcastChannel->readPort;
 				readOutArgs->instanceId = pSeqMcastChannel->readInstanceID;
+#ifdef SEQ_MCAST_MMSG
+				if (pSeqMcastChannel->readMsgs)
+				{
+					readOutArgs->readOutFlags |= RSSL_READ_OUT_BATCH_DEPTH;
+					readOutArgs->readBatchDepth = pSeqMcastChannel->readBatchCount - pSeqMcastChannel->readBatchIndex;
+				}
+#endif
 				*readRet = RSSL_RET_READ_PING;
 				if (chnlLocking)
 					seqMcastUnlock(&pSeqMcastChannel->lock);
@@ -1070,6 +1324,10 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 			{
 				pSeqMcastChannel->stillProcessingPacket = RSSL_TRUE;
 			}
+#ifdef SEQ_MCAST_MMSG
+			/* Staged datagrams also count as data left to read */
+			remainingLen += pSeqMcastChannel->readBatchBytes;
+#endif
 			*readRet = remainingLen;
 		}
 		else /* still processing previous packet */
@@ -1113,8 +1371,18 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslBuffer*) rsslSeqMcastRead(rsslChannelImpl* rss
 			{
 				pSeqMcastChannel->stillProcessingPacket = RSSL_FALSE;
 			}
+#ifdef SEQ_MCAST_MMSG
+			remainingLen += pSeqMcastChannel->readBatchBytes;
+#endif
 			*readRet = remainingLen;
 		}
+#ifdef SEQ_MCAST_MMSG
+		if (pSeqMcastChannel->readMsgs)
+		{
+			readOutArgs->readOutFlags |= RSSL_READ_OUT_BATCH_DEPTH;
+			readOutArgs->readBatchDepth = pSeqMcastChannel->readBatchCount - pSeqMcastChannel->readBatchIndex;
+		}
+#endif
 		if (chnlLocking)
 			seqMcastUnlock(&pSeqMcastChannel->lock);
 	}
@@ -1275,6 +1543,48 @@ RSSL_RSSL_SEQ_MCAST_IMPL_FAST(RsslRet) rsslSeqMcastWrite(rsslChannelImpl *rsslCh
 
 		pktLength = seqMcastBuffer->length - hdrOffset;
 	}
+
+#ifdef SEQ_MCAST_MMSG
+	if (pSeqMcastChannel->writeMsgs)
+	{
+		/* Stage the datagram in place; it is sent once the batch fills or on rsslFlush() */
+		pSeqMcastChannel->writeIov[pSeqMcastChannel->writeBatchCount].iov_base = seqMcastBuffer->buffer + hdrOffset;
+		pSeqMcastChannel->writeIov[pSeqMcastChannel->writeBatchCount].iov_len = pktLength;
+		pSeqMcastChannel->writeBatchCount++;
+		pSeqMcastChannel->writeBatchBytes += pktLength;
+
+		if (pSeqMcastChannel->writeBatchCount == pSeqMcastChannel->writeBatchSize)
+			ret = rsslSeqMcastSendBatched(pSeqMcastChannel, rsslChnlImpl->Channel.socketId);
+		else
+			ret = pSeqMcastChannel->writeBatchBytes;
+
+		if (ret < 0)
+		{
+			writeOutArgs->bytesWritten = 0;
+			writeOutArgs->uncompressedBytesWritten = 0;
+			rsslChnlImpl->Channel.state = RSSL_CH_STATE_CLOSED;
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE,  errno);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT, "<%s:%d> rsslWrite() Error: 1002 Call to sendmmsg() failed.  System errno: (%d).\n", __FILE__, __LINE__, errno);
+			if (chnlLocking)
+				seqMcastUnlock(&pSeqMcastChannel->lock);
+			return RSSL_RET_FAILURE;
+		}
+
+		pSeqMcastChannel->bufferInUse = RSSL_FALSE;
+		if (rsslQueueLinkInAList(&(rsslBufImpl->link1)))
+			rsslQueueRemoveLink(&(rsslChnlImpl->activeBufferList), &(rsslBufImpl->link1));
+
+		rsslQueueAddLinkToBack(&(rsslChnlImpl->freeBufferList), &(rsslBufImpl->link1));
+
+		writeOutArgs->bytesWritten = pktLength;
+		writeOutArgs->uncompressedBytesWritten = pktLength;
+		if (chnlLocking)
+			seqMcastUnlock(&pSeqMcastChannel->lock);
+
+		/* A positive return indicates bytes waiting for rsslFlush() */
+		return ret;
+	}
+#endif
 		
 	/* send packet */
 	do
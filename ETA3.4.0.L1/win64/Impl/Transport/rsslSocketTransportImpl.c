@@ -98,6 +98,10 @@ RsslRet rsslSocketGetSockOpts(RsslSocketChannel *rsslSocketChannel, RsslInt32 co
 
 RsslRet ripcInitZlibComp();
 RsslRet ripcInitLz4Comp();
+RsslRet ripcInitZstdComp();
+void ripcCompUninitialize();
+void *ripcLoadCompDict(const char *fileName, RsslError *error);
+RsslUInt32 ripcCompDictId(void *compDict);
 
 // used to assign global sessionID's for each session. Will need to optimize to reuse session ID
 static RsslUInt32					g_sessionID = 0;
@@ -135,6 +139,7 @@ static ripcCompFuncs	compressFuncs[RSSL_COMP_MAX_TYPE + 1];
 
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZLIB = 30;
 static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_LZ4 = 300;
+static const RsslUInt32	RSSL_COMP_DFLT_THRESHOLD_ZSTD = 30;
 
 static RsslInitializeExOpts  transOpts = RSSL_INIT_INITIALIZE_EX_OPTS;
 
@@ -150,7 +155,9 @@ static rtr_atomic_val		gblmutexinit = 0;
 
 static u8 ripccompressions[][3]	=	{	{ 0, 0x00, RSSL_COMP_NONE  },	/* no compression	*/
 										{ 0, 0x01, RSSL_COMP_ZLIB  },	/* zlib compression	*/
-										{ 0, 0x02, RSSL_COMP_LZ4 } };	/* LZ4 compression	*/
+										{ 0, 0x02, RSSL_COMP_LZ4 },		/* LZ4 compression	*/
+										{ 0, 0x00, RSSL_COMP_NONE  },	/* unused - rows are indexed by RsslCompTypes */
+										{ 0, 0x04, RSSL_COMP_ZSTD } };	/* zstd compression	*/
 
 /* winInet tunneling */
 #include "rtr/ripcinetutils.h"
@@ -536,6 +543,36 @@ RsslServerSocketChannel* newRsslServerSocketChannel()
 *		from the ipc headers with compression enabled.
 *********************************************/
 
+/* Collects the receive staged by rsslSocketPrepareRead.  Returns 0 if none was staged,
+ * otherwise 1 with cc set the way readTransport would have set it. */
+static RsslInt32 ipcUringTakeRead(RsslSocketChannel *rsslSocketChannel, RsslInt32 *cc)
+{
+	RsslInt32 result = 0;
+
+	switch (ripcUringTakeResult(&rsslSocketChannel->uringChnl->readOp, &result))
+	{
+		case RIPC_URING_OP_IDLE:
+			return 0;
+		case RIPC_URING_OP_PENDING:
+			/* rsslSubmitIo has not run yet and the input buffer belongs to the ring until it does */
+			*cc = 0;
+			return 1;
+		default:
+			if (result > 0)
+				*cc = result;
+			else if (result == 0)
+				*cc = -2;
+			else if ((result == -EAGAIN) || (result == -EINTR))
+				*cc = 0;
+			else
+			{
+				errno = -result;
+				*cc = -1;
+			}
+			return 1;
+	}
+}
+
 rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readret, RsslInt32 *moreData, RsslInt32 *fragLength, RsslInt32 *fragId,
 	RsslInt32* bytesRead, RsslInt32* uncompBytesRead, RsslInt32 *packing, RsslError *error)
 {
@@ -583,29 +620,33 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 	if (rsslSocketChannel->inputBuffer->length == 0)
 	{
+		/* with io_uring the read was already done by rsslSubmitIo */
+		if ((rsslSocketChannel->uringChnl == 0) || !ipcUringTakeRead(rsslSocketChannel, &cc))
+		{
 #ifdef MUTEX_DEBUG
 	printf("UNLOCK rsslSocketChannel -- ipcReadSession (before transportFuncs->readTransport)\n");
 #endif
-		IPC_MUTEX_UNLOCK(rsslSocketChannel);
+			IPC_MUTEX_UNLOCK(rsslSocketChannel);
 
-		cc = (*(rsslSocketChannel->transportFuncs->readTransport))(rsslSocketChannel->transportInfo,
-			rsslSocketChannel->inputBuffer->buffer, rsslSocketChannel->readSize, rwflags, error);
+			cc = (*(rsslSocketChannel->transportFuncs->readTransport))(rsslSocketChannel->transportInfo,
+				rsslSocketChannel->inputBuffer->buffer, rsslSocketChannel->readSize, rwflags, error);
 
 #ifdef MUTEX_DEBUG
 	printf("LOCK rsslSocketChannel -- ipcReadSession (after transportFuncs->readTransport)\n");
 #endif
-		IPC_MUTEX_LOCK(rsslSocketChannel);
+			IPC_MUTEX_LOCK(rsslSocketChannel);
 
-		if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
-		{
-			_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
-			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
-				"<%s:%d> Error: 1003 ipcReadSession() failed due to channel shutting down.\n",
-				__FILE__, __LINE__);
+			if (rsslSocketChannel->workState & RIPC_INT_SHTDOWN_PEND)
+			{
+				_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1003 ipcReadSession() failed due to channel shutting down.\n",
+					__FILE__, __LINE__);
 
-			*readret = RSSL_RET_FAILURE;
+				*readret = RSSL_RET_FAILURE;
 
-			return 0;
+				return 0;
+			}
 		}
 #ifdef IPC_DEBUG
 		if (rtrUnlikely(readdebug))
@@ -1008,7 +1049,7 @@ rtr_msgb_t *ipcReadSession( RsslSocketChannel *rsslSocketChannel, RsslRet *readr
 
 		/* header has been set up, need to determine if we have to decompress or not */
 		/* if this was a compression type that was not good at decompression, we may need to copy off content and decompress when next part comes */
-		if ((rsslSocketChannel->inDecompress == RSSL_COMP_LZ4) && ((rsslSocketChannel->tempDecompressBuf->length) || (ipcOpcode & IPC_COMP_FRAG)))
+		if (RSSL_COMP_IS_BLOCK(rsslSocketChannel->inDecompress) && ((rsslSocketChannel->tempDecompressBuf->length) || (ipcOpcode & IPC_COMP_FRAG)))
 		{
 			/* need to come in here if this is LZ and its the first part of compression, or need to know its the second part */
 			if (ipcOpcode & IPC_COMP_FRAG)
@@ -1697,6 +1738,25 @@ RsslInt32 ipcIntWrtHeader(RsslSocketChannel *rsslSocketChannel, RsslError *error
 }
 
 
+/* Feeds the bytes left queued after a flush to adaptive compression and applies any level change.
+ * Called with the channel mutex held, between messages. */
+static void ipcAdaptCompFlushed(RsslSocketChannel *rsslSocketChannel, RsslInt32 queuedBytes)
+{
+	RsslInt32 oldLevel = rsslSocketChannel->adaptComp->level;
+	RsslInt32 newLevel;
+	RsslError error;
+
+	if ((newLevel = ripcAdaptCompFlushed(rsslSocketChannel->adaptComp, queuedBytes)) == 0)
+		return;
+
+	if ((rsslSocketChannel->outCompFuncs->setLevel == 0) ||
+		((*(rsslSocketChannel->outCompFuncs->setLevel))(rsslSocketChannel->c_stream_out, newLevel, &error) < 0))
+	{
+		/* keep compressing at the level we had */
+		ripcAdaptCompFixLevel(rsslSocketChannel->adaptComp, oldLevel);
+	}
+}
+
 RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rsslBufferImpl, RsslInt32 wFlags, RsslInt32 *bytesWritten,
 	RsslInt32 *uncompBytesWritten, RsslInt32 forceFlush, RsslError *error)
 {
@@ -1852,7 +1912,8 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					((rsslSocketChannel->compressQueue == -1) || (rsslSocketChannel->compressQueue == msgb->priority))) &&
 					(msgb->length >= rsslSocketChannel->lowerCompressionThreshold) &&
 					((rsslSocketChannel->safeLZ4 == 0) || ((rsslSocketChannel->safeLZ4 == 1) && (msgb->length <= rsslSocketChannel->upperCompressionThreshold))) &&
-					(!(wFlags & RIPC_WRITE_DO_NOT_COMPRESS)))
+					(!(wFlags & RIPC_WRITE_DO_NOT_COMPRESS)) &&
+					((rsslSocketChannel->adaptComp == 0) || ripcAdaptCompCheck(rsslSocketChannel->adaptComp, (RsslUInt32)msgb->length)))
 				{
 					/* get first buffer to compress into */
 					/* need to unlock the mutex to avoid deadlock */
@@ -1970,6 +2031,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					RsslUInt8				headerLength = 0;
 					rtr_msgb_t				*compressedmb2;
 					ripcCompBuffer				compBuf;
+					RsslUInt64				compStart = 0;
 
 #ifdef IPC_DEBUG
 					if (rtrUnlikely(readdebug))
@@ -2051,7 +2113,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					}
 
 					/* if doing a compression that does not grow across buffers, and it is over the threshold that will grow, use the intermediate buffer to compress into */
-					if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
+					if (RSSL_COMP_IS_BLOCK(rsslSocketChannel->outCompression) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
 					{
 						compBuf.next_out = rsslSocketChannel->tempCompressBuf->buffer;
 						compBuf.avail_out = (unsigned long)rsslSocketChannel->tempCompressBuf->maxLength;
@@ -2065,6 +2127,9 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					compBuf.next_in = msgb->buffer + headerLength;
 					compBuf.avail_in = messageLength - headerLength;
 
+					if (rsslSocketChannel->adaptComp)
+						compStart = ripcAdaptCompTime();
+
 					if ((*(rsslSocketChannel->outCompFuncs->compress)) (rsslSocketChannel->c_stream_out, &compBuf, error) < 0)
 					{
 						_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -2077,13 +2142,22 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 					}
 
 					compLen1 = compBuf.bytes_out_used;
+
+					if (rsslSocketChannel->adaptComp)
+					{
+						/* if zlib filled the buffer, the message did not get any smaller */
+						RsslUInt32 inLen = messageLength - headerLength;
+						RsslUInt32 outLen = ((compBuf.avail_out == 0) && !RSSL_COMP_IS_BLOCK(rsslSocketChannel->outCompression)) ? inLen : compLen1;
+
+						ripcAdaptCompRecord(rsslSocketChannel->adaptComp, inLen, outLen, ripcAdaptCompTime() - compStart);
+					}
 #ifdef IPC_DEBUG
 					if (rtrUnlikely(readdebug))
 						printf("#1 compressed %d bytes into %d bytes (avail_out = %d)\n", messageLength - headerLength, compLen1, compBuf.avail_out);
 #endif
 
 					/* if we have to split content, now do it */
-					if ((rsslSocketChannel->outCompression == RSSL_COMP_LZ4) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
+					if (RSSL_COMP_IS_BLOCK(rsslSocketChannel->outCompression) && (tempLen >= rsslSocketChannel->upperCompressionThreshold))
 					{
 						/* save length of content in the buffer */
 						rsslSocketChannel->tempCompressBuf->length = compLen1;
@@ -2371,7 +2445,7 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 						headerLength = IPC_header_size;
 
 
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4) /* we should not be here with LZ4 unless it was over the comp threshold && (tempLen >= sess->upperCompressionThreshold) */
+						if (RSSL_COMP_IS_BLOCK(rsslSocketChannel->outCompression)) /* we should not be here with LZ4 unless it was over the comp threshold && (tempLen >= sess->upperCompressionThreshold) */
 						{
 							/* compression was already done above, just need to continue copy */
 							/* compLen2 should be whatever is left that we didnt copy into the buffer */
@@ -2766,6 +2840,9 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 		if ((forceFlush == RSSL_WRITE_DIRECT_SOCKET_WRITE) || (retval >(RsslInt32)rsslSocketChannel->high_water_mark))
 		{
 			retval = ipcFlushSession(rsslSocketChannel, error);
+
+			if (rsslSocketChannel->adaptComp && (retval >= 0))
+				ipcAdaptCompFlushed(rsslSocketChannel, retval);
 		}
 	}
 
@@ -2777,6 +2854,82 @@ RsslRet ipcWriteSession(RsslSocketChannel *rsslSocketChannel, rsslBufferImpl *rs
 	return(retval);
 }
 
+/* Applies the result of the send queued by ipcFlushSession to the priority queues.
+ * Returns RSSL_RET_SUCCESS when the next vector can be built, 1 while the send
+ * is still with the ring, or RSSL_RET_FAILURE. */
+static RsslRet ipcUringTakeWrite(RsslSocketChannel *rsslSocketChannel, RsslError *error)
+{
+	ripcUringChannel	*uringChnl = rsslSocketChannel->uringChnl;
+	rtr_msgb_t			*curmsgb = 0;
+	RsslQueueLink		*pLink = 0;
+	RsslInt32			cc = 0;
+	RsslInt32			curpos = 0;
+	RsslInt32			iovLen;
+
+	switch (ripcUringTakeResult(&uringChnl->writeOp, &cc))
+	{
+		case RIPC_URING_OP_IDLE:
+			return RSSL_RET_SUCCESS;
+		case RIPC_URING_OP_PENDING:
+			return 1;
+		default:
+			break;
+	}
+
+	if (cc < 0)
+	{
+		if ((cc != -EAGAIN) && (cc != -EINTR))
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, -cc);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+				"<%s:%d> Error: 1002 ipcWrite() failed. System errno: (%d)\n",
+				__FILE__, __LINE__, -cc);
+
+			return RSSL_RET_FAILURE;
+		}
+		return RSSL_RET_SUCCESS;
+	}
+
+	while ((cc > 0) && (curpos < uringChnl->wrtveclen))
+	{
+		pLink = rsslQueuePeekFront(&rsslSocketChannel->priorityQueues[uringChnl->iovPriority[curpos]].priorityQueue);
+		curmsgb = RSSL_QUEUE_LINK_TO_OBJECT(rtr_msgb_t, link, pLink);
+		RIPC_ASSERT(curmsgb);
+
+		iovLen = (RsslInt32)RIPC_IOV_GETLEN(&uringChnl->wrtvec[curpos]);
+
+		if (iovLen <= cc)
+		{
+			if (iovLen < (RsslInt32)(curmsgb->length - ((caddr_t)curmsgb->local - curmsgb->buffer)))
+			{
+				/* ipcWriteSession coalesced more data into this buffer while the send was
+				 * with the ring.  What was sent ended on a message boundary, so the rest
+				 * just stays at the front of its queue. */
+				curmsgb->local = (caddr_t)curmsgb->local + iovLen;
+			}
+			else
+			{
+				rsslQueueRemoveFirstLink(&rsslSocketChannel->priorityQueues[uringChnl->iovPriority[curpos]].priorityQueue);
+				rsslSocketChannel->priorityQueues[uringChnl->iovPriority[curpos]].queueLength -= (RsslInt32)curmsgb->length;
+				rsslSocketChannel->nextOutBuf = -1;
+				rtr_dfltcFreeMsg(curmsgb);
+			}
+
+			cc -= iovLen;
+		}
+		else
+		{
+			/* partial write - this buffer has to go out first next time */
+			curmsgb->local = (caddr_t)curmsgb->local + cc;
+			rsslSocketChannel->nextOutBuf = uringChnl->iovPriority[curpos];
+			cc = 0;
+		}
+		curpos++;
+	}
+
+	return RSSL_RET_SUCCESS;
+}
+
 RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 {
 	rtr_msgb_t			*curmsgb = 0;
@@ -3068,6 +3221,16 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 		return(retVal);
 	}
 
+	/* a channel using io_uring has at most one send with the ring at a time */
+	if (rsslSocketChannel->uringChnl)
+	{
+		if ((retVal = ipcUringTakeWrite(rsslSocketChannel, error)) < RSSL_RET_SUCCESS)
+			return retVal;
+		if (retVal > 0)
+			cont = 0;
+		retVal = RSSL_RET_SUCCESS;
+	}
+
 	/* this is where we do a vectored write */
 	while (cont)
 	{
@@ -3241,6 +3404,17 @@ RsslRet ipcFlushSession(RsslSocketChannel *rsslSocketChannel, RsslError *error)
 
 		if (wrtveclen > 0)
 		{
+			if (rsslSocketChannel->uringChnl)
+			{
+				/* rsslSubmitIo sends the vector; the next flush applies the result */
+				memcpy(rsslSocketChannel->uringChnl->wrtvec, wrtvec, wrtveclen * sizeof(ripcIovType));
+				memcpy(rsslSocketChannel->uringChnl->iovPriority, iovPriority, wrtveclen * sizeof(RsslInt32));
+				rsslSocketChannel->uringChnl->wrtveclen = wrtveclen;
+
+				if (ripcUringQueueSend(rsslSocketChannel->uringChnl, rsslSocketChannel->stream))
+					break;
+			}
+
 			if (rsslSocketChannel->httpHeaders)
 				cc = (*(rsslSocketChannel->transportFuncs->writeVTransport))(rsslSocketChannel->tunnelTransportInfo, wrtvec, wrtveclen, lenToWrite, rwflags, error);
 			else
@@ -3636,6 +3810,39 @@ static ripcSessInit ipcReadHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInP
 	return ipcProcessHdr(rsslSocketChannel, inProg, error, cc);
 }
 
+/* Returns 1 if the client's compression bitmap asks for the compression type in row i of
+ * ripccompressions and the server allows it.  zstd also requires the dictionary ID the
+ * client sent after the bitmap to match the dictionary loaded by the server. */
+static RsslInt32 ipcCompRequested(RsslSocketChannel *rsslSocketChannel, RsslUInt8 *compbitmap, RsslUInt8 compbitmapsize, RsslInt32 i)
+{
+	RsslInt16 idx = ripccompressions[i][RSSL_COMP_BYTEINDEX];
+	RsslUInt32 dictId = 0;
+
+	if ((idx >= RSSL_COMP_BITMAP_SIZE) || (idx >= (RsslInt16)compbitmapsize))
+		return 0;
+
+	if (((compbitmap[idx] & ripccompressions[i][RSSL_COMP_BYTEBIT]) == 0) ||
+		((ripccompressions[i][RSSL_COMP_TYPE] & rsslSocketChannel->srvrcomp) == 0))
+		return 0;
+
+	if (ripccompressions[i][RSSL_COMP_TYPE] == RSSL_COMP_ZSTD)
+	{
+		if (compbitmapsize >= RSSL_COMP_ZSTD_BITMAP_SIZE)
+		{
+			_move_u32_swap(&dictId, compbitmap + RSSL_COMP_ZSTD_DICTID_INDEX);
+		}
+
+		if (dictId != ripcCompDictId(rsslSocketChannel->compDict))
+		{
+			if (rtrUnlikely(conndebug))
+				printf("client zstd dictionary 0x%x does not match ours (0x%x)\n", dictId, ripcCompDictId(rsslSocketChannel->compDict));
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
 ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *inProg, RsslError *error, RsslInt32 cc)
 {
 	RsslUInt32			version_number;
@@ -3789,7 +3996,9 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							RsslInt16 idx = ripccompressions[i][RSSL_COMP_BYTEINDEX];
 							if ((idx < RSSL_COMP_BITMAP_SIZE) && (idx < (RsslInt16)compbitmapsize))
 							{
-								if (compbitmap[idx] & ripccompressions[i][RSSL_COMP_BYTEBIT])
+								/* zstd still needs the client's dictionary ID to match ours */
+								if ((compbitmap[idx] & ripccompressions[i][RSSL_COMP_BYTEBIT]) &&
+									((ripccompressions[i][RSSL_COMP_TYPE] != RSSL_COMP_ZSTD) || ipcCompRequested(rsslSocketChannel, compbitmap, compbitmapsize, i)))
 								{
 									rsslSocketChannel->outCompression = ripccompressions[i][RSSL_COMP_TYPE];
 									break;
@@ -3810,7 +4019,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						{
 							if (rtrUnlikely(conndebug))	printf("about to initialize compression = %d\n", rsslSocketChannel->inDecompress);
 							rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(
-								rsslSocketChannel->server->zlibCompressionLevel, error);
+								rsslSocketChannel->server->zlibCompressionLevel, rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_out == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -3845,15 +4054,10 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 
 							for (i = 0; i <= RSSL_COMP_MAX_TYPE; i++)
 							{
-								RsslInt16 idx = ripccompressions[i][RSSL_COMP_BYTEINDEX];
-								if ((idx < RSSL_COMP_BITMAP_SIZE) && (idx < (RsslInt16)compbitmapsize))
+								if (ipcCompRequested(rsslSocketChannel, compbitmap, compbitmapsize, i))
 								{
-									if ((compbitmap[idx] & ripccompressions[i][RSSL_COMP_BYTEBIT]) != 0 &&
-										((ripccompressions[i][RSSL_COMP_TYPE] & rsslSocketChannel->srvrcomp) != 0))
-									{
-										rsslSocketChannel->outCompression = ripccompressions[i][RSSL_COMP_TYPE];
-										break;
-									}
+									rsslSocketChannel->outCompression = ripccompressions[i][RSSL_COMP_TYPE];
+									break;
 								}
 							}
 						}
@@ -3886,7 +4090,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							if (rtrUnlikely(conndebug))
 								printf("about to initialize compression = %d\n", rsslSocketChannel->outCompression);
 							rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(
-								rsslSocketChannel->server->zlibCompressionLevel, error);
+								rsslSocketChannel->server->zlibCompressionLevel, rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_out == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -3896,7 +4100,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						if (rsslSocketChannel->inDecompFuncs)
 						{
 							if (rtrUnlikely(conndebug))	printf("about to initialize decompression = %d\n", rsslSocketChannel->inDecompress);
-							rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(error);
+							rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_in == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -3948,9 +4152,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							for (i = 0; i <= RSSL_COMP_MAX_TYPE; i++)
 							{
 								/* if the client is requesting the same compression we want to do, then do it! */
-								RsslInt16 idx = ripccompressions[i][RSSL_COMP_BYTEINDEX];
-								if ((compbitmap[idx] & ripccompressions[i][RSSL_COMP_BYTEBIT]) != 0 &&
-									((ripccompressions[i][RSSL_COMP_TYPE] & rsslSocketChannel->srvrcomp) != 0))
+								if (ipcCompRequested(rsslSocketChannel, compbitmap, compbitmapsize, i))
 								{
 									rsslSocketChannel->outCompression = ripccompressions[i][RSSL_COMP_TYPE];
 									break;
@@ -3986,7 +4188,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							if (rtrUnlikely(conndebug))
 								printf("about to initialize compression = %d\n", rsslSocketChannel->outCompression);
 							rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(
-								rsslSocketChannel->server->zlibCompressionLevel, error);
+								rsslSocketChannel->server->zlibCompressionLevel, rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_out == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -3997,7 +4199,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						if (rsslSocketChannel->inDecompFuncs)
 						{
 							if (rtrUnlikely(conndebug))	printf("about to initialize decompression = %d\n", rsslSocketChannel->inDecompress);
-							rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(error);
+							rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_in == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -4006,17 +4208,17 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							}
 						}
 
-						/* LZ4 compression can sometimes grow data instead of shrinking it
+						/* LZ4 and zstd compression can sometimes grow data instead of shrinking it
 						* the compression routine isnt smart enough to stop at the end of a buffer (yes, this is hard to believe)
 						* so we need to make sure we do not exceed the buffer.
 						* so we wont compress buffers that are so full that they might compress past the end of the buffer
 						* so we need to calculate the largest buffer that we will compress
 						*/
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4)
+						if (RSSL_COMP_IS_BLOCK(rsslSocketChannel->outCompression))
 						{
 							RsslInt32 i = rsslSocketChannel->maxUserMsgSize;
 
-							while (LZ4_compressBound(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
+							while ((*(rsslSocketChannel->outCompFuncs->compressBound))(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
 							{
 								i--;
 							}
@@ -4032,7 +4234,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							rsslSocketChannel->upperCompressionThreshold = i;
 
 							/* Create buffer to compress into and decompress from */
-							i = LZ4_compressBound(rsslSocketChannel->maxUserMsgSize);
+							i = (*(rsslSocketChannel->outCompFuncs->compressBound))(rsslSocketChannel->maxUserMsgSize);
 							i += 5; /* add in small fudge factor to ensure these buffers are larger than needed */
 							rsslSocketChannel->tempCompressBuf = rtr_smplcAllocMsg(gblInputBufs, i);
 							if (rsslSocketChannel->tempCompressBuf == 0)
@@ -4095,6 +4297,11 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						if (rsslSocketChannel->forcecomp)
 						{
 							rsslSocketChannel->outCompression = (RsslCompTypes)rsslSocketChannel->srvrcomp;
+
+							/* zstd needs the client to have the same dictionary; otherwise force zlib, which all versions of ripc support */
+							if ((rsslSocketChannel->outCompression == RSSL_COMP_ZSTD) &&
+								!ipcCompRequested(rsslSocketChannel, (RsslUInt8*)&(hdrStart[10]), compbitmapsize, RSSL_COMP_ZSTD))
+								rsslSocketChannel->outCompression = RSSL_COMP_ZLIB;
 						}
 						else if (compbitmapsize > 0)
 						{
@@ -4104,9 +4311,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							{
 								/* check if the client is requesting a compression type we support */
 								/* if not, then there will be no compression */
-								RsslInt16 idx = ripccompressions[i][RSSL_COMP_BYTEINDEX];
-								if ((compbitmap[idx] & ripccompressions[i][RSSL_COMP_BYTEBIT]) != 0 &&
-									((ripccompressions[i][RSSL_COMP_TYPE] & rsslSocketChannel->srvrcomp) != 0))
+								if (ipcCompRequested(rsslSocketChannel, compbitmap, compbitmapsize, i))
 								{
 									rsslSocketChannel->outCompression = (RsslCompTypes)ripccompressions[i][RSSL_COMP_TYPE];
 									break;
@@ -4137,7 +4342,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							if (rtrUnlikely(conndebug))
 								printf("about to initialize compression = %d\n", rsslSocketChannel->outCompression);
 							rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(
-								rsslSocketChannel->server->zlibCompressionLevel, error);
+								rsslSocketChannel->server->zlibCompressionLevel, rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_out == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -4148,7 +4353,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 						if (rsslSocketChannel->inDecompFuncs)
 						{
 							if (rtrUnlikely(conndebug))	printf("about to initialize decompression = %d\n", rsslSocketChannel->inDecompress);
-							rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(error);
+							rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(rsslSocketChannel->compDict, error);
 							if (rsslSocketChannel->c_stream_in == 0)
 							{
 								_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -4157,16 +4362,16 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							}
 						}
 
-						/* LZ4 compression can sometimes grow data instead of shrinking it
+						/* LZ4 and zstd compression can sometimes grow data instead of shrinking it
 						*  the compression routine isnt smart enough to stop at the end of a buffer (yes, this is hard to believe)
 						* so we need to make sure we do not exceed the buffer.
 						* so we wont compress buffers that are so full that they might compress past the end of the buffer
 						* so we need to calculate the largest buffer that we will compress
 						*/
-						if (rsslSocketChannel->outCompression == RSSL_COMP_LZ4)
+						if (RSSL_COMP_IS_BLOCK(rsslSocketChannel->outCompression))
 						{
 							RsslInt32 i = rsslSocketChannel->maxUserMsgSize;
-							while (LZ4_compressBound(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
+							while ((*(rsslSocketChannel->outCompFuncs->compressBound))(i) > rsslSocketChannel->maxUserMsgSize && i > 0)
 							{
 								i--;
 							}
@@ -4182,7 +4387,7 @@ ripcSessInit ipcProcessHdr(RsslSocketChannel *rsslSocketChannel, ripcSessInProg
 							/* this is the threshold that we will not compress directly into the output buffer, but use the intermediate */
 							rsslSocketChannel->upperCompressionThreshold = i;
 							/* Create buffer to compress into and decompress from */
-							i = LZ4_compressBound(rsslSocketChannel->maxUserMsgSize);
+							i = (*(rsslSocketChannel->outCompFuncs->compressBound))(rsslSocketChannel->maxUserMsgSize);
 							i += 5; /* add in small fudge factor to ensure these buffers are larger than needed */
 							rsslSocketChannel->tempCompressBuf = rtr_smplcAllocMsg(gblInputBufs, i);
 							if (rsslSocketChannel->tempCompressBuf == 0)
@@ -5439,6 +5644,9 @@ static ripcSessInit ipcFinishSess(RsslSocketChannel *rsslSocketChannel, ripcSess
 			case RSSL_COMP_LZ4:
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 				break;
+			case RSSL_COMP_ZSTD:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+				break;
 			default:
 				break;
 			}
@@ -5719,6 +5927,9 @@ static ripcSessInit ipcWaitClientKey(RsslSocketChannel *rsslSocketChannel, ripcS
 		case RSSL_COMP_LZ4:
 			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 			break;
+		case RSSL_COMP_ZSTD:
+			rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+			break;
 		default:
 			break;
 		}
@@ -5955,15 +6166,18 @@ static ripcSessInit ipcConnecting(RsslSocketChannel *rsslSocketChannel, ripcSess
 			}
 			else
 			{
-				ripcHeaderSize = V10_MIN_CONN_HDR + RSSL_COMP_BITMAP_SIZE +
+				/* zstd sends its dictionary ID along with the bitmap */
+				RsslUInt8 compBitmapSize = (rsslSocketChannel->compression == RSSL_COMP_ZSTD) ? RSSL_COMP_ZSTD_BITMAP_SIZE : RSSL_COMP_BITMAP_SIZE;
+
+				ripcHeaderSize = V10_MIN_CONN_HDR + compBitmapSize +
 					hostnameLen + addrLen + 2;
 				if (rsslSocketChannel->version->connVersion > CONN_VERSION_11)
 					++ripcHeaderSize;
 				ripcHead[8] = (char)ripcHeaderSize;
-				ripcHead[9] = RSSL_COMP_BITMAP_SIZE;
-				MemCopyByInt((ripcHead + 10), (char*)rsslSocketChannel->compressionBitmap, RSSL_COMP_BITMAP_SIZE);
+				ripcHead[9] = compBitmapSize;
+				MemCopyByInt((ripcHead + 10), (char*)rsslSocketChannel->compressionBitmap, compBitmapSize);
 				/* set len to the next element for the variable portion */
-				len = 10 + RSSL_COMP_BITMAP_SIZE;
+				len = 10 + compBitmapSize;
 			}
 			/* add the ping interval in */
 			ripcHead[len++] = (RsslUInt8)rsslSocketChannel->pingTimeout;
@@ -6830,7 +7044,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			{
 				if (rtrUnlikely(conndebug))
 					printf("about to initialize decompression\n");
-				rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(error);
+				rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(rsslSocketChannel->compDict, error);
 				if (rsslSocketChannel->c_stream_in == 0)
 				{
 					_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -6851,15 +7065,15 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			rsslSocketChannel->inDecompress = comp;
 			rsslSocketChannel->outCompression = comp;
 
-			/* LZ4 cannot compress and span multiple buffers when content grows as a result of compression.
+			/* LZ4 and zstd cannot compress and span multiple buffers when content grows as a result of compression.
 			* We want to know where the threshold for this is, and when it can grow we want to compress
 			* into a larger buffer and then split it across two buffers.
 			*/
-			if (comp == RSSL_COMP_LZ4)
+			if (RSSL_COMP_IS_BLOCK(comp) && compressFuncs[comp].compressBound)
 			{
 				RsslInt32 i = maxMsgSize;
 
-				while (LZ4_compressBound(i) > maxMsgSize && i > 0)
+				while ((*(compressFuncs[comp].compressBound))(i) > maxMsgSize && i > 0)
 				{
 					i--;
 				}
@@ -6876,7 +7090,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 				rsslSocketChannel->upperCompressionThreshold = i;
 
 				/* Create buffer to compress into and decompress from */
-				i = LZ4_compressBound(maxMsgSize);
+				i = (*(compressFuncs[comp].compressBound))(maxMsgSize);
 				i += 5; /* add in small fudge factor to ensure these buffers are larger than needed */
 				rsslSocketChannel->tempCompressBuf = rtr_smplcAllocMsg(gblInputBufs, i);
 				if (rsslSocketChannel->tempCompressBuf == 0)
@@ -6928,7 +7142,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 				if (rtrUnlikely(conndebug))
 					printf("about to initialize decompression\n");
 
-				rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(error);
+				rsslSocketChannel->c_stream_in = (*(rsslSocketChannel->inDecompFuncs->decompressInit))(rsslSocketChannel->compDict, error);
 				if (rsslSocketChannel->c_stream_in == 0)
 				{
 					_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -6940,7 +7154,7 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			{
 				if (rtrUnlikely(conndebug))
 					printf("about to initialize compression\n");
-				rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(rsslSocketChannel->zlibCompLevel, error);
+				rsslSocketChannel->c_stream_out = (*(rsslSocketChannel->outCompFuncs->compressInit))(rsslSocketChannel->zlibCompLevel, rsslSocketChannel->compDict, error);
 				if (rsslSocketChannel->c_stream_out == 0)
 				{
 					_rsslSetError(error, NULL, RSSL_RET_FAILURE, errno);
@@ -7074,6 +7288,9 @@ ripcSessInit ipcWaitAck(RsslSocketChannel *rsslSocketChannel, ripcSessInProg *in
 			case RSSL_COMP_LZ4:
 				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_LZ4;
 				break;
+			case RSSL_COMP_ZSTD:
+				rsslSocketChannel->lowerCompressionThreshold = RSSL_COMP_DFLT_THRESHOLD_ZSTD;
+				break;
 			default:
 				break;
 			}
@@ -7191,6 +7408,25 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 		rsslServerSocketChannel->forcecomp = opts->forceCompression;
 	}
 
+	rsslServerSocketChannel->compDict = 0;
+	if (opts->compressionType & RSSL_COMP_ZSTD)
+	{
+		if (compressFuncs[RSSL_COMP_ZSTD].compressInit == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 zstd compression is not supported by this build.\n",
+					__FILE__, __LINE__);
+			return RSSL_RET_FAILURE;
+		}
+
+		if (opts->compressionDictionary && (opts->compressionDictionary[0] != '\0'))
+		{
+			if ((rsslServerSocketChannel->compDict = ripcLoadCompDict(opts->compressionDictionary, error)) == 0)
+				return RSSL_RET_FAILURE;
+		}
+	}
+
 	rsslServerSocketChannel->server_blocking = (opts->serverBlocking ? 1 : 0);
 	rsslServerSocketChannel->session_blocking = (opts->channelsBlocking ? 1 : 0);
 
@@ -7227,6 +7463,8 @@ RsslRet rsslSocketBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, Rssl
 	else
 		rsslServerSocketChannel->tcp_nodelay = 0;
 
+	rsslServerSocketChannel->ioMode = opts->tcpOpts.ioMode;
+
 	if (opts->maxOutputBuffers < opts->guaranteedOutputBuffers)
 		rsslServerSocketChannel->maxNumMsgs = opts->guaranteedOutputBuffers;
 	else
@@ -7634,6 +7872,29 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	rsslSocketChannel->blocking = opts->blocking;
 	rsslSocketChannel->compression = opts->compressionType;
 
+	if (rsslSocketChannel->compression == RSSL_COMP_ZSTD)
+	{
+		if (compressFuncs[RSSL_COMP_ZSTD].compressInit == 0)
+		{
+			_rsslSetError(error, NULL, RSSL_RET_FAILURE, 0);
+			snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+					"<%s:%d> Error: 1004 zstd compression is not supported by this build.\n",
+					__FILE__, __LINE__);
+
+			ripcRelSocketChannel(rsslSocketChannel);
+			return RSSL_RET_FAILURE;
+		}
+
+		if (opts->compressionDictionary && (opts->compressionDictionary[0] != '\0'))
+		{
+			if ((rsslSocketChannel->compDict = ripcLoadCompDict(opts->compressionDictionary, error)) == 0)
+			{
+				ripcRelSocketChannel(rsslSocketChannel);
+				return RSSL_RET_FAILURE;
+			}
+		}
+	}
+
 	/* check ping timeout for valid value */
 	if ((opts->pingTimeout > 0) && (opts->pingTimeout <= IPC_MAXIMUM_PINGTIMEOUT))
 		rsslSocketChannel->pingTimeout = opts->pingTimeout;
@@ -7675,6 +7936,8 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 	else
 		rsslSocketChannel->tcp_nodelay = 0;
 
+	rsslSocketChannel->ioMode = opts->tcpOpts.ioMode;
+
 	rsslSocketChannel->numInputBufs = opts->numInputBuffers;
 
 	rsslSocketChannel->encryptionProtocolFlags = opts->encryptionOpts.encryptionProtocolFlags;
@@ -7913,6 +8176,12 @@ RsslRet rsslSocketConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opt
 		RsslInt16 idx = ripccompressions[rsslSocketChannel->compression][RSSL_COMP_BYTEINDEX];
 		if (idx < RSSL_COMP_BITMAP_SIZE)
 			rsslSocketChannel->compressionBitmap[idx] |= ripccompressions[rsslSocketChannel->compression][RSSL_COMP_BYTEBIT];
+
+		if (rsslSocketChannel->compression == RSSL_COMP_ZSTD)
+		{
+			RsslUInt32 dictId = ripcCompDictId(rsslSocketChannel->compDict);
+			_move_u32_swap(rsslSocketChannel->compressionBitmap + RSSL_COMP_ZSTD_DICTID_INDEX, &dictId);
+		}
 	}
 
 	/* Set Proxy options, if present */
@@ -8284,9 +8553,12 @@ static RsslSocketChannel *ipcClientChannel(rsslServerImpl* serverImpl, RsslError
 
 	rsslSocketChannel->blocking = (rsslServerSocketChannel->session_blocking ? 1 : 0);
 	rsslSocketChannel->tcp_nodelay = (rsslServerSocketChannel->tcp_nodelay ? 1 : 0);
+	rsslSocketChannel->ioMode = rsslServerSocketChannel->ioMode;
 	rsslSocketChannel->maxMsgSize = rsslServerSocketChannel->maxMsgSize;
 	rsslSocketChannel->maxUserMsgSize = rsslServerSocketChannel->maxUserMsgSize;
 	rsslSocketChannel->srvrcomp = rsslServerSocketChannel->compressionSupported;
+	rsslSocketChannel->compDict = rsslServerSocketChannel->compDict;
+	rsslSocketChannel->zlibCompLevel = rsslServerSocketChannel->zlibCompressionLevel;
 	rsslSocketChannel->forcecomp = rsslServerSocketChannel->forcecomp ? 1 : 0;
 	rsslSocketChannel->upperCompressionThreshold = rsslServerSocketChannel->maxUserMsgSize;
 
@@ -9448,6 +9720,12 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketWrite(rsslChannelImpl *rsslChnlImp
 			if ((errno == EINTR) || (errno == EAGAIN) || (errno == _IPC_WOULD_BLOCK))
 			{
 				/* flush was blocked */
+				if (rsslSocketChannel->adaptComp)
+				{
+					IPC_MUTEX_LOCK(rsslSocketChannel);
+					ipcAdaptCompFlushed(rsslSocketChannel, 1);
+					IPC_MUTEX_UNLOCK(rsslSocketChannel);
+				}
 				rsslBufImpl->bufferInfo = NULL;
 				return RSSL_RET_WRITE_FLUSH_FAILED;
 			}
@@ -9749,6 +10027,9 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImp
 
 	retVal = ipcFlushSession(rsslSocketChannel, error);
 
+	if (rsslSocketChannel->adaptComp && (retVal >= 0))
+		ipcAdaptCompFlushed(rsslSocketChannel, retVal);
+
 #ifdef MUTEX_DEBUG
 	printf("UNLOCK rsslSocketChannel -- rsslSocketFlush (end)\n");
 #endif
@@ -9765,6 +10046,53 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketFlush(rsslChannelImpl *rsslChnlImp
 	return retVal;
 }
 
+/* rssl Socket PrepareRead - stages a receive into the empty input buffer of a RSSL_SOCKET_IO_URING channel */
+RsslRet rsslSocketPrepareRead(rsslChannelImpl *rsslChnlImpl, RsslError *error)
+{
+	RsslRet		 retVal = 0;
+	RsslSocketChannel *rsslSocketChannel = (RsslSocketChannel*)rsslChnlImpl->transportInfo;
+
+	if (IPC_NULL_PTR(rsslSocketChannel, "rsslSocketPrepareRead", "rsslSocketChannel", error))
+		return RSSL_RET_FAILURE;
+
+	if (rsslSocketChannel->ioMode != RSSL_SOCKET_IO_URING)
+		return 0;
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+	{
+		/* a read is already in progress on another thread; let it read directly */
+		if (RSSL_MUTEX_LOCK(&rsslChnlImpl->chanMutex))
+			return 0;
+	}
+
+	IPC_MUTEX_LOCK(rsslSocketChannel);
+
+	if (rsslSocketChannel->uringChnl == 0)
+	{
+		/* tunneled, encrypted and blocking channels keep using the transport functions */
+		if ((rsslSocketChannel->connType != RSSL_CONN_TYPE_SOCKET) || rsslSocketChannel->blocking ||
+			rsslSocketChannel->httpHeaders || (rsslSocketChannel->uringChnl = ripcUringNewChannel()) == 0)
+			rsslSocketChannel->ioMode = RSSL_SOCKET_IO_DEFAULT;
+	}
+
+	if (rsslSocketChannel->uringChnl && (rsslSocketChannel->inputBuffer->length == 0))
+		retVal = ripcUringQueueRecv(rsslSocketChannel->uringChnl, rsslSocketChannel->stream,
+			rsslSocketChannel->inputBuffer->buffer, rsslSocketChannel->readSize);
+
+	IPC_MUTEX_UNLOCK(rsslSocketChannel);
+
+	if (multiThread == RSSL_LOCK_GLOBAL_AND_CHANNEL)
+		(void) RSSL_MUTEX_UNLOCK(&rsslChnlImpl->chanMutex);
+
+	return retVal;
+}
+
+/* rssl Socket SubmitIo */
+RsslRet rsslSocketSubmitIo(RsslError *error)
+{
+	return ripcUringSubmit(error);
+}
+
 /* rssl Socket Ping */
 RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketPing(rsslChannelImpl *rsslChnlImpl, RsslError *error)
 {
@@ -9833,6 +10161,8 @@ RSSL_RSSL_SOCKET_IMPL_FAST(RsslRet) rsslSocketGetChannelInfo(rsslChannelImpl *rs
 	info->compressionThreshold = rsslSocketChannel->lowerCompressionThreshold;
 	info->compressionType = (RsslCompTypes)rsslSocketChannel->outCompression;
 	info->encryptionProtocol = rsslSocketChannel->sslCurrentProtocol;
+	if (rsslSocketChannel->adaptComp)
+		ripcAdaptCompGetInfo(rsslSocketChannel->adaptComp, &info->adaptiveCompression);
 
 	/* until we own this memory, we have not gotten the info from the other side of the connection */
 	if (rsslSocketChannel->outComponentVer)
@@ -10363,8 +10693,8 @@ printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
 	    if (rsslSocketChannel->outCompression == RSSL_COMP_NONE)
 		  break;
 
-		lowerThreshold = (rsslSocketChannel->outCompression == RSSL_COMP_ZLIB ?
-									RSSL_COMP_DFLT_THRESHOLD_ZLIB : RSSL_COMP_DFLT_THRESHOLD_LZ4);
+		lowerThreshold = (rsslSocketChannel->outCompression == RSSL_COMP_LZ4 ?
+									RSSL_COMP_DFLT_THRESHOLD_LZ4 : RSSL_COMP_DFLT_THRESHOLD_ZLIB);
 		if(iValue >= lowerThreshold)
 			rsslSocketChannel->lowerCompressionThreshold = iValue;
 		else
@@ -10383,6 +10713,38 @@ printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
 	}
 		break;
 
+	case RSSL_COMPRESSION_ADAPTIVE:
+	    if (rsslSocketChannel->outCompression == RSSL_COMP_NONE)
+		  break;
+
+		if (iValue && (rsslSocketChannel->adaptComp == 0))
+		{
+			/* start from the negotiated level */
+			if ((rsslSocketChannel->adaptComp = ripcAdaptCompNew(rsslSocketChannel->outCompFuncs->setLevel ? (RsslInt32)rsslSocketChannel->zlibCompLevel : 0)) == 0)
+			{
+				_rsslSetError(error, (RsslChannel*)(&rsslChnlImpl->Channel), RSSL_RET_FAILURE, 0);
+				snprintf(error->text, MAX_RSSL_ERROR_TEXT,
+						"<%s,%d> Error: 1001 rsslSocketIoctl() failed, could not allocate memory for adaptive compression\n",
+						__FILE__, __LINE__);
+
+#ifdef MUTEX_DEBUG
+	printf("UNLOCK rsslSocketChannel -- rsslSocketIoctl\n");
+#endif
+				IPC_MUTEX_UNLOCK(rsslSocketChannel);
+				return RSSL_RET_FAILURE;
+			}
+		}
+		else if (!iValue && rsslSocketChannel->adaptComp)
+		{
+			/* go back to the negotiated level */
+			if (rsslSocketChannel->outCompFuncs->setLevel && (rsslSocketChannel->adaptComp->level != (RsslInt32)rsslSocketChannel->zlibCompLevel))
+				(void)(*(rsslSocketChannel->outCompFuncs->setLevel))(rsslSocketChannel->c_stream_out, rsslSocketChannel->zlibCompLevel, error);
+
+			ripcAdaptCompFree(rsslSocketChannel->adaptComp);
+			rsslSocketChannel->adaptComp = 0;
+		}
+		break;
+
 	case RSSL_PRIORITY_FLUSH_ORDER:
 		/* cast value to char*, go through one by one to verify that they are all H, M, L
 		   Null terminate - Make sure at least H and M are represented.  Then store in sess->flushStrategy[];
@@ -10713,10 +11075,13 @@ RsslInt32 ipcInitialize(RsslInt32 numServers, RsslInt32 numClients, RsslInitiali
 			compressFuncs[i].decompressEnd = 0;
 			compressFuncs[i].compress = 0;
 			compressFuncs[i].decompress = 0;
+			compressFuncs[i].compressBound = 0;
+			compressFuncs[i].setLevel = 0;
 		}
 
 		ripcInitZlibComp();
 		ripcInitLz4Comp();
+		ripcInitZstdComp();
 
 		/* initialize open SSL library */
 		/* Copy the ssl and crypto lib name config */
@@ -11142,6 +11507,7 @@ RsslRet rsslSocketInitialize(RsslInitializeExOpts *initOpts, RsslError *error)
 	{
 		retVal = rsslSocketSetServerFunctions();
 		retVal = rsslSocketSetChannelFunctions();
+		ripcUringInitialize();
 	}
 
 	return retVal;
@@ -11149,8 +11515,13 @@ RsslRet rsslSocketInitialize(RsslInitializeExOpts *initOpts, RsslError *error)
 
 RsslRet rsslSocketUninitialize()
 {
-	/* clean up ipc */
-	return ipcCleanup();
+	RsslRet retVal;
+
+	/* clean up ipc; channels closed here still use the ring */
+	retVal = ipcCleanup();
+	ripcUringUninitialize();
+	ripcCompUninitialize();
+	return retVal;
 }
 
 RsslInt32 ripcSetDbgFuncs(
@@ -11491,6 +11862,12 @@ RSSL_RSSL_SOCKET_IMPL_FAST(void) ripcRelSocketChannel(RsslSocketChannel *rsslSoc
 	if (multiThread)
 	  (void) RSSL_MUTEX_LOCK(&ripcMutex);
 
+	if (rsslSocketChannel->uringChnl)
+	{
+		ripcUringFreeChannel(rsslSocketChannel->uringChnl);
+		rsslSocketChannel->uringChnl = 0;
+	}
+
 	if (rsslSocketChannel->curlHandle)
 	{
 		if (rsslSocketChannel->curlThreadInfo.curlThreadState == RSSL_CURL_ACTIVE)
@@ -11569,6 +11946,12 @@ RSSL_RSSL_SOCKET_IMPL_FAST(void) ripcRelSocketChannel(RsslSocketChannel *rsslSoc
 	if (rsslSocketChannel->c_stream_out && rsslSocketChannel->outCompFuncs)
 		(*(rsslSocketChannel->outCompFuncs->compressEnd))(rsslSocketChannel->c_stream_out);
 
+	if (rsslSocketChannel->adaptComp)
+	{
+		ripcAdaptCompFree(rsslSocketChannel->adaptComp);
+		rsslSocketChannel->adaptComp = 0;
+	}
+
 	if (rsslSocketChannel->c_stream_in && rsslSocketChannel->inDecompFuncs)
 		(*(rsslSocketChannel->inDecompFuncs->decompressEnd))(rsslSocketChannel->c_stream_in);
 
@@ -11653,6 +12036,13 @@ RSSL_RSSL_SOCKET_IMPL_FAST(void) ripcRelSocketChannel(RsslSocketChannel *rsslSoc
 /* Session should be locked before call */
 void rsslSocketChannelClose(RsslSocketChannel *rsslSocketChannel)
 {
+	/* queued io_uring operations refer to the socket and the channel's buffers */
+	if (rsslSocketChannel->uringChnl)
+	{
+		ripcUringFreeChannel(rsslSocketChannel->uringChnl);
+		rsslSocketChannel->uringChnl = 0;
+	}
+
 	/* When we are setting up for renegotiation a new socket
 	* is created and the old is closed. We need to keep
 	* track of both in case of an error for feedback to user.
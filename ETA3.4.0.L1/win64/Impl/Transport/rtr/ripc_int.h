@@ -178,6 +178,12 @@ static const u32 _conn_version_14	=	CONN_VERSION_14;
 /* Current number of bytes in the compression bitmap */
 #define RSSL_COMP_BITMAP_SIZE 1
 
+/* A client requesting zstd follows the bitmap with the 4 byte ID of its zstd
+ * dictionary (0 for none).  Servers only read the bitmap bytes they know about,
+ * so older servers ignore it. */
+#define RSSL_COMP_ZSTD_DICTID_INDEX 1
+#define RSSL_COMP_ZSTD_BITMAP_SIZE 5
+
 
 #define IPC_100_OTHER_HEADER_SIZE	8	/* Non Data opcode header size */
 #define IPC_100_CONN_ACK		    10	
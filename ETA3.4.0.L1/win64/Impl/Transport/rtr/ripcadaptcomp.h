@@ -0,0 +1,93 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __ripcadaptcomp_h
+#define __ripcadaptcomp_h
+
+/* Adaptive compression for socket channels (RSSL_COMPRESSION_ADAPTIVE).
+ *
+ * Outbound messages are grouped by size.  For each group the channel keeps the
+ * recent compressed to uncompressed ratio and the time spent compressing.  A
+ * group is sent uncompressed when compression saves too little, or when the
+ * link is keeping up and compressing costs more time than sending the saved
+ * bytes would; every RIPC_ADAPT_COMP_PROBE skipped messages one is compressed
+ * anyway so the decision follows the data.
+ *
+ * The compression level follows back-pressure: it goes up while flushes leave
+ * data queued on the channel and comes back down while they do not.
+ *
+ * All calls are made with the channel mutex held.
+ */
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslTransport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RIPC_ADAPT_COMP_WINDOW			64		/* samples needed before a size range is judged; older samples are aged out in halves */
+#define RIPC_ADAPT_COMP_PROBE			256		/* skipped messages between probes */
+#define RIPC_ADAPT_COMP_MIN_SAVING		10		/* percent; ranges saving less are never worth compressing */
+#define RIPC_ADAPT_COMP_WIRE_NS_PER_BYTE	8		/* time to send one byte at 1 Gb/s */
+#define RIPC_ADAPT_COMP_FLUSH_INTERVAL	64		/* flushes between compression level decisions */
+#define RIPC_ADAPT_COMP_MAX_LEVEL		9		/* higher zstd levels are too slow to use per message */
+
+typedef struct
+{
+	RsslUInt64		messages;
+	RsslUInt64		compressed;
+	RsslUInt64		bytesIn;		/* recent samples only */
+	RsslUInt64		bytesOut;
+	RsslUInt64		compressNs;
+	RsslUInt32		samples;
+	RsslUInt32		skipCount;		/* messages skipped since the last probe */
+	RsslUInt8		skip;
+} ripcAdaptCompBucket;
+
+typedef struct
+{
+	ripcAdaptCompBucket	buckets[RSSL_COMP_ADAPTIVE_BUCKETS];
+	RsslInt32			level;			/* current level, 0 if the compression type has no levels */
+	RsslInt32			minLevel;
+	RsslInt32			maxLevel;
+	RsslUInt32			flushes;		/* flushes since the last level decision */
+	RsslUInt32			pressureFlushes;	/* of those, the ones that left data queued */
+	RsslUInt8			congested;		/* back-pressure was seen in the last interval */
+	RsslUInt64			backPressureEvents;
+} ripcAdaptComp;
+
+/* Returns new adaptive state starting at level, or 0 if out of memory.
+ * Pass level 0 for compression types without levels */
+ripcAdaptComp *ripcAdaptCompNew(RsslInt32 level);
+
+void ripcAdaptCompFree(ripcAdaptComp *adaptComp);
+
+/* Returns the current time in nanoseconds, for timing compression */
+RsslUInt64 ripcAdaptCompTime();
+
+/* Called for each message that is eligible for compression.  Returns 1 if it should be compressed */
+RsslInt32 ripcAdaptCompCheck(ripcAdaptComp *adaptComp, RsslUInt32 length);
+
+/* Records the result of compressing a message of length bytes into compLen bytes */
+void ripcAdaptCompRecord(ripcAdaptComp *adaptComp, RsslUInt32 length, RsslUInt32 compLen, RsslUInt64 compressNs);
+
+/* Called after each flush with the number of bytes still queued on the channel.
+ * Returns the level the compressor should change to, or 0 to keep the current one */
+RsslInt32 ripcAdaptCompFlushed(ripcAdaptComp *adaptComp, RsslInt32 queuedBytes);
+
+/* Stops changing the level, e.g. because the compressor failed to change it */
+void ripcAdaptCompFixLevel(ripcAdaptComp *adaptComp, RsslInt32 level);
+
+void ripcAdaptCompGetInfo(ripcAdaptComp *adaptComp, RsslAdaptiveCompInfo *info);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
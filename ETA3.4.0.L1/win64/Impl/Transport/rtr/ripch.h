@@ -96,8 +96,10 @@ typedef struct {
 	RsslUInt64	shared_key;  /* used for encryption/decryption - 0 when not available */
 } RIPC_SOCKET;
 
-#define RSSL_COMP_ALL_TYPE ((unsigned)RSSL_COMP_ZLIB | (unsigned)RSSL_COMP_LZ4)
-#define RSSL_COMP_MAX_TYPE 0x02		/* set to the highest ripcCompressType enum value */
+#define RSSL_COMP_ALL_TYPE ((unsigned)RSSL_COMP_ZLIB | (unsigned)RSSL_COMP_LZ4 | (unsigned)RSSL_COMP_ZSTD)
+#define RSSL_COMP_MAX_TYPE 0x04		/* set to the highest ripcCompressType enum value */
+/* compression types that compress each message on its own and may grow it; these go through tempCompressBuf */
+#define RSSL_COMP_IS_BLOCK(__type) (((__type) == RSSL_COMP_LZ4) || ((__type) == RSSL_COMP_ZSTD))
 #define ZLIB_COMP_MAX_LEVEL 9
 #define ZLIB_COMP_MIN_LEVEL 0
 
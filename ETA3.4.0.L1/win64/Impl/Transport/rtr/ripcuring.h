@@ -0,0 +1,100 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __ripcuring_h
+#define __ripcuring_h
+
+/* Batches socket receives and vectored sends for channels using
+ * RSSL_SOCKET_IO_URING through one io_uring shared by the process.
+ *
+ * Operations are queued by the channel and handed to the kernel together by
+ * ripcUringSubmit.  Every operation is issued with MSG_DONTWAIT, so it
+ * completes during ripcUringSubmit and never consumes a socket's readiness
+ * after the call returns; select/poll based dispatch keeps working unchanged.
+ * The ring is driven through the raw system calls, liburing is not required.
+ */
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslTransport.h"
+#include "rtr/rtratomic.h"
+#include "rtr/socket.h"
+#include "rtr/ripcutils.h"
+
+#if defined(Linux) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RIPC_HAS_IO_URING
+#include <sys/socket.h>
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* number of submission queue entries in the process wide ring */
+#define RIPC_URING_ENTRIES	256
+
+typedef enum {
+	RIPC_URING_OP_IDLE		= 0,	/* nothing outstanding */
+	RIPC_URING_OP_PENDING	= 1,	/* queued or in the kernel; buffers belong to the ring */
+	RIPC_URING_OP_DONE		= 2		/* result holds the completion */
+} ripcUringOpState;
+
+typedef struct
+{
+	rtr_atomic_val		state;		/* ripcUringOpState */
+	RsslInt32			result;		/* bytes transferred, or -errno */
+} ripcUringOp;
+
+/* per channel state, allocated the first time a RSSL_SOCKET_IO_URING channel prepares a read */
+typedef struct
+{
+	ripcUringOp			readOp;
+	ripcUringOp			writeOp;
+	/* the vector handed to the kernel by the last queued send, kept
+	 * so the completion can be applied to the priority queues */
+	ripcIovType			wrtvec[RIPC_MAXIOVLEN];
+	RsslInt32			iovPriority[RIPC_MAXIOVLEN + 1];
+	RsslInt32			wrtveclen;
+#ifdef RIPC_HAS_IO_URING
+	struct msghdr		msg;
+#endif
+} ripcUringChannel;
+
+/* Called from rsslSocketInitialize; the ring itself is created on first use */
+void ripcUringInitialize();
+
+/* Waits for outstanding operations and tears down the ring */
+void ripcUringUninitialize();
+
+/* Returns new channel state, or 0 if io_uring is not available and the channel should use plain system calls */
+ripcUringChannel *ripcUringNewChannel();
+
+/* Waits until the kernel is done with the channel's buffers, then frees the state */
+void ripcUringFreeChannel(ripcUringChannel *uringChnl);
+
+/* Queues a receive of up to len bytes into buf.  Returns 1 if queued, 0 if the read is
+ * already outstanding or the ring is full */
+RsslInt32 ripcUringQueueRecv(ripcUringChannel *uringChnl, RsslSocket fd, char *buf, RsslInt32 len);
+
+/* Queues a send of uringChnl->wrtvec.  Returns 1 if queued, 0 if the ring is full */
+RsslInt32 ripcUringQueueSend(ripcUringChannel *uringChnl, RsslSocket fd);
+
+/* Returns the state of op; when it is RIPC_URING_OP_DONE the result is
+ * stored in *result and op goes back to RIPC_URING_OP_IDLE */
+ripcUringOpState ripcUringTakeResult(ripcUringOp *op, RsslInt32 *result);
+
+/* Hands every queued operation to the kernel in one system call and collects
+ * the completions.  Returns the number of completions, or RSSL_RET_FAILURE */
+RsslInt32 ripcUringSubmit(RsslError *error);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
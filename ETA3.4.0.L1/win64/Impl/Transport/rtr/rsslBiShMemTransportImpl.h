@@ -0,0 +1,196 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_IMPL_H
+#define __RTR_RSSL_BIDIRECTION_SHMEM_TRANSPORT_IMPL_H
+
+/* Contains function declarations and shared memory layout for the
+ * bidirectional shared memory connection type.
+ *
+ * The segment holds a header followed by two single producer/single consumer
+ * rings, one per direction.  Each ring carries variable length records, so a
+ * message of up to maxFragmentSize is written in place and read without a copy.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslChanManagement.h"
+#include "rtr/shmemtrans.h"
+#include "rtr/rwfNet.h"
+#include "rtr/rwfNetwork.h"
+#include <stdio.h>
+
+#define 	RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(ret)		ret RTR_FASTCALL
+
+#define RSSL_BISHM_VERSION				3		/* the unidirectional segment is version 1 */
+
+/* segment header flags */
+#define RSSL_BISHM_SERVER_INITIALIZED	0x01
+#define RSSL_BISHM_SERVER_SHUTDOWN		0x02
+#define RSSL_BISHM_CLIENT_ATTACHED		0x04
+#define RSSL_BISHM_CLIENT_DETACHED		0x08
+#define RSSL_BISHM_SERVER_PING_ENABLED	0x10
+
+/* record flags */
+#define RSSL_BISHM_REC_PAD				0x01	/* skip to the start of the ring */
+#define RSSL_BISHM_REC_PING				0x02
+
+/* largest ring we will create; keeps the 32 bit offsets unambiguous after they wrap */
+#define RSSL_BISHM_MAX_RING_SIZE		0x40000000
+
+/* segment header - the fixed fields are all 32 bits wide (rtr_atomic_val included), so the compiler
+ * inserts no padding and 32 and 64 bit processes agree on the layout */
+typedef struct
+{
+	rtrUInt32			shmemVersion;
+	rtr_atomic_val		flags;
+	rtrUInt32			pingTimeout;
+	rtrUInt32			protocolType;
+	rtrUInt32			majorVersion;
+	rtrUInt32			minorVersion;
+	rtrUInt32			maxMsgSize;
+	rtrUInt32			pad;
+	rtrUInt8			serverComponentVersionLen;
+	char				serverComponentVersion[RSSL_SHM_COMPONENT_VERSION_SIZE];
+	rtrUInt8			clientComponentVersionLen;
+	char				clientComponentVersion[RSSL_SHM_COMPONENT_VERSION_SIZE];
+} rsslBiShmHdr;
+
+/* one direction of the channel.  The writer owns writeOffset, the reader owns readOffset;
+ * they are kept on separate 64 byte cache lines so the two processes do not false share.
+ * Offsets increase forever and are masked with size - 1 to find the position in the ring.
+ * The writer publishes writeOffset with a release store and the reader loads it with acquire,
+ * so a record is complete before the reader sees it; readOffset is handed back the same way. */
+typedef struct
+{
+	volatile rtrUInt32	writeOffset;
+	char				pad1[60];
+	volatile rtrUInt32	readOffset;
+	char				pad2[60];
+	rtr_atomic_val		wakeSeq;			/* futex word, bumped by the writer when the reader is asleep */
+	rtr_atomic_val		readerSleeping;
+	rtr_atomic_val		readerArmed;		/* reader waits for its eventfd; set at bind and when the reader finds the ring empty */
+	rtrUInt32			size;				/* power of 2 */
+	rtrUInt32			wakeupType;			/* RsslShmemWakeupTypes of the reader */
+	char				pad3[44];
+} rsslBiShmRing;
+
+/* record header written in front of every message in a ring.  RSSL_BISHM_REC_LEN rounds the header
+ * and message up to a multiple of 8 bytes, so every record header starts 8 byte aligned */
+typedef struct
+{
+	rtrUInt32			length;
+	rtrUInt32			flags;
+} rsslBiShmRec;
+
+#define RSSL_BISHM_REC_LEN(___len)	((rtrUInt32)RTR_8BYTE_ALIGN((___len) + sizeof(rsslBiShmRec)))
+
+/* per process view of a bidirectional shared memory channel */
+typedef struct
+{
+	rtrShmSeg			shMemSeg;
+	rtrShmMutexPtr		controlMutex;
+#if defined(Linux)
+	int					_fdSocket;			/* server - listens for the client; client - receives the eventfds from the server */
+	int					_readyFd;			/* eventfd written by the other side when it publishes to inRing */
+	int					_peerReadyFd;		/* eventfd the other side waits on for outRing */
+#else
+	rssl_pipe			_bindPipe;			/* server only - holds a byte until the channel is accepted */
+	rssl_pipe			_pipe;				/* always readable so the user keeps calling rsslRead */
+#endif
+	RsslBool			isServer;
+	RsslBool			channelsBlocking;
+	RsslBool			accepted;
+	RsslBool			_hasBuffer;
+	rsslBiShmHdr		*hdr;
+	rsslBiShmRing		*outRing;
+	char				*outData;
+	rsslBiShmRing		*inRing;
+	char				*inData;
+	rtrUInt32			outPadLen;			/* pad record reserved in front of the outstanding buffer */
+	rtrUInt32			inPendingLen;		/* record returned by the last rsslRead, released on the next one */
+	rtrUInt32			emptyReads;
+	rtrUInt32			wakeupSpinCount;
+	rtrUInt32			wakeupTimeout;
+} rsslBiShmChannel;
+
+/* Contains code necessary for creating a shared memory segment */
+RsslRet rsslBiShMemBind(rsslServerImpl* rsslSrvrImpl, RsslBindOptions *opts, RsslError *error );
+
+/* Contains code necessary for accepting the inbound shared memory connection to a shm segment */
+rsslChannelImpl* rsslBiShMemAccept(rsslServerImpl *rsslSrvrImpl, RsslAcceptOptions *opts, RsslError *error);
+
+/* Contains code necessary for connecting to a shared memory segment */
+RsslRet rsslBiShMemConnect(rsslChannelImpl* rsslChnlImpl, RsslConnectOptions *opts, RsslError *error);
+
+/* Contains code necessary to reconnect shmem connections and bridge data flow (no-op) */
+RsslRet rsslBiShMemReconnect(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary for shared memory connections (client or server side) to wait for the other side */
+RsslRet rsslBiShMemInitChannel(rsslChannelImpl* rsslChnlImpl, RsslInProgInfo *inProg, RsslError *error);
+
+/* Contains code necessary to disconnect from a shared memory segment (client or server side) */
+RsslRet rsslBiShMemCloseChannel(rsslChannelImpl* rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to read from a shared memory segment (client or server side) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBiShMemRead(rsslChannelImpl* rsslChnlImpl, RsslReadOutArgs *readOutArgs, RsslRet *readRet, RsslError *error);
+
+/* Contains code necessary to write data going to a shared memory segment (client or server side) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemWrite(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslWriteInArgs *writeInArgs, RsslWriteOutArgs *writeOutArgs, RsslError *error);
+
+/* Contains code necessary to flush data to shared memory segment (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemFlush(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to obtain a buffer in the outbound ring (client or server side) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(rsslBufferImpl*) rsslBiShMemGetBuffer(rsslChannelImpl *rsslChnlImpl, RsslUInt32 size, RsslBool packedBuffer, RsslError *error);
+
+/* Contains code necessary to release an unused/unsuccessfully written buffer */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemReleaseBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
+
+/* Contains code necessary to query number of used output buffers for shared memory connection */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBiShMemBufferUsage(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to query number of used buffers by the server (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslInt32) rsslBiShMemSrvrBufferUsage(rsslServerImpl *rsslSrvrImpl, RsslError *error);
+
+/* Contains code necessary for buffer packing with shared memory connection buffer (not supported) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslBuffer*) rsslBiShMemPackBuffer(rsslChannelImpl *rsslChnlImpl, rsslBufferImpl *rsslBufImpl, RsslError *error);
+
+/* Contains code necessary to send a ping message */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemPing(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Contains code necessary to query shared memory channel for more detailed connection info (client or server side) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemGetChannelInfo(rsslChannelImpl *rsslChnlImpl, RsslChannelInfo *info, RsslError *error);
+
+/* Contains code necessary to query shared memory server for more detailed connection info (server only) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemGetSrvrInfo(rsslServerImpl *rsslSrvrImpl, RsslServerInfo *info, RsslError *error);
+
+/* Contains code necessary to do an ioctl on a shmem channel (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemIoctl(rsslChannelImpl *rsslChnlImpl, RsslIoctlCodes code, void *value, RsslError *error);
+
+/* Contains code necessary to do an ioctl on a shmem server (no-op) */
+RSSL_RSSL_BIDIRECTION_SHMEM_IMPL_FAST(RsslRet) rsslBiShMemSrvrIoctl(rsslServerImpl *rsslSrvrImpl, RsslIoctlCodes code, void *value, RsslError *error);
+
+/* Releases the shared memory segment created by rsslBiShMemBind */
+RsslRet rsslBiShMemDestroy(void *transportInfo, RsslError *error);
+
+// Contains code necessary to set the debug func pointers for BiShMem transport
+RsslRet rsslSetBiShMemDebugFunctions(
+	void(*dumpRsslIn)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+	void(*dumpRsslOut)(const char *functionName, char *buffer, RsslUInt32 length, RsslSocket socketId),
+	RsslError *error);
+
+#ifdef __cplusplus
+};
+#endif
+
+
+#endif
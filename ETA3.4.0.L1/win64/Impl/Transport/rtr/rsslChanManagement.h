@@ -36,7 +36,8 @@ typedef struct RsslTransServerFuncs RsslTransServerFuncs;
 #define RSSL_UNIDIRECTION_SHMEM_TRANSPORT  1
 #define RSSL_RRCP_TRANSPORT 2
 #define RSSL_SEQ_MCAST_TRANSPORT 3
-#define RSSL_MAX_TRANSPORTS     RSSL_SEQ_MCAST_TRANSPORT + 1
+#define RSSL_BIDIRECTION_SHMEM_TRANSPORT 4
+#define RSSL_MAX_TRANSPORTS     RSSL_BIDIRECTION_SHMEM_TRANSPORT + 1
 
 /* used for all connection types to control locking */
 extern RsslLockingTypes multiThread;  /* 0 == No Locking; 1 == All locking; 2 == Only global locking */
@@ -39,6 +39,12 @@ RsslRet rsslSocketInitialize(RsslInitializeExOpts *rsslInitOpts, RsslError *erro
 /* Uninitializes socket transport */
 RsslRet rsslSocketUninitialize();
 
+/* Stages an io_uring read on a channel using RSSL_SOCKET_IO_URING */
+RsslRet rsslSocketPrepareRead(rsslChannelImpl *rsslChnlImpl, RsslError *error);
+
+/* Performs staged io_uring reads and writes for every socket channel */
+RsslRet rsslSocketSubmitIo(RsslError *error);
+
 #ifdef __cplusplus
 };
 #endif
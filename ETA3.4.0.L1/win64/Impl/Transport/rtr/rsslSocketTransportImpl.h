@@ -24,6 +24,8 @@ extern "C" {
 #include "rtr/ripch.h"
 #include "rtr/ripc_int.h"
 #include "rtr/ripcutils.h"
+#include "rtr/ripcuring.h"
+#include "rtr/ripcadaptcomp.h"
 #include "rtr/custmem.h"
 #include "rtr/rwfNet.h"
 #include "rtr/rwfNetwork.h"
@@ -39,8 +41,8 @@ extern "C" {
 #define RIPC_RWF_PROTOCOL_TYPE 0 /* TODO must match definition for RWF in RSSL */
 #define RIPC_TRWF_PROTOCOL_TYPE 1 /* TODO must match definition for TRWF in RSSL */
 
-/* Current number of bytes in the compression bitmap */
-#define RIPC_COMP_BITMAP_SIZE 1
+/* Number of bytes kept for the compression bitmap; room for the zstd dictionary ID that follows it */
+#define RIPC_COMP_BITMAP_SIZE RSSL_COMP_ZSTD_BITMAP_SIZE
 
 #define RIPC_SOCKET_TRANSPORT   0
 #define RIPC_OPENSSL_TRANSPORT  1
@@ -251,12 +253,14 @@ typedef struct {
 } ripcCompBuffer;
 
 typedef struct {
-	void*	(*compressInit)(int compressionLevel, RsslError*);
-	void*	(*decompressInit)(RsslError*);
+	void*	(*compressInit)(int compressionLevel, void *compDict, RsslError*);
+	void*	(*decompressInit)(void *compDict, RsslError*);
 	void(*compressEnd)(void *compressInfo);
 	void(*decompressEnd)(void *compressInfo);
 	int(*compress)(void *compressInfo, ripcCompBuffer *buf, RsslError *error);
 	int(*decompress)(void *compressInfo, ripcCompBuffer *buf, RsslError *error);
+	int(*compressBound)(int length);	/* only set by compression types that compress each message on its own (LZ4, zstd) */
+	int(*setLevel)(void *compressInfo, int compressionLevel, RsslError *error);	/* changes the level between messages; 0 for types without levels (LZ4) */
 } ripcCompFuncs;
 
 typedef struct {
@@ -270,6 +274,7 @@ typedef struct {
 	RsslUInt32	numInputBufs;		/* number of input buffers used to read in data */
 	RsslUInt32  compressionSupported;	/* a bitmask of The types of compression supported by this server. 0 means no compression */
 	RsslUInt32	zlibCompressionLevel;	/* compression level for zlib */
+	void		*compDict;			/* zstd dictionary shared by accepted channels, 0 if none */
 	RsslBool	forcecomp;			/* Force compression */
 	RsslBool	server_blocking;	/* Perform server blocking operations */
 	RsslBool	session_blocking;	/* Perform session blocking operations */
@@ -299,6 +304,7 @@ typedef struct {
 	RsslUInt32		encryptionProtocolFlags;
 	char*			serverCert;
 	char*			serverPrivateKey;
+	RsslUInt32		ioMode;				/* RsslSocketIoModes for accepted channels */
 } RsslServerSocketChannel;
 
 #define RSSL_INIT_SERVER_SOCKET_Bind { 0, 0, 0, 0, 0, 0, 0, RSSL_COMP_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, RSSL_ENC_TLSV1_2, 0, 0 };
@@ -405,6 +411,7 @@ typedef struct
 	ripcCompFuncs		*outCompFuncs;
 	void				*c_stream_in;
 	void				*c_stream_out;			/* Compression stream information */
+	void				*compDict;				/* zstd dictionary, 0 if none; owned by ripccomp.c */
 
 	RsslUInt32			httpHeaders : 1;		/* Is there http header information */
 	RsslUInt32			isJavaTunnel : 1;		/* Is this a single-channel HTTP connection (i.e. from a java client) */
@@ -415,8 +422,11 @@ typedef struct
 	RsslUInt32			upperCompressionThreshold;			/* dont compress any buffers larger than this */
 	RsslUInt32			high_water_mark;		/* used for the upper buffer usage threshold for this channel */
 	RsslUInt32			safeLZ4 : 1;			/* limits LZ4 compression to only packets that wont span multiple buffers */
+	ripcAdaptComp		*adaptComp;				/* adaptive compression state, set by RSSL_COMPRESSION_ADAPTIVE */
 
 	ripcTransportFuncs	*transportFuncs; /* The transport functions to use */
+	RsslUInt32			ioMode;			/* RsslSocketIoModes requested by the user */
+	ripcUringChannel	*uringChnl;		/* io_uring state, set once an RSSL_SOCKET_IO_URING channel stages its first read */
 
 	RsslUInt32			keyExchange : 1; /* indicates whether we should be exchanging encryption keys on the handshake */
 	RsslUInt8			usingWinInet;	/* indicates whether we are using wininet - needed for proxy override */
@@ -495,6 +505,7 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->inDecompFuncs = 0;
 	rsslSocketChannel->outCompFuncs = 0;
 	rsslSocketChannel->c_stream_out = 0;
+	rsslSocketChannel->compDict = 0;
 	rsslSocketChannel->c_stream_in = 0;
 	rsslSocketChannel->srvrcomp = 0;
 	rsslSocketChannel->forcecomp = 0;
@@ -507,9 +518,12 @@ RTR_C_INLINE void ripcClearRsslSocketChannel(RsslSocketChannel *rsslSocketChanne
 	rsslSocketChannel->upperCompressionThreshold = 10000000;
 	rsslSocketChannel->high_water_mark = 6000;
 	rsslSocketChannel->safeLZ4 = 0;
+	rsslSocketChannel->adaptComp = 0;
 	rsslSocketChannel->keyExchange = 0;
 	rsslSocketChannel->transportFuncs = 0; 
 	rsslSocketChannel->transportInfo = 0; 
+	rsslSocketChannel->ioMode = RSSL_SOCKET_IO_DEFAULT;
+	rsslSocketChannel->uringChnl = 0;
 	rsslSocketChannel->sendBufSize = 0;
 	rsslSocketChannel->recvBufSize = 0;
 	rsslSocketChannel->usingWinInet = 0;
@@ -8,6 +8,8 @@
 
 #include "rtr/rsslHashTable.h"
 
+#include <string.h>
+
 /* U16 */
 
 RSSL_API RsslUInt32 rsslHashU16Sum(void *pKey)
@@ -34,19 +36,35 @@ RSSL_API RsslBool rsslHashU64Compare(void *pKey1, void *pKey2)
 
 /* RsslBuffer */
 
+/* Hashes the buffer eight bytes at a time. */
 RSSL_API RsslUInt32 rsslHashBufferSum(void *pKey)
 {
-	RsslUInt32 i;
-	RsslUInt32 hashSum = 0;
 	RsslBuffer *pBuffer = (RsslBuffer*)pKey;
+	const char *pData = pBuffer->data;
+	RsslUInt32 length = pBuffer->length;
+	RsslUInt64 hashSum = length;
+	RsslUInt64 word;
 
-	for(i = 0; i < pBuffer->length; ++i)
+	for(; length >= sizeof(RsslUInt64); length -= sizeof(RsslUInt64), pData += sizeof(RsslUInt64))
 	{
-		hashSum = (hashSum << 4) + (RsslUInt32)pBuffer->data[i];
-		hashSum ^= (hashSum >> 12);
+		memcpy(&word, pData, sizeof(RsslUInt64));
+		hashSum = (hashSum ^ word) * 0xff51afd7ed558ccdULL;
+		hashSum ^= (hashSum >> 32);
 	}
 
-	return hashSum;
+	if (length)
+	{
+		word = 0;
+		memcpy(&word, pData, length);
+		hashSum = (hashSum ^ word) * 0xff51afd7ed558ccdULL;
+		hashSum ^= (hashSum >> 32);
+	}
+
+	hashSum ^= (hashSum >> 33);
+	hashSum *= 0xc4ceb9fe1a85ec53ULL;
+	hashSum ^= (hashSum >> 29);
+
+	return (RsslUInt32)hashSum;
 }
 
 RSSL_API RsslBool rsslHashBufferCompare(void *pKey1, void *pKey2)
@@ -10,7 +10,7 @@
 #include <stdlib.h>
 
 /* On windows, select is used for notification.
- * Otherwise poll is used. */
+ * Otherwise poll is used, unless the notifier was created for epoll (Linux only). */
 #if defined(WIN32)
 #define FD_SETSIZE 6400
 #include <winsock2.h>
@@ -18,6 +18,11 @@
 #include <poll.h>
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+#include <unistd.h>
+#include <errno.h>
+#endif
+
 typedef struct
 {
 	RsslNotifierEvent base;
@@ -31,6 +36,12 @@ typedef struct
 	SOCKET _fd;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	int _fd; /* Descriptor registered with epoll for this event */
+	int _epollFlags; /* RsslNotifierEvent flags currently registered with epoll. */
+	int _added; /* Set while the event is counted in the notifier's _eventCount. */
+#endif
+
 } RsslNotifierEventImpl;
 
 typedef struct
@@ -46,8 +57,135 @@ typedef struct
 	fd_set _writeFds; /* Write fd_set */
 	fd_set _exceptFds; /* Except fd_set */
 #endif
+#ifdef RSSL_NOTIFIER_EPOLL
+	int _epollFd; /* epoll descriptor. Set to -1 when poll is used instead. */
+	struct epoll_event *_epollEvents; /* Array populated by epoll_wait. */
+	RsslNotifierEventImpl **_lastNotifiedEvents; /* Events notified by the last wait, whose flags must be cleared by the next one. */
+	int _lastNotifiedEventCount;
+	RsslNotifierEventImpl **_fdOwners; /* Event that most recently added each descriptor number, indexed by descriptor. */
+	int _fdOwnerCount; /* Number of descriptors the _fdOwners array can hold. */
+#endif
 } RsslNotifierImpl;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+#define RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl) ((pNotifierImpl)->_epollFd != -1)
+
+/* Converts RsslNotifierEvent flags to the epoll events to register. */
+RTR_C_INLINE unsigned int _notifierEpollEvents(int registeredFlags)
+{
+	unsigned int events = 0;
+
+	if (registeredFlags & RSSL_NESF_READ)
+		events |= EPOLLIN | EPOLLPRI;
+
+	if (registeredFlags & RSSL_NESF_WRITE)
+		events |= EPOLLOUT;
+
+	return events;
+}
+
+/* Indicates whether an event's descriptor number still belongs to it.
+ * Once the descriptor is closed, its number may be reused by a descriptor added for another event. epoll_ctl
+ * identifies descriptors by number, so the event must then leave the number alone. */
+RTR_C_INLINE int _notifierEpollOwnsFd(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	return pNotifierEventImpl->_fd >= 0 && pNotifierEventImpl->_fd < pNotifierImpl->_fdOwnerCount
+		&& pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] == pNotifierEventImpl;
+}
+
+/* Removes an event's descriptor from the epoll set, unless its number now belongs to another event. */
+static void _notifierEpollDel(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	if (_notifierEpollOwnsFd(pNotifierImpl, pNotifierEventImpl))
+	{
+		/* The descriptor may already be closed (and so removed from the set), so errors are ignored. */
+		epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_DEL, pNotifierEventImpl->_fd, NULL);
+		pNotifierImpl->_fdOwners[pNotifierEventImpl->_fd] = NULL;
+	}
+
+	pNotifierEventImpl->_fd = -1;
+	pNotifierEventImpl->_epollFlags = 0;
+}
+
+/* Updates the epoll registration of an event to match its registered flags. */
+static int _notifierEpollUpdate(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	struct epoll_event epollEvent;
+
+	if (pNotifierEventImpl->_epollFlags == pNotifierEventImpl->_registeredFlags)
+		return 0;
+
+	/* Descriptor was closed and its number given to another event. */
+	if (!_notifierEpollOwnsFd(pNotifierImpl, pNotifierEventImpl))
+		return -1;
+
+	memset(&epollEvent, 0, sizeof(struct epoll_event));
+	epollEvent.events = _notifierEpollEvents(pNotifierEventImpl->_registeredFlags);
+	epollEvent.data.ptr = pNotifierEventImpl;
+
+	if (epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_MOD, pNotifierEventImpl->_fd, &epollEvent) < 0)
+		return -1;
+
+	pNotifierEventImpl->_epollFlags = pNotifierEventImpl->_registeredFlags;
+	return 0;
+}
+
+/* Adds an event's descriptor to the epoll set, registered for its current flags. */
+static int _notifierEpollAdd(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl, int fd)
+{
+	struct epoll_event epollEvent;
+
+	if (fd < 0)
+		return -1;
+
+	if (fd >= pNotifierImpl->_fdOwnerCount)
+	{
+		int fdOwnerCount = pNotifierImpl->_fdOwnerCount ? pNotifierImpl->_fdOwnerCount : 64;
+		RsslNotifierEventImpl **fdOwners;
+
+		while (fdOwnerCount <= fd)
+			fdOwnerCount *= 2;
+
+		fdOwners = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_fdOwners, fdOwnerCount * sizeof(RsslNotifierEventImpl*));
+		if (fdOwners == NULL)
+			return -1;
+
+		memset(&fdOwners[pNotifierImpl->_fdOwnerCount], 0, (fdOwnerCount - pNotifierImpl->_fdOwnerCount) * sizeof(RsslNotifierEventImpl*));
+		pNotifierImpl->_fdOwners = fdOwners;
+		pNotifierImpl->_fdOwnerCount = fdOwnerCount;
+	}
+
+	memset(&epollEvent, 0, sizeof(struct epoll_event));
+	epollEvent.events = _notifierEpollEvents(pNotifierEventImpl->_registeredFlags);
+	epollEvent.data.ptr = pNotifierEventImpl;
+
+	if (epoll_ctl(pNotifierImpl->_epollFd, EPOLL_CTL_ADD, fd, &epollEvent) < 0)
+		return -1;
+
+	/* If the number was still recorded for another event, that event's descriptor was closed. */
+	pNotifierImpl->_fdOwners[fd] = pNotifierEventImpl;
+	pNotifierEventImpl->_fd = fd;
+	pNotifierEventImpl->_epollFlags = pNotifierEventImpl->_registeredFlags;
+	return 0;
+}
+
+/* Removes an event from the list of events notified by the last wait, so its flags are not touched after removal. */
+static void _notifierEpollForgetNotified(RsslNotifierImpl *pNotifierImpl, RsslNotifierEventImpl *pNotifierEventImpl)
+{
+	int i;
+
+	for (i = 0; i < pNotifierImpl->_lastNotifiedEventCount; ++i)
+	{
+		if (pNotifierImpl->_lastNotifiedEvents[i] == pNotifierEventImpl)
+		{
+			pNotifierImpl->_lastNotifiedEvents[i] = pNotifierImpl->_lastNotifiedEvents[pNotifierImpl->_lastNotifiedEventCount - 1];
+			--pNotifierImpl->_lastNotifiedEventCount;
+			return;
+		}
+	}
+}
+#endif
+
 RSSL_API RsslNotifierEvent *rsslCreateNotifierEvent()
 {
 	return (RsslNotifierEvent*)calloc(sizeof(RsslNotifierEventImpl), 1);
@@ -66,10 +204,49 @@ RSSL_API void *rsslNotifierEventGetObject(RsslNotifierEvent *pEvent)
 
 
 RSSL_API RsslNotifier *rsslCreateNotifier(int maxEventsHint)
+{
+	return rsslCreateNotifierEx(maxEventsHint, RSSL_NOTIFIER_TYPE_DEFAULT);
+}
+
+RSSL_API RsslNotifier *rsslCreateNotifierEx(int maxEventsHint, RsslNotifierType notifierType)
 {
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)malloc(sizeof(RsslNotifierImpl));
+	if (pNotifierImpl == NULL)
+		return NULL;
+
 	memset(pNotifierImpl, 0, sizeof(RsslNotifierImpl));
 
+	if (maxEventsHint < 1)
+		maxEventsHint = 1;
+
+#ifdef RSSL_NOTIFIER_EPOLL
+	pNotifierImpl->_epollFd = -1;
+
+	if (notifierType == RSSL_NOTIFIER_TYPE_EPOLL)
+	{
+		if ((pNotifierImpl->_epollFd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+		{
+			pNotifierImpl->_epollFd = -1;
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+
+		pNotifierImpl->_maxEvents = maxEventsHint;
+		pNotifierImpl->base.notifiedEvents = (RsslNotifierEvent**)malloc(maxEventsHint * sizeof(RsslNotifierEvent*));
+		pNotifierImpl->_lastNotifiedEvents = (RsslNotifierEventImpl**)malloc(maxEventsHint * sizeof(RsslNotifierEventImpl*));
+		pNotifierImpl->_epollEvents = (struct epoll_event*)malloc(maxEventsHint * sizeof(struct epoll_event));
+
+		if (pNotifierImpl->base.notifiedEvents == NULL || pNotifierImpl->_lastNotifiedEvents == NULL 
+				|| pNotifierImpl->_epollEvents == NULL)
+		{
+			rsslDestroyNotifier(&pNotifierImpl->base);
+			return NULL;
+		}
+
+		return &pNotifierImpl->base;
+	}
+#endif
+
 	pNotifierImpl->_maxEvents = maxEventsHint;
 	pNotifierImpl->_events = (RsslNotifierEventImpl**)malloc(maxEventsHint * sizeof(RsslNotifierEventImpl**));
 	if (pNotifierImpl->_events == NULL)
@@ -103,6 +280,23 @@ RSSL_API void rsslDestroyNotifier(RsslNotifier *pNotifier)
 	free(pNotifierImpl->_events);
 	pNotifierImpl->_events = NULL;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+	{
+		close(pNotifierImpl->_epollFd);
+		pNotifierImpl->_epollFd = -1;
+	}
+
+	free(pNotifierImpl->_epollEvents);
+	pNotifierImpl->_epollEvents = NULL;
+
+	free(pNotifierImpl->_lastNotifiedEvents);
+	pNotifierImpl->_lastNotifiedEvents = NULL;
+
+	free(pNotifierImpl->_fdOwners);
+	pNotifierImpl->_fdOwners = NULL;
+#endif
+
 	free(pNotifierImpl->base.notifiedEvents);
 	pNotifierImpl->base.notifiedEvents = NULL;
 
@@ -125,6 +319,45 @@ RSSL_API int rsslNotifierAddEvent(RsslNotifier *pNotifier, RsslNotifierEvent *pE
 		return -1;
 #endif
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+	{
+		/* epoll tracks the events itself, so only the arrays receiving notifications need to grow. */
+		if (pNotifierImpl->_eventCount == pNotifierImpl->_maxEvents)
+		{
+			RsslNotifierEvent **notifiedEvents;
+			RsslNotifierEventImpl **lastNotifiedEvents;
+			struct epoll_event *epollEvents;
+
+			notifiedEvents = (RsslNotifierEvent**)realloc(pNotifierImpl->base.notifiedEvents, pNotifierImpl->_maxEvents * 2 * sizeof(RsslNotifierEvent*));
+			if (notifiedEvents == NULL)
+				return -1;
+			pNotifierImpl->base.notifiedEvents = notifiedEvents;
+
+			lastNotifiedEvents = (RsslNotifierEventImpl**)realloc(pNotifierImpl->_lastNotifiedEvents, pNotifierImpl->_maxEvents * 2 * sizeof(RsslNotifierEventImpl*));
+			if (lastNotifiedEvents == NULL)
+				return -1;
+			pNotifierImpl->_lastNotifiedEvents = lastNotifiedEvents;
+
+			epollEvents = (struct epoll_event*)realloc(pNotifierImpl->_epollEvents, pNotifierImpl->_maxEvents * 2 * sizeof(struct epoll_event));
+			if (epollEvents == NULL)
+				return -1;
+			pNotifierImpl->_epollEvents = epollEvents;
+
+			pNotifierImpl->_maxEvents *= 2;
+		}
+
+		pNotifierEventImpl->_registeredFlags = 0;
+		if (_notifierEpollAdd(pNotifierImpl, pNotifierEventImpl, fd) < 0)
+			return -1;
+
+		pNotifierEventImpl->_object = object;
+		pNotifierEventImpl->_added = 1;
+		++pNotifierImpl->_eventCount;
+		return 0;
+	}
+#endif
+
 
 	if (pNotifierImpl->_eventCount == pNotifierImpl->_maxEvents)
 	{
@@ -176,6 +409,16 @@ RSSL_API int rsslNotifierUpdateEventFd(RsslNotifier *pNotifier, RsslNotifierEven
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	int i;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+	{
+		/* The previous descriptor is closed, so it has normally left the epoll set already. Remove it in case it was duplicated. 
+		 * As with poll, the new descriptor keeps the notification that was registered for the old one. */
+		_notifierEpollDel(pNotifierImpl, pNotifierEventImpl);
+		return _notifierEpollAdd(pNotifierImpl, pNotifierEventImpl, fd);
+	}
+#endif
+
 	pNotifierEventImpl->_registeredFlags = 0;
 
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
@@ -204,6 +447,21 @@ RSSL_API int rsslNotifierRemoveEvent(RsslNotifier *pNotifier, RsslNotifierEvent
 
 	pNotifierEventImpl->_registeredFlags = 0;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+	{
+		/* As with poll, removing an event that is not in the notifier changes nothing. */
+		if (!pNotifierEventImpl->_added)
+			return 0;
+
+		_notifierEpollDel(pNotifierImpl, pNotifierEventImpl);
+		_notifierEpollForgetNotified(pNotifierImpl, pNotifierEventImpl);
+		pNotifierEventImpl->_added = 0;
+		--pNotifierImpl->_eventCount;
+		return 0;
+	}
+#endif
+
 	for (i = 0; i < pNotifierImpl->_eventCount; ++i)
 	{
 		if (pNotifierImpl->_events[i] == pNotifierEventImpl)
@@ -233,6 +491,10 @@ RSSL_API int rsslNotifierRegisterRead(RsslNotifier *pNotifier, RsslNotifierEvent
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_READ;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLIN | POLLPRI;
 #endif
@@ -244,6 +506,10 @@ RSSL_API int rsslNotifierUnregisterRead(RsslNotifier *pNotifier, RsslNotifierEve
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_READ;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~(POLLIN | POLLPRI);
 #endif
@@ -256,6 +522,10 @@ RSSL_API int rsslNotifierRegisterWrite(RsslNotifier *pNotifier, RsslNotifierEven
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags |= RSSL_NESF_WRITE;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events |= POLLOUT;
 #endif
@@ -267,6 +537,10 @@ RSSL_API int rsslNotifierUnregisterWrite(RsslNotifier *pNotifier, RsslNotifierEv
 	RsslNotifierImpl *pNotifierImpl = (RsslNotifierImpl*)pNotifier;
 	RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pEvent;
 	pNotifierEventImpl->_registeredFlags &= ~RSSL_NESF_WRITE;
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+		return _notifierEpollUpdate(pNotifierImpl, pNotifierEventImpl);
+#endif
 #ifndef WIN32
 	pNotifierImpl->_pollFds[pNotifierEventImpl->_pollFdIndex].events &= ~POLLOUT;
 #endif
@@ -279,6 +553,53 @@ RSSL_API int rsslNotifierWait(RsslNotifier *pNotifier, long timeoutUsec)
 	int i;
 	int ret;
 
+#ifdef RSSL_NOTIFIER_EPOLL
+	if (RSSL_NOTIFIER_IS_EPOLL(pNotifierImpl))
+	{
+		/* Only the events notified by the previous wait can have flags set, so clear just those. */
+		for (i = 0; i < pNotifierImpl->_lastNotifiedEventCount; ++i)
+			pNotifierImpl->_lastNotifiedEvents[i]->base.notifiedFlags = 0;
+		pNotifierImpl->_lastNotifiedEventCount = 0;
+
+		pNotifierImpl->base.notifiedEventCount = 0;
+		ret = epoll_wait(pNotifierImpl->_epollFd, pNotifierImpl->_epollEvents, pNotifierImpl->_maxEvents, timeoutUsec/1000);
+		if (ret < 0)
+			return ret;
+
+		for (i = 0; i < ret; ++i)
+		{
+			RsslNotifierEventImpl *pNotifierEventImpl = (RsslNotifierEventImpl*)pNotifierImpl->_epollEvents[i].data.ptr;
+			unsigned int revents = pNotifierImpl->_epollEvents[i].events;
+
+			if (revents & (EPOLLIN | EPOLLPRI))
+				pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_READ;
+
+			if (revents & EPOLLOUT)
+				pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_WRITE;
+
+			/* Errors and hangups are always reported by epoll. Surface them through whichever operation 
+			 * is registered, so that the failure is seen when reading or writing. */
+			if (revents & (EPOLLERR | EPOLLHUP))
+			{
+				if (pNotifierEventImpl->_registeredFlags & RSSL_NESF_READ)
+					pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_READ;
+				else if (pNotifierEventImpl->_registeredFlags & RSSL_NESF_WRITE)
+					pNotifierEventImpl->base.notifiedFlags |= RSSL_NESF_WRITE;
+			}
+
+			if (pNotifierEventImpl->base.notifiedFlags)
+			{
+				pNotifierImpl->base.notifiedEvents[pNotifierImpl->base.notifiedEventCount] = &pNotifierEventImpl->base;
+				++pNotifierImpl->base.notifiedEventCount;
+				pNotifierImpl->_lastNotifiedEvents[pNotifierImpl->_lastNotifiedEventCount] = pNotifierEventImpl;
+				++pNotifierImpl->_lastNotifiedEventCount;
+			}
+		}
+
+		return ret;
+	}
+#endif
+
 #ifndef WIN32
 	pNotifierImpl->base.notifiedEventCount = 0;
 	ret = poll(pNotifierImpl->_pollFds, pNotifierImpl->_eventCount, timeoutUsec/1000);
@@ -389,6 +389,21 @@ RSSL_API RsslRet rsslDateTimeLocalTime(RsslDateTime * oDateTime);
  */
 RSSL_API RsslRet rsslDateTimeGmtTime(RsslDateTime * oDateTime);
 
+/**
+ * @brief Convert an array of RsslDateTime (in GMT) to nanoseconds since 1970-01-01 00:00:00 GMT
+ *
+ * Blank members of the time count as zero.  A value with a blank date is blank, and converts to 0.
+ * A value whose date or time is out of range, or whose year is outside 1678 to 2261 (the range that nanoseconds since the epoch can represent), converts to 0.
+ * The day is not checked against the length of the month; see rsslDateTimeIsValid().
+ * @param oNanos Array of count values to populate.
+ * @param oIsBlank Optional array of count RsslBool, each populated with RSSL_TRUE if the RsslDateTime was blank.
+ * @param iDateTimes Array of count RsslDateTime to convert.
+ * @param count Number of values to convert.
+ * @return RsslRet ::RSSL_RET_SUCCESS if successful, ::RSSL_RET_INVALID_DATA if any non-blank value could not be converted.  All values are converted in either case.
+ * @see RsslDateTime, rsslDecodeDateTimesToEpochNanos
+ */
+RSSL_API RsslRet rsslDateTimesToEpochNanos(RsslInt64 *oNanos, RsslBool *oIsBlank, const RsslDateTime *iDateTimes, RsslUInt32 count);
+
 /**
  * @}
  */
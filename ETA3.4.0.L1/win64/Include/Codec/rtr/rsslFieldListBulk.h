@@ -0,0 +1,153 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_FIELD_LIST_BULK_H
+#define __RSSL_FIELD_LIST_BULK_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslReal.h"
+#include "rtr/rsslDateTime.h"
+#include "rtr/rsslQos.h"
+#include "rtr/rsslState.h"
+#include "rtr/rsslFieldList.h"
+#include "rtr/rsslDataDictionary.h"
+#include <string.h>
+
+
+/**
+ * @addtogroup FieldListDecoding
+ * @{
+ */
+
+/**
+ * @brief Set of field identifiers, used to select the entries decoded by rsslDecodeFieldListBulk().
+ * Holds one bit for every possible RsslFieldId.
+ * @see rsslClearFieldIdFilter, rsslFieldIdFilterAdd, rsslFieldIdFilterRemove, rsslFieldIdFilterCheck
+ */
+typedef struct {
+	RsslUInt64	bits[1024];	/*!< @brief Bit per field identifier, indexed by the identifier as an unsigned 16-bit value. */
+} RsslFieldIdFilter;
+
+/**
+ * @brief Clears an RsslFieldIdFilter, so that it contains no field identifiers.
+ * @see RsslFieldIdFilter
+ */
+RTR_C_INLINE void rsslClearFieldIdFilter(RsslFieldIdFilter *pFilter)
+{
+	memset(pFilter->bits, 0, sizeof(pFilter->bits));
+}
+
+/**
+ * @brief Adds a field identifier to an RsslFieldIdFilter.
+ * @see RsslFieldIdFilter
+ */
+RTR_C_INLINE void rsslFieldIdFilterAdd(RsslFieldIdFilter *pFilter, RsslFieldId fieldId)
+{
+	pFilter->bits[(RsslUInt16)fieldId >> 6] |= ((RsslUInt64)1 << ((RsslUInt16)fieldId & 0x3F));
+}
+
+/**
+ * @brief Removes a field identifier from an RsslFieldIdFilter.
+ * @see RsslFieldIdFilter
+ */
+RTR_C_INLINE void rsslFieldIdFilterRemove(RsslFieldIdFilter *pFilter, RsslFieldId fieldId)
+{
+	pFilter->bits[(RsslUInt16)fieldId >> 6] &= ~((RsslUInt64)1 << ((RsslUInt16)fieldId & 0x3F));
+}
+
+/**
+ * @brief Checks whether an RsslFieldIdFilter contains a field identifier.
+ * @see RsslFieldIdFilter
+ */
+RTR_C_INLINE RsslBool rsslFieldIdFilterCheck(const RsslFieldIdFilter *pFilter, RsslFieldId fieldId)
+{
+	return (pFilter->bits[(RsslUInt16)fieldId >> 6] & ((RsslUInt64)1 << ((RsslUInt16)fieldId & 0x3F))) ? RSSL_TRUE : RSSL_FALSE;
+}
+
+/**
+ * @brief Flag values for use with the RsslDecodedFieldEntry (DFEF = DecodedFieldEntry Flags)
+ * @see RsslDecodedFieldEntry
+ */
+typedef enum {
+	RSSL_DFEF_NONE			= 0x00,	/*!< (0x00) No RsslDecodedFieldEntry flags are present */
+	RSSL_DFEF_DECODED		= 0x01,	/*!< (0x01) RsslDecodedFieldEntry::value contains the decoded content of the entry. */
+	RSSL_DFEF_BLANK			= 0x02,	/*!< (0x02) The entry was blank (its primitive decoder returned ::RSSL_RET_BLANK_DATA). */
+	RSSL_DFEF_SET_DEFINED	= 0x04	/*!< (0x04) The entry was set-defined data. */
+} RsslDecodedFieldEntryFlags;
+
+/**
+ * @brief One entry of an RsslFieldList, decoded by rsslDecodeFieldListBulk().
+ * @see rsslDecodeFieldListBulk, RsslDecodedFieldEntryFlags
+ */
+typedef struct {
+	RsslFieldId		fieldId;	/*!< @brief The field identifier. */
+	RsslUInt8		dataType;	/*!< @brief The type of the entry's content: the type given by the dictionary (or the set definition, for set-defined data), or ::RSSL_DT_UNKNOWN if neither gives one. */
+	RsslUInt8		flags;		/*!< @brief Flag values from RsslDecodedFieldEntryFlags. */
+	RsslBuffer		encData;	/*!< @brief Raw encoded content of the entry. */
+	union {
+		RsslInt			intValue;		/*!< @brief Value of an ::RSSL_DT_INT entry. */
+		RsslUInt		uintValue;		/*!< @brief Value of an ::RSSL_DT_UINT entry. */
+		RsslFloat		floatValue;		/*!< @brief Value of an ::RSSL_DT_FLOAT entry. */
+		RsslDouble		doubleValue;	/*!< @brief Value of an ::RSSL_DT_DOUBLE entry. */
+		RsslReal		realValue;		/*!< @brief Value of an ::RSSL_DT_REAL entry. */
+		RsslDate		dateValue;		/*!< @brief Value of an ::RSSL_DT_DATE entry. */
+		RsslTime		timeValue;		/*!< @brief Value of an ::RSSL_DT_TIME entry. */
+		RsslDateTime	dateTimeValue;	/*!< @brief Value of an ::RSSL_DT_DATETIME entry. */
+		RsslQos			qosValue;		/*!< @brief Value of an ::RSSL_DT_QOS entry. */
+		RsslState		stateValue;		/*!< @brief Value of an ::RSSL_DT_STATE entry. */
+		RsslEnum		enumValue;		/*!< @brief Value of an ::RSSL_DT_ENUM entry. */
+		RsslBuffer		bufferValue;	/*!< @brief Value of an ::RSSL_DT_BUFFER, ::RSSL_DT_ASCII_STRING, ::RSSL_DT_UTF8_STRING or ::RSSL_DT_RMTES_STRING entry. */
+	} value;					/*!< @brief Decoded content, present when RsslDecodedFieldEntry::flags contains ::RSSL_DFEF_DECODED. */
+} RsslDecodedFieldEntry;
+
+/**
+ * @brief Decodes an RsslFieldList and all of its entries in one call
+ *
+ * Decodes the field list header as rsslDecodeFieldList() does, then decodes each entry (set-defined and standard) into
+ * the next element of pEntries.  Each entry's type is taken from the set definition, or else from pDictionary, and the
+ * entry is decoded with the primitive decoder for that type, giving the same value and blank handling as rsslDecodePrimitiveType().
+ * Entries with container types, or with no type, get only their raw content.
+ *
+ * When the call returns, the iterator has finished the field list, as if rsslDecodeFieldEntry() had returned ::RSSL_RET_END_OF_CONTAINER.
+ *
+ * @param pIter Decode iterator to use for decode process
+ * @param pFieldList RsslFieldList structure to populate with decoded contents.
+ * @param pLocalSetDb Set definition database to use while decoding any set defined content.  Optional.
+ * @param pDictionary Dictionary used to find the type of each standard entry.  Optional; without it, only set-defined entries are decoded.
+ * @param pFilter If present, only entries whose field identifiers are in the filter are returned.
+ * @param pEntries Array to decode entries into.
+ * @param pEntryCount On input, the number of elements in pEntries.  On output, the number of entries decoded.
+ * @return ::RSSL_RET_SUCCESS (or ::RSSL_RET_SET_SKIPPED if set data was present but had no set definition),
+ * ::RSSL_RET_BUFFER_TOO_SMALL if pEntries could not hold all of the entries (it holds those that fit),
+ * ::RSSL_RET_INVALID_ARGUMENT if pDictionary has not been loaded, or another RsslRet on a decoding failure.
+ * @see rsslDecodeFieldList, RsslDecodedFieldEntry, RsslFieldIdFilter
+ */
+RSSL_API RsslRet rsslDecodeFieldListBulk(
+							RsslDecodeIterator			*pIter,
+							RsslFieldList				*pFieldList,
+							RsslLocalFieldSetDefDb		*pLocalSetDb,
+							const RsslDataDictionary	*pDictionary,
+							const RsslFieldIdFilter		*pFilter,
+							RsslDecodedFieldEntry		*pEntries,
+							RsslUInt32					*pEntryCount);
+
+/**
+ * @}
+ */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
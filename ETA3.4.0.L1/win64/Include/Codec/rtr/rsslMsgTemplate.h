@@ -0,0 +1,156 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_MSG_TEMPLATE_H
+#define __RSSL_MSG_TEMPLATE_H
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtr/rsslTypes.h"
+#include "rtr/rsslIterators.h"
+#include "rtr/rsslFieldList.h"
+
+
+/**
+ * @addtogroup MsgEncoders
+ * @{
+ */
+
+/**
+ * @brief Flag values for use with the RsslMsgTemplateSlot (MTSF = MsgTemplateSlot Flags)
+ * @see RsslMsgTemplateSlot
+ */
+typedef enum {
+	RSSL_MTSF_NONE			= 0x00,	/*!< (0x00) No RsslMsgTemplateSlot flags are present. */
+	RSSL_MTSF_SET_DEFINED	= 0x01,	/*!< (0x01) The slot is a set-defined field entry, written as the type given by its set definition. */
+	RSSL_MTSF_SEQ_NUM		= 0x02	/*!< (0x02) The slot is the sequence number of the message.  Its value is an RsslUInt32. */
+} RsslMsgTemplateSlotFlags;
+
+/**
+ * @brief A value in an RsslMsgTemplate that is written in place each time a message is encoded from the template.
+ *
+ * Each slot has a fixed width, so it can be written without moving the rest of the message.
+ * @see RsslMsgTemplate, rsslEncodeFieldEntryTemplateSlot, rsslAddMsgTemplateSeqNumSlot
+ */
+typedef struct {
+	RsslFieldId		fieldId;	/*!< @brief The field identifier of the entry.  0 for the sequence number slot. */
+	RsslUInt8		flags;		/*!< @brief Flags from RsslMsgTemplateSlotFlags. */
+	RsslUInt8		dataType;	/*!< @brief Primitive type of the slot's values, as passed to rsslEncodeFieldEntry(), e.g. RSSL_DT_REAL. */
+	RsslUInt8		encType;	/*!< @brief Type the values are written as, e.g. RSSL_DT_UINT_8 or RSSL_DT_REAL_8RB.  RSSL_DT_REAL is a hint followed by an eight byte value. */
+	RsslUInt16		length;		/*!< @brief Width of the encoded value. */
+	RsslUInt32		offset;		/*!< @brief Offset of the encoded value from the start of the message. */
+} RsslMsgTemplateSlot;
+
+/**
+ * @brief A pre-encoded message whose slots can be changed without encoding the message again.
+ *
+ * Typical use:<BR>
+ *  1. Point RsslMsgTemplate::slots at an array of RsslMsgTemplateSlot and set RsslMsgTemplate::maxSlots to its size.<BR>
+ *  2. Encode the message as usual, calling rsslEncodeFieldEntryTemplateSlot() instead of rsslEncodeFieldEntry() for each field that changes between messages.<BR>
+ *  3. After rsslEncodeMsgComplete(), call rsslEncodeMsgTemplateComplete(), and rsslAddMsgTemplateSeqNumSlot() if the sequence number changes between messages.<BR>
+ *  4. For each message, call rsslEncodeMsgFromTemplate() with the new slot values.  If it returns RSSL_RET_VALUE_OUT_OF_RANGE, a value does not fit its slot and the message should be encoded in full.<BR>
+ *
+ * The template refers to the buffer the message was encoded into, which must not be changed or released while the template is in use.
+ * @see RsslMsgTemplateSlot, RSSL_INIT_MSG_TEMPLATE, rsslClearMsgTemplate
+ */
+typedef struct {
+	RsslBuffer				encMsgBuf;	/*!< @brief The encoded message.  Set by rsslEncodeMsgTemplateComplete(). */
+	RsslMsgTemplateSlot		*slots;		/*!< @brief Application provided array of slots, in the order they were encoded. */
+	RsslUInt32				slotCount;	/*!< @brief Number of slots in use. */
+	RsslUInt32				maxSlots;	/*!< @brief Number of slots available in RsslMsgTemplate::slots. */
+} RsslMsgTemplate;
+
+/**
+ * @brief Static initializer for the RsslMsgTemplate
+ * @see RsslMsgTemplate, rsslClearMsgTemplate
+ */
+#define RSSL_INIT_MSG_TEMPLATE { RSSL_INIT_BUFFER, 0, 0, 0 }
+
+/**
+ * @brief Clears an RsslMsgTemplate
+ * @see RsslMsgTemplate, RSSL_INIT_MSG_TEMPLATE
+ */
+RTR_C_INLINE void rsslClearMsgTemplate(RsslMsgTemplate *pTemplate)
+{
+	rsslClearBuffer(&pTemplate->encMsgBuf);
+	pTemplate->slots = 0;
+	pTemplate->slotCount = 0;
+	pTemplate->maxSlots = 0;
+}
+
+/**
+ * @brief Encodes an RsslFieldEntry as a slot of an RsslMsgTemplate.
+ *
+ * Used in place of rsslEncodeFieldEntry() while encoding the message of a template.  A standard entry is encoded
+ * at the widest length of its type; RSSL_DT_INT, RSSL_DT_UINT, RSSL_DT_REAL, RSSL_DT_FLOAT, RSSL_DT_DOUBLE,
+ * RSSL_DT_DATE, RSSL_DT_TIME and RSSL_DT_DATETIME are supported.  A set-defined entry is encoded as its set type,
+ * with RSSL_DT_REAL, RSSL_DT_REAL_4RB and RSSL_DT_REAL_8RB using their longest form; set types of varying length other
+ * than RSSL_DT_REAL are not supported.
+ *
+ * @param pIter	Pointer to the encode iterator.
+ * @param pTemplate The template to add the slot to.
+ * @param pField RsslFieldEntry to encode.
+ * @param pData Pointer to the primitive value of the entry.  Blank values cannot be used.
+ * @return RSSL_RET_SUCCESS or RSSL_RET_SET_COMPLETE as from rsslEncodeFieldEntry().  RSSL_RET_VALUE_OUT_OF_RANGE if the value cannot be written as a slot,
+ * RSSL_RET_UNSUPPORTED_DATA_TYPE if the type cannot be a slot, or RSSL_RET_BUFFER_TOO_SMALL if the template has no slots left.
+ * @see RsslMsgTemplate, rsslEncodeFieldEntry
+ */
+RSSL_API RsslRet rsslEncodeFieldEntryTemplateSlot(
+							RsslEncodeIterator	*pIter,
+							RsslMsgTemplate		*pTemplate,
+							RsslFieldEntry		*pField,
+							const void			*pData );
+
+/**
+ * @brief Completes an RsslMsgTemplate after its message has been encoded with rsslEncodeMsgComplete().
+ * @param pIter	Pointer to the encode iterator used to encode the message.
+ * @param pTemplate The template being encoded.
+ * @see RsslMsgTemplate
+ * @return Returns an RsslRet to provide success or failure information.
+ */
+RSSL_API RsslRet rsslEncodeMsgTemplateComplete(
+							RsslEncodeIterator	*pIter,
+							RsslMsgTemplate		*pTemplate );
+
+/**
+ * @brief Adds the sequence number of a completed template's message as a slot.
+ * @note The message must have been encoded with a sequence number.
+ * @param pTemplate The completed template.
+ * @return RSSL_RET_SUCCESS if the slot was added, RSSL_RET_FAILURE if the message has no sequence number, or RSSL_RET_BUFFER_TOO_SMALL if the template has no slots left.
+ * @see RsslMsgTemplate, rsslReplaceSeqNum
+ */
+RSSL_API RsslRet rsslAddMsgTemplateSeqNumSlot(
+							RsslMsgTemplate		*pTemplate );
+
+/**
+ * @brief Encodes a message by copying a template's message into a buffer and writing new values into its slots.
+ * @param pTemplate The completed template.
+ * @param pValues Array of RsslMsgTemplate::slotCount pointers to the value of each slot, of the slot's RsslMsgTemplateSlot::dataType.  A NULL pointer keeps the template's value.
+ * @param pBuffer Buffer to encode into, e.g. one from rsslGetBuffer().  RsslBuffer::length is set to the length of the message.
+ * @return RSSL_RET_SUCCESS, RSSL_RET_BUFFER_TOO_SMALL, or RSSL_RET_VALUE_OUT_OF_RANGE if a value does not fit its slot, in which case the contents of the buffer
+ * are undefined and the message should be encoded in full.
+ * @see RsslMsgTemplate
+ */
+RSSL_API RsslRet rsslEncodeMsgFromTemplate(
+							const RsslMsgTemplate	*pTemplate,
+							const void				**pValues,
+							RsslBuffer				*pBuffer );
+
+/**
+ *	@}
+ */
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
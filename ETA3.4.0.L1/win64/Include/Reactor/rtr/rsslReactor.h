@@ -128,6 +128,11 @@ typedef struct
 	RsslUInt32						maxOutstandingPosts;	/*!< Sets the maximum number of post acknowledgments that may be outstanding for the channel. */
 	RsslUInt32						postAckTimeout;			/*!< Time a stream will wait for acknowledgment of a post message, in milliseconds. */
 	RsslUInt32						requestTimeout;			/*!< Time a requested stream will wait for a response from the provider, in milliseconds. */
+	RsslBool						filterViewsPerRequest;	/*!< When several requests with different views share a stream, reduces each RsslFieldList update to the fields in each request's own view before delivering it. */
+	RsslUInt32						requestPacingRate;		/*!< Maximum rate, in requests per second, at which item requests that need a refresh are sent, such as when recovering items after a reconnection. Requests beyond it wait and are sent highest priority class first. 0 (the default) does not limit the rate. */
+	RsslUInt32						requestPacingBurst;		/*!< Number of item requests that may be sent at once when requestPacingRate is set. 0 allows a tenth of a second's worth of requests. */
+	RsslUInt32						requestPacingLatencyTarget;	/*!< If set along with requestPacingRate, the time in milliseconds providers should take to complete refreshes. The rate is lowered while the average time is above this and raised back towards requestPacingRate while it is below. */
+	RsslBool						cacheItemImages;		/*!< Keeps the current image of each open item stream whose payload is an RsslFieldList, so that a streaming request joining the stream receives its refresh from the image instead of the stream requesting a new refresh from the provider. Images are not used while data is suspect, or for requests with views. */
 } RsslConsumerWatchlistOptions;
 
 /**
@@ -192,6 +197,11 @@ RTR_C_INLINE void rsslClearOMMConsumerRole(RsslReactorOMMConsumerRole *pRole)
 	pRole->watchlistOptions.maxOutstandingPosts = 100000;
 	pRole->watchlistOptions.postAckTimeout = 15000;
 	pRole->watchlistOptions.requestTimeout = 15000;
+	pRole->watchlistOptions.filterViewsPerRequest = RSSL_FALSE;
+	pRole->watchlistOptions.requestPacingRate = 0;
+	pRole->watchlistOptions.requestPacingBurst = 0;
+	pRole->watchlistOptions.requestPacingLatencyTarget = 0;
+	pRole->watchlistOptions.cacheItemImages = RSSL_FALSE;
 }
 
 /**
@@ -264,6 +274,17 @@ RTR_C_INLINE void rsslClearReactorChannelRole(RsslReactorChannelRole *pRole)
 }
 
 
+/**
+ * @brief Enumerated types indicating the mechanism an RsslReactor uses to wait for notification on its channels.
+ * @see RsslCreateReactorOptions
+ */
+typedef enum
+{
+	RSSL_RC_NT_DEFAULT	= 0,	/*!< (0) Platform default (poll, or select on Windows). The cost of each notification check scales with the number of channels. */
+	RSSL_RC_NT_EPOLL	= 1		/*!< (1) epoll. The cost of each notification check scales with the number of channels that have been notified.
+								 * Only available on Linux; other platforms use RSSL_RC_NT_DEFAULT. */
+} RsslReactorNotifierType;
+
 /**
  * @brief Configuration options for creating an RsslReactor.
  * @see rsslCreateReactor
@@ -281,6 +302,11 @@ typedef struct {
 	RsslInt32	reissueTokenAttemptInterval;	/*!< The interval time for the RsslReactor will wait before attempting to reissue the token, in milliseconds. The minimum interval is 1000 milliseconds */
 	RsslUInt32	restRequestTimeOut;				/*!< Specifies maximum time the request is allowed to take for token service and service discovery, in seconds. If set to 0, there is no timeout */
 	int			port;							/*!< @deprecated DEPRECATED: This parameter no longer has any effect. It was a port used for creating the eventFd descriptor on the RsslReactor. It was never used on Linux or Solaris platforms. */
+	RsslReactorNotifierType	notifierType;	/*!< The mechanism the RsslReactor and its worker thread use to wait for notification on channels. See RsslReactorNotifierType. */
+	RsslUInt32	dispatchShardCount;				/*!< If greater than 1, the RsslReactor is split into this many shards so that channels can be dispatched from multiple threads.
+												 * Each shard has its own notifier, event queues, decode buffer and worker thread. Each channel is assigned to the shard with the fewest
+												 * channels by rsslReactorConnect() or rsslReactorAccept(), and all callbacks for that channel are made when that shard is dispatched.
+												 * See rsslReactorGetShard(). */
 } RsslCreateReactorOptions;
 
 /**
@@ -321,6 +347,26 @@ RSSL_VA_API RsslReactor *rsslCreateReactor(RsslCreateReactorOptions *pReactorOpt
  */
 RSSL_VA_API RsslRet rsslDestroyReactor(RsslReactor *pReactor, RsslErrorInfo *pError);
 
+/**
+ * @brief Returns the number of shards of an RsslReactor created with RsslCreateReactorOptions::dispatchShardCount greater than 1, or 0 if the RsslReactor is not sharded.
+ * @param pReactor The reactor.
+ * @see rsslReactorGetShard
+ */
+RSSL_VA_API RsslUInt32 rsslReactorGetShardCount(RsslReactor *pReactor);
+
+/**
+ * @brief Returns a shard of a sharded RsslReactor, or NULL if the RsslReactor is not sharded or index is out of range.
+ * Each shard is an RsslReactor with its own eventFd, and is normally dispatched by its own thread by passing it to rsslReactorDispatch().
+ * Callbacks for a channel receive the shard that owns the channel as their RsslReactor.
+ * The sharded RsslReactor itself may also be passed to any reactor function; calls for a channel are passed on to the channel's shard,
+ * and rsslReactorDispatch() without a channel dispatches the shards in turn, sharing RsslReactorDispatchOptions::maxMessages among them.
+ * Its eventFd is triggered when any shard has events to dispatch, and is reset when the sharded RsslReactor is dispatched.
+ * @param pReactor The sharded reactor.
+ * @param index The index of the shard, from 0 to rsslReactorGetShardCount() - 1.
+ * @see RsslCreateReactorOptions, rsslReactorGetShardCount
+ */
+RSSL_VA_API RsslReactor *rsslReactorGetShard(RsslReactor *pReactor, RsslUInt32 index);
+
 /**
  * @brief Enumerated types indicating the transport query parameter.
  * @see RsslReactorServiceDiscoveryOptions
@@ -604,6 +650,8 @@ RSSL_VA_API RsslRet rsslReactorSubmit(RsslReactor *pReactor, RsslReactorChannel
 typedef struct
 {
 	void		*pUserSpec;			/*!< User-specified pointer to return as the application receives events related to this request. */
+	RsslUInt32	conflationInterval;	/*!< If nonzero, RsslFieldList updates for this request are conflated and delivered at most once per interval, in milliseconds (e.g. 250 for four updates per second). Refresh and status messages are not delayed. */
+	RsslUInt32	conflationBypassUpdateTypes;	/*!< Update types that are delivered immediately instead of being conflated, as a mask of (1 << updateType), e.g. (1 << RDM_UPD_EVENT_TYPE_TRADE). Updates with RSSL_UPMF_DO_NOT_CONFLATE set are always delivered immediately. */
 } RsslReactorRequestMsgOptions;
 
 typedef struct
@@ -853,6 +901,90 @@ RTR_C_INLINE void rsslClearReactorChannelStatistic(RsslReactorChannelStatistic *
 RSSL_VA_API RsslRet rsslReactorRetrieveChannelStatistic(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
 	RsslReactorChannelStatistic *pRsslReactorChannelStatistic, RsslErrorInfo *pError);
 
+/**
+ * @brief This structure is used to retrieve the progress of item requests paced by the watchlist from the rsslReactorRetrieveRequestPacingStatistic() method.
+ * @see RsslConsumerWatchlistOptions
+ */
+typedef struct
+{
+	RsslUInt32							requestsWaiting;			/*!< Returns the number of item requests waiting to be sent */
+	RsslUInt							requestsSent;				/*!< Returns the aggregated number of item requests allowed to be sent */
+	RsslUInt							refreshesCompleted;			/*!< Returns the aggregated number of requested refreshes completed */
+	RsslUInt32							requestRate;				/*!< Returns the current rate, in requests per second */
+	RsslUInt32							averageRefreshLatency;		/*!< Returns the average time providers took to complete requested refreshes, in milliseconds */
+} RsslReactorRequestPacingStatistic;
+
+/**
+ * @brief Clears an RsslReactorRequestPacingStatistic object.
+ * @see RsslReactorRequestPacingStatistic
+ */
+RTR_C_INLINE void rsslClearReactorRequestPacingStatistic(RsslReactorRequestPacingStatistic *pStatistic)
+{
+	memset(pStatistic, 0, sizeof(RsslReactorRequestPacingStatistic));
+}
+
+/**
+ * @brief Retrieves the progress of item requests paced by the watchlist of the specified RsslReactorChannel, e.g. while it recovers items after a reconnection.
+ * The aggregated values are kept for the lifetime of the channel.
+ * @param pReactor The reactor handling the RsslReactorChannel.
+ * @param pReactorChannel The channel to retrieve the statistics of. Its watchlist must be enabled with a requestPacingRate.
+ * @param pRsslReactorRequestPacingStatistic The passed in RsslReactorRequestPacingStatistic to populate.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return failure codes, if specified invalid arguments or the RsslReactor was shut down due to a failure.
+ * @see RsslReactor, RsslReactorRequestPacingStatistic, RsslConsumerWatchlistOptions
+ */
+RSSL_VA_API RsslRet rsslReactorRetrieveRequestPacingStatistic(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
+	RsslReactorRequestPacingStatistic *pRsslReactorRequestPacingStatistic, RsslErrorInfo *pError);
+
+/**
+ * @brief The number of size classes reported in an RsslReactorWatchlistMemoryStatistic.
+ * @see RsslReactorWatchlistMemoryStatistic
+ */
+#define RSSL_REACTOR_WATCHLIST_MEMORY_CLASSES 10
+
+/**
+ * @brief Occupancy of one size class of the memory the watchlist uses for views, buffered messages and message copies.
+ * @see RsslReactorWatchlistMemoryStatistic
+ */
+typedef struct
+{
+	RsslUInt32							blockSize;					/*!< Returns the size of the blocks in this class, in bytes. 0 for the class of allocations larger than the largest block size */
+	RsslUInt32							blocksAllocated;			/*!< Returns the number of blocks allocated for this class */
+	RsslUInt32							blocksInUse;				/*!< Returns the number of blocks currently in use */
+	RsslUInt32							blocksHighWater;			/*!< Returns the highest number of blocks in use at once */
+} RsslReactorWatchlistMemoryClass;
+
+/**
+ * @brief This structure is used to retrieve the memory usage of the watchlist from the rsslReactorRetrieveWatchlistMemoryStatistic() method.
+ * @see RsslReactorWatchlistMemoryClass
+ */
+typedef struct
+{
+	RsslReactorWatchlistMemoryClass		classes[RSSL_REACTOR_WATCHLIST_MEMORY_CLASSES];	/*!< Returns the occupancy of each size class, smallest first, followed by allocations larger than the largest block size */
+} RsslReactorWatchlistMemoryStatistic;
+
+/**
+ * @brief Clears an RsslReactorWatchlistMemoryStatistic object.
+ * @see RsslReactorWatchlistMemoryStatistic
+ */
+RTR_C_INLINE void rsslClearReactorWatchlistMemoryStatistic(RsslReactorWatchlistMemoryStatistic *pStatistic)
+{
+	memset(pStatistic, 0, sizeof(RsslReactorWatchlistMemoryStatistic));
+}
+
+/**
+ * @brief Retrieves the memory usage of the watchlist of the specified RsslReactorChannel, by size class, including the highest usage of each class.
+ * The memory is released when the channel is closed.
+ * @param pReactor The reactor handling the RsslReactorChannel.
+ * @param pReactorChannel The channel to retrieve the statistics of. Its watchlist must be enabled.
+ * @param pRsslReactorWatchlistMemoryStatistic The passed in RsslReactorWatchlistMemoryStatistic to populate.
+ * @param pError Error structure to be populated in the event of failure.
+ * @return failure codes, if specified invalid arguments or the RsslReactor was shut down due to a failure.
+ * @see RsslReactor, RsslReactorWatchlistMemoryStatistic
+ */
+RSSL_VA_API RsslRet rsslReactorRetrieveWatchlistMemoryStatistic(RsslReactor *pReactor, RsslReactorChannel *pReactorChannel,
+	RsslReactorWatchlistMemoryStatistic *pRsslReactorWatchlistMemoryStatistic, RsslErrorInfo *pError);
+
 /**
  *	@}
  */
@@ -0,0 +1,191 @@
+/*|-----------------------------------------------------------------------------
+ *|            This source code is provided under the Apache 2.0 license      --
+ *|  and is provided AS IS with no warranty or guarantee of fit for purpose.  --
+ *|                See the project's LICENSE.md for details.                  --
+ *|           Copyright (C) 2019 Refinitiv. All rights reserved.            --
+ *|-----------------------------------------------------------------------------
+ */
+
+#ifndef __RSSL_CAPTURE_H
+#define __RSSL_CAPTURE_H
+
+#include "rtr/rsslTransport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RSSLCapture
+ * @{
+ */
+
+/**
+ * @brief Direction of a captured message
+ * @see RsslCaptureReplayOpts
+ */
+typedef enum {
+	RSSL_CAPTURE_DIR_IN		= 0x01,	/*!< (0x01) Message read from the channel */
+	RSSL_CAPTURE_DIR_OUT	= 0x02	/*!< (0x02) Message written to the channel */
+} RsslCaptureDirection;
+
+/**
+ * @brief Options for starting a capture
+ *
+ * The capture file starts with the eight bytes "RSSLCAP" and a version byte of 1.  Each message follows as a
+ * record of its length (4 bytes), direction (1 byte, from RsslCaptureDirection), time it was read or written
+ * (8 bytes, nanoseconds since 1 January 1970 UTC), channel id (8 bytes, the RsslChannel::socketId) and then the
+ * message itself.  All numbers are in network byte order.
+ * @see rsslCaptureStart
+ */
+typedef struct {
+	char		*fileName;	/*!< @brief Name of the capture file.  An existing file is replaced. */
+	RsslUInt32	ringSize;	/*!< @brief Size in bytes of the ring that holds messages until the writer thread saves them.  Rounded up to a power of 2.  Messages that do not fit are dropped and counted. */
+} RsslCaptureOpts;
+
+/**
+ * @brief Static initializer for RsslCaptureOpts
+ * @see RsslCaptureOpts, rsslClearCaptureOpts
+ */
+#define RSSL_INIT_CAPTURE_OPTS { 0, 16*1024*1024 }
+
+/**
+ * @brief Clears an RsslCaptureOpts
+ * @see RsslCaptureOpts, RSSL_INIT_CAPTURE_OPTS
+ */
+RTR_C_INLINE void rsslClearCaptureOpts(RsslCaptureOpts *pOpts)
+{
+	pOpts->fileName = 0;
+	pOpts->ringSize = 16*1024*1024;
+}
+
+/**
+ * @brief Counters of the current or last capture
+ * @see rsslCaptureGetStats
+ */
+typedef struct {
+	RsslUInt64	messagesCaptured;	/*!< @brief Messages written to the capture file. */
+	RsslUInt64	messagesDropped;	/*!< @brief Messages not captured because the ring was full or they were larger than half the ring. */
+	RsslUInt64	bytesWritten;		/*!< @brief Bytes written to the capture file. */
+} RsslCaptureStats;
+
+/**
+ * @brief Starts capturing RSSL messages to a file.
+ *
+ * Typical use:<BR>
+ * Call rsslCaptureStart(), then turn on ::RSSL_DEBUG_RSSL_DUMP_IN and ::RSSL_DEBUG_RSSL_DUMP_OUT with the
+ * rsslIoctl ::RSSL_DEBUG_FLAGS option of each channel to capture.  Messages are copied into a ring as they
+ * are read or written, without taking a lock, and a thread started by this call writes them to the file.<BR>
+ * The capture is made through the RSSL dump functions of rsslSetDebugFunctions(), so it cannot be used by an
+ * application that sets its own RSSL dump functions, and any IPC dump functions already set are cleared.
+ * Only one capture may run at a time.
+ * @param pOpts Capture options
+ * @param error Rssl Error, to be populated in event of an error
+ * @return RsslRet RSSL return value
+ * @see RsslCaptureOpts, rsslCaptureStop, rsslCaptureReplayOpen
+ */
+RSSL_API RsslRet rsslCaptureStart(RsslCaptureOpts *pOpts, RsslError *error);
+
+/**
+ * @brief Stops the capture, writing all messages in the ring to the file before closing it.
+ *
+ * The channels' debug flags may be left on; messages are no longer captured once this returns.
+ * @param error Rssl Error, to be populated in event of an error
+ * @return RsslRet RSSL return value
+ * @see rsslCaptureStart
+ */
+RSSL_API RsslRet rsslCaptureStop(RsslError *error);
+
+/**
+ * @brief Gets the counters of the current capture, or of the last capture if none is running.
+ * @param pStats Set to the counters
+ * @see RsslCaptureStats
+ */
+RSSL_API void rsslCaptureGetStats(RsslCaptureStats *pStats);
+
+/**
+ * @brief Replays a capture file through a channel.
+ * @see rsslCaptureReplayOpen
+ */
+typedef struct RsslCaptureReplay RsslCaptureReplay;
+
+/**
+ * @brief Options for replaying a capture file
+ * @see rsslCaptureReplayOpen
+ */
+typedef struct {
+	char		*fileName;	/*!< @brief Name of the capture file. */
+	RsslUInt8	direction;	/*!< @brief Direction of the messages to replay, from RsslCaptureDirection.  A provider replays the messages it wrote, ::RSSL_CAPTURE_DIR_OUT. */
+	RsslUInt64	channelId;	/*!< @brief Replay only the messages of this channel id.  0 replays the messages of all channels. */
+	RsslDouble	speed;		/*!< @brief Pace of the replay relative to the capture: 1 is the original pace, 10 is ten times faster.  0 replays as fast as the channel allows. */
+} RsslCaptureReplayOpts;
+
+/**
+ * @brief Static initializer for RsslCaptureReplayOpts
+ * @see RsslCaptureReplayOpts, rsslClearCaptureReplayOpts
+ */
+#define RSSL_INIT_CAPTURE_REPLAY_OPTS { 0, RSSL_CAPTURE_DIR_OUT, 0, 1.0 }
+
+/**
+ * @brief Clears an RsslCaptureReplayOpts
+ * @see RsslCaptureReplayOpts, RSSL_INIT_CAPTURE_REPLAY_OPTS
+ */
+RTR_C_INLINE void rsslClearCaptureReplayOpts(RsslCaptureReplayOpts *pOpts)
+{
+	pOpts->fileName = 0;
+	pOpts->direction = RSSL_CAPTURE_DIR_OUT;
+	pOpts->channelId = 0;
+	pOpts->speed = 1.0;
+}
+
+/**
+ * @brief Information returned by rsslCaptureReplayDispatch
+ */
+typedef struct {
+	RsslUInt32	messagesWritten;	/*!< @brief Messages written by this call. */
+	RsslUInt32	waitTime;			/*!< @brief Microseconds until the next message is due.  0 if it is due now, e.g. because the channel had no buffers, and the application should wait for the channel to be writable. */
+} RsslCaptureReplayInfo;
+
+/**
+ * @brief Opens a capture file for replay.
+ * @param pOpts Replay options
+ * @param error Rssl Error, to be populated in event of an error
+ * @return The replay, or NULL if the file cannot be opened or is not a capture file
+ * @see RsslCaptureReplayOpts, rsslCaptureReplayDispatch, rsslCaptureReplayClose
+ */
+RSSL_API RsslCaptureReplay *rsslCaptureReplayOpen(RsslCaptureReplayOpts *pOpts, RsslError *error);
+
+/**
+ * @brief Writes the messages of a replay that are due to a channel.
+ *
+ * Typical use:<BR>
+ * Once the channel is active, call rsslCaptureReplayDispatch() whenever RsslCaptureReplayInfo::waitTime has passed
+ * or the channel becomes writable, calling rsslFlush() as usual, until it returns 0.  The first call starts the
+ * replay's clock.  Each message is written with rsslGetBuffer() and rsslWrite(); a message that cannot be written
+ * because of ::RSSL_RET_BUFFER_NO_BUFFERS or ::RSSL_RET_WRITE_CALL_AGAIN is kept and written by the next call.
+ * @param pReplay The replay
+ * @param chnl RSSL Channel to write to
+ * @param pInfo Set to the number of messages written and the time until the next one is due
+ * @param error Rssl Error, to be populated in event of an error
+ * @return Greater than 0 if messages remain, 0 when all messages have been written, or a failure RsslRet
+ * @see rsslCaptureReplayOpen
+ */
+RSSL_API RsslRet rsslCaptureReplayDispatch(RsslCaptureReplay *pReplay, RsslChannel *chnl, RsslCaptureReplayInfo *pInfo, RsslError *error);
+
+/**
+ * @brief Closes a replay, releasing any message it holds.
+ * @param pReplay The replay
+ * @param chnl The channel the replay wrote to, so a buffer it holds can be released, or NULL if the channel has been closed
+ * @see rsslCaptureReplayOpen
+ */
+RSSL_API void rsslCaptureReplayClose(RsslCaptureReplay *pReplay, RsslChannel *chnl);
+
+/**
+ *	@}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -59,7 +59,8 @@ typedef enum {
 typedef enum {
 	RSSL_COMP_NONE	= 0x00,  /*!< (0) No compression will be negotiated. */
 	RSSL_COMP_ZLIB	= 0x01,	 /*!< (1) RSSL will attempt to use Zlib compression. */
-	RSSL_COMP_LZ4	= 0x02	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_LZ4	= 0x02,	 /*!< (2) RSSL will attempt to use LZ4 compression */
+	RSSL_COMP_ZSTD	= 0x04	 /*!< (4) RSSL will attempt to use zstd compression, optionally with a dictionary.  Both sides must load the same dictionary; see RsslConnectOptions::compressionDictionary and RsslBindOptions::compressionDictionary */
 } RsslCompTypes;
 
 /**
@@ -82,7 +83,8 @@ typedef enum {
 										 /*!< (12) Reserved */
 										 /*!< (13) Reserved */
 	RSSL_REGISTER_HASH_ID			= 14, /*!< (14) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Registers a hash so that a filtering-enabled channel allows it. */
-	RSSL_UNREGISTER_HASH_ID			= 15 /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_UNREGISTER_HASH_ID			= 15, /*!< (15) Channel: Used with ::RSSL_CONN_TYPE_RELIABLE_MCAST connections. Unregisters a hash so that a filtering-enabled channel no longer allows it. */
+	RSSL_COMPRESSION_ADAPTIVE		= 16 /*!< (16) Channel: When compression is on, 1 turns on adaptive compression and 0 turns it off.  Adaptive compression skips message sizes that do not compress well enough to pay for the CPU and follows socket back-pressure when picking the compression level.  Decisions are reported in RsslChannelInfo::adaptiveCompression */
 } RsslIoctlCodes;
 
 /**
@@ -96,7 +98,8 @@ typedef enum {
 	RSSL_CONN_TYPE_UNIDIR_SHMEM		= 3,  /*!< (3) Channel is using a shared memory connection */
 	RSSL_CONN_TYPE_RELIABLE_MCAST	= 4,   /*!< (4) Channel is a reliable multicast based connection. This can be on a unified/mesh network where send and receive networks are the same or a segmented network where send and receive networks are different */
 	RSSL_CONN_TYPE_EXT_LINE_SOCKET  = 5,   /*!< (5) Channel is using an extended line socket transport */	
-	RSSL_CONN_TYPE_SEQ_MCAST		= 6    /*!< (6) Channel is an unreliable, sequenced multicast connection for reading from an Elektron Direct Feed system. This is a client-only, read-only transport. This transport is supported on Linux only. */
+	RSSL_CONN_TYPE_SEQ_MCAST		= 6,   /*!< (6) Channel is an unreliable, sequenced multicast connection for reading from an Elektron Direct Feed system. This is a client-only, read-only transport. This transport is supported on Linux only. */
+	RSSL_CONN_TYPE_BIDIR_SHMEM		= 7    /*!< (7) Channel is a two-way shared memory connection between processes on the same host.  Each server accepts one client.  Messages up to maxFragmentSize are written in place without fragmentation. */
 } RsslConnectionTypes;
 
 /**
@@ -295,6 +298,38 @@ typedef struct {
 } RsslMCastStats;
 
 
+/**
+ * @brief Number of message size ranges tracked by adaptive compression.
+ * @see RsslAdaptiveCompInfo
+ */
+#define RSSL_COMP_ADAPTIVE_BUCKETS 12
+
+/**
+ * @brief Adaptive compression statistics for one range of message sizes, returned by rsslGetChannelInfo call.
+ * @see RsslAdaptiveCompInfo
+ */
+typedef struct {
+	RsslUInt32		minLength;			/*!< @brief Smallest message length in this range.  The range ends where the next range starts */
+	RsslUInt64		messages;			/*!< @brief This is the number of messages in this range that were eligible for compression */
+	RsslUInt64		compressed;			/*!< @brief This is the number of messages in this range that were compressed, including the occasional probe while compression is skipped */
+	RsslUInt32		ratio;				/*!< @brief This is the recent compressed size as a percentage of the uncompressed size, 0 until a message in this range has been compressed */
+	RsslUInt32		compressTime;		/*!< @brief This is the recent average time, in nanoseconds, spent compressing one message in this range */
+	RsslBool		skipped;			/*!< @brief This is RSSL_TRUE while messages in this range are sent without compression */
+} RsslCompBucketInfo;
+
+/**
+ * @brief Adaptive compression state returned by rsslGetChannelInfo call.
+ * @see rsslGetChannelInfo
+ * @see RsslChannelInfo
+ * @see RSSL_COMPRESSION_ADAPTIVE
+ */
+typedef struct {
+	RsslBool			enabled;			/*!< @brief This is RSSL_TRUE when adaptive compression was turned on with ::RSSL_COMPRESSION_ADAPTIVE.  The other members are only populated when it is */
+	RsslUInt32			compressionLevel;	/*!< @brief This is the compression level currently in use, 0 if the compression type does not have levels */
+	RsslUInt64			backPressureEvents;	/*!< @brief This is the number of flushes that could not write everything queued on the channel */
+	RsslCompBucketInfo	buckets[RSSL_COMP_ADAPTIVE_BUCKETS];	/*!< @brief Statistics and decisions for each range of message sizes, smallest first */
+} RsslAdaptiveCompInfo;
+
 /**
  * @brief Connected Component Information, used to identify components from across the connection
  * @see rsslGetChannelInfo
@@ -311,6 +346,7 @@ typedef struct {
  * @see rsslGetChannelInfo
  * @see RsslMCastStats
  * @see RsslComponentInfo
+ * @see RsslAdaptiveCompInfo
  */
 typedef struct {
 	RsslUInt32 			maxFragmentSize;		 /*!< @brief This is the max fragment size before fragmentation and reassembly is necessary. */ 
@@ -331,6 +367,7 @@ typedef struct {
 	RsslUInt32			componentInfoCount;		 /*!< @brief Number of RsslComponentInfo structures contained in the dynamic componentInfo array */
 	RsslComponentInfo**	componentInfo;			 /*!< @brief A variable length array that contains product version information for the component(s) that this RsslChannel is connected to. The number of RsslComponentInfo structures present in array is indicated by componentInfoCount.  */
 	RsslUInt64			encryptionProtocol;		 /*!< @brief Current encryption protocol used. */
+	RsslAdaptiveCompInfo adaptiveCompression;	 /*!< @brief When adaptive compression is turned on with ::RSSL_COMPRESSION_ADAPTIVE, this is populated with its current decisions */
 } RsslChannelInfo;
 
 /**
@@ -393,6 +430,15 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  *	@{
  */
 
+/**
+ * @brief How a non-blocking ::RSSL_CONN_TYPE_SOCKET channel performs its socket reads and writes.
+ * @see RsslTcpOpts
+ */
+typedef enum {
+	RSSL_SOCKET_IO_DEFAULT	= 0,	/*!< (0) rsslRead and rsslFlush each make their own read or write system call. */
+	RSSL_SOCKET_IO_URING	= 1		/*!< (1) Reads staged with rsslPrepareRead and writes queued by rsslFlush are performed together by one rsslSubmitIo call through an io_uring.  Linux 5.6 or later only; elsewhere the channel behaves as ::RSSL_SOCKET_IO_DEFAULT. */
+} RsslSocketIoModes;
+
 /**
  * @brief Options used for configuring TCP specific transport options (::RSSL_CONN_TYPE_SOCKET, ::RSSL_CONN_TYPE_ENCRYPTED, ::RSSL_CONN_TYPE_HTTP).
  * @see rsslConnect
@@ -400,9 +446,10 @@ RSSL_API RsslInt32 rsslBufferUsage(RsslChannel *chnl,
  */
 typedef struct {
 	RsslBool			tcp_nodelay;			/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. */
+	RsslSocketIoModes	ioMode;					/*!< @brief Only used with connectionType of ::RSSL_CONN_TYPE_SOCKET on non-blocking channels.  When set in RsslBindOptions it applies to every accepted channel. */
 } RsslTcpOpts;
 
-#define RSSL_INIT_TCP_OPTS { RSSL_FALSE }
+#define RSSL_INIT_TCP_OPTS { RSSL_FALSE, RSSL_SOCKET_IO_DEFAULT }
 
 typedef enum {
 	RSSL_MCAST_NO_FLAGS				= 0x00, /*!< @brief None. */
@@ -441,15 +488,30 @@ typedef struct {
 #define RSSL_INIT_MCAST_OPTS { RSSL_MCAST_NO_FLAGS, RSSL_FALSE, 5, 7, 3, 1, 4, 3, 3, 3, 65535, 128, 190000, 180000, NULL, NULL, NULL, 0, 0, NULL, 0 }
 
 /**
- * @brief Options used for configuring shared memory specific transport options (::RSSL_CONN_TYPE_UNIDIR_SHMEM).
+ * @brief How a blocking ::RSSL_CONN_TYPE_BIDIR_SHMEM reader waits when there is nothing to read.
+ * A non-blocking rsslRead never waits; it returns ::RSSL_RET_READ_WOULD_BLOCK and, on Linux, the channel's
+ * descriptor becomes readable when the other side writes again.  On other platforms the descriptor is always readable.
+ * @see RsslShmemOpts
+ */
+typedef enum {
+	RSSL_SHMEM_WAKEUP_POLL		= 0,	/*!< (0) A blocking rsslRead spins on shared memory until there is something to read. */
+	RSSL_SHMEM_WAKEUP_FUTEX		= 1		/*!< (1) After wakeupSpinCount empty reads, a blocking rsslRead sleeps on a futex in shared memory until the writer signals new data.  The writer only makes a system call while the reader is asleep.  Linux only; other platforms poll. */
+} RsslShmemWakeupTypes;
+
+/**
+ * @brief Options used for configuring shared memory specific transport options (::RSSL_CONN_TYPE_UNIDIR_SHMEM and ::RSSL_CONN_TYPE_BIDIR_SHMEM).
  * @see rsslConnect
  * @see RsslConnectOptions
+ * @see RsslBindOptions
  */
 typedef struct {
-	RsslUInt		maxReaderLag;			/*!<  @brief Maximum number of messages that the client can have waiting to read. If the client "lags" the server by more than this amount, UPA will disconnect the client */
+	RsslUInt		maxReaderLag;			/*!<  @brief Maximum number of messages that the client can have waiting to read. If the client "lags" the server by more than this amount, UPA will disconnect the client. Not used by ::RSSL_CONN_TYPE_BIDIR_SHMEM, where a full ring makes the writer's rsslGetBuffer return ::RSSL_RET_BUFFER_NO_BUFFERS instead. */
+	RsslShmemWakeupTypes	wakeupType;		/*!<  @brief ::RSSL_CONN_TYPE_BIDIR_SHMEM only. How this side waits for data to read. */
+	RsslUInt32		wakeupSpinCount;		/*!<  @brief ::RSSL_CONN_TYPE_BIDIR_SHMEM only. Number of consecutive empty reads a blocking rsslRead spins before sleeping when wakeupType is ::RSSL_SHMEM_WAKEUP_FUTEX. */
+	RsslUInt32		wakeupTimeout;			/*!<  @brief ::RSSL_CONN_TYPE_BIDIR_SHMEM only. Longest time, in microseconds, that a blocking rsslRead sleeps on the futex before checking whether the other side closed the channel. */
 } RsslShmemOpts;
 
-#define RSSL_INIT_SHMEM_OPTS { 0 }
+#define RSSL_INIT_SHMEM_OPTS { 0, RSSL_SHMEM_WAKEUP_POLL, 1000, 1000 }
 
 /**
  * @brief Options used for configuring sequenced multicast specific transport options (::RSSL_CONN_TYPE_SEQ_MCAST).
@@ -459,9 +521,13 @@ typedef struct {
 typedef struct {
 	RsslUInt32		maxMsgSize;			/*!<  @brief Maximum size of messages that the SEQ_MCAST transport will read. */
 	RsslUInt16		instanceId;			/*!<  @brief This is used, when combined with the origin IP address and port, to uniquely identify a sequenced multicast channel. */
+	RsslUInt32		readBatchSize;		/*!<  @brief Maximum number of datagrams received by one system call. Received datagrams are staged and returned one message at a time by rsslRead; 
+										 * RsslReadOutArgs::readBatchDepth reports how many remain staged. Values of 0 or 1 read one datagram per call. Batching is only available on Linux. */
+	RsslUInt32		writeBatchSize;		/*!<  @brief Maximum number of datagrams sent by one system call. When greater than 1, rsslWrite stages each datagram and returns the number of staged bytes; 
+										 * staged datagrams are sent when the batch fills or when rsslFlush is called. Values of 0 or 1 send each datagram on rsslWrite. Batching is only available on Linux. */
 } RsslSeqMCastOpts;
 
-#define RSSL_INIT_SEQ_MCAST_OPTS { 3000, 0 }
+#define RSSL_INIT_SEQ_MCAST_OPTS { 3000, 0, 0, 0 }
 typedef struct {
 	char* proxyHostName;				/*!<  @brief Proxy host name. */
 	char* proxyPort;					/*!<  @brief Proxy port. */
@@ -566,7 +632,7 @@ typedef struct {
 	char*				hostName;				/*!< @deprecated DEPRECATED: Hostname to connect to/join. All data is exchanged on this hostName:serviceName combination.  This option will only function for the SOCKET, HTTP, and ENCRYPTED connection types.  Users should migrate to the RsslConnectOptions::connectionInfo::unified::address configuration for the same behavior with current and future connection types */
 	char*				serviceName;			/*!< @deprecated DEPRECATED: Port number or service name to connect to/join.  All data is exchanged on this hostName:serviceName combination.  This option will only function for the SOCKET, HTTP, and ENCRYPTED connection types.  Users should migrate to the RsslConnectOptions::connectionInfo::unified::serviceName configuration for the same behavior with current and future connection types */
 	char				*objectName;			/*!< @brief When using connection type of ::RSSL_CONN_TYPE_HTTP or ::RSSL_CONN_TYPE_ENCRYPTED, this can be used as an object name to pass with the URL in underlying HTTP connection messages */
-	RsslConnectionTypes	connectionType;			/*!< @brief If ::RSSL_CONN_TYPE_ENCRYPTED this will use encryption, if ::RSSL_CONN_TYPE_HTTP this will use unencrypted http tunneling, if ::RSSL_CONN_TYPE_UNIDIR_SHMEM this will use server to client shared memory */
+	RsslConnectionTypes	connectionType;			/*!< @brief If ::RSSL_CONN_TYPE_ENCRYPTED this will use encryption, if ::RSSL_CONN_TYPE_HTTP this will use unencrypted http tunneling, if ::RSSL_CONN_TYPE_UNIDIR_SHMEM this will use server to client shared memory, if ::RSSL_CONN_TYPE_BIDIR_SHMEM this will use two-way shared memory */
 	RsslConnectionInfo	connectionInfo;			/*!< @brief Information about the network hosts/addresses, ports, and network interface cards to leverage during connection.  This configuration offers configuration for various network topologies and can be used for all connection types.  */
 	RsslCompTypes		compressionType;		/*!< @brief Which compression type, if any, to attempt to negotiate. Compression is only supported for connectionType of SOCKET, HTTP, or ENCRYPTED */	
 	RsslBool			blocking;				/*!< @brief If RSSL_TRUE, the connection will block. */
@@ -582,19 +648,20 @@ typedef struct {
 	void				*userSpecPtr;			/*!< @brief A user specified pointer, returned as userSpecPtr of the RsslChannel. */
 	RsslTcpOpts			tcpOpts;				/*!< @brief TCP transport specific options (used by ::RSSL_CONN_TYPE_SOCKET, ::RSSL_CONN_TYPE_ENCRYPTED, ::RSSL_CONN_TYPE_HTTP). */
 	RsslMCastOpts		multicastOpts;			/*!< @brief Multicast transport specific options (used by ::RSSL_CONN_TYPE_RELIABLE_MCAST). */
-	RsslShmemOpts		shmemOpts;				/*!< @brief shmem transport specific options (used by ::RSSL_CONN_TYPE_UNIDIR_SHMEM). */
+	RsslShmemOpts		shmemOpts;				/*!< @brief shmem transport specific options (used by ::RSSL_CONN_TYPE_UNIDIR_SHMEM and ::RSSL_CONN_TYPE_BIDIR_SHMEM). */
 	RsslSeqMCastOpts	seqMulticastOpts;		/*!< @brief Sequenced Multicast transport specific options (used by ::RSSL_CONN_TYPE_SEQ_MCAST). */
 	RsslProxyOpts		proxyOpts;
 	char*				componentVersion;		/*!< @brief User defined component version information*/
 	RsslEncryptionOpts  encryptionOpts;
 	RsslELOpts			extLineOptions;			/* Extended Line specific options */
+	char*				compressionDictionary;	/*!< @brief Path of a zstd dictionary file used when compressionType is ::RSSL_COMP_ZSTD.  The dictionary ID is sent to the server, which only agrees to zstd when it loaded the same dictionary.  If NULL, zstd is used without a dictionary. */
 } RsslConnectOptions;
 
 /**
  * @brief RSSL Connect Options initialization
  * @see RsslConnectOptions
  */
-#define RSSL_INIT_CONNECT_OPTS { 0, 0, 0, RSSL_CONN_TYPE_SOCKET, RSSL_INIT_CONNECTION_INFO, RSSL_COMP_NONE, RSSL_FALSE, RSSL_FALSE, 60, 50, 10, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, RSSL_INIT_MCAST_OPTS, RSSL_INIT_SHMEM_OPTS, RSSL_INIT_SEQ_MCAST_OPTS, RSSL_INIT_PROXY_OPTS, 0, RSSL_INIT_ENCRYPTION_OPTS, RSSL_INIT_EL_OPTS }
+#define RSSL_INIT_CONNECT_OPTS { 0, 0, 0, RSSL_CONN_TYPE_SOCKET, RSSL_INIT_CONNECTION_INFO, RSSL_COMP_NONE, RSSL_FALSE, RSSL_FALSE, 60, 50, 10, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, RSSL_INIT_MCAST_OPTS, RSSL_INIT_SHMEM_OPTS, RSSL_INIT_SEQ_MCAST_OPTS, RSSL_INIT_PROXY_OPTS, 0, RSSL_INIT_ENCRYPTION_OPTS, RSSL_INIT_EL_OPTS, 0 }
 
 
 /**
@@ -628,6 +695,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.ioMode = RSSL_SOCKET_IO_DEFAULT;
 	opts->multicastOpts.flags = RSSL_MCAST_NO_FLAGS;
 	opts->multicastOpts.disconnectOnGaps = RSSL_FALSE;
 	opts->multicastOpts.packetTTL = 5;
@@ -649,10 +717,15 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->multicastOpts.tcpControlPort = NULL;
 	opts->multicastOpts.portRoamRange = 0;
 	opts->shmemOpts.maxReaderLag = 0;
+	opts->shmemOpts.wakeupType = RSSL_SHMEM_WAKEUP_POLL;
+	opts->shmemOpts.wakeupSpinCount = 1000;
+	opts->shmemOpts.wakeupTimeout = 1000;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->seqMulticastOpts.maxMsgSize = 3000;
 	opts->seqMulticastOpts.instanceId = 0;
+	opts->seqMulticastOpts.readBatchSize = 0;
+	opts->seqMulticastOpts.writeBatchSize = 0;
 	opts->proxyOpts.proxyHostName = 0;
 	opts->proxyOpts.proxyPort = 0;
 	opts->componentVersion = NULL;
@@ -669,6 +742,7 @@ RTR_C_INLINE void rsslClearConnectOpts(RsslConnectOptions *opts)
 	opts->proxyOpts.proxyUserName = NULL;
 	opts->proxyOpts.proxyPasswd = NULL;
 	opts->proxyOpts.proxyDomain = NULL;
+	opts->compressionDictionary = NULL;
 	
 }
 
@@ -835,7 +909,7 @@ typedef struct {
 	RsslBool		tcp_nodelay;			/*!< @deprecated DEPRECATED: Only used with connectionType of SOCKET.  If RSSL_TRUE, disables Nagle's Algorithm. Users should migrate to the RsslBindOptions::tcpOpts::tcp_nodelay configuration for the same behavior with current and future connection types */
 	RsslBool		serverToClientPings;	/*!< @brief If RSSL_TRUE, pings will be sent from server side to client side */
 	RsslBool		clientToServerPings;	/*!< @brief If RSSL_TRUE, pings will be sent from client side to server side */
-	RsslConnectionTypes	connectionType;		/*!< @brief If RSSL_CONN_TYPE_UNIDIR_SHMEM this will use server to client shared memory.  Setting to RSSL_CONN_TYPE_SOCKET or RSSL_CONN_TYPE_HTTP will allow for accepting both socket or HTTP connection types.  RSSL_CONN_TYPE_ENCRYPTED is currently not supported for servers  */
+	RsslConnectionTypes	connectionType;		/*!< @brief If RSSL_CONN_TYPE_UNIDIR_SHMEM this will use server to client shared memory, if RSSL_CONN_TYPE_BIDIR_SHMEM this will use two-way shared memory.  Setting to RSSL_CONN_TYPE_SOCKET or RSSL_CONN_TYPE_HTTP will allow for accepting both socket or HTTP connection types.  RSSL_CONN_TYPE_ENCRYPTED is currently not supported for servers  */
 	RsslUInt32		pingTimeout;			/*!< @brief Desired amount of time to use as a timeout for a connected channel. */
 	RsslUInt32		minPingTimeout;			/*!< @brief Least amount of time to use as a timeout for a connected channel. */
 	RsslUInt32		maxFragmentSize;		/*!< @brief Sets the maximum size fragment to be sent without any fragmentation or assembly of messages. */
@@ -853,6 +927,8 @@ typedef struct {
 	RsslTcpOpts		tcpOpts;				/*!< @brief TCP transport specific options (used by RSSL_CONN_TYPE_SOCKET and RSSL_CONN_TYPE_HTTP). */
 	char*			componentVersion;		/*!< @brief User defined component version information */
 	RsslBindEncryptionOpts encryptionOpts;	/*!< @brief Encryption options. */
+	RsslShmemOpts	shmemOpts;				/*!< @brief Shared memory options for the server side of ::RSSL_CONN_TYPE_BIDIR_SHMEM channels.  The server to client ring holds maxOutputBuffers and the client to server ring holds numInputBuffers messages of maxFragmentSize. */
+	char*			compressionDictionary;	/*!< @brief Path of a zstd dictionary file used when compressionType includes ::RSSL_COMP_ZSTD.  zstd is only negotiated with clients that loaded a dictionary with the same ID.  If NULL, zstd is used without a dictionary. */
 } RsslBindOptions;
 
 
@@ -860,7 +936,7 @@ typedef struct {
  * @brief RSSL Bind Options initialization
  * @see RsslBindOptions
  */
-#define RSSL_INIT_BIND_OPTS { 0, 0, RSSL_COMP_NONE, 0, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_TRUE, RSSL_TRUE, RSSL_CONN_TYPE_SOCKET, 60, 20, 6144, 50, 50, 10, 0, RSSL_FALSE, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, 0, RSSL_INIT_BIND_ENCRYPTION_OPTS }
+#define RSSL_INIT_BIND_OPTS { 0, 0, RSSL_COMP_NONE, 0, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_FALSE, RSSL_TRUE, RSSL_TRUE, RSSL_CONN_TYPE_SOCKET, 60, 20, 6144, 50, 50, 10, 0, RSSL_FALSE, 0, 0, 0, 0, 0, 0, RSSL_INIT_TCP_OPTS, 0, RSSL_INIT_BIND_ENCRYPTION_OPTS, RSSL_INIT_SHMEM_OPTS, 0 }
 
 /**
  * @brief Clears RSSL Bind Options 
@@ -896,6 +972,7 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->protocolType = 0;
 	opts->userSpecPtr = 0;
 	opts->tcpOpts.tcp_nodelay = RSSL_FALSE;
+	opts->tcpOpts.ioMode = RSSL_SOCKET_IO_DEFAULT;
 	opts->sysSendBufSize = 0;
 	opts->sysRecvBufSize = 0;
 	opts->componentVersion = NULL;
@@ -904,6 +981,11 @@ RTR_C_INLINE void rsslClearBindOpts(RsslBindOptions *opts)
 	opts->encryptionOpts.encryptionProtocolFlags = RSSL_ENC_TLSV1_2;
 	opts->encryptionOpts.serverCert = NULL;
 	opts->encryptionOpts.serverPrivateKey = NULL;
+	opts->shmemOpts.maxReaderLag = 0;
+	opts->shmemOpts.wakeupType = RSSL_SHMEM_WAKEUP_POLL;
+	opts->shmemOpts.wakeupSpinCount = 1000;
+	opts->shmemOpts.wakeupTimeout = 1000;
+	opts->compressionDictionary = NULL;
 }
 
 /**
@@ -1136,7 +1218,8 @@ typedef enum {
 	RSSL_READ_OUT_HASH_ID		= 0x0008,	/*!< (0x08) set when a hash ID is returned */
 	RSSL_READ_OUT_UNICAST		= 0x0010,	/*!< (0x10) set when the message was sent unicast to this node */
 	RSSL_READ_OUT_INSTANCE_ID	= 0x0020,	/*!< (0x20) set when the message has an instance ID set */
-	RSSL_READ_OUT_RETRANSMIT     = 0x0040  	/*!< (0x40) indicates that this message is a retransmission of previous content*/
+	RSSL_READ_OUT_RETRANSMIT     = 0x0040,	/*!< (0x40) indicates that this message is a retransmission of previous content*/
+	RSSL_READ_OUT_BATCH_DEPTH	= 0x0080	/*!< (0x80) set when readBatchDepth is returned */
 } RsslReadOutFlags;
 
 typedef struct {
@@ -1157,12 +1240,14 @@ typedef struct {
 		RsslUInt8				FTGroupId;				/*!< The FTGroup of the node that sent this message */
 		RsslUInt16				instanceId;				/*!< The instance ID of the sender's channel.  When combined with the sender's IP address and port, contained in the nodeId, 
 															 this can be used to identify the specific channel that sent this message. */
+		RsslUInt32				readBatchDepth;			/*!< For transports that receive in batches, the number of received datagrams still staged after this call.  
+															 Staged datagrams are not signaled by the socket, so the application should keep reading while this is non-zero, including after ::RSSL_RET_READ_PING. */
 } RsslReadOutArgs;
 
 /**
  * @brief RsslReadOutArgs static initialization
  */
-#define RSSL_INIT_READ_OUT_ARGS {RSSL_READ_OUT_NO_FLAGS, 0, 0, 0, {0, 0}, 0, 0, 0}
+#define RSSL_INIT_READ_OUT_ARGS {RSSL_READ_OUT_NO_FLAGS, 0, 0, 0, {0, 0}, 0, 0, 0, 0}
 
 /**
  * @brief Clears the RsslReadInArgs structure passed in
@@ -1240,6 +1325,43 @@ RSSL_API RsslBuffer* rsslReadEx(	RsslChannel *chnl,
 											RsslRet *readRet,
 											RsslError *error);
 
+/**
+ * @brief Stages a read on a channel using ::RSSL_SOCKET_IO_URING
+ *
+ * Typical use:<BR>
+ * After select (or the notifier) reports several channels readable, call
+ * rsslPrepareRead for each of them, then rsslSubmitIo once, then rsslRead
+ * as usual.  The socket reads of every staged channel are done by the single
+ * rsslSubmitIo call and rsslRead consumes the data without a system call.
+ * Channels that do not use ::RSSL_SOCKET_IO_URING, or that still have data
+ * buffered, are left alone and rsslRead reads them directly.
+ *
+ * @param chnl RSSL Channel to stage a read on
+ * @param error RSSL Error, to be populated in event of an error
+ * @return 1 if a read was staged, 0 if the channel will read directly, or a failure code
+ * @see rsslSubmitIo
+ */
+RSSL_API RsslRet rsslPrepareRead(RsslChannel *chnl, RsslError *error);
+
+/**
+ * @brief Performs the reads staged by rsslPrepareRead and the writes queued by rsslFlush
+ *
+ * Typical use:<BR>
+ * Called once per pass of the application's dispatch loop when any channel
+ * uses ::RSSL_SOCKET_IO_URING.  All staged operations are handed to the kernel
+ * in one system call and complete before it returns; none of them wait for
+ * the socket, so a channel's descriptor keeps reporting readability and
+ * writability as it would without io_uring.  A channel with a write
+ * outstanding returns the queued bytes from rsslFlush until the write is
+ * done, and the next rsslFlush applies its result.  The RSSL Reactor calls
+ * this itself.
+ *
+ * @param error RSSL Error, to be populated in event of an error
+ * @return The number of completed operations, or a failure code
+ * @see rsslPrepareRead
+ */
+RSSL_API RsslRet rsslSubmitIo(RsslError *error);
+
 /**
  *	@}
  */